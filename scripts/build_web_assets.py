@@ -0,0 +1,131 @@
+"""Embed the system portal assets under web/ as PROGMEM blobs.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand:  python scripts/build_web_assets.py
+
+Every file in web/ becomes one entry of SYSTEM_WEB_ASSETS in
+src/managers/SystemWebAssets.h. Each entry holds the gzip body (mtime fixed
+to 0 so output is reproducible) and the plain body for clients that do not
+accept gzip, their lengths, the content type, and one strong ETag per
+representation taken from the SHA-256 of the uncompressed content. The
+header is only rewritten when its content changes, so unchanged assets do
+not trigger a rebuild.
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+CONTENT_TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".js": "application/javascript; charset=utf-8",
+    ".css": "text/css; charset=utf-8",
+    ".svg": "image/svg+xml",
+    ".json": "application/json; charset=utf-8",
+    ".ico": "image/x-icon",
+}
+
+HEADER_PATH = os.path.join("src", "managers", "SystemWebAssets.h")
+ASSET_DIR = "web"
+
+
+def project_dir():
+    try:
+        return env.subst("$PROJECT_DIR")  # noqa: F821 (PlatformIO SCons env)
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def url_for(name):
+    return "/" if name == "index.html" else "/" + name
+
+
+def symbol_for(name):
+    cleaned = "".join(c if c.isalnum() else "_" for c in name)
+    return "WEB_ASSET_" + cleaned.upper()
+
+
+def compress(raw):
+    body = gzip.compress(raw, compresslevel=9, mtime=0)
+    # 构建期自检：压缩结果必须能还原为原文，避免把损坏的页面烧进固件。
+    if gzip.decompress(body) != raw:
+        raise RuntimeError("gzip round trip failed")
+    return body
+
+
+def format_bytes(body):
+    lines = []
+    for start in range(0, len(body), 16):
+        chunk = body[start:start + 16]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def build_header(root):
+    asset_root = os.path.join(root, ASSET_DIR)
+    names = sorted(
+        name for name in os.listdir(asset_root)
+        if os.path.splitext(name)[1] in CONTENT_TYPES)
+    blobs = []
+    entries = []
+    for name in names:
+        with open(os.path.join(asset_root, name), "rb") as source:
+            raw = source.read()
+        body = compress(raw)
+        digest = hashlib.sha256(raw).hexdigest()[:16]
+        # Strong ETags must differ between the gzip and the plain bytes.
+        etag = '"%s"' % digest
+        plain_etag = '"%s-identity"' % digest
+        symbol = symbol_for(name)
+        plain_symbol = symbol + "_PLAIN"
+        blobs.append("// %s: %d -> %d bytes\nconst uint8_t %s[] PROGMEM = {\n%s\n};\n"
+                     % (name, len(raw), len(body), symbol, format_bytes(body)))
+        blobs.append("const uint8_t %s[] PROGMEM = {\n%s\n};\n"
+                     % (plain_symbol, format_bytes(raw)))
+        entries.append('    {"%s", "%s", %s, sizeof(%s), "%s", %s, sizeof(%s), "%s"},'
+                       % (url_for(name), CONTENT_TYPES[os.path.splitext(name)[1]],
+                          symbol, symbol, etag.replace('"', '\\"'),
+                          plain_symbol, plain_symbol,
+                          plain_etag.replace('"', '\\"')))
+    return ("#pragma once\n\n"
+            "// Generated by scripts/build_web_assets.py from web/. Do not edit.\n\n"
+            "#include <Arduino.h>\n\n"
+            "struct SystemWebAsset {\n"
+            "  const char *path;\n"
+            "  const char *contentType;\n"
+            "  const uint8_t *gzipData;\n"
+            "  size_t gzipLength;\n"
+            "  const char *etag;\n"
+            "  const uint8_t *plainData;\n"
+            "  size_t plainLength;\n"
+            "  const char *plainEtag;\n"
+            "};\n\n"
+            + "\n".join(blobs)
+            + "\nconst SystemWebAsset SYSTEM_WEB_ASSETS[] = {\n"
+            + "\n".join(entries)
+            + "\n};\n\n"
+            "constexpr size_t SYSTEM_WEB_ASSET_COUNT =\n"
+            "    sizeof(SYSTEM_WEB_ASSETS) / sizeof(SYSTEM_WEB_ASSETS[0]);\n")
+
+
+def main():
+    root = project_dir()
+    header = build_header(root)
+    path = os.path.join(root, HEADER_PATH)
+    current = None
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as existing:
+            current = existing.read()
+    if current != header:
+        with open(path, "w", encoding="utf-8", newline="\n") as output:
+            output.write(header)
+        print("web assets: regenerated %s" % HEADER_PATH)
+
+
+try:
+    Import("env")  # noqa: F821
+except NameError:
+    pass
+
+main()
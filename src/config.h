@@ -38,6 +38,7 @@
 #define SPI_SPEED 20009008 // SD卡频率
 #define SD_PWD_ON 0        // SD卡电源开关，8开启，1关闭
 #define SD_PWD_OFF 1       // SD卡电源开关，8开启，1关闭
+#define SD_IDLE_UNMOUNT_MS 30000UL // 最后一个使用者释放后保持挂载的时长
 
 // 功放
 #define AMP_EN 16   // 功放开关 1开，0关
@@ -1,8 +1,41 @@
 #include "AudioDriver.h"
 #include "../utils/I2CBus.h"
+#include "../utils/Metrics.h"
+#include "SharedSPIBus.h"
 #include <SD.h>
 
-AudioDriver::AudioDriver() {}
+namespace {
+constexpr uint32_t AUDIO_TASK_STACK = 8192;
+// 高于 Arduino loopTask（优先级 1），与 UI 同在 Core 1，网络协议栈留在 Core 0。
+constexpr UBaseType_t AUDIO_TASK_PRIORITY = 3;
+constexpr BaseType_t AUDIO_TASK_CORE = 1;
+constexpr uint32_t AUDIO_IDLE_POLL_MS = 20;
+constexpr uint32_t AUDIO_FILL_SAMPLE_MS = 250;
+// 原生铃声的 I2S DMA 约可缓冲 40ms 以上的采样，轮询放宽到 10ms，
+// 播放期间 CPU 大部分时间可以停在空闲任务里。
+constexpr uint32_t RINGTONE_POLL_MS = 10;
+
+// 解码库在读完文件并停止当前曲目后回调，回调发生在 Audio::loop() 内部。
+volatile bool endOfFileReached = false;
+
+class DecoderLock {
+public:
+  explicit DecoderLock(SemaphoreHandle_t mutex) : mutex(mutex) {
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+  }
+  ~DecoderLock() { xSemaphoreGiveRecursive(mutex); }
+
+private:
+  SemaphoreHandle_t mutex;
+};
+} // namespace
+
+void audio_eof_mp3(const char *info) {
+  (void)info;
+  endOfFileReached = true;
+}
+
+AudioDriver::AudioDriver() : audioMutex(xSemaphoreCreateRecursiveMutex()) {}
 
 AudioDriver::~AudioDriver() { end(); }
 
@@ -11,30 +44,117 @@ bool AudioDriver::init() {
 }
 
 void AudioDriver::end() {
-  if (audio) {
-    audio->stopSong();
-    delete audio;
-    audio = nullptr;
+  {
+    DecoderLock lock(audioMutex);
+    clearQueued();
+    armState = ARM_NONE;
+    latencyPending = false;
+    ringtone.end();
+    releaseDecoder();
   }
   digitalWrite(AMP_EN, LOW);
   I2CBus::powerDownSharedBus();
 }
 
 void AudioDriver::setVolume(uint8_t vol) {
+  DecoderLock lock(audioMutex);
   currentVolume = vol;
   if (audio)
     audio->setVolume(currentVolume);
+  ringtone.setVolume(currentVolume);
   // Also update ES8311 volume if needed, but I2S digital volume is usually
   // enough writeES8311(0x32, vol);
 }
 
 void AudioDriver::playFromFS(fs::FS &fs, const char *path) {
+  // 打开文件时预读层会同步读入首批数据，锁顺序为 SPI -> 解码锁。
+  SharedSPIBus::Guard spiGuard;
+  if (RingtonePlayer::isRingtonePath(path)) {
+    startRingtone(fs, path);
+    return;
+  }
   if (!ensureAudio())
     return;
 
+  DecoderLock lock(audioMutex);
+  clearQueued();
+  armState = ARM_NONE;
+  digitalWrite(CODEC_EN, HIGH);
+  digitalWrite(AMP_EN, HIGH);
+  audio->connecttoFS(readAhead.wrap(fs, &fs == &SD), path);
+}
+
+bool AudioDriver::armAlarm(fs::FS &fs, const char *path, uint32_t startAtMs) {
+  SharedSPIBus::Guard spiGuard;
+  if (RingtonePlayer::isRingtonePath(path)) {
+    DecoderLock lock(audioMutex);
+    if (!startRingtone(fs, path)) {
+      return false;
+    }
+    ringtone.setPaused(true);
+    armState = ARM_WAITING;
+    armedStartMs = startAtMs;
+    return true;
+  }
+  if (!ensureAudio())
+    return false;
+
+  DecoderLock lock(audioMutex);
+  clearQueued();
+  armState = ARM_NONE;
+  digitalWrite(CODEC_EN, HIGH);
+  digitalWrite(AMP_EN, HIGH);
+  if (!audio->connecttoFS(readAhead.wrap(fs, &fs == &SD), path)) {
+    return false;
+  }
+  // 关键逻辑：连接与暂停在同一把解码锁内完成，音频任务拿到锁之前
+  // 解码器不会输出任何采样；预读层打开文件时已填好首批数据。
+  audio->pauseResume();
+  armState = ARM_WAITING;
+  armedStartMs = startAtMs;
+  return true;
+}
+
+bool AudioDriver::isAlarmArmed() {
+  DecoderLock lock(audioMutex);
+  return armState != ARM_NONE;
+}
+
+void AudioDriver::releaseAlarmArm() {
+  DecoderLock lock(audioMutex);
+  armState = ARM_NONE;
+}
+
+void AudioDriver::trackStartLatency(uint32_t triggerMs) {
+  DecoderLock lock(audioMutex);
+  beginLatencyProbe(triggerMs);
+}
+
+bool AudioDriver::startRingtone(fs::FS &fs, const char *path) {
+  if (!ensureAudioTask())
+    return false;
+
+  DecoderLock lock(audioMutex);
+  clearQueued();
+  armState = ARM_NONE;
+  // 关键逻辑：Audio 实例占着 I2S0，必须先释放才能安装铃声自己的驱动。
+  releaseDecoder();
   digitalWrite(CODEC_EN, HIGH);
   digitalWrite(AMP_EN, HIGH);
-  audio->connecttoFS(fs, path);
+  if (!ringtone.begin(readAhead.wrap(fs, &fs == &SD).open(path, FILE_READ),
+                      currentVolume)) {
+    return false;
+  }
+  xTaskNotifyGive(audioTask);
+  return true;
+}
+
+void AudioDriver::releaseDecoder() {
+  if (audio) {
+    audio->stopSong();
+    delete audio;
+    audio = nullptr;
+  }
 }
 
 void AudioDriver::playFromSD(const char *path) { playFromFS(SD, path); }
@@ -42,37 +162,253 @@ void AudioDriver::playFromSD(const char *path) { playFromFS(SD, path); }
 void AudioDriver::stop() { end(); }
 
 void AudioDriver::pause() {
-  if (audio)
+  DecoderLock lock(audioMutex);
+  if (ringtone.isActive())
+    ringtone.setPaused(true);
+  else if (audio)
     audio->pauseResume();
 }
 
 void AudioDriver::resume() {
-  if (audio)
+  DecoderLock lock(audioMutex);
+  if (ringtone.isActive())
+    ringtone.setPaused(false);
+  else if (audio)
     audio->pauseResume();
 }
 
-void AudioDriver::loop() {
-  if (audio)
-    audio->loop();
+void AudioDriver::audioTaskEntry(void *param) {
+  static_cast<AudioDriver *>(param)->runAudioTask();
+}
+
+void AudioDriver::runAudioTask() {
+  uint32_t lastFillSampleMs = 0;
+  uint32_t lastPlayTickMs = 0;
+  bool wasPlaying = false;
+  for (;;) {
+    bool active = false;
+    bool running = false;
+    bool native = false;
+    bool switchTrack = false;
+    uint32_t decodeUs = 0;
+    {
+      DecoderLock lock(audioMutex);
+      native = ringtone.isActive();
+      if (audio || native) {
+        active = true;
+        if (armState == ARM_WAITING &&
+            static_cast<int32_t>(millis() - armedStartMs) >= 0) {
+          if (native)
+            ringtone.setPaused(false);
+          else
+            audio->pauseResume();
+          armState = ARM_STARTED;
+          beginLatencyProbe(armedStartMs);
+        }
+        // 只计解码调用本身：取锁等待和预读读盘不算进 CPU 时间。
+        uint32_t decodeStartUs = micros();
+        if (native)
+          ringtone.pump();
+        else
+          audio->loop();
+        decodeUs = micros() - decodeStartUs;
+        checkLatencyProbe();
+        running = (native ? ringtone.isRunning() : audio->isRunning()) ||
+                  armState == ARM_WAITING;
+        if (!native && endOfFileReached) {
+          endOfFileReached = false;
+          switchTrack = queuedPath.length() > 0;
+        }
+      }
+    }
+    if (!active) {
+      // Audio 实例已释放：挂起到下一次 ensureAudio 通知，不占用 CPU。
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (switchTrack) {
+      startQueued();
+    }
+    // 关键逻辑：读盘放在解码锁之外，UI 任务持有 SPI 锁等待解码锁时
+    // 不会与这里形成反向等待。
+    readAhead.refill();
+
+    uint32_t now = millis();
+    // 两条播放路径分别累计解码耗时与播放时长，/metrics 中二者之比
+    // 即每分钟响铃的 CPU 占用，可直接对比 MP3 与原生铃声的能耗。
+    bool playing = running && armState != ARM_WAITING;
+    if (playing) {
+      Metrics::add(native ? Metrics::AUDIO_CPU_US_NATIVE
+                          : Metrics::AUDIO_CPU_US_MP3,
+                   decodeUs);
+      if (wasPlaying) {
+        Metrics::add(native ? Metrics::AUDIO_PLAY_MS_NATIVE
+                            : Metrics::AUDIO_PLAY_MS_MP3,
+                     now - lastPlayTickMs);
+      }
+    }
+    wasPlaying = playing;
+    lastPlayTickMs = now;
+    if (running && now - lastFillSampleMs >= AUDIO_FILL_SAMPLE_MS) {
+      lastFillSampleMs = now;
+      int fill = readAhead.fillPercent();
+      if (fill >= 0) {
+        Metrics::observe(Metrics::AUDIO_BUFFER_FILL_PERCENT,
+                         static_cast<uint32_t>(fill));
+      }
+    }
+    vTaskDelay(!running ? pdMS_TO_TICKS(AUDIO_IDLE_POLL_MS)
+               : native ? pdMS_TO_TICKS(RINGTONE_POLL_MS)
+                        : 1);
+  }
+}
+
+void AudioDriver::startQueued() {
+  // 关键逻辑：在解码库报告文件结束后立即接上下一首，I2S DMA 里剩余的尾音
+  // 还在输出，不经过上层轮询、删除 Audio 实例和重新上电编解码器这几段延迟。
+  // 下一首在预排时已经打开并预填，connecttoFS 只接管内存里的文件，
+  // 这里不取共享 SPI 锁，屏幕刷新中也不会卡住音频任务。
+  DecoderLock lock(audioMutex);
+  if (!audio || queuedPath.length() == 0) {
+    return;
+  }
+  String path = queuedPath;
+  queuedPath = String();
+  if (!readAhead.hasPreload(path.c_str())) {
+    // 预开的文件已被丢弃：交回 UI 线程，播完后按普通路径加载。
+    return;
+  }
+  audio->connecttoFS(readAhead.wrap(SD, true), path.c_str());
+  handoffPending = true;
 }
 
-bool AudioDriver::isPlaying() { return audio && audio->isRunning(); }
+bool AudioDriver::isPlaying() {
+  DecoderLock lock(audioMutex);
+  if (ringtone.isActive())
+    return ringtone.isRunning();
+  return audio && audio->isRunning();
+}
 
 uint32_t AudioDriver::getElapsed() {
+  DecoderLock lock(audioMutex);
+  if (ringtone.isActive())
+    return ringtone.getElapsedSeconds();
   return audio ? audio->getAudioCurrentTime() : 0;
 }
 
 uint32_t AudioDriver::getDuration() {
+  DecoderLock lock(audioMutex);
+  if (ringtone.isActive())
+    return ringtone.getDurationSeconds();
   return audio ? audio->getAudioFileDuration() : 0;
 }
 
+bool AudioDriver::seekToByte(uint32_t offset) {
+  DecoderLock lock(audioMutex);
+  return audio ? audio->setFilePos(offset) : false;
+}
+
+bool AudioDriver::seekToSeconds(uint32_t seconds) {
+  DecoderLock lock(audioMutex);
+  return audio ? audio->setAudioPlayPosition(static_cast<uint16_t>(seconds))
+               : false;
+}
+
+uint32_t AudioDriver::getStreamPosition() {
+  DecoderLock lock(audioMutex);
+  return consumedBytesLocked();
+}
+
+void AudioDriver::beginLatencyProbe(uint32_t triggerMs) {
+  latencyPending = audio != nullptr || ringtone.isActive();
+  latencyTriggerMs = triggerMs;
+  latencyBaseline = outputProgressLocked();
+}
+
+void AudioDriver::checkLatencyProbe() {
+  // 解码库不暴露 I2S 首次写入的时刻；它从输入缓冲消费数据即开始解码出声，
+  // 以此作为首个采样的近似时间点。
+  if (!latencyPending || outputProgressLocked() <= latencyBaseline) {
+    return;
+  }
+  latencyPending = false;
+  uint32_t latencyMs = millis() - latencyTriggerMs;
+  Metrics::observe(Metrics::ALARM_START_LATENCY_MS, latencyMs);
+  Serial.printf("[Audio][alarm] trigger-to-first-sample %lums\n",
+                static_cast<unsigned long>(latencyMs));
+}
+
+uint32_t AudioDriver::outputProgressLocked() {
+  // 原生铃声直接以已送入 I2S 的采样数计，探针只比较是否增长。
+  return ringtone.isActive() ? ringtone.getDecodedSamples()
+                             : consumedBytesLocked();
+}
+
+uint32_t AudioDriver::consumedBytesLocked() {
+  if (!audio) {
+    return 0;
+  }
+  uint32_t position = audio->getFilePos();
+  uint32_t buffered = audio->inBufferFilled();
+  return position > buffered ? position - buffered : 0;
+}
+
+bool AudioDriver::queueNextFromSD(const char *path) {
+  {
+    DecoderLock lock(audioMutex);
+    queuedPath = String();
+  }
+  // 预读在解码锁之外进行，音频任务照常解码当前曲目的缓冲数据。
+  if (!readAhead.preload(SD, true, path)) {
+    return false;
+  }
+  DecoderLock lock(audioMutex);
+  queuedPath = path;
+  return true;
+}
+
+void AudioDriver::clearQueued() {
+  DecoderLock lock(audioMutex);
+  queuedPath = String();
+  handoffPending = false;
+  endOfFileReached = false;
+  // 只读文件关闭不会回写 FAT，可以在解码锁内直接丢弃预开的下一首。
+  readAhead.discardPreload();
+}
+
+bool AudioDriver::consumeHandoff() {
+  DecoderLock lock(audioMutex);
+  bool pending = handoffPending;
+  handoffPending = false;
+  return pending;
+}
+
+bool AudioDriver::ensureAudioTask() {
+  if (audioTask == nullptr &&
+      xTaskCreatePinnedToCore(audioTaskEntry, "AudioTask", AUDIO_TASK_STACK,
+                              this, AUDIO_TASK_PRIORITY, &audioTask,
+                              AUDIO_TASK_CORE) != pdPASS) {
+    audioTask = nullptr;
+    Serial.println("[Audio][task] create failed");
+    return false;
+  }
+  return true;
+}
+
 bool AudioDriver::ensureAudio() {
+  if (!ensureAudioTask())
+    return false;
+
+  DecoderLock lock(audioMutex);
   if (audio)
     return true;
 
+  // 铃声播放器与解码库共用 I2S0，切回 MP3 前先卸载它的驱动。
+  ringtone.end();
   audio = new Audio();
   audio->setPinout(I2S_BCK, I2S_WS, I2S_DOUT);
   audio->setVolume(currentVolume);
+  xTaskNotifyGive(audioTask);
   return true;
 }
 
@@ -1,11 +1,19 @@
 #pragma once
 
 #include "../config.h"
+#include "ReadAheadFS.h"
+#include "RingtonePlayer.h"
 #include <Arduino.h>
 #include <Audio.h>
 #include <FS.h>
 #include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
+// 解码运行在固定核心的高优先级音频任务里，文件数据经 ReadAheadFS 预读，
+// 主循环刷屏或延时都不会再饿死解码器。公开接口可以在任意任务调用，
+// 内部以解码锁与音频任务互斥；可能访问 SD 的接口先取共享 SPI 锁。
 class AudioDriver {
 public:
   AudioDriver();
@@ -13,22 +21,66 @@ public:
   bool init();
   void end();
   void setVolume(uint8_t vol);
+  // .rtn 原生铃声走 RingtonePlayer，不创建 MP3 解码器。
   void playFromFS(fs::FS &fs, const char *path);
   void playFromSD(const char *path);
   void stop();
   void pause();
   void resume();
-  void loop();
   bool isPlaying();
   uint32_t getElapsed();
   uint32_t getDuration();
+  // 跳到文件字节偏移，解码器从下一个帧头重新同步。
+  bool seekToByte(uint32_t offset);
+  bool seekToSeconds(uint32_t seconds);
+  // 解码器已消费的文件位置：读指针减去输入缓冲中尚未解码的字节。
+  uint32_t getStreamPosition();
+  // 预排下一首 SD 曲目：调用方持有 SPI 锁，文件在此打开并预填首批数据，
+  // 打不开或读不出时返回 false。音频任务在解码库报告文件结束后直接接管
+  // 这份文件，复用同一个 Audio 实例，I2S 驱动与 ES8311 都不重新初始化。
+  bool queueNextFromSD(const char *path);
+  void clearQueued();
+  // 自上次调用以来发生过一次预排切换时返回 true。
+  bool consumeHandoff();
+  // 闹钟预唤醒：提前上电、打开并预读铃声后立即暂停，音频任务在 startAtMs
+  // 时刻自行恢复输出，不依赖主循环当时是否正在刷屏。
+  bool armAlarm(fs::FS &fs, const char *path, uint32_t startAtMs);
+  bool isAlarmArmed();
+  // 响铃状态已接管后解除预备标记，铃声继续播放。
+  void releaseAlarmArm();
+  // 从 triggerMs 起计时，解码器开始消费音频数据时记录触发到出声的延迟。
+  void trackStartLatency(uint32_t triggerMs);
 
 private:
+  enum ArmState : uint8_t { ARM_NONE, ARM_WAITING, ARM_STARTED };
+
+  static void audioTaskEntry(void *param);
+  void runAudioTask();
+  void startQueued();
+  // 调用方已持有 SPI 锁（SD 时）。
+  bool startRingtone(fs::FS &fs, const char *path);
+  void releaseDecoder();
+  void beginLatencyProbe(uint32_t triggerMs);
+  void checkLatencyProbe();
+  uint32_t outputProgressLocked();
+  uint32_t consumedBytesLocked();
+  bool ensureAudioTask();
   bool ensureAudio();
   void initES8311();
   void writeES8311(uint8_t reg, uint8_t val);
   void writeES8311Locked(uint8_t reg, uint8_t val);
   Audio *audio = nullptr;
+  SemaphoreHandle_t audioMutex = nullptr;
+  TaskHandle_t audioTask = nullptr;
+  ReadAheadFS readAhead;
+  RingtonePlayer ringtone;
+  String queuedPath;
+  bool handoffPending = false;
+  ArmState armState = ARM_NONE;
+  uint32_t armedStartMs = 0;
+  bool latencyPending = false;
+  uint32_t latencyTriggerMs = 0;
+  uint32_t latencyBaseline = 0;
   uint8_t currentVolume = 10;
   const uint8_t ES8311_ADDR = 0x18; // Standard address
 };
@@ -14,9 +14,10 @@ DisplayDriver::DisplayDriver()
     : display(EPD2_DRV(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)) {}
 
 void DisplayDriver::init() {
-  SPISettings spisettings(4000000, MSBFIRST, SPI_MODE0);
   prepareDisplayTransfer();
-  display.epd2.selectSPI(SharedSPIBus::bus(), spisettings);
+  display.epd2.selectSPI(
+      SharedSPIBus::bus(),
+      SharedSPIBus::settingsFor(SharedSPIBus::DEVICE_DISPLAY));
   display.init(0, true, 10, true);
   // 关键逻辑：UI 坐标保持正常方向，左右镜像在 SSD1619A RAM 写入层完成；
   // 不使用 GxEPD2 mirror()，因为它不会同步镜像局刷窗口坐标。
@@ -11,6 +11,8 @@
 // Library: https://github.com/ZinggJM/GxEPD2
 
 #include "GxEPD2_420_SSD1619A.h"
+#include "../utils/Metrics.h"
+#include "SharedSPIBus.h"
 
 namespace {
 constexpr uint32_t FULL_BUSY_TIMEOUT_MS = 16000;
@@ -82,11 +84,23 @@ void GxEPD2_420_SSD1619A::_writeRepeatedData(uint8_t value, uint32_t count)
   _startTransfer();
   for (uint32_t i = 0; i < count; i++)
   {
+    if (i % (WIDTH / 8) == 0) _yieldBusBetweenRows();
     _transfer(value);
   }
   _endTransfer();
 }
 
+void GxEPD2_420_SSD1619A::_yieldBusBetweenRows()
+{
+  // 关键逻辑：0x24 之后的 RAM 数据在片选抬起后仍按地址自增接续，
+  // 行间结束本次传输即可把总线交给等待中的音频预读，回来后继续写下一行。
+  if (!SharedSPIBus::hasUrgentWaiter()) return;
+  _endTransfer();
+  SharedSPIBus::yieldToUrgent();
+  SharedSPIBus::prepareDisplay();
+  _startTransfer();
+}
+
 void GxEPD2_420_SSD1619A::_writeMirroredXImageData(
     const uint8_t bitmap[], const ImageTransferSpec &spec)
 {
@@ -96,6 +110,7 @@ void GxEPD2_420_SSD1619A::_writeMirroredXImageData(
   _startTransfer();
   for (int16_t i = 0; i < spec.outputRows; i++)
   {
+    _yieldBusBetweenRows();
     int16_t row = spec.mirrorY ? spec.sourceHeight - 1 - (spec.baseY + i)
                                : spec.baseY + i;
     int16_t rowBase = row * spec.sourceWidthBytes;
@@ -349,6 +364,8 @@ bool GxEPD2_420_SSD1619A::_waitUntilIdle(const char *comment,
 
   uint32_t startMs = millis();
   while (digitalRead(_busy) != LOW) {
+    // 刷新期间控制器不接收数据，是总线最长的空闲段，紧急读取在这里插入。
+    SharedSPIBus::yieldToUrgent();
     delay(BUSY_POLL_INTERVAL_MS);
     if (millis() - startMs > timeoutMs) {
       Serial.print(comment);
@@ -536,14 +553,20 @@ void GxEPD2_420_SSD1619A::_Update_Full()
 {
   // 关键逻辑：参考工程初始化阶段已经写入 0x22=0xC7；
   // 刷新阶段只发送 0x20，不能再写 0xC4 覆盖更新控制位。
+  uint32_t startMs = millis();
   _writeCommand(0x20);
   _waitUntilIdle("_Update_Full", FULL_BUSY_TIMEOUT_MS);
   _initial_refresh = false;
+  Metrics::add(Metrics::PANEL_REFRESH_FULL);
+  Metrics::observe(Metrics::PANEL_REFRESH_MS, millis() - startMs);
 }
 
 void GxEPD2_420_SSD1619A::_Update_Part()
 {
   // 关键逻辑：局刷同样沿用初始化阶段的 0x22=0xC7，和参考工程一致。
+  uint32_t startMs = millis();
   _writeCommand(0x20);
   _waitUntilIdle("_Update_Part", PARTIAL_BUSY_TIMEOUT_MS);
+  Metrics::add(Metrics::PANEL_REFRESH_PARTIAL);
+  Metrics::observe(Metrics::PANEL_REFRESH_MS, millis() - startMs);
 }
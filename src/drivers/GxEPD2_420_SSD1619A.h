@@ -88,6 +88,7 @@ class GxEPD2_420_SSD1619A : public GxEPD2_EPD
     void _writeMirroredXImageData(const uint8_t bitmap[],
                                   const ImageTransferSpec &spec);
     void _writeRepeatedData(uint8_t value, uint32_t count);
+    void _yieldBusBetweenRows();
     void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
     bool _waitUntilIdle(const char *comment, uint32_t timeoutMs);
     void _PowerOn();
@@ -0,0 +1,361 @@
+#include "ReadAheadFS.h"
+#include "../utils/Metrics.h"
+#include "SharedSPIBus.h"
+#include <FSImpl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace {
+// 缓冲低于一半时改为紧急取锁，让正在刷新的屏幕在行间或等待 BUSY 时让出；
+// 等待上限远小于缓冲剩余的播放时长。
+constexpr int URGENT_FILL_PERCENT = 50;
+constexpr uint32_t URGENT_LOCK_WAIT_MS = 20;
+
+// SD 上按测速推荐的传输大小突发，按扇区取整且不超过缓冲的一半，
+// 解码器读掉半个缓冲时总能再放下一整块。
+size_t burstSizeFor(bool sharedBus, size_t capacity) {
+  size_t size = sharedBus
+                    ? SharedSPIBus::transferSizeFor(SharedSPIBus::DEVICE_SD)
+                    : ReadAheadFS::BURST_SIZE;
+  if (size > capacity / 2) {
+    size = capacity / 2;
+  }
+  size -= size % ReadAheadFS::SECTOR_SIZE;
+  return size < ReadAheadFS::SECTOR_SIZE ? ReadAheadFS::SECTOR_SIZE : size;
+}
+
+class StateLock {
+public:
+  explicit StateLock(SemaphoreHandle_t mutex) : mutex(mutex) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+  }
+  ~StateLock() { xSemaphoreGive(mutex); }
+
+private:
+  SemaphoreHandle_t mutex;
+};
+} // namespace
+
+class ReadAheadFile;
+
+// 关键逻辑：锁顺序固定为 共享 SPI 锁 -> 解码锁 -> 本层状态锁。
+// 解码器在解码锁内调用的 read/seek/close 只动内存，不碰 SD；
+// 真正的读盘只发生在 open、preload（调用方已持有 SPI 锁）和 refill 中；
+// 接管预开文件的 open 不读盘。
+class ReadAheadFSImpl : public fs::FSImpl {
+public:
+  ReadAheadFSImpl() : mutex(xSemaphoreCreateMutex()) {}
+
+  fs::FileImplPtr open(const char *path, const char *mode,
+                       const bool create) override;
+  bool exists(const char *path) override;
+  // 调用方已持有 SPI 锁：打开底层文件、分配缓冲并同步预填两块。
+  std::shared_ptr<ReadAheadFile> openStream(const char *path);
+  // 预读层只读，写类操作一律拒绝。
+  bool rename(const char *, const char *) override { return false; }
+  bool remove(const char *) override { return false; }
+  bool mkdir(const char *) override { return false; }
+  bool rmdir(const char *) override { return false; }
+
+  SemaphoreHandle_t mutex;
+  fs::FS *target = nullptr;
+  bool sharedBus = false;
+  ReadAheadFile *active = nullptr;
+  // 预开的下一首：已完成目录查找和首批读取，等待解码器 open 接管。
+  std::shared_ptr<ReadAheadFile> pending;
+  String pendingPath;
+};
+
+// 各版本 arduino-esp32 的 FileImpl 纯虚接口略有差异（seekDir、
+// getNextFileName 等），这里不标 override，旧版本中多出的只是普通虚函数。
+class ReadAheadFile : public fs::FileImpl {
+public:
+  ReadAheadFile(ReadAheadFSImpl *owner, fs::File file, uint8_t *ring,
+                size_t capacity, size_t burstSize)
+      : owner(owner), file(file), ring(ring), capacity(capacity),
+        burstSize(burstSize), fileSize(file.size()) {}
+  ~ReadAheadFile() { close(); }
+
+  size_t read(uint8_t *buf, size_t size) {
+    StateLock lock(owner->mutex);
+    size_t count = size < filled ? size : filled;
+    size_t first = count < capacity - head ? count : capacity - head;
+    memcpy(buf, ring + head, first);
+    memcpy(buf + first, ring, count - first);
+    head = (head + count) % capacity;
+    filled -= count;
+    readPosition += count;
+    // 缓冲读空但文件未结束即为欠载；返回 0 字节时解码库按"暂无数据"处理，
+    // 同一次断流只计一次。
+    if (count == 0 && size > 0 && readPosition < fileSize) {
+      if (!starving) {
+        starving = true;
+        Metrics::add(Metrics::AUDIO_UNDERRUNS);
+      }
+    } else if (count > 0) {
+      starving = false;
+    }
+    return count;
+  }
+
+  bool seek(uint32_t pos, fs::SeekMode mode) {
+    StateLock lock(owner->mutex);
+    // SeekEnd 的 pos 是距文件末尾的字节数（如 seek(128, SeekEnd) 定位到
+    // ID3v1 标签）；三种模式都先做越界判断，再换算成绝对位置。
+    uint32_t target;
+    if (mode == fs::SeekCur) {
+      if (pos > fileSize - readPosition) {
+        return false;
+      }
+      target = readPosition + pos;
+    } else if (mode == fs::SeekEnd) {
+      if (pos > fileSize) {
+        return false;
+      }
+      target = fileSize - pos;
+    } else {
+      if (pos > fileSize) {
+        return false;
+      }
+      target = pos;
+    }
+    if (target >= readPosition && target - readPosition <= filled) {
+      // 跳过已预读的数据（如 ID3 标签尾部）不必丢弃整块缓冲。
+      size_t skip = target - readPosition;
+      head = (head + skip) % capacity;
+      filled -= skip;
+    } else {
+      head = 0;
+      filled = 0;
+      fileOffset = target;
+    }
+    readPosition = target;
+    starving = false;
+    return true;
+  }
+
+  // 调用方持有状态锁，且 SD 时已持有 SPI 锁。首块只读到下一个扇区边界，
+  // 之后每次突发都从扇区边界开始，FAT 层可以整扇区直接读入。
+  size_t burst() {
+    if (ring == nullptr || fileOffset >= fileSize) {
+      return 0;
+    }
+    size_t length = burstSize - fileOffset % ReadAheadFS::SECTOR_SIZE;
+    uint32_t remaining = fileSize - fileOffset;
+    if (length > remaining) {
+      length = remaining;
+    }
+    if (capacity - filled < length) {
+      return 0;
+    }
+    if (fileCursor != fileOffset && !file.seek(fileOffset)) {
+      return 0;
+    }
+    size_t tail = (head + filled) % capacity;
+    size_t first = length < capacity - tail ? length : capacity - tail;
+    size_t got = file.read(ring + tail, first);
+    if (got == first && length > first) {
+      got += file.read(ring, length - first);
+    }
+    fileOffset += got;
+    fileCursor = fileOffset;
+    filled += got;
+    return got;
+  }
+
+  bool needsBurst() const {
+    return ring != nullptr && fileOffset < fileSize &&
+           capacity - filled >= burstSize;
+  }
+
+  int fillPercent() const {
+    return static_cast<int>(filled * 100 / capacity);
+  }
+
+  size_t buffered() const { return filled; }
+
+  size_t write(const uint8_t *, size_t) { return 0; }
+  void flush() {}
+  size_t position() const { return readPosition; }
+  size_t size() const { return fileSize; }
+  bool setBufferSize(size_t) { return false; }
+
+  void close() {
+    StateLock lock(owner->mutex);
+    if (owner->active == this) {
+      owner->active = nullptr;
+    }
+    // 只读文件关闭不会回写 FAT，可以在解码锁内直接执行。
+    if (file) {
+      file.close();
+    }
+    free(ring);
+    ring = nullptr;
+  }
+
+  time_t getLastWrite() { return file.getLastWrite(); }
+  const char *path() const { return file.path(); }
+  const char *name() const { return file.name(); }
+  boolean isDirectory(void) { return false; }
+  fs::FileImplPtr openNextFile(const char *) { return fs::FileImplPtr(); }
+  boolean seekDir(long) { return false; }
+  String getNextFileName(void) { return String(); }
+  String getNextFileName(bool *) { return String(); }
+  void rewindDirectory(void) {}
+  operator bool() { return ring != nullptr; }
+
+private:
+  ReadAheadFSImpl *owner;
+  fs::File file;
+  uint8_t *ring;
+  size_t capacity;
+  size_t burstSize;
+  uint32_t fileSize;
+  size_t head = 0;
+  size_t filled = 0;
+  uint32_t readPosition = 0; // 解码器看到的读位置
+  uint32_t fileOffset = 0;   // 下一次突发的起点，恒等于 readPosition + filled
+  uint32_t fileCursor = 0;   // 底层文件的实际读指针
+  bool starving = false;
+};
+
+bool ReadAheadFSImpl::exists(const char *path) {
+  {
+    StateLock lock(mutex);
+    if (pending && pendingPath == path) {
+      return true;
+    }
+  }
+  return target != nullptr && target->exists(path);
+}
+
+fs::FileImplPtr ReadAheadFSImpl::open(const char *path, const char *mode,
+                                      const bool create) {
+  (void)create;
+  if (target == nullptr || strcmp(mode, FILE_READ) != 0) {
+    return fs::FileImplPtr();
+  }
+  {
+    StateLock lock(mutex);
+    if (pending && pendingPath == path) {
+      // 关键逻辑：接管预开的文件只动内存，音频任务在曲目边界不碰 SD，
+      // 也就不必等待正在刷新的屏幕让出总线。
+      std::shared_ptr<ReadAheadFile> stream = std::move(pending);
+      pendingPath = String();
+      active = stream.get();
+      return stream;
+    }
+  }
+  std::shared_ptr<ReadAheadFile> stream = openStream(path);
+  if (!stream) {
+    return fs::FileImplPtr();
+  }
+  StateLock lock(mutex);
+  active = stream.get();
+  return stream;
+}
+
+std::shared_ptr<ReadAheadFile> ReadAheadFSImpl::openStream(const char *path) {
+  fs::File file = target->open(path, FILE_READ);
+  if (!file || file.isDirectory()) {
+    return nullptr;
+  }
+  size_t capacity = ReadAheadFS::BUFFER_SIZE;
+  uint8_t *ring = static_cast<uint8_t *>(malloc(capacity));
+  if (ring == nullptr) {
+    capacity = ReadAheadFS::MIN_BUFFER_SIZE;
+    ring = static_cast<uint8_t *>(malloc(capacity));
+  }
+  if (ring == nullptr) {
+    Serial.println("[Audio][readahead] buffer allocation failed");
+    file.close();
+    return nullptr;
+  }
+
+  std::shared_ptr<ReadAheadFile> stream = std::make_shared<ReadAheadFile>(
+      this, file, ring, capacity, burstSizeFor(sharedBus, capacity));
+  StateLock lock(mutex);
+  // 调用方已持有 SPI 锁：同步预填两块，解码器拿到文件即可解析帧头。
+  stream->burst();
+  stream->burst();
+  return stream;
+}
+
+ReadAheadFS::ReadAheadFS()
+    : impl(std::make_shared<ReadAheadFSImpl>()), fs(impl) {}
+
+fs::FS &ReadAheadFS::wrap(fs::FS &target, bool sharedBus) {
+  StateLock lock(impl->mutex);
+  impl->target = &target;
+  impl->sharedBus = sharedBus;
+  return fs;
+}
+
+bool ReadAheadFS::refill() {
+  bool urgent = false;
+  {
+    StateLock lock(impl->mutex);
+    if (impl->active == nullptr || !impl->active->needsBurst()) {
+      return false;
+    }
+    urgent = impl->active->fillPercent() < URGENT_FILL_PERCENT;
+  }
+  // 缓冲充足时总线被占用就不等待，本轮先继续解码缓冲里的数据。
+  bool sharedBus = impl->sharedBus;
+  if (sharedBus && !(urgent ? SharedSPIBus::lockUrgent(URGENT_LOCK_WAIT_MS)
+                            : SharedSPIBus::lock(0))) {
+    return false;
+  }
+  uint32_t startUs = micros();
+  size_t got = 0;
+  {
+    StateLock lock(impl->mutex);
+    if (impl->active != nullptr) {
+      got = impl->active->burst();
+    }
+  }
+  if (sharedBus) {
+    SharedSPIBus::unlock();
+  }
+  if (got == 0) {
+    return false;
+  }
+  Metrics::add(Metrics::AUDIO_READ_BURSTS);
+  Metrics::add(Metrics::AUDIO_READ_BYTES, got);
+  Metrics::observe(Metrics::AUDIO_READ_BURST_US, micros() - startUs);
+  return true;
+}
+
+int ReadAheadFS::fillPercent() {
+  StateLock lock(impl->mutex);
+  return impl->active != nullptr ? impl->active->fillPercent() : -1;
+}
+
+bool ReadAheadFS::preload(fs::FS &target, bool sharedBus, const char *path) {
+  discardPreload();
+  wrap(target, sharedBus);
+  std::shared_ptr<ReadAheadFile> stream = impl->openStream(path);
+  // 首批数据读不出来说明文件已删除或损坏，在边界前就放弃预排。
+  if (!stream || stream->buffered() == 0) {
+    return false;
+  }
+  StateLock lock(impl->mutex);
+  impl->pending = stream;
+  impl->pendingPath = path;
+  return true;
+}
+
+bool ReadAheadFS::hasPreload(const char *path) {
+  StateLock lock(impl->mutex);
+  return impl->pending && impl->pendingPath == path;
+}
+
+void ReadAheadFS::discardPreload() {
+  std::shared_ptr<ReadAheadFile> stream;
+  {
+    StateLock lock(impl->mutex);
+    stream = std::move(impl->pending);
+    impl->pendingPath = String();
+  }
+  // 在状态锁外析构：关闭文件时还要再取一次状态锁。
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <memory>
+
+class ReadAheadFSImpl;
+
+// 解码库的文件预读层：解码器只从内存环形缓冲取数据，真正的 SD 读取由
+// 音频任务在解码锁之外按扇区对齐的整块突发完成，两次突发之间 SD 卡和
+// 共享 SPI 总线保持空闲，墨水屏刷新也不会再直接卡住解码。
+// 同一时刻只服务一个打开的文件（解码器当前播放的那一首），另可保留
+// 一个为无缝播放预开的下一首，它只有预填的首批数据，接管后才开始续读。
+class ReadAheadFS {
+public:
+  static constexpr size_t BUFFER_SIZE = 32 * 1024;
+  static constexpr size_t MIN_BUFFER_SIZE = 16 * 1024;
+  // 非 SD 文件系统的突发大小；SD 上使用 SharedSPIBus 的测速推荐值。
+  static constexpr size_t BURST_SIZE = 8 * 1024;
+  static constexpr size_t SECTOR_SIZE = 512;
+
+  ReadAheadFS();
+
+  // 返回以 target 为底层的文件系统，交给 Audio::connecttoFS 使用；
+  // sharedBus 为 true 时突发读取前持有共享 SPI 锁。调用方必须已持有该锁，
+  // 打开文件时会同步预填第一块数据。
+  fs::FS &wrap(fs::FS &target, bool sharedBus);
+  // 音频任务调用，不得持有解码锁；空余不足一个突发时直接返回。缓冲过半时
+  // 总线被占用即放弃本轮，低于一半则以紧急请求短暂等待屏幕让出。
+  bool refill();
+  // 当前文件的缓冲填充百分比；没有打开的文件时返回 -1。
+  int fillPercent();
+  // 预开下一首并同步预填首批数据，之后 open 同一路径直接接管这份文件，
+  // 不再查目录或读盘。调用方必须已持有共享 SPI 锁；只保留一个预开文件。
+  bool preload(fs::FS &target, bool sharedBus, const char *path);
+  bool hasPreload(const char *path);
+  void discardPreload();
+
+private:
+  std::shared_ptr<ReadAheadFSImpl> impl;
+  fs::FS fs;
+};
@@ -0,0 +1,184 @@
+#include "RingtonePlayer.h"
+#include "../config.h"
+#include <driver/i2s.h>
+#include <esp_idf_version.h>
+
+namespace {
+constexpr i2s_port_t RINGTONE_I2S_PORT = I2S_NUM_0;
+constexpr int RINGTONE_DMA_BUFFERS = 8;
+constexpr int RINGTONE_DMA_FRAMES = 256;
+constexpr uint8_t MAX_VOLUME = 21; // 与 Audio::setVolume 的刻度一致
+
+// 近似解码库的音量曲线：按平方律映射到 Q8 增益，21 为原始幅度。
+int32_t gainForVolume(uint8_t volume) {
+  if (volume > MAX_VOLUME) {
+    volume = MAX_VOLUME;
+  }
+  return static_cast<int32_t>(volume) * volume * 256 /
+         (MAX_VOLUME * MAX_VOLUME);
+}
+} // namespace
+
+bool RingtonePlayer::isRingtonePath(const char *path) {
+  size_t length = path != nullptr ? strlen(path) : 0;
+  return length > 4 && strcasecmp(path + length - 4, ".rtn") == 0;
+}
+
+bool RingtonePlayer::begin(fs::File source, uint8_t volume) {
+  end();
+  if (!source) {
+    return false;
+  }
+  uint8_t raw[RingtoneCodec::HEADER_SIZE];
+  if (source.read(raw, sizeof(raw)) != sizeof(raw) ||
+      !RingtoneCodec::parseHeader(raw, sizeof(raw), header)) {
+    Serial.println("[Audio][ringtone] invalid header");
+    source.close();
+    return false;
+  }
+  if (!installI2S(header.sampleRate)) {
+    source.close();
+    return false;
+  }
+  file = source;
+  active = true;
+  paused = false;
+  finished = false;
+  decodedSamples = 0;
+  blockFill = 0;
+  frameBytes = 0;
+  frameOffset = 0;
+  setVolume(volume);
+  return true;
+}
+
+void RingtonePlayer::end() {
+  if (file) {
+    file.close();
+  }
+  if (i2sInstalled) {
+    i2s_driver_uninstall(RINGTONE_I2S_PORT);
+    i2sInstalled = false;
+  }
+  active = false;
+  paused = false;
+  finished = false;
+}
+
+void RingtonePlayer::setVolume(uint8_t volume) { gain = gainForVolume(volume); }
+
+void RingtonePlayer::setPaused(bool value) {
+  if (!active || paused == value) {
+    return;
+  }
+  paused = value;
+  // 暂停时清空 DMA，否则自动补零前会把残留的几十毫秒循环播出。
+  if (paused) {
+    i2s_zero_dma_buffer(RINGTONE_I2S_PORT);
+  }
+}
+
+uint32_t RingtonePlayer::getElapsedSeconds() const {
+  return active ? decodedSamples / header.sampleRate : 0;
+}
+
+uint32_t RingtonePlayer::getDurationSeconds() const {
+  return active ? header.sampleCount / header.sampleRate : 0;
+}
+
+bool RingtonePlayer::pump() {
+  if (!isRunning()) {
+    return false;
+  }
+  for (;;) {
+    if (frameOffset >= frameBytes && !decodeNext()) {
+      return !finished;
+    }
+    size_t written = 0;
+    i2s_write(RINGTONE_I2S_PORT,
+              reinterpret_cast<const uint8_t *>(frames) + frameOffset,
+              frameBytes - frameOffset, &written, 0);
+    frameOffset += written;
+    if (frameOffset < frameBytes) {
+      // DMA 已满：交还 CPU，下一轮再写剩余部分。
+      return true;
+    }
+  }
+}
+
+bool RingtonePlayer::decodeNext() {
+  uint32_t remaining = header.sampleCount - decodedSamples;
+  if (remaining == 0) {
+    finished = true;
+    return false;
+  }
+  size_t expected = RingtoneCodec::ADPCM_BLOCK_SIZE;
+  if (header.format == RingtoneCodec::FORMAT_PCM16 &&
+      remaining * 2 < expected) {
+    expected = remaining * 2;
+  }
+  // 预读层缓冲暂空时 read 返回 0，已读入的半块保留到下次。
+  blockFill += file.read(block + blockFill, expected - blockFill);
+  if (blockFill < expected) {
+    if (file.position() >= file.size()) {
+      finished = true;
+    }
+    return false;
+  }
+  blockFill = 0;
+
+  size_t count = 0;
+  if (header.format == RingtoneCodec::FORMAT_IMA_ADPCM) {
+    count = RingtoneCodec::decodeAdpcmBlock(block, expected, mono,
+                                            remaining);
+  } else {
+    count = expected / 2;
+    for (size_t i = 0; i < count; ++i) {
+      mono[i] = static_cast<int16_t>(block[2 * i] | (block[2 * i + 1] << 8));
+    }
+  }
+  // 单声道复制到左右两路，与解码库的输出格式一致。
+  for (size_t i = 0; i < count; ++i) {
+    int16_t sample = static_cast<int16_t>((mono[i] * gain) >> 8);
+    frames[2 * i] = sample;
+    frames[2 * i + 1] = sample;
+  }
+  decodedSamples += count;
+  frameBytes = count * 2 * sizeof(int16_t);
+  frameOffset = 0;
+  return count > 0;
+}
+
+bool RingtonePlayer::installI2S(uint32_t sampleRate) {
+  i2s_config_t config = {};
+  config.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_TX);
+  config.sample_rate = sampleRate;
+  config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+  config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+  config.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+  config.dma_buf_count = RINGTONE_DMA_BUFFERS;
+  config.dma_buf_len = RINGTONE_DMA_FRAMES;
+  config.use_apll = false;
+  // 欠载时 DMA 自动输出静音，而不是重复最后一段缓冲。
+  config.tx_desc_auto_clear = true;
+  if (i2s_driver_install(RINGTONE_I2S_PORT, &config, 0, nullptr) != ESP_OK) {
+    Serial.println("[Audio][ringtone] i2s install failed");
+    return false;
+  }
+  i2s_pin_config_t pins = {};
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+  pins.mck_io_num = I2S_PIN_NO_CHANGE;
+#endif
+  pins.bck_io_num = I2S_BCK;
+  pins.ws_io_num = I2S_WS;
+  pins.data_out_num = I2S_DOUT;
+  pins.data_in_num = I2S_PIN_NO_CHANGE;
+  if (i2s_set_pin(RINGTONE_I2S_PORT, &pins) != ESP_OK) {
+    Serial.println("[Audio][ringtone] i2s pin setup failed");
+    i2s_driver_uninstall(RINGTONE_I2S_PORT);
+    return false;
+  }
+  i2sInstalled = true;
+  return true;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../utils/RingtoneCodec.h"
+#include <Arduino.h>
+#include <FS.h>
+
+// 原生铃声（.rtn）的轻量播放路径：ADPCM/PCM 解码后直接写 I2S DMA，
+// 不创建 MP3 解码器。与 Audio 实例共用 I2S0，二者不能同时存在，
+// 由 AudioDriver 负责切换并在解码锁内调用全部接口。
+class RingtonePlayer {
+public:
+  static bool isRingtonePath(const char *path);
+
+  // file 需已由调用方打开（通常来自预读层），成功后由本对象持有。
+  bool begin(fs::File file, uint8_t volume);
+  void end();
+  // 解码并以零超时写入 I2S，DMA 已满时保留剩余数据下次继续。
+  // 播放结束（或从未开始）时返回 false。
+  bool pump();
+  void setVolume(uint8_t volume);
+  void setPaused(bool value);
+  bool isActive() const { return active; }
+  bool isPaused() const { return paused; }
+  bool isRunning() const { return active && !paused && !finished; }
+  uint32_t getElapsedSeconds() const;
+  uint32_t getDurationSeconds() const;
+  // 已解码送出的采样数，启动延迟探针据此判断是否开始出声。
+  uint32_t getDecodedSamples() const { return decodedSamples; }
+
+private:
+  bool installI2S(uint32_t sampleRate);
+  bool decodeNext();
+
+  fs::File file;
+  RingtoneCodec::Header header = {};
+  bool active = false;
+  bool paused = false;
+  bool finished = false;
+  bool i2sInstalled = false;
+  int32_t gain = 256; // Q8
+  uint32_t decodedSamples = 0;
+  uint8_t block[RingtoneCodec::ADPCM_BLOCK_SIZE];
+  size_t blockFill = 0;
+  int16_t mono[RingtoneCodec::ADPCM_BLOCK_SAMPLES];
+  int16_t frames[RingtoneCodec::ADPCM_BLOCK_SAMPLES * 2];
+  size_t frameBytes = 0;
+  size_t frameOffset = 0;
+};
@@ -77,6 +77,9 @@ DateTime RtcDriver::getSoftwareTime() const {
     return _cachedTime;
   return RTC_DEFAULT_TIME;
 }
+time_t RtcDriver::getSoftwareTimeAsTimeT() const {
+  return toTimeT(getSoftwareTime());
+}
 void RtcDriver::setSecond(uint8_t seconds) {
   if (writeRegister(RX8010_REG_SEC, decToBcd(seconds)))
     _lastReadTime = 0;
@@ -70,6 +70,7 @@ public:
 
   // Utilities
   time_t getTimeAsTimeT();
+  time_t getSoftwareTimeAsTimeT() const;
   void setTime(uint8_t hour, uint8_t minute, uint8_t second);
   void setDate(uint8_t day, uint8_t month, uint16_t year);
   void setDateTime(const char *date,
@@ -0,0 +1,309 @@
+#include "../utils/Metrics.h"
+#include "SDCardDriver.h"
+#include "SharedSPIBus.h"
+#include <esp_system.h>
+
+namespace {
+constexpr uint8_t BENCHMARK_VERSION = 1;
+constexpr const char *BENCHMARK_PREFS_NAMESPACE = "sd_bench";
+constexpr const char *BENCHMARK_PREFS_KEY = "result";
+constexpr const char *BENCHMARK_FILE = "/.sdbench.tmp";
+constexpr size_t BENCHMARK_FILE_SIZE = 256 * 1024;
+constexpr size_t BENCHMARK_BUFFER_SIZE = 16 * 1024; // 不小于最大测试块
+constexpr size_t RANDOM_READ_SIZE = 4096;
+constexpr uint32_t RANDOM_READ_COUNT = 64;
+constexpr uint32_t DIR_SCAN_LIMIT = 256;
+// ESP32 的 SPI 时钟由 80MHz 整数分频得到，依次为 8/4/3/2 分频。
+constexpr uint32_t CLOCK_STEPS_HZ[] = {10000000, 20000000, 26666667,
+                                       40000000};
+constexpr uint32_t BUFFER_PICK_PERCENT = 90;
+// 每档时钟需连续多次断电重挂并读回校验都通过，偶然通过的临界档不会被采用。
+constexpr uint8_t CLOCK_VERIFY_PASSES = 3;
+
+// 每个扇区的内容都不同，时钟过高造成的移位或读错扇区都能被校验发现。
+uint8_t patternByte(uint32_t offset) {
+  return static_cast<uint8_t>(offset * 31 + (offset >> 9) * 7);
+}
+
+uint32_t rateKBps(size_t bytes, uint32_t elapsedUs) {
+  return elapsedUs == 0 ? 0
+                        : static_cast<uint32_t>(static_cast<uint64_t>(bytes) *
+                                                1000000ULL / 1024ULL /
+                                                elapsedUs);
+}
+
+uint32_t perSecond(uint32_t count, uint32_t elapsedUs) {
+  return elapsedUs == 0 ? 0
+                        : static_cast<uint32_t>(static_cast<uint64_t>(count) *
+                                                1000000ULL / elapsedUs);
+}
+
+bool writePattern(uint8_t *buffer) {
+  File file = SD.open(BENCHMARK_FILE, FILE_WRITE);
+  if (!file) {
+    return false;
+  }
+  bool ok = true;
+  for (uint32_t offset = 0; ok && offset < BENCHMARK_FILE_SIZE;
+       offset += BENCHMARK_BUFFER_SIZE) {
+    for (size_t i = 0; i < BENCHMARK_BUFFER_SIZE; ++i) {
+      buffer[i] = patternByte(offset + i);
+    }
+    ok = file.write(buffer, BENCHMARK_BUFFER_SIZE) == BENCHMARK_BUFFER_SIZE;
+  }
+  file.close();
+  return ok;
+}
+
+bool verifyPattern(uint8_t *buffer) {
+  File file = SD.open(BENCHMARK_FILE, FILE_READ);
+  if (!file || file.size() != BENCHMARK_FILE_SIZE) {
+    return false;
+  }
+  bool ok = true;
+  for (uint32_t offset = 0; ok && offset < BENCHMARK_FILE_SIZE;
+       offset += BENCHMARK_BUFFER_SIZE) {
+    ok = file.read(buffer, BENCHMARK_BUFFER_SIZE) == BENCHMARK_BUFFER_SIZE;
+    for (size_t i = 0; ok && i < BENCHMARK_BUFFER_SIZE; ++i) {
+      ok = buffer[i] == patternByte(offset + i);
+    }
+  }
+  file.close();
+  return ok;
+}
+
+// 计时包含打开与关闭：关闭时才回写 FAT 和目录项，
+// 上传落盘同样要付这部分开销。
+bool timedWrite(uint8_t *buffer, size_t block, uint32_t &elapsedUs) {
+  uint32_t startUs = micros();
+  File file = SD.open(BENCHMARK_FILE, FILE_WRITE);
+  if (!file) {
+    return false;
+  }
+  bool ok = true;
+  for (size_t done = 0; ok && done < BENCHMARK_FILE_SIZE; done += block) {
+    ok = file.write(buffer, block) == block;
+  }
+  file.close();
+  elapsedUs = micros() - startUs;
+  return ok;
+}
+
+bool timedRead(uint8_t *buffer, size_t block, uint32_t &elapsedUs) {
+  uint32_t startUs = micros();
+  File file = SD.open(BENCHMARK_FILE, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  bool ok = true;
+  for (size_t done = 0; ok && done < BENCHMARK_FILE_SIZE; done += block) {
+    ok = file.read(buffer, block) == block;
+  }
+  file.close();
+  elapsedUs = micros() - startUs;
+  return ok;
+}
+
+bool timedRandomReads(uint8_t *buffer, uint32_t &elapsedUs) {
+  File file = SD.open(BENCHMARK_FILE, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  bool ok = true;
+  uint32_t startUs = micros();
+  for (uint32_t i = 0; ok && i < RANDOM_READ_COUNT; ++i) {
+    uint32_t offset =
+        esp_random() % (BENCHMARK_FILE_SIZE / RANDOM_READ_SIZE) *
+        RANDOM_READ_SIZE;
+    ok = file.seek(offset) &&
+         file.read(buffer, RANDOM_READ_SIZE) == RANDOM_READ_SIZE;
+  }
+  elapsedUs = micros() - startUs;
+  file.close();
+  return ok;
+}
+} // namespace
+
+constexpr uint16_t SDBenchmarkResult::BLOCK_SIZES[];
+
+void SDCardDriver::loadBenchmark() {
+  benchPrefsReady = benchPrefs.begin(BENCHMARK_PREFS_NAMESPACE, false);
+  if (!benchPrefsReady) {
+    return;
+  }
+  SDBenchmarkResult stored;
+  size_t length =
+      benchPrefs.getBytes(BENCHMARK_PREFS_KEY, &stored, sizeof(stored));
+  if (length != sizeof(stored) || stored.version != BENCHMARK_VERSION ||
+      !stored.valid || stored.clockHz == 0 || stored.bufferSize == 0) {
+    return;
+  }
+  benchmark = stored;
+  applyBenchmark();
+}
+
+bool SDCardDriver::runBenchmark() {
+  // 关键逻辑：整个测速持有共享总线，换档重新挂载之间不会插入屏幕刷新或
+  // 其他 SD 访问；只在无人持有挂载时执行，不会打断播放或上传。
+  SharedSPIBus::Guard spiGuard;
+  if (refCount > 0) {
+    Serial.println("[SD][bench] card in use, skipped");
+    return false;
+  }
+  uint8_t *buffer = static_cast<uint8_t *>(malloc(BENCHMARK_BUFFER_SIZE));
+  if (buffer == nullptr) {
+    Serial.println("[SD][bench] buffer allocation failed");
+    return false;
+  }
+  uint32_t previousClockHz = SharedSPIBus::clockFor(SharedSPIBus::DEVICE_SD);
+  size_t previousTransferSize =
+      SharedSPIBus::transferSizeFor(SharedSPIBus::DEVICE_SD);
+  uint32_t startMs = millis();
+  SDBenchmarkResult result = {};
+  result.version = BENCHMARK_VERSION;
+  bool ok = false;
+  // 先回到默认时钟再挂载：上次的调优值若已不可靠，测试文件的写入和
+  // 低档校验不应建立在它之上。
+  if (mounted) {
+    unmount();
+  }
+  SharedSPIBus::resetTuning(SharedSPIBus::DEVICE_SD);
+  if (acquire()) {
+    ok = benchmarkClocks(buffer, result) && benchmarkThroughput(buffer, result);
+    if (mounted) {
+      SD.remove(BENCHMARK_FILE);
+    }
+    release();
+  }
+  free(buffer);
+
+  if (!ok) {
+    SharedSPIBus::setTuning(SharedSPIBus::DEVICE_SD, previousClockHz,
+                            previousTransferSize);
+    if (mounted) {
+      remountAt(previousClockHz);
+    }
+    Serial.println("[SD][bench] failed");
+    return false;
+  }
+  result.valid = true;
+  benchmark = result;
+  applyBenchmark();
+  if (benchPrefsReady) {
+    benchPrefs.putBytes(BENCHMARK_PREFS_KEY, &benchmark, sizeof(benchmark));
+    Metrics::add(Metrics::NVS_WRITES);
+  }
+  Serial.printf("[SD][bench] done in %lums clock=%luHz buffer=%lu "
+                "random=%luIOPS dir=%lu/s\n",
+                static_cast<unsigned long>(millis() - startMs),
+                static_cast<unsigned long>(benchmark.clockHz),
+                static_cast<unsigned long>(benchmark.bufferSize),
+                static_cast<unsigned long>(benchmark.randomReadIops),
+                static_cast<unsigned long>(benchmark.dirEntriesPerSec));
+  return true;
+}
+
+bool SDCardDriver::remountAt(uint32_t clockHz) {
+  SharedSPIBus::setTuning(SharedSPIBus::DEVICE_SD, clockHz, 0);
+  if (mounted) {
+    unmount();
+  }
+  return mount(false);
+}
+
+bool SDCardDriver::benchmarkClocks(uint8_t *buffer,
+                                   SDBenchmarkResult &result) {
+  if (!writePattern(buffer)) {
+    Serial.println("[SD][bench] test file write failed");
+    return false;
+  }
+  uint32_t fallbackHz = SharedSPIBus::clockFor(SharedSPIBus::DEVICE_SD);
+  // 从低到高逐档断电重挂并读回校验，第一档失败即停止：再高的时钟只会更差。
+  for (uint32_t clockHz : CLOCK_STEPS_HZ) {
+    uint8_t passes = 0;
+    while (passes < CLOCK_VERIFY_PASSES && remountAt(clockHz) &&
+           verifyPattern(buffer)) {
+      passes++;
+    }
+    bool passed = passes == CLOCK_VERIFY_PASSES;
+    Serial.printf("[SD][bench] clock %luHz %u/%u %s\n",
+                  static_cast<unsigned long>(clockHz),
+                  static_cast<unsigned>(passes),
+                  static_cast<unsigned>(CLOCK_VERIFY_PASSES),
+                  passed ? "ok" : "failed");
+    if (!passed) {
+      break;
+    }
+    result.clockHz = clockHz;
+  }
+  uint32_t finalHz = result.clockHz != 0 ? result.clockHz : fallbackHz;
+  return remountAt(finalHz) && result.clockHz != 0;
+}
+
+bool SDCardDriver::benchmarkThroughput(uint8_t *buffer,
+                                       SDBenchmarkResult &result) {
+  uint32_t elapsedUs = 0;
+  uint32_t bestRead = 0;
+  uint32_t bestWrite = 0;
+  for (uint8_t i = 0; i < SDBenchmarkResult::BLOCK_SIZE_COUNT; ++i) {
+    size_t block = SDBenchmarkResult::BLOCK_SIZES[i];
+    if (!timedWrite(buffer, block, elapsedUs)) {
+      return false;
+    }
+    result.writeKBps[i] = rateKBps(BENCHMARK_FILE_SIZE, elapsedUs);
+    if (!timedRead(buffer, block, elapsedUs)) {
+      return false;
+    }
+    result.readKBps[i] = rateKBps(BENCHMARK_FILE_SIZE, elapsedUs);
+    bestRead = max(bestRead, result.readKBps[i]);
+    bestWrite = max(bestWrite, result.writeKBps[i]);
+    Serial.printf("[SD][bench] block %u write=%luKB/s read=%luKB/s\n",
+                  static_cast<unsigned>(block),
+                  static_cast<unsigned long>(result.writeKBps[i]),
+                  static_cast<unsigned long>(result.readKBps[i]));
+  }
+
+  if (!timedRandomReads(buffer, elapsedUs)) {
+    return false;
+  }
+  result.randomReadIops = perSecond(RANDOM_READ_COUNT, elapsedUs);
+
+  SDDirectoryCursor cursor;
+  DirEntry entry;
+  uint32_t entries = 0;
+  uint32_t startUs = micros();
+  if (cursor.open(this, "/")) {
+    while (entries < DIR_SCAN_LIMIT && cursor.next(entry)) {
+      entries++;
+    }
+    cursor.close();
+  }
+  result.dirEntriesPerSec = perSecond(entries, micros() - startUs);
+
+  // 关键逻辑：块越大预读与上传占用的内存越多、单次持有总线越久，
+  // 取读写都达到最佳速度 90% 的最小块，而不是单纯取最快的那一档。
+  result.bufferSize =
+      SDBenchmarkResult::BLOCK_SIZES[SDBenchmarkResult::BLOCK_SIZE_COUNT - 1];
+  for (uint8_t i = 0; i < SDBenchmarkResult::BLOCK_SIZE_COUNT; ++i) {
+    if (result.readKBps[i] * 100 >= bestRead * BUFFER_PICK_PERCENT &&
+        result.writeKBps[i] * 100 >= bestWrite * BUFFER_PICK_PERCENT) {
+      result.bufferSize = SDBenchmarkResult::BLOCK_SIZES[i];
+      break;
+    }
+  }
+  return true;
+}
+
+void SDCardDriver::applyBenchmark() {
+  SharedSPIBus::setTuning(SharedSPIBus::DEVICE_SD, benchmark.clockHz,
+                          benchmark.bufferSize);
+}
+
+void SDCardDriver::dropBenchmark() {
+  SharedSPIBus::resetTuning(SharedSPIBus::DEVICE_SD);
+  benchmark.valid = false;
+  if (benchPrefsReady) {
+    benchPrefs.remove(BENCHMARK_PREFS_KEY);
+    Metrics::add(Metrics::NVS_WRITES);
+  }
+}
@@ -1,19 +1,79 @@
 #include "SDCardDriver.h"
+#include "../utils/Metrics.h"
 #include "SharedSPIBus.h"
 #include "config.h"
-#include <vector>
 
-SDCardDriver::SDCardDriver() {}
+namespace {
+// 音乐索引后台重扫同时占 4 个句柄（新旧索引、路径池、当前目录），
+// 再加上播放中的曲目、界面读索引和 Web 下载，库默认的 5 个不够用。
+constexpr uint8_t SD_MAX_OPEN_FILES = 8;
+} // namespace
 
-bool SDCardDriver::begin() {
+SDCardDriver::SDCardDriver() : idleTimeoutMs(SD_IDLE_UNMOUNT_MS) {}
+
+bool SDCardDriver::acquire() {
+  // 引用计数与挂载状态在 UI 任务和 Web 任务间共享，统一在 SPI 锁内修改。
+  SharedSPIBus::Guard spiGuard;
   if (mounted) {
+    Metrics::add(Metrics::SD_MOUNT_REUSES);
+  } else if (!mount()) {
+    return false;
+  }
+  refCount++;
+  return true;
+}
+
+void SDCardDriver::release() {
+  SharedSPIBus::Guard spiGuard;
+  if (refCount == 0) {
+    return;
+  }
+  if (--refCount == 0) {
+    idleSinceMs = millis();
+  }
+}
+
+void SDCardDriver::unmountIfIdle(bool force) {
+  SharedSPIBus::Guard spiGuard(force ? SharedSPIBus::WAIT_FOREVER : 0);
+  uint32_t idleMs = millis() - idleSinceMs;
+  if (!spiGuard.isLocked() || !mounted || refCount > 0 ||
+      (!force && idleMs < idleTimeoutMs)) {
+    return;
+  }
+  unmount();
+  Metrics::add(Metrics::SD_IDLE_UNMOUNTS);
+  Serial.printf("[SD][session] unmounted after %lums idle\n",
+                static_cast<unsigned long>(idleMs));
+}
+
+bool SDCardDriver::beginCard() {
+  SharedSPIBus::prepareSDCard();
+  if (SD.begin(SD_CS, SharedSPIBus::bus(),
+               SharedSPIBus::clockFor(SharedSPIBus::DEVICE_SD), "/sd",
+               SD_MAX_OPEN_FILES)) {
     return true;
   }
+  SharedSPIBus::releaseSDCard();
+  return false;
+}
+
+bool SDCardDriver::mount(bool fallbackToDefault) {
+  uint32_t startMs = millis();
   Serial.println("Mounting SD card...");
-  SharedSPIBus::prepareSDCard();
-  if (!SD.begin(SD_CS, SharedSPIBus::bus(), SPI_SPEED)) {
+  bool begun = beginCard();
+  // 关键逻辑：测速时钟在换卡、降温或供电变化后可能不再可靠，调优时钟挂载
+  // 失败时退回默认时钟重试一次并丢弃测速结果，避免卡从此一直挂不上。
+  // 测速自身逐档挂载时不回退，否则高档失败会被误判为通过。
+  if (!begun && fallbackToDefault &&
+      SharedSPIBus::clockFor(SharedSPIBus::DEVICE_SD) != SPI_SPEED) {
+    Serial.printf("[SD][session] mount at %luHz failed, retry at default\n",
+                  static_cast<unsigned long>(
+                      SharedSPIBus::clockFor(SharedSPIBus::DEVICE_SD)));
+    dropBenchmark();
+    begun = beginCard();
+  }
+  if (!begun) {
     Serial.println("Card Mount Failed");
-    SharedSPIBus::releaseSDCard();
     return false;
   }
   uint8_t cardType = SD.cardType();
@@ -27,14 +87,16 @@ bool SDCardDriver::begin() {
 
   digitalWrite(SD_CS, HIGH);
   mounted = true;
-  Serial.println("SD card mounted successfully.");
+  idleSinceMs = millis();
+  uint32_t elapsedMs = idleSinceMs - startMs;
+  Metrics::add(Metrics::SD_MOUNTS);
+  Metrics::observe(Metrics::SD_MOUNT_MS, elapsedMs);
+  Serial.printf("[SD][session] mounted in %lums\n",
+                static_cast<unsigned long>(elapsedMs));
   return true;
 }
 
-void SDCardDriver::end() {
-  if (!mounted) {
-    return;
-  }
+void SDCardDriver::unmount() {
   SD.end();
   SharedSPIBus::releaseSDCard();
   mounted = false;
@@ -60,35 +122,70 @@ bool SDCardDriver::softDelete(const char *path) {
   return trashPath.length() > 0 && SD.rename(path, trashPath.c_str());
 }
 
+bool SDCardDriver::remove(const char *path) { return SD.remove(path); }
+
 bool SDCardDriver::mkdir(const char *path) { return SD.mkdir(path); }
 
 bool SDCardDriver::rmdir(const char *path) { return SD.rmdir(path); }
 
-std::vector<FileInfo> SDCardDriver::listDir(const char *dirname) {
-  std::vector<FileInfo> fileList;
-  File root = SD.open(dirname);
-  if (!root) {
+bool SDDirectoryCursor::open(SDCardDriver *sd, const char *path) {
+  close();
+  if (sd == nullptr || !sd->isMounted()) {
+    return false;
+  }
+  dir = sd->open(path, FILE_READ);
+  if (!dir) {
     Serial.println("Failed to open directory");
-    return fileList;
+    return false;
   }
-  if (!root.isDirectory()) {
+  if (!dir.isDirectory()) {
     Serial.println("Not a directory");
-    return fileList;
-  }
-
-  File file = root.openNextFile();
-  while (file) {
-    FileInfo info;
-    info.name = file.name();
-    info.isDirectory = file.isDirectory();
-    info.size = file.size();
-    info.lastWrite = file.getLastWrite();
-    fileList.push_back(info);
-    file.close();
-    file = root.openNextFile();
-  }
-  root.close();
-  return fileList;
+    dir.close();
+    return false;
+  }
+  return true;
+}
+
+size_t SDDirectoryCursor::skip(size_t count) {
+  // 关键逻辑：翻页跳过的条目只读取名字，不逐个打开文件取大小，
+  // 大目录深分页时避免每个条目都触发一次 FAT 目录项查找。
+  size_t skipped = 0;
+  while (dir && skipped < count) {
+    if (dir.getNextFileName().length() == 0) {
+      break;
+    }
+    skipped++;
+    index++;
+  }
+  return skipped;
+}
+
+bool SDDirectoryCursor::next(DirEntry &entry) {
+  if (!dir) {
+    return false;
+  }
+  File file = dir.openNextFile();
+  if (!file) {
+    return false;
+  }
+  const char *name = file.name();
+  const char *slash = strrchr(name, '/');
+  strlcpy(entry.name, slash != nullptr ? slash + 1 : name,
+          sizeof(entry.name));
+  entry.isDirectory = file.isDirectory();
+  entry.size = file.size();
+  entry.lastWrite = file.getLastWrite();
+  file.close();
+  index++;
+  return true;
+}
+
+void SDDirectoryCursor::close() {
+  if (dir) {
+    dir.close();
+  }
+  dir = File();
+  index = 0;
 }
 
 String SDCardDriver::readFile(const char *path) {
@@ -1,38 +1,104 @@
 #pragma once
 
 #include "SD.h"
+#include <Preferences.h>
 #include <SPI.h>
 
-#include <vector>
-
-struct FileInfo
+// 目录项使用定长名字缓冲，遍历大目录时内存占用与条目数无关。
+struct DirEntry
 {
-    String name;
+    static constexpr size_t NAME_SIZE = 256;
+    char name[NAME_SIZE];
     bool isDirectory;
     size_t size;
     time_t lastWrite;
 };
 
+// 上一次 SD 测速的结果与推荐参数，整体以二进制块存入 NVS。
+struct SDBenchmarkResult
+{
+    static constexpr uint8_t BLOCK_SIZE_COUNT = 4;
+    static constexpr uint16_t BLOCK_SIZES[BLOCK_SIZE_COUNT] = {512, 2048, 8192,
+                                                               16384};
+    uint8_t version;
+    bool valid;
+    uint32_t writeKBps[BLOCK_SIZE_COUNT];
+    uint32_t readKBps[BLOCK_SIZE_COUNT];
+    uint32_t randomReadIops; // 4KB 对齐随机读
+    uint32_t dirEntriesPerSec;
+    uint32_t clockHz;    // 读回校验通过的最高时钟
+    uint32_t bufferSize; // 顺序读达到最佳速度 90% 的最小块
+};
+
+class SDCardDriver;
+
+// 流式目录游标：每次只持有一个目录句柄和当前条目，
+// Web 文件列表分页和音乐扫描共用同一套遍历逻辑。
+class SDDirectoryCursor
+{
+public:
+    ~SDDirectoryCursor() { close(); }
+    bool open(SDCardDriver *sd, const char *path);
+    size_t skip(size_t count);
+    bool next(DirEntry &entry);
+    void close();
+    size_t position() const { return index; }
+
+private:
+    File dir;
+    size_t index = 0;
+};
+
+// 挂载按引用计数共享：任何使用者先 acquire，用完 release；最后一个使用者
+// 释放后卡保持挂载，空闲超过超时才卸载断电。连续的目录列表、下载和
+// 分块上传请求因此不必每次都重新初始化卡。
 class SDCardDriver
 {
 public:
     SDCardDriver();
-    bool begin();
-    void end();
+    bool acquire();
+    void release();
+    // 无人持有且空闲超过超时后卸载。总线正被屏幕或其他任务占用时本轮跳过；
+    // force 为 true 时忽略超时并等待总线（入睡前）。
+    void unmountIfIdle(bool force = false);
+    void setIdleTimeout(uint32_t timeoutMs) { idleTimeoutMs = timeoutMs; }
     bool isMounted() const { return mounted; }
+    uint8_t getRefCount() const { return refCount; }
     fs::SDFS getFS();
 
+    // 启动时读取上次测速结果并应用推荐时钟与传输大小。
+    void loadBenchmark();
+    // 顺序读写多种块大小、4KB 随机读和目录遍历测速，并从默认时钟起逐档
+    // 提高时钟、每档多次重挂读回校验测试文件，结果写入 NVS 后立即生效。
+    // 全程（十几秒）独占共享总线，有其他使用者持有挂载时拒绝执行。
+    bool runBenchmark();
+    const SDBenchmarkResult &getBenchmark() const { return benchmark; }
+
     File open(const char *path, const char *mode = FILE_READ);
     bool exists(const char *path);
     bool rename(const char *pathFrom, const char *pathTo);
     bool softDelete(const char *path);
+    bool remove(const char *path);
     bool mkdir(const char *path);
     bool rmdir(const char *path);
-    std::vector<FileInfo> listDir(const char *dirname);
     String readFile(const char *path);
     bool writeFile(const char *path, const char *message);
 
 private:
     bool mounted = false;
+    uint8_t refCount = 0;
+    uint32_t idleSinceMs = 0;
+    uint32_t idleTimeoutMs;
+    Preferences benchPrefs;
+    bool benchPrefsReady = false;
+    SDBenchmarkResult benchmark = {};
+    bool beginCard();
+    bool mount(bool fallbackToDefault = true);
+    void unmount();
+    bool remountAt(uint32_t clockHz);
+    bool benchmarkClocks(uint8_t *buffer, SDBenchmarkResult &result);
+    bool benchmarkThroughput(uint8_t *buffer, SDBenchmarkResult &result);
+    void applyBenchmark();
+    void dropBenchmark();
     String buildTrashPath(const char *path);
 };
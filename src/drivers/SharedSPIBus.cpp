@@ -1,8 +1,115 @@
 #include "SharedSPIBus.h"
+#include "../utils/Metrics.h"
 #include "config.h"
 #include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
 namespace {
+constexpr uint32_t DISPLAY_SPI_CLOCK_HZ = 4000000;
+constexpr size_t DEFAULT_TRANSFER_SIZE = 8 * 1024;
+// 交出总线后等待紧急方真正取得锁的上限；同核高优先级任务会立即抢占，
+// 这里只兜住紧急方在另一核上的情况。
+constexpr uint32_t YIELD_HANDOFF_MS = 5;
+// 记录各层登记设备的嵌套深度上限，更深的层沿用最深一层的记录。
+constexpr uint32_t MAX_TRACKED_DEPTH = 8;
+
+const Metrics::Counter BUSY_COUNTERS[SharedSPIBus::DEVICE_COUNT] = {
+    Metrics::SPI_BUSY_US_DISPLAY, Metrics::SPI_BUSY_US_SD};
+
+// 关键逻辑：用普通互斥锁加自管的持有者/层数实现重入，而不是 FreeRTOS
+// 递归锁——让出时必须一次性交出全部层数，递归锁无法得知当前层数。
+// owner/depth/device 只由持有者在持锁期间修改。
+SemaphoreHandle_t spiMutex = nullptr;
+TaskHandle_t owner = nullptr;
+uint32_t depth = 0;
+// 关键逻辑：占用时间记在当前真正在用总线的设备上，而不是最外层取锁的
+// 设备。嵌套取锁时切到内层登记的设备，退出时切回外层；屏幕和 SD 的片选
+// 准备函数也会切换，UI 锁内读 SD（索引、测速）因此计入 SD。
+SharedSPIBus::Device levelDevice[MAX_TRACKED_DEPTH + 1] = {};
+SharedSPIBus::Device chargedDevice = SharedSPIBus::DEVICE_SD;
+uint32_t chargedSinceUs = 0;
+volatile uint8_t urgentWaiters = 0;
+portMUX_TYPE urgentMux = portMUX_INITIALIZER_UNLOCKED;
+
+// 只在启动加载测速结果和测速过程中修改，按值读取，不需要加锁。
+constexpr uint32_t DEFAULT_CLOCK_HZ[SharedSPIBus::DEVICE_COUNT] = {
+    DISPLAY_SPI_CLOCK_HZ, SPI_SPEED};
+uint32_t deviceClockHz[SharedSPIBus::DEVICE_COUNT] = {DISPLAY_SPI_CLOCK_HZ,
+                                                      SPI_SPEED};
+size_t deviceTransferSize[SharedSPIBus::DEVICE_COUNT] = {
+    DEFAULT_TRANSFER_SIZE, DEFAULT_TRANSFER_SIZE};
+
+void ensureMutex() {
+  if (spiMutex == nullptr) {
+    spiMutex = xSemaphoreCreateMutex();
+  }
+}
+
+TickType_t toTicks(uint32_t timeoutMs) {
+  return timeoutMs == SharedSPIBus::WAIT_FOREVER ? portMAX_DELAY
+                                                 : pdMS_TO_TICKS(timeoutMs);
+}
+
+uint32_t trackedDepth() {
+  return depth < MAX_TRACKED_DEPTH ? depth : MAX_TRACKED_DEPTH;
+}
+
+void chargeTo(SharedSPIBus::Device device) {
+  if (device == chargedDevice) {
+    return;
+  }
+  uint32_t now = micros();
+  Metrics::add(BUSY_COUNTERS[chargedDevice], now - chargedSinceUs);
+  chargedDevice = device;
+  chargedSinceUs = now;
+}
+
+void enterLevel(SharedSPIBus::Device device) {
+  depth++;
+  levelDevice[trackedDepth()] = device;
+  chargeTo(device);
+}
+
+// 返回是否释放了最外层。
+bool leaveLevel() {
+  if (--depth == 0) {
+    return true;
+  }
+  chargeTo(levelDevice[trackedDepth()]);
+  return false;
+}
+
+void takeOwnership(SharedSPIBus::Device device, uint32_t levels) {
+  owner = xTaskGetCurrentTaskHandle();
+  depth = levels;
+  levelDevice[trackedDepth()] = device;
+  chargedDevice = device;
+  chargedSinceUs = micros();
+}
+
+void releaseOwnership() {
+  Metrics::add(BUSY_COUNTERS[chargedDevice], micros() - chargedSinceUs);
+  owner = nullptr;
+  depth = 0;
+  xSemaphoreGive(spiMutex);
+}
+
+void switchHeldDevice(SharedSPIBus::Device device) {
+  if (owner != xTaskGetCurrentTaskHandle() || depth == 0) {
+    return;
+  }
+  levelDevice[trackedDepth()] = device;
+  chargeTo(device);
+}
+
+void changeUrgentWaiters(int8_t delta) {
+  portENTER_CRITICAL(&urgentMux);
+  urgentWaiters += delta;
+  portEXIT_CRITICAL(&urgentMux);
+}
+
 void deselectSharedSPIDevices() {
   digitalWrite(EPD_CS, HIGH);
   digitalWrite(SD_CS, HIGH);
@@ -18,7 +125,33 @@ void configureSharedSPIPins() {
 
 SPIClass &SharedSPIBus::bus() { return SPI; }
 
+uint32_t SharedSPIBus::clockFor(Device device) {
+  return deviceClockHz[device];
+}
+
+size_t SharedSPIBus::transferSizeFor(Device device) {
+  return deviceTransferSize[device];
+}
+
+void SharedSPIBus::setTuning(Device device, uint32_t clockHz,
+                             size_t transferSize) {
+  if (clockHz > 0)
+    deviceClockHz[device] = clockHz;
+  if (transferSize > 0)
+    deviceTransferSize[device] = transferSize;
+}
+
+void SharedSPIBus::resetTuning(Device device) {
+  deviceClockHz[device] = DEFAULT_CLOCK_HZ[device];
+  deviceTransferSize[device] = DEFAULT_TRANSFER_SIZE;
+}
+
+SPISettings SharedSPIBus::settingsFor(Device device) {
+  return SPISettings(clockFor(device), MSBFIRST, SPI_MODE0);
+}
+
 void SharedSPIBus::begin() {
+  ensureMutex();
   configureSharedSPIPins();
   digitalWrite(SD_EN, SD_PWD_OFF);
 
@@ -27,14 +160,92 @@ void SharedSPIBus::begin() {
   bus().begin(EPD_SCK, SPI_MISO, EPD_MOSI);
 }
 
+bool SharedSPIBus::lock(uint32_t timeoutMs, Device device) {
+  // 关键逻辑：屏幕刷新在 UI 主循环，SD 文件流在 Web 服务任务，
+  // 两个任务跨核访问同一组 SPI 引脚，必须整段事务互斥；
+  // 可重入，允许刷屏流程内部再次进入（如切页时嵌套 draw）。
+  ensureMutex();
+  if (spiMutex == nullptr)
+    return false;
+  if (owner == xTaskGetCurrentTaskHandle()) {
+    enterLevel(device);
+    return true;
+  }
+  if (xSemaphoreTake(spiMutex, toTicks(timeoutMs)) != pdTRUE)
+    return false;
+  takeOwnership(device, 1);
+  return true;
+}
+
+bool SharedSPIBus::lockUrgent(uint32_t timeoutMs) {
+  ensureMutex();
+  if (spiMutex == nullptr)
+    return false;
+  if (owner == xTaskGetCurrentTaskHandle()) {
+    enterLevel(DEVICE_SD);
+    return true;
+  }
+  uint32_t startUs = micros();
+  changeUrgentWaiters(1);
+  bool locked = xSemaphoreTake(spiMutex, toTicks(timeoutMs)) == pdTRUE;
+  changeUrgentWaiters(-1);
+  if (!locked)
+    return false;
+  takeOwnership(DEVICE_SD, 1);
+  Metrics::observe(Metrics::SPI_URGENT_WAIT_US, micros() - startUs);
+  return true;
+}
+
+void SharedSPIBus::unlock() {
+  if (spiMutex == nullptr || owner != xTaskGetCurrentTaskHandle())
+    return;
+  if (leaveLevel())
+    releaseOwnership();
+}
+
+bool SharedSPIBus::yieldToUrgent() {
+  if (urgentWaiters == 0 || owner != xTaskGetCurrentTaskHandle())
+    return false;
+  // 让出期间紧急方会改写层级记录，先整体保存，取回后原样恢复。
+  Device saved[MAX_TRACKED_DEPTH + 1];
+  memcpy(saved, levelDevice, sizeof(saved));
+  Device device = chargedDevice;
+  uint32_t levels = depth;
+  releaseOwnership();
+  // 紧急方取得锁后才会把等待计数减一；等它接手再重新排队取锁。
+  uint32_t startMs = millis();
+  while (urgentWaiters > 0 && millis() - startMs < YIELD_HANDOFF_MS) {
+    vTaskDelay(1);
+  }
+  xSemaphoreTake(spiMutex, portMAX_DELAY);
+  takeOwnership(device, levels);
+  memcpy(levelDevice, saved, sizeof(saved));
+  Metrics::add(Metrics::SPI_URGENT_YIELDS);
+  return true;
+}
+
+bool SharedSPIBus::hasUrgentWaiter() { return urgentWaiters > 0; }
+
+SharedSPIBus::Guard::Guard(uint32_t timeoutMs, Device device)
+    : locked(lock(timeoutMs, device)) {}
+
+SharedSPIBus::Guard::~Guard() {
+  if (locked)
+    unlock();
+}
+
+bool SharedSPIBus::Guard::isLocked() const { return locked; }
+
 void SharedSPIBus::prepareDisplay() {
   // 关键逻辑：访问屏幕前先确保 SD 卡处于未选中状态，避免共享 SPI 时被另一个
   // 从设备错误响应，造成墨水屏初始化或刷屏卡死。
   deselectSharedSPIDevices();
+  switchHeldDevice(DEVICE_DISPLAY);
 }
 
 void SharedSPIBus::prepareSDCard() {
   deselectSharedSPIDevices();
+  switchHeldDevice(DEVICE_SD);
   digitalWrite(SD_EN, SD_PWD_ON);
   delay(20);
 }
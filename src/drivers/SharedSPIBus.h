@@ -2,10 +2,49 @@
 
 #include <SPI.h>
 
+// 屏幕与 SD 卡共用的 SPI 总线仲裁：整段事务互斥（同一任务可重入），
+// 按设备统计占用时长；音频预读等紧急读取可以让长时间持有总线的
+// 屏幕刷新在安全点（行与行之间、等待 BUSY 期间）临时让出。
 namespace SharedSPIBus {
+constexpr uint32_t WAIT_FOREVER = UINT32_MAX;
+
+enum Device : uint8_t { DEVICE_DISPLAY, DEVICE_SD, DEVICE_COUNT };
+
 SPIClass &bus();
 void begin();
+// 各设备的总线参数：墨水屏 4MHz，SD 卡用更高时钟。两个驱动库都在每次
+// 事务开始时套用自己的参数，切换设备不需要额外重配控制器。
+uint32_t clockFor(Device device);
+SPISettings settingsFor(Device device);
+// 单次连续传输的推荐字节数：SD 预读突发和上传落盘块都按它切分。
+size_t transferSizeFor(Device device);
+// SD 测速得出推荐值后调用。时钟在下一次挂载时生效，传输大小在下一次
+// 打开文件或开始上传时生效。
+void setTuning(Device device, uint32_t clockHz, size_t transferSize);
+// 恢复默认时钟与传输大小：测速开始前和调优时钟挂载失败时调用。
+void resetTuning(Device device);
+// device 只用于占用统计：嵌套取锁时按最内层登记的设备计时，
+// prepareDisplay/prepareSDCard 也会把当前层切到对应设备。
+bool lock(uint32_t timeoutMs = WAIT_FOREVER, Device device = DEVICE_SD);
+// 紧急读取：登记后等待当前持有者在下一个让出点交出总线，最多 timeoutMs。
+bool lockUrgent(uint32_t timeoutMs);
+void unlock();
+// 持有者在不处于 SPI 事务中的安全点调用：有紧急请求等待时完整交出锁
+// （包括重入层数），对方用完后再取回。返回是否发生了让出。
+bool yieldToUrgent();
+bool hasUrgentWaiter();
 void prepareDisplay();
 void prepareSDCard();
 void releaseSDCard();
+
+class Guard {
+public:
+  explicit Guard(uint32_t timeoutMs = WAIT_FOREVER,
+                 Device device = DEVICE_SD);
+  ~Guard();
+  bool isLocked() const;
+
+private:
+  bool locked = false;
+};
 } // namespace SharedSPIBus
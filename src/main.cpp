@@ -11,16 +11,20 @@
 #include "managers/AlarmManager.h"
 #include "managers/ConfigManager.h"
 #include "managers/ConnectionManager.h"
+#include "managers/HttpTransport.h"
+#include "managers/NetworkEvents.h"
 #include "managers/WeatherManager.h"
 #include "ui/UIManager.h"
 #include "utils/HardwareCheck.h"
 #include "utils/I2CBus.h"
+#include "utils/Metrics.h"
 #include "utils/SleepLogger.h"
 #include <Arduino.h>
 #include <driver/gpio.h>
 #include <SPIFFS.h>
 #include <esp_pm.h>
 #include <esp_sleep.h>
+#include <esp_timer.h>
 #include <esp_wifi.h>
 
 // Global Objects
@@ -38,6 +42,9 @@ ConnectionManager connectionManager;
 WeatherManager weatherManager;
 AlarmManager alarmManager;
 MusicManager musicManager(&audioDriver, &sdCardDriver, &configManager);
+#if HTTP_REPLAY_ENABLE
+ReplayHttpTransport replayTransport(SPIFFS);
+#endif
 
 UIManager uiManager(&displayDriver, &rtcDriver, &weatherManager, &sensorDriver,
                     &batteryDriver, &connectionManager, &alarmManager,
@@ -57,6 +64,11 @@ constexpr uint32_t ACTIVE_LOOP_DELAY_MS = 50UL;
 uint32_t g_lastButtonWakeMs = 0;
 uint32_t g_lastUserActivityMs = 0;
 uint32_t g_lastAlarmPlaybackAttemptMs = 0;
+uint32_t g_lastLatencyTrackedTriggerMs = 0;
+uint32_t g_armedAlarmAtMs = 0;
+bool g_alarmStorageHeld = false;
+// 预唤醒铃声到点后，闹钟状态必须在该宽限内跟上，否则视为闹钟已被取消。
+constexpr uint32_t ARMED_ALARM_GRACE_MS = 5000UL;
 
 void startSerialDebug() {
 #if ENABLE_SERIAL_DEBUG
@@ -98,6 +110,8 @@ void initBootDrivers() {
   configManager.begin();
   audioDriver.setVolume(configManager.config.volume);
   Serial.println("Config Manager Init Success");
+  // 首次挂载前套用上次测速推荐的 SD 时钟与传输大小。
+  sdCardDriver.loadBenchmark();
   batteryDriver.begin();
   displayDriver.init();
   displayDriver.clear();
@@ -194,6 +208,12 @@ void initOptionalDrivers() {
 }
 
 void initManagers() {
+#if HTTP_REPLAY_ENABLE
+  // 离线调试：天气和节假日请求改为回放 SPIFFS /replay 下录制的响应。
+  HttpTransportRegistry::set(&replayTransport);
+  Serial.println("HTTP replay transport enabled");
+#endif
+  NetworkEvents::begin();
   connectionManager.begin(&configManager, &rtcDriver);
   Serial.println("Connection Manager Init Success");
   alarmManager.begin(&configManager);
@@ -326,11 +346,16 @@ void handleInputEvents() {
   }
 
   markUserActivity();
-  if (alarmManager.isRinging()) {
+  uiManager.lockSharedState();
+  bool ringing = alarmManager.isRinging();
+  if (ringing) {
     // 关键逻辑：响铃时任意实体按键优先停止闹钟，不能继续分发给当前页面，
     // 否则用户没有可靠的静音入口，按键还可能误触发页面业务操作。
     alarmManager.stop();
     audioDriver.stop();
+  }
+  uiManager.unlockSharedState();
+  if (ringing) {
     return;
   }
   UIKey key = mapButtonEventToUIKey(btn);
@@ -390,7 +415,8 @@ void runScheduledTasks() {
 
 bool canEnterIdleSleep() {
   if (connectionManager.isNetworkEnabled() || alarmManager.isRinging() ||
-      audioDriver.isPlaying() || isButtonHeld() ||
+      audioDriver.isPlaying() || audioDriver.isAlarmArmed() ||
+      isButtonHeld() ||
       isWithinGracePeriod(g_lastButtonWakeMs, BUTTON_WAKE_GRACE_MS) ||
       isWithinGracePeriod(g_lastUserActivityMs, USER_ACTIVITY_GRACE_MS)) {
     return false;
@@ -419,10 +445,19 @@ void idleOrLightSleep() {
   gpio_wakeup_enable((gpio_num_t)KEY_RIGHT, GPIO_INTR_LOW_LEVEL);
   gpio_wakeup_enable((gpio_num_t)KEY_ENTER, GPIO_INTR_LOW_LEVEL);
   esp_sleep_enable_gpio_wakeup();
+  configManager.flushPendingWrites("sleep");
+  // 入睡前不等空闲超时：无人持有的 SD 立即卸载断电，轻睡眠可能持续数十分钟。
+  sdCardDriver.unmountIfIdle(true);
   SleepLogger::logEnterLightSleep();
+  int64_t sleepStartUs = esp_timer_get_time();
   esp_light_sleep_start();
 
   esp_sleep_wakeup_cause_t wakeupCause = esp_sleep_get_wakeup_cause();
+  Metrics::add(Metrics::LIGHT_SLEEP_ENTRIES);
+  Metrics::add(Metrics::LIGHT_SLEEP_MS,
+               static_cast<uint32_t>((esp_timer_get_time() - sleepStartUs) /
+                                     1000));
+  Metrics::recordWakeCause(wakeupCause);
   SleepLogger::logWakeFromLightSleep(wakeupCause);
 
   if (wakeupCause == ESP_SLEEP_WAKEUP_GPIO) {
@@ -440,46 +475,161 @@ void idleOrLightSleep() {
 bool shouldUpdateWeatherWhileOnline(ScreenState state,
                                     bool systemPortalActive);
 
-void networkTask(void *pvParameters) {
-  static uint32_t wifiSessionStart = 0;
+enum NetworkTaskState {
+  NETWORK_TASK_OFF,
+  NETWORK_TASK_CONNECTING,
+  NETWORK_TASK_SYNCING,
+  NETWORK_TASK_HOLDING
+};
 
-  while (true) {
-    uint32_t now = millis();
+namespace {
+constexpr uint32_t NETWORK_ACTIVE_POLL_MS = 500UL;
+constexpr uint32_t NETWORK_WAKE_REPORT_INTERVAL_MS = 3600000UL;
+constexpr uint32_t LEGACY_POLL_WAKES_PER_HOUR =
+    NETWORK_WAKE_REPORT_INTERVAL_MS / NETWORK_ACTIVE_POLL_MS;
+NetworkTaskState g_networkTaskState = NETWORK_TASK_OFF;
+uint32_t g_wifiSessionStartMs = 0;
+uint32_t g_networkWakeWindowStartMs = 0;
+uint32_t g_networkEventWakes = 0;
+uint32_t g_networkPollWakes = 0;
+
+const char *networkTaskStateLabel(NetworkTaskState state) {
+  switch (state) {
+  case NETWORK_TASK_OFF:
+    return "OFF";
+  case NETWORK_TASK_CONNECTING:
+    return "CONNECTING";
+  case NETWORK_TASK_SYNCING:
+    return "SYNCING";
+  case NETWORK_TASK_HOLDING:
+    return "HOLDING";
+  }
+  return "UNKNOWN";
+}
 
-    if (connectionManager.isNetworkEnabled()) {
-      if (wifiSessionStart == 0) {
-        wifiSessionStart = now;
-      }
-      connectionManager.loop();
-      alarmManager.updateHolidayCache(rtcDriver.getSoftwareTime());
-      bool systemPortalActive = connectionManager.isSystemPortalActive();
-
-      if (shouldUpdateWeatherWhileOnline(uiManager.getCurrentState(),
-                                         systemPortalActive)) {
-        weatherManager.update();
-      }
-
-      // 同步完成后关闭 WiFi 以省电
-      // 判断条件：NTP 已同步；在首页/天气页时还要求天气刚更新
-      ScreenState state = uiManager.getCurrentState();
-      bool weatherNeeded = state == SCREEN_HOME || state == SCREEN_CALENDAR ||
-                           state == SCREEN_WEATHER;
-      bool weatherFresh = millis() - weatherManager.getLastUpdate() < 120000;
-      bool settingsVisible = state == SCREEN_SETTINGS;
-      if (!settingsVisible && connectionManager.isSyncComplete() &&
-          (!weatherNeeded || weatherFresh)) {
-        Serial.println("Sync Complete, powering off WiFi...");
-        connectionManager.enableNetwork(false);
-        wifiSessionStart = 0;
-      } else if (!settingsVisible &&
-                 now - wifiSessionStart > WIFI_SYNC_TIMEOUT_MS) {
-        Serial.println("WiFi sync timeout, powering off WiFi...");
-        connectionManager.enableNetwork(false);
-        wifiSessionStart = 0;
-      }
-    }
+void transitionNetworkTask(NetworkTaskState next) {
+  if (g_networkTaskState == next) {
+    return;
+  }
+#if ENABLE_SERIAL_DEBUG
+  Serial.printf("[Network][task] %s -> %s\n",
+                networkTaskStateLabel(g_networkTaskState),
+                networkTaskStateLabel(next));
+#endif
+  g_networkTaskState = next;
+}
+
+void shutdownNetworkSession(const char *reason) {
+  Serial.println(reason);
+  connectionManager.enableNetwork(false);
+  g_wifiSessionStartMs = 0;
+  transitionNetworkTask(NETWORK_TASK_OFF);
+}
+
+TickType_t getNetworkTaskWaitTicks() {
+  // 关键逻辑：WiFi 关闭时没有任何截止时间需要本任务跟踪，
+  // 定时同步由主循环 startScheduledSyncIfDue() 上电后经事件唤醒；
+  // 只有联网期间才需要按固定间隔驱动 WiFiManager 和同步超时。
+  if (g_networkTaskState == NETWORK_TASK_OFF) {
+    return portMAX_DELAY;
+  }
+  return pdMS_TO_TICKS(NETWORK_ACTIVE_POLL_MS);
+}
+
+EventBits_t getNetworkTaskWaitMask() {
+  // WiFi 关闭时切页和 WiFi 事件都不需要处理，只等待上电事件；
+  // 未命中的位保留在事件组里，上电后一并消费。
+  return g_networkTaskState == NETWORK_TASK_OFF ? NetworkEvents::POWER_ON
+                                                : NetworkEvents::ALL;
+}
+
+void recordNetworkTaskWake(EventBits_t bits, uint32_t now) {
+  if (bits != 0) {
+    g_networkEventWakes++;
+  } else {
+    g_networkPollWakes++;
+  }
+
+  if (g_networkWakeWindowStartMs == 0) {
+    g_networkWakeWindowStartMs = now;
+    return;
+  }
+  uint32_t elapsed = now - g_networkWakeWindowStartMs;
+  if (elapsed < NETWORK_WAKE_REPORT_INTERVAL_MS) {
+    return;
+  }
+#if ENABLE_SERIAL_DEBUG
+  // 旧实现固定 500ms 轮询，每小时唤醒次数恒为 LEGACY_POLL_WAKES_PER_HOUR。
+  uint32_t wakes = g_networkEventWakes + g_networkPollWakes;
+  Serial.printf("[Network][task] wakeups=%lu/%lus event=%lu poll=%lu "
+                "legacy=%lu/h\n",
+                static_cast<unsigned long>(wakes),
+                static_cast<unsigned long>(elapsed / 1000UL),
+                static_cast<unsigned long>(g_networkEventWakes),
+                static_cast<unsigned long>(g_networkPollWakes),
+                static_cast<unsigned long>(LEGACY_POLL_WAKES_PER_HOUR));
+#endif
+  g_networkWakeWindowStartMs = now;
+  g_networkEventWakes = 0;
+  g_networkPollWakes = 0;
+}
+
+void runNetworkTaskStep(uint32_t now) {
+  if (!connectionManager.isNetworkEnabled()) {
+    g_wifiSessionStartMs = 0;
+    transitionNetworkTask(NETWORK_TASK_OFF);
+    return;
+  }
+
+  if (g_networkTaskState == NETWORK_TASK_OFF) {
+    g_wifiSessionStartMs = now;
+    transitionNetworkTask(NETWORK_TASK_CONNECTING);
+  }
+
+  connectionManager.loop();
+  alarmManager.updateHolidayCache(rtcDriver.getSoftwareTime());
+  bool systemPortalActive = connectionManager.isSystemPortalActive();
 
-    vTaskDelay(pdMS_TO_TICKS(500)); // 增加延迟，降低轮询开销
+  if (shouldUpdateWeatherWhileOnline(uiManager.getCurrentState(),
+                                     systemPortalActive)) {
+    weatherManager.update();
+  }
+
+  // 同步完成后关闭 WiFi 以省电
+  // 判断条件：NTP 已同步；在首页/天气页时还要求天气刚更新
+  ScreenState state = uiManager.getCurrentState();
+  if (state == SCREEN_SETTINGS) {
+    // 设置页可能在配网或上传文件，保持联网且不计超时。
+    transitionNetworkTask(NETWORK_TASK_HOLDING);
+    return;
+  }
+
+  bool weatherNeeded = state == SCREEN_HOME || state == SCREEN_CALENDAR ||
+                       state == SCREEN_WEATHER;
+  bool weatherFresh = millis() - weatherManager.getLastUpdate() < 120000;
+  if (connectionManager.isSyncComplete() &&
+      (!weatherNeeded || weatherFresh)) {
+    shutdownNetworkSession("Sync Complete, powering off WiFi...");
+    return;
+  }
+  if (now - g_wifiSessionStartMs > WIFI_SYNC_TIMEOUT_MS) {
+    shutdownNetworkSession("WiFi sync timeout, powering off WiFi...");
+    return;
+  }
+
+  transitionNetworkTask(connectionManager.isConnected()
+                            ? NETWORK_TASK_SYNCING
+                            : NETWORK_TASK_CONNECTING);
+}
+} // namespace
+
+void networkTask(void *pvParameters) {
+  while (true) {
+    EventBits_t bits =
+        NetworkEvents::wait(getNetworkTaskWaitMask(), getNetworkTaskWaitTicks());
+    uint32_t now = millis();
+    recordNetworkTaskWake(bits, now);
+    runNetworkTaskStep(now);
   }
 }
 
@@ -494,8 +644,25 @@ bool shouldUpdateWeatherWhileOnline(ScreenState state,
          (systemPortalActive && state == SCREEN_SETTINGS);
 }
 
+// 铃声在 SD 上时持有一次挂载引用，直到响铃与预唤醒都结束。
+bool acquireAlarmStorage() {
+  if (!g_alarmStorageHeld) {
+    g_alarmStorageHeld = sdCardDriver.acquire();
+  }
+  return g_alarmStorageHeld;
+}
+
+void releaseAlarmStorage() {
+  if (g_alarmStorageHeld) {
+    g_alarmStorageHeld = false;
+    sdCardDriver.release();
+  }
+}
+
 void manageAudioPower(ScreenState state) {
-  if (alarmManager.isRinging() || audioDriver.isPlaying()) {
+  sdCardDriver.unmountIfIdle();
+  if (alarmManager.isRinging() || audioDriver.isPlaying() ||
+      audioDriver.isAlarmArmed()) {
     digitalWrite(CODEC_EN, HIGH);
     return;
   }
@@ -507,10 +674,10 @@ void manageAudioPower(ScreenState state) {
   // 关键逻辑：audioDriver.end() 会关闭 AMP_EN 和共享 I2C 电源域。
   // 收音机使用同一个功放和 I2C 总线，不能在收音机页把它当作闲置音频关闭。
   audioDriver.end();
-  // 系统配置页可能正在分块上传文件，不能在每次主循环末尾关闭 SD。
-  if (!connectionManager.isSystemPortalActive()) {
-    sdCardDriver.end();
-  }
+  // 只交还本模块持有的挂载引用；Web 上传等其他会话仍在时卡保持挂载，
+  // 全部释放后由空闲超时统一卸载。
+  musicManager.releaseStorage();
+  releaseAlarmStorage();
 }
 
 void manageRadioPower(ScreenState state) {
@@ -521,6 +688,70 @@ void manageRadioPower(ScreenState state) {
   digitalWrite(RADIO_EN, LOW);
 }
 
+// 解析铃声来源：SD 铃声缺失时退回 SPIFFS。
+bool resolveAlarmRingtone(const String &ringtone, fs::FS *&fs, String &path) {
+  if (ringtone.startsWith("sd:")) {
+    path = ringtone.substring(3);
+    if (acquireAlarmStorage() && sdCardDriver.exists(path.c_str())) {
+      fs = &SD;
+      return true;
+    }
+  }
+
+  path = ringtone.startsWith("spiffs:") ? ringtone.substring(7)
+                                        : "/alarm.mp3";
+  if (SPIFFS.exists(path)) {
+    fs = &SPIFFS;
+    return true;
+  }
+  Serial.printf("Alarm ringtone not found: %s\n", ringtone.c_str());
+  return false;
+}
+
+void prepareUpcomingAlarm() {
+  String ringtone;
+  uint32_t triggerAtMs = 0;
+  if (!alarmManager.takePreWake(rtcDriver.getSoftwareTime(), millis(),
+                                ringtone, triggerAtMs)) {
+    return;
+  }
+  // 正在播放音乐时不提前抢占，到点后走原有的响铃路径。
+  if (audioDriver.isPlaying()) {
+    return;
+  }
+  fs::FS *fs = nullptr;
+  String path;
+  if (!resolveAlarmRingtone(ringtone, fs, path) ||
+      !audioDriver.armAlarm(*fs, path.c_str(), triggerAtMs)) {
+    return;
+  }
+  g_armedAlarmAtMs = triggerAtMs;
+  Serial.printf("[Alarm][prewake] %s armed %lums ahead\n", path.c_str(),
+                static_cast<unsigned long>(triggerAtMs - millis()));
+}
+
+void syncArmedAlarm() {
+  if (!audioDriver.isAlarmArmed()) {
+    return;
+  }
+  uint32_t now = millis();
+  if (static_cast<int32_t>(now - g_armedAlarmAtMs) < 0) {
+    return;
+  }
+  // 关键逻辑：音频任务已按时开始输出，这里立即对齐响铃状态，
+  // 让任意按键都能停止铃声，而不是等下一次 1 秒节流的检查。
+  alarmManager.check(rtcDriver.getTime(), true);
+  if (alarmManager.isRinging()) {
+    g_lastLatencyTrackedTriggerMs = alarmManager.getTriggeredAtMs();
+    audioDriver.releaseAlarmArm();
+    return;
+  }
+  if (now - g_armedAlarmAtMs > ARMED_ALARM_GRACE_MS) {
+    Serial.println("[Alarm][prewake] alarm no longer due, ringtone stopped");
+    audioDriver.stop();
+  }
+}
+
 void playConfiguredAlarm() {
   uint32_t now = millis();
   if (g_lastAlarmPlaybackAttemptMs != 0 &&
@@ -529,22 +760,18 @@ void playConfiguredAlarm() {
   }
   g_lastAlarmPlaybackAttemptMs = now;
 
-  String ringtone = alarmManager.getActiveRingtone();
-  if (ringtone.startsWith("sd:")) {
-    String path = ringtone.substring(3);
-    if (sdCardDriver.begin() && sdCardDriver.exists(path.c_str())) {
-      audioDriver.playFromSD(path.c_str());
-      return;
-    }
-  }
-
-  String path = ringtone.startsWith("spiffs:") ? ringtone.substring(7)
-                                               : "/alarm.mp3";
-  if (SPIFFS.exists(path)) {
-    audioDriver.playFromFS(SPIFFS, path.c_str());
+  fs::FS *fs = nullptr;
+  String path;
+  if (!resolveAlarmRingtone(alarmManager.getActiveRingtone(), fs, path)) {
     return;
   }
-  Serial.printf("Alarm ringtone not found: %s\n", ringtone.c_str());
+  audioDriver.playFromFS(*fs, path.c_str());
+  // 未经预唤醒的冷启动路径同样统计延迟；铃声循环重播不重复计数。
+  uint32_t triggeredAtMs = alarmManager.getTriggeredAtMs();
+  if (triggeredAtMs != g_lastLatencyTrackedTriggerMs) {
+    g_lastLatencyTrackedTriggerMs = triggeredAtMs;
+    audioDriver.trackStartLatency(triggeredAtMs);
+  }
 }
 
 void setup() {
@@ -567,29 +794,37 @@ void setup() {
 void loop() {
   uint32_t t_start = millis();
 
+  // 关键逻辑：系统设置页的 Web 接口在独立任务中修改闹钟/待办/配置，
+  // 主循环只在处理这些状态的业务步骤期间持有共享状态锁。刷屏动辄数秒，
+  // 页面在 UIManager 里于锁内拷出要画的状态后再画，不占着锁刷屏。
+  uiManager.lockSharedState();
+  prepareUpcomingAlarm();
+  syncArmedAlarm();
   runScheduledTasks();
   connectionManager.flushPendingRtcSync();
+  uiManager.unlockSharedState();
 
   t_start = millis();
   uiManager.update();
   // Serial.printf("UI update: %ums\n", millis() - t_start);
 
-  t_start = millis();
-  audioDriver.loop(); // For audio processing
-  // Serial.printf("Audio loop: %ums\n", millis() - t_start);
-
+  uiManager.lockSharedState();
   if (alarmManager.isRinging()) {
     if (!audioDriver.isPlaying()) {
       playConfiguredAlarm();
     }
   }
+  uiManager.unlockSharedState();
 
   handleInputEvents();
   // Serial.printf("Input loop: %ums\n", millis() - t_start);
 
+  uiManager.lockSharedState();
   ScreenState currentState = uiManager.getCurrentState();
   manageAudioPower(currentState);
   manageRadioPower(currentState);
+  configManager.flushIfQuiet(millis());
+  uiManager.unlockSharedState();
 
   idleOrLightSleep();
 }
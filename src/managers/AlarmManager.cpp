@@ -10,6 +10,8 @@ AlarmManager::AlarmManager() {
   ringing = false;
   prefsReady = false;
   lastCheck = 0;
+  preWakeMinuteKey = 0;
+  triggeredAtMs = 0;
 }
 
 void AlarmManager::begin(ConfigManager *config) {
@@ -41,8 +43,8 @@ AlarmConfig AlarmManager::buildDefaultAlarm() const {
   return alarm;
 }
 
-void AlarmManager::check(const DateTime &now) {
-  if (millis() - lastCheck < CHECK_INTERVAL_MS || ringing) {
+void AlarmManager::check(const DateTime &now, bool force) {
+  if ((!force && millis() - lastCheck < CHECK_INTERVAL_MS) || ringing) {
     return;
   }
   lastCheck = millis();
@@ -63,6 +65,7 @@ void AlarmManager::check(const DateTime &now) {
     // 关键逻辑：用“分钟级时间戳”去重，确保同一分钟内多次唤醒、
     // 或者页面刷新重复调用 check() 时，不会把同一个闹钟连响多次。
     ringing = true;
+    triggeredAtMs = millis();
     activeRingtone = alarm.ringtone;
     alarm.lastTriggeredMinuteKey = currentMinuteKey;
     return;
@@ -101,6 +104,42 @@ uint32_t AlarmManager::getNextWakeDelayMs(const DateTime &now, uint32_t nowMs) {
   }
 
   time_t nowTime = toTimeT(now);
+  size_t alarmIndex = 0;
+  time_t bestWakeTime = findNextTriggerTime(nowTime, alarmIndex);
+  if (bestWakeTime == 0) {
+    return UINT32_MAX;
+  }
+
+  // 提前醒来给音频通路上电、预读铃声，闹钟时刻只需开始输出。
+  uint32_t delayMs = getMsUntil(bestWakeTime, nowTime, nowMs);
+  return delayMs > PRE_WAKE_LEAD_MS ? delayMs - PRE_WAKE_LEAD_MS : 0;
+}
+
+bool AlarmManager::takePreWake(const DateTime &now, uint32_t nowMs,
+                               String &ringtone, uint32_t &triggerAtMs) {
+  if (ringing || !hasEnabledAlarms()) {
+    return false;
+  }
+  time_t nowTime = toTimeT(now);
+  size_t alarmIndex = 0;
+  time_t triggerTime = findNextTriggerTime(nowTime, alarmIndex);
+  if (triggerTime == 0) {
+    return false;
+  }
+  uint32_t delayMs = getMsUntil(triggerTime, nowTime, nowMs);
+  uint32_t minuteKey = toMinuteKey(toDateTime(triggerTime));
+  if (delayMs > PRE_WAKE_LEAD_MS || minuteKey == preWakeMinuteKey) {
+    return false;
+  }
+  preWakeMinuteKey = minuteKey;
+  ringtone = alarms[alarmIndex].ringtone.length() > 0
+                 ? alarms[alarmIndex].ringtone
+                 : String("spiffs:/alarm.mp3");
+  triggerAtMs = nowMs + delayMs;
+  return true;
+}
+
+time_t AlarmManager::findNextTriggerTime(time_t nowTime, size_t &alarmIndex) {
   time_t bestWakeTime = 0;
   for (size_t i = 0; i < alarms.size(); ++i) {
     if (!alarms[i].enabled) {
@@ -112,14 +151,15 @@ uint32_t AlarmManager::getNextWakeDelayMs(const DateTime &now, uint32_t nowMs) {
     }
     if (bestWakeTime == 0 || candidateTime < bestWakeTime) {
       bestWakeTime = candidateTime;
+      alarmIndex = i;
     }
   }
+  return bestWakeTime;
+}
 
-  if (bestWakeTime == 0) {
-    return UINT32_MAX;
-  }
-
-  uint32_t delaySeconds = static_cast<uint32_t>(bestWakeTime - nowTime);
+uint32_t AlarmManager::getMsUntil(time_t when, time_t nowTime,
+                                  uint32_t nowMs) const {
+  uint32_t delaySeconds = static_cast<uint32_t>(when - nowTime);
   return (delaySeconds - 1) * 1000UL +
          WakeTiming::getMsUntilNextSecondBoundary(nowMs);
 }
@@ -223,13 +263,23 @@ String AlarmManager::getAlarmsJSON() const {
 bool AlarmManager::saveAlarmsFromJSON(const String &json) {
   JsonDocument doc;
   DeserializationError error = deserializeJson(doc, json);
-  if (error || !doc.is<JsonArray>() || doc.size() > 20) {
+  if (error || !doc.is<JsonArray>()) {
     Serial.printf("Alarm config parse failed: %s\n", error.c_str());
     return false;
   }
 
   std::vector<AlarmConfig> updated;
-  for (JsonObject item : doc.as<JsonArray>()) {
+  return parseAlarmsJSON(doc.as<JsonArray>(), updated) &&
+         applyAlarms(updated);
+}
+
+bool AlarmManager::parseAlarmsJSON(JsonArray items,
+                                   std::vector<AlarmConfig> &updated) const {
+  updated.clear();
+  if (items.size() > 20) {
+    return false;
+  }
+  for (JsonObject item : items) {
     AlarmConfig alarm;
     int hour = item["h"] | -1;
     int minute = item["m"] | -1;
@@ -252,7 +302,10 @@ bool AlarmManager::saveAlarmsFromJSON(const String &json) {
     alarm.ringtone = ringtone;
     updated.push_back(sanitizeAlarm(alarm));
   }
+  return true;
+}
 
+bool AlarmManager::applyAlarms(const std::vector<AlarmConfig> &updated) {
   std::vector<AlarmConfig> previous = alarms;
   alarms = updated;
   if (save()) {
@@ -4,6 +4,7 @@
 #include "AlarmTypes.h"
 #include "ConfigManager.h"
 #include "HolidayCalendar.h"
+#include <ArduinoJson.h>
 #include <Preferences.h>
 #include <vector>
 
@@ -14,7 +15,8 @@ public:
   void begin(ConfigManager *config);
   bool addAlarm(const AlarmConfig &alarm);
   AlarmConfig buildDefaultAlarm() const;
-  void check(const DateTime &now);
+  // force 跳过 1 秒节流，用于预唤醒后在触发时刻立即对齐响铃状态。
+  void check(const DateTime &now, bool force = false);
   HolidayDayType getHolidayDayType(const DateTime &date);
   String getHolidayName(const DateTime &date);
   HolidayCountdown getNextHolidayCountdown(const DateTime &date,
@@ -22,7 +24,14 @@ public:
   String getHolidayStatusText(uint16_t fullYear) const;
   AlarmConfig getAlarm(size_t index) const;
   size_t getAlarmCount() const;
+  // 已扣除预唤醒提前量，供轻睡眠计算唤醒时间。
   uint32_t getNextWakeDelayMs(const DateTime &now, uint32_t nowMs);
+  // 下一个闹钟进入预唤醒窗口时返回 true（每次闹钟只返回一次），
+  // 给出铃声和 millis 时基下的触发时刻，调用方据此提前准备音频通路。
+  bool takePreWake(const DateTime &now, uint32_t nowMs, String &ringtone,
+                   uint32_t &triggerAtMs);
+  // 最近一次开始响铃的 millis 时刻，用于统计触发到出声的延迟。
+  uint32_t getTriggeredAtMs() const { return triggeredAtMs; }
   String getRepeatText(const AlarmConfig &alarm) const;
   bool hasEnabledAlarms() const;
   bool isRinging() const;
@@ -35,11 +44,16 @@ public:
   String getActiveRingtone() const;
   String getAlarmsJSON() const;
   bool saveAlarmsFromJSON(const String &json);
+  bool parseAlarmsJSON(JsonArray items,
+                       std::vector<AlarmConfig> &updated) const;
+  bool applyAlarms(const std::vector<AlarmConfig> &updated);
+  const std::vector<AlarmConfig> &getAlarmConfigs() const { return alarms; }
   void resetHolidayFetchState();
 
 private:
   static const uint32_t CHECK_INTERVAL_MS = 1000UL;
   static const uint8_t LOOKAHEAD_DAYS = 31;
+  static const uint32_t PRE_WAKE_LEAD_MS = 5000UL;
 
   std::vector<AlarmConfig> alarms;
   HolidayCalendar holidayCalendar;
@@ -48,11 +62,15 @@ private:
   bool prefsReady;
   uint32_t lastCheck;
   String activeRingtone;
+  uint32_t preWakeMinuteKey;
+  uint32_t triggeredAtMs;
 
   AlarmRepeatType inferRepeatType(uint8_t weekMask) const;
   AlarmConfig sanitizeAlarm(const AlarmConfig &alarm) const;
   String buildWeeklyText(uint8_t weekMask) const;
   time_t findNextAlarmTime(const AlarmConfig &alarm, time_t nowTime);
+  time_t findNextTriggerTime(time_t nowTime, size_t &alarmIndex);
+  uint32_t getMsUntil(time_t when, time_t nowTime, uint32_t nowMs) const;
   bool isIndexValid(size_t index) const;
   bool matchesDate(const AlarmConfig &alarm, const DateTime &date);
   DateTime toDateTime(time_t value) const;
@@ -1,4 +1,16 @@
 #include "ConfigManager.h"
+#include "../utils/Metrics.h"
+#include <esp_system.h>
+#include <memory>
+#include <new>
+
+namespace {
+constexpr const char *RADIO_BLOB_KEY = "radio_blob";
+constexpr uint32_t DEFERRED_WRITE_QUIET_MS = 3000;
+constexpr uint32_t FLUSH_LOCK_TIMEOUT_MS = 200;
+} // namespace
+
+ConfigManager *ConfigManager::shutdownInstance = nullptr;
 
 ConfigManager::ConfigManager() {
   // Defaults
@@ -12,11 +24,7 @@ ConfigManager::ConfigManager() {
   config.radio_soft_mute = true;
   config.hw_checked = false;
   config.hw_check_version = 0;
-  for (int i = 0; i < RADIO_PRESET_COUNT; i++) {
-    config.radio_presets[i] = 0;
-    config.radio_alias_frequencies[i] = 0;
-    config.radio_names[i] = "";
-  }
+  radioStore.clear();
 }
 
 void ConfigManager::begin() {
@@ -25,9 +33,15 @@ void ConfigManager::begin() {
   }
   prefsReady = prefs.begin("clock_cfg", false);
   load();
+  // esp_restart 前补写仍在静默期内的修改，避免重启丢掉最后一次调整。
+  if (shutdownInstance == nullptr) {
+    shutdownInstance = this;
+    esp_register_shutdown_handler(flushOnShutdown);
+  }
 }
 
 void ConfigManager::load() {
+  uint32_t startUs = micros();
   lockConfig();
   config.volume = prefs.getUChar("vol", 10);
   config.radio_focus_index = prefs.getUChar("radio_focus", 0);
@@ -41,64 +55,223 @@ void ConfigManager::load() {
   config.holiday_api_token = prefs.getString("holiday_token", "");
   config.hw_checked = prefs.getBool("hwck", false);
   config.hw_check_version = prefs.getUChar("hwv", 0);
-  for (int i = 0; i < RADIO_PRESET_COUNT; i++) {
-    char key[16];
-    snprintf(key, sizeof(key), "radio_p%d", i);
-    config.radio_presets[i] = prefs.getUShort(key, 0);
-    snprintf(key, sizeof(key), "radio_n%d", i);
-    config.radio_names[i] = prefs.getString(key, "");
-    snprintf(key, sizeof(key), "radio_a%d", i);
-    config.radio_alias_frequencies[i] =
-        prefs.getUShort(key, config.radio_names[i].length() > 0
-                                ? config.radio_presets[i]
-                                : 0);
+  persistedVolume = config.volume;
+  persistedRadioFocus = config.radio_focus_index;
+  persistedRadioPage = config.radio_preset_page;
+  dirtyKeys = 0;
+  requestedWrites = 0;
+  radioStoreLoaded = false;
+  unlockConfig();
+  Serial.printf("[Config][load] us=%lu config=%uB radioStore=%uB\n",
+                static_cast<unsigned long>(micros() - startUs),
+                static_cast<unsigned>(sizeof(AppConfig)),
+                static_cast<unsigned>(sizeof(RadioPresetStore)));
+}
+
+String ConfigManager::getRadioName(uint16_t frequency) {
+  String name;
+  lockConfig();
+  ensureRadioStoreLocked();
+  radioStore.findName(frequency, name);
+  unlockConfig();
+  return name;
+}
+
+uint16_t ConfigManager::getRadioPreset(uint8_t index) {
+  lockConfig();
+  ensureRadioStoreLocked();
+  uint16_t frequency = radioStore.getPreset(index);
+  unlockConfig();
+  return frequency;
+}
+
+bool ConfigManager::saveRadioPresets(const uint16_t *stations,
+                                     uint8_t count) {
+  lockConfig();
+  ensureRadioStoreLocked();
+  for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+    radioStore.setPreset(i, i < count ? stations[i] : 0);
   }
+  markDirtyLocked(DIRTY_RADIO_PRESETS, 1);
+  unlockConfig();
+  return true;
+}
+
+void ConfigManager::getRadioSettings(RadioSettings &settings) {
+  lockConfig();
+  ensureRadioStoreLocked();
+  settings.seekStep = config.radio_seek_step;
+  settings.seekThreshold = config.radio_seek_threshold;
+  settings.bassBoost = config.radio_bass_boost;
+  settings.forceMono = config.radio_force_mono;
+  settings.softMute = config.radio_soft_mute;
+  settings.names = radioStore;
   unlockConfig();
 }
 
-String ConfigManager::getRadioName(uint16_t frequency) const {
+bool ConfigManager::applyRadioSettings(const RadioSettings &settings,
+                                       bool &restored) {
+  restored = true;
+  std::unique_ptr<RadioSettings> previous(new (std::nothrow) RadioSettings);
+  if (!previous) {
+    Serial.println("[Config][radio] no memory for rollback copy");
+    return false;
+  }
   lockConfig();
-  for (int i = 0; i < RADIO_PRESET_COUNT; ++i) {
-    if (config.radio_alias_frequencies[i] == frequency &&
-        config.radio_names[i].length() > 0) {
-      String name = config.radio_names[i];
-      unlockConfig();
-      return name;
+  ensureRadioStoreLocked();
+  previous->seekStep = config.radio_seek_step;
+  previous->seekThreshold = config.radio_seek_threshold;
+  previous->bassBoost = config.radio_bass_boost;
+  previous->forceMono = config.radio_force_mono;
+  previous->softMute = config.radio_soft_mute;
+  previous->names = radioStore;
+  auto copyToConfig = [this](const RadioSettings &source) {
+    config.radio_seek_step = source.seekStep;
+    config.radio_seek_threshold = source.seekThreshold;
+    config.radio_bass_boost = source.bassBoost;
+    config.radio_force_mono = source.forceMono;
+    config.radio_soft_mute = source.softMute;
+    // 副本只用于台名，预设频率以当前值为准，避免覆盖期间的扫台结果。
+    uint16_t presets[RADIO_PRESET_COUNT];
+    for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+      presets[i] = radioStore.getPreset(i);
+    }
+    radioStore = source.names;
+    for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+      radioStore.setPreset(i, presets[i]);
     }
+  };
+  copyToConfig(settings);
+  bool saved = saveRadioScalarsLocked() && saveRadioStoreLocked();
+  if (!saved) {
+    // 关键逻辑：NVS 每次 put 都会立即提交，写到一半失败时把内存和
+    // 已写入的键一起恢复为旧值，避免重启后读到新旧混合的电台配置。
+    copyToConfig(*previous);
+    restored = saveRadioScalarsLocked() && saveRadioStoreLocked();
+    Serial.printf("[Config][radio] save failed, restored=%d\n", restored);
   }
   unlockConfig();
-  return "";
+  return saved;
 }
 
-bool ConfigManager::setRadioName(uint16_t frequency, const String &name) {
-  lockConfig();
-  int emptyIndex = -1;
-  for (int i = 0; i < RADIO_PRESET_COUNT; ++i) {
-    if (config.radio_alias_frequencies[i] == frequency) {
-      config.radio_names[i] = name;
-      if (name.length() == 0) {
-        config.radio_alias_frequencies[i] = 0;
-      }
-      unlockConfig();
-      return true;
+bool ConfigManager::assignRadioName(RadioSettings &settings,
+                                    uint16_t frequency, const String &name) {
+  return settings.names.assignName(frequency, name);
+}
+
+void ConfigManager::ensureRadioStoreLocked() {
+  if (radioStoreLoaded) {
+    return;
+  }
+  radioStoreLoaded = true;
+  uint32_t startUs = micros();
+  size_t length = prefsReady ? prefs.getBytesLength(RADIO_BLOB_KEY) : 0;
+  bool loaded = length > 0 && length <= radioStore.capacity() &&
+                prefs.getBytes(RADIO_BLOB_KEY, radioStore.raw(), length) ==
+                    length &&
+                radioStore.decode(length);
+  const char *source = "blob";
+  if (!loaded) {
+    radioStore.clear();
+    if (length > 0) {
+      Serial.println("[Config][radio] blob invalid, presets reset");
     }
-    if (emptyIndex < 0 && config.radio_alias_frequencies[i] == 0) {
-      emptyIndex = i;
+    source = migrateLegacyRadioKeysLocked() ? "legacy" : "empty";
+  }
+  Serial.printf("[Config][radio] source=%s us=%lu bytes=%u names=%u "
+                "arena=%u/%u\n",
+                source, static_cast<unsigned long>(micros() - startUs),
+                static_cast<unsigned>(length), radioStore.getNameCount(),
+                radioStore.getArenaUsed(),
+                static_cast<unsigned>(RadioPresetStore::ARENA_SIZE));
+}
+
+bool ConfigManager::migrateLegacyRadioKeysLocked() {
+  if (!prefsReady || !prefs.isKey("radio_p0")) {
+    return false;
+  }
+  // 旧版本每个槽位各占 radio_p/radio_n/radio_a 三个键，首次访问时
+  // 读入紧凑存储并写成单个 blob，写入成功后再删除旧键。
+  bool complete = true;
+  for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+    char key[16];
+    snprintf(key, sizeof(key), "radio_p%u", i);
+    uint16_t preset = prefs.getUShort(key, 0);
+    radioStore.setPreset(i, preset);
+    snprintf(key, sizeof(key), "radio_n%u", i);
+    String name = prefs.getString(key, "");
+    snprintf(key, sizeof(key), "radio_a%u", i);
+    uint16_t alias = prefs.getUShort(key, name.length() > 0 ? preset : 0);
+    if (alias != 0 && name.length() > 0 &&
+        !radioStore.assignName(alias, name)) {
+      Serial.printf("[Config][radio] legacy name rejected freq=%u bytes=%u\n",
+                    alias, static_cast<unsigned>(name.length()));
+      complete = false;
     }
   }
-  if (emptyIndex >= 0 && name.length() > 0) {
-    config.radio_alias_frequencies[emptyIndex] = frequency;
-    config.radio_names[emptyIndex] = name;
-    unlockConfig();
+  // 关键逻辑：任何一个台名没能放进紧凑存储都放弃迁移，不写 blob 也不删
+  // 旧键，下次开机仍从旧键完整读取；本次运行先用已读入的部分。
+  if (!complete) {
+    Serial.println("[Config][radio] legacy migration aborted, keys kept");
     return true;
   }
-  unlockConfig();
-  return name.length() == 0;
+  if (!saveRadioStoreLocked()) {
+    return true;
+  }
+  for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+    char key[16];
+    snprintf(key, sizeof(key), "radio_p%u", i);
+    prefs.remove(key);
+    snprintf(key, sizeof(key), "radio_n%u", i);
+    prefs.remove(key);
+    snprintf(key, sizeof(key), "radio_a%u", i);
+    prefs.remove(key);
+  }
+  return true;
+}
+
+bool ConfigManager::saveRadioStoreLocked() {
+  if (!prefsReady) {
+    return false;
+  }
+  size_t length = radioStore.encode();
+  if (prefs.putBytes(RADIO_BLOB_KEY, radioStore.raw(), length) != length) {
+    // 写入失败保留脏标记，下一次落盘重试。
+    Serial.println("[Config][flush] radio blob write failed");
+    return false;
+  }
+  Metrics::add(Metrics::NVS_WRITES);
+  // 整个 blob 已包含最新预设，之前延迟的预设写入随之完成。
+  dirtyKeys &= ~DIRTY_RADIO_PRESETS;
+  return true;
+}
+
+bool ConfigManager::saveRadioScalarsLocked() {
+  // 只统计真正写入成功的键，失败的 put 不计入 NVS 写次数。
+  uint32_t writes = 0;
+  auto written = [&writes](size_t length) {
+    if (length == 0) {
+      return false;
+    }
+    ++writes;
+    return true;
+  };
+  bool saved = written(prefs.putUShort("radio_step", config.radio_seek_step));
+  saved = written(prefs.putUChar("radio_th", config.radio_seek_threshold)) &&
+          saved;
+  saved = written(prefs.putBool("radio_bass", config.radio_bass_boost)) &&
+          saved;
+  saved = written(prefs.putBool("radio_mono", config.radio_force_mono)) &&
+          saved;
+  saved = written(prefs.putBool("radio_soft", config.radio_soft_mute)) &&
+          saved;
+  Metrics::add(Metrics::NVS_WRITES, writes);
+  return saved;
 }
 
 void ConfigManager::saveVolume() {
   lockConfig();
-  prefs.putUChar("vol", config.volume);
+  markDirtyLocked(DIRTY_VOLUME, 1);
   unlockConfig();
 }
 
@@ -106,48 +279,112 @@ void ConfigManager::saveHardwareCheck() {
   lockConfig();
   prefs.putBool("hwck", config.hw_checked);
   prefs.putUChar("hwv", config.hw_check_version);
+  Metrics::add(Metrics::NVS_WRITES, 2);
   unlockConfig();
 }
 
 void ConfigManager::saveRadioUiState() {
   lockConfig();
-  prefs.putUChar("radio_focus", config.radio_focus_index);
-  prefs.putUChar("radio_page", config.radio_preset_page);
+  markDirtyLocked(DIRTY_RADIO_UI, 2);
   unlockConfig();
 }
 
-void ConfigManager::saveRadioPresets() {
+void ConfigManager::flushIfQuiet(uint32_t now) {
   lockConfig();
-  for (int i = 0; i < RADIO_PRESET_COUNT; ++i) {
-    char key[16];
-    snprintf(key, sizeof(key), "radio_p%d", i);
-    prefs.putUShort(key, config.radio_presets[i]);
-  }
+  bool due = dirtyKeys != 0 && now - lastDirtyMs >= DEFERRED_WRITE_QUIET_MS;
   unlockConfig();
+  if (due) {
+    flushPendingWrites("quiet");
+  }
 }
 
-bool ConfigManager::saveRadioConfiguration() {
-  lockConfig();
-  bool saved = prefs.putUShort("radio_step", config.radio_seek_step) > 0;
-  saved = (prefs.putUChar("radio_th", config.radio_seek_threshold) > 0) &&
-          saved;
-  saved = (prefs.putBool("radio_bass", config.radio_bass_boost) > 0) &&
-          saved;
-  saved = (prefs.putBool("radio_mono", config.radio_force_mono) > 0) &&
-          saved;
-  saved = (prefs.putBool("radio_soft", config.radio_soft_mute) > 0) &&
-          saved;
-  for (int i = 0; i < RADIO_PRESET_COUNT; ++i) {
-    char key[16];
-    snprintf(key, sizeof(key), "radio_a%d", i);
-    saved =
-        (prefs.putUShort(key, config.radio_alias_frequencies[i]) > 0) && saved;
-    snprintf(key, sizeof(key), "radio_n%d", i);
-    size_t written = prefs.putString(key, config.radio_names[i]);
-    saved = (config.radio_names[i].length() == 0 || written > 0) && saved;
+void ConfigManager::flushPendingWrites(const char *reason) {
+  // 关键逻辑：入睡前和关机回调里不能无限等锁，持锁方若已停住会把整个
+  // 关机流程卡死；等不到就放弃本次落盘，脏标记原样保留。
+  if (!tryLockConfig(FLUSH_LOCK_TIMEOUT_MS)) {
+    Serial.printf("[Config][flush] reason=%s skipped, config busy\n", reason);
+    return;
+  }
+  if (dirtyKeys == 0) {
+    unlockConfig();
+    return;
+  }
+  // 关键逻辑：静默期内的多次修改只落盘最终值，且与上次写入值相同的键
+  // 直接跳过；NVS 每次 put 都会擦写 flash 页，这里是省写次数的关键。
+  // 只有确认写入成功的键才清除脏标记并计数，失败的留到下一次重试。
+  uint32_t writes = 0;
+  uint32_t failedWrites = 0;
+  uint8_t failedKeys = 0;
+  if ((dirtyKeys & DIRTY_VOLUME) && config.volume != persistedVolume) {
+    if (prefs.putUChar("vol", config.volume) == sizeof(uint8_t)) {
+      persistedVolume = config.volume;
+      ++writes;
+    } else {
+      failedKeys |= DIRTY_VOLUME;
+      ++failedWrites;
+    }
+  }
+  if ((dirtyKeys & DIRTY_RADIO_UI) &&
+      config.radio_focus_index != persistedRadioFocus) {
+    if (prefs.putUChar("radio_focus", config.radio_focus_index) ==
+        sizeof(uint8_t)) {
+      persistedRadioFocus = config.radio_focus_index;
+      ++writes;
+    } else {
+      failedKeys |= DIRTY_RADIO_UI;
+      ++failedWrites;
+    }
+  }
+  if ((dirtyKeys & DIRTY_RADIO_UI) &&
+      config.radio_preset_page != persistedRadioPage) {
+    if (prefs.putUChar("radio_page", config.radio_preset_page) ==
+        sizeof(uint8_t)) {
+      persistedRadioPage = config.radio_preset_page;
+      ++writes;
+    } else {
+      failedKeys |= DIRTY_RADIO_UI;
+      ++failedWrites;
+    }
+  }
+  Metrics::add(Metrics::NVS_WRITES, writes);
+  if (dirtyKeys & DIRTY_RADIO_PRESETS) {
+    if (saveRadioStoreLocked()) {
+      ++writes;
+    } else {
+      failedKeys |= DIRTY_RADIO_PRESETS;
+      ++failedWrites;
+    }
+  }
+  uint32_t settled = writes + failedWrites;
+  uint32_t avoided = requestedWrites > settled ? requestedWrites - settled : 0;
+  avoidedWrites += avoided;
+  Metrics::add(Metrics::NVS_WRITES_AVOIDED, avoided);
+  Serial.printf("[Config][flush] reason=%s requested=%lu writes=%lu "
+                "failed=%lu avoided=%lu totalAvoided=%lu\n",
+                reason, static_cast<unsigned long>(requestedWrites),
+                static_cast<unsigned long>(writes),
+                static_cast<unsigned long>(failedWrites),
+                static_cast<unsigned long>(avoided),
+                static_cast<unsigned long>(avoidedWrites));
+  dirtyKeys = failedKeys;
+  requestedWrites = failedWrites;
+  if (failedKeys != 0) {
+    // 重新计时，失败的键等下一个静默期再重试，而不是每轮循环都写一次。
+    lastDirtyMs = millis();
   }
   unlockConfig();
-  return saved;
+}
+
+void ConfigManager::markDirtyLocked(uint8_t keys, uint32_t writes) {
+  dirtyKeys |= keys;
+  requestedWrites += writes;
+  lastDirtyMs = millis();
+}
+
+void ConfigManager::flushOnShutdown() {
+  if (shutdownInstance != nullptr) {
+    shutdownInstance->flushPendingWrites("shutdown");
+  }
 }
 
 String ConfigManager::getWeatherApiToken() const {
@@ -157,6 +394,15 @@ String ConfigManager::getWeatherApiToken() const {
   return token;
 }
 
+void ConfigManager::copyWeatherApiToken(char *buffer, size_t size) const {
+  if (buffer == nullptr || size == 0) {
+    return;
+  }
+  lockConfig();
+  strlcpy(buffer, config.weather_api_token.c_str(), size);
+  unlockConfig();
+}
+
 String ConfigManager::getHolidayApiToken() const {
   lockConfig();
   String token = config.holiday_api_token;
@@ -167,28 +413,41 @@ String ConfigManager::getHolidayApiToken() const {
 bool ConfigManager::updateApiTokens(const String &weather,
                                     bool updateWeather,
                                     const String &holiday,
-                                    bool updateHoliday) {
+                                    bool updateHoliday, bool &restored) {
+  restored = true;
   if (!prefsReady) {
     return false;
   }
 
+  // putString 写空串时返回 0，成败只能读回核对。
+  auto writeToken = [this](const char *key, const String &value) {
+    prefs.putString(key, value);
+    if (prefs.getString(key, "\x01") != value) {
+      return false;
+    }
+    Metrics::add(Metrics::NVS_WRITES);
+    return true;
+  };
   lockConfig();
   String previousWeather = config.weather_api_token;
   String previousHoliday = config.holiday_api_token;
-  if (updateWeather) {
-    config.weather_api_token = weather;
-    prefs.putString("weather_token", weather);
-  }
-  if (updateHoliday) {
-    config.holiday_api_token = holiday;
-    prefs.putString("holiday_token", holiday);
-  }
-  bool saved =
-      (!updateWeather || prefs.getString("weather_token", "\x01") == weather) &&
-      (!updateHoliday || prefs.getString("holiday_token", "\x01") == holiday);
-  if (!saved) {
-    config.weather_api_token = previousWeather;
-    config.holiday_api_token = previousHoliday;
+  bool saved = (!updateWeather || writeToken("weather_token", weather)) &&
+               (!updateHoliday || writeToken("holiday_token", holiday));
+  if (saved) {
+    if (updateWeather) {
+      config.weather_api_token = weather;
+    }
+    if (updateHoliday) {
+      config.holiday_api_token = holiday;
+    }
+  } else {
+    // 关键逻辑：NVS 每次 put 立即提交，前一个键可能已经是新值；
+    // 把本次碰过的键写回旧值并逐个核对，恢复失败如实返回给调用方。
+    restored =
+        (!updateWeather || writeToken("weather_token", previousWeather)) &&
+        (!updateHoliday || writeToken("holiday_token", previousHoliday));
+    Serial.printf("[Config][api] token write failed, restored=%d\n",
+                  restored);
   }
   unlockConfig();
   return saved;
@@ -200,6 +459,11 @@ void ConfigManager::lockConfig() const {
   }
 }
 
+bool ConfigManager::tryLockConfig(uint32_t timeoutMs) const {
+  return configMutex == nullptr ||
+         xSemaphoreTake(configMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
 void ConfigManager::unlockConfig() const {
   if (configMutex != nullptr) {
     xSemaphoreGive(configMutex);
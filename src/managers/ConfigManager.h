@@ -1,17 +1,13 @@
 #pragma once
 
+#include "RadioPresetStore.h"
 #include <Arduino.h>
 #include <Preferences.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
-static const uint8_t RADIO_PRESET_COUNT = 50;
-
 struct AppConfig {
   uint8_t volume;
-  uint16_t radio_presets[RADIO_PRESET_COUNT];
-  uint16_t radio_alias_frequencies[RADIO_PRESET_COUNT];
-  String radio_names[RADIO_PRESET_COUNT];
   uint8_t radio_focus_index;
   uint8_t radio_preset_page;
   uint16_t radio_seek_step;
@@ -25,22 +21,45 @@ struct AppConfig {
   uint8_t hw_check_version; // 硬件自检清单版本
 };
 
+// 电台参数与台名的完整副本：Web 配置先在副本上预演台名分配，
+// 全部通过后再整体写回 config 并落盘。名称区按最坏情况预留约 5KB，
+// 副本一律放在堆上，不要在任务栈上声明。
+struct RadioSettings {
+  uint16_t seekStep;
+  uint8_t seekThreshold;
+  bool bassBoost;
+  bool forceMono;
+  bool softMute;
+  RadioPresetStore names;
+};
+
 class ConfigManager {
 public:
   ConfigManager();
   void begin();
   void load();
-  String getRadioName(uint16_t frequency) const;
-  bool setRadioName(uint16_t frequency, const String &name);
+  String getRadioName(uint16_t frequency);
+  uint16_t getRadioPreset(uint8_t index);
+  bool saveRadioPresets(const uint16_t *stations, uint8_t count);
+  void getRadioSettings(RadioSettings &settings);
+  // 写入失败时会把已提交的键恢复为旧值；返回 false 时 restored 表示
+  // NVS 中的旧值是否已完整恢复。updateApiTokens 同理。
+  bool applyRadioSettings(const RadioSettings &settings, bool &restored);
+  static bool assignRadioName(RadioSettings &settings, uint16_t frequency,
+                              const String &name);
   void saveVolume();
   void saveHardwareCheck();
   void saveRadioUiState();
-  void saveRadioPresets();
-  bool saveRadioConfiguration();
+  // 音量、电台焦点和扫台预设来自按键操作，save* 只标记脏位；
+  // 静默 DEFERRED_WRITE_QUIET_MS、入睡前或重启前合并成一批写入 NVS。
+  void flushIfQuiet(uint32_t now);
+  void flushPendingWrites(const char *reason);
   String getWeatherApiToken() const;
+  void copyWeatherApiToken(char *buffer, size_t size) const;
   String getHolidayApiToken() const;
   bool updateApiTokens(const String &weather, bool updateWeather,
-                       const String &holiday, bool updateHoliday);
+                       const String &holiday, bool updateHoliday,
+                       bool &restored);
 
   AppConfig config;
 
@@ -48,6 +67,30 @@ private:
   Preferences prefs;
   mutable SemaphoreHandle_t configMutex = nullptr;
   bool prefsReady = false;
+  // 预设与台名首次被访问时才从 NVS 读取，开机路径不再为电台付出读取开销。
+  RadioPresetStore radioStore;
+  bool radioStoreLoaded = false;
+  void ensureRadioStoreLocked();
+  bool migrateLegacyRadioKeysLocked();
+  bool saveRadioStoreLocked();
+  bool saveRadioScalarsLocked();
+
+  enum DirtyKey : uint8_t {
+    DIRTY_VOLUME = 1 << 0,
+    DIRTY_RADIO_UI = 1 << 1,
+    DIRTY_RADIO_PRESETS = 1 << 2
+  };
+  uint8_t dirtyKeys = 0;
+  uint32_t lastDirtyMs = 0;
+  uint32_t requestedWrites = 0;
+  uint32_t avoidedWrites = 0;
+  uint8_t persistedVolume = 0;
+  uint8_t persistedRadioFocus = 0;
+  uint8_t persistedRadioPage = 0;
+  static ConfigManager *shutdownInstance;
+  void markDirtyLocked(uint8_t keys, uint32_t writes);
+  static void flushOnShutdown();
   void lockConfig() const;
+  bool tryLockConfig(uint32_t timeoutMs) const;
   void unlockConfig() const;
 };
@@ -1,5 +1,7 @@
 #include "ConnectionManager.h"
 #include "ConfigPortal.h"
+#include "NetworkEvents.h"
+#include "../utils/Metrics.h"
 #include <esp_wifi.h>
 #include <WiFiManager.h>
 
@@ -27,6 +29,20 @@ void ConnectionManager::begin(ConfigManager *config, RtcDriver *rtc) {
   if (networkMutex == nullptr) {
     networkMutex = xSemaphoreCreateRecursiveMutex();
   }
+  loadLeaseCache();
+  // 用 GOT_IP 事件记录真实拿到地址的时刻，连接耗时不受 loop 轮询间隔影响。
+  WiFi.onEvent(
+      [this](WiFiEvent_t event, WiFiEventInfo_t info) {
+        gotIpAtMs = millis();
+        NetworkEvents::notify(NetworkEvents::WIFI_STATE);
+      },
+      ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  // 断线同样唤醒网络任务，让状态机立即回到连接态而不是等下一次轮询。
+  WiFi.onEvent(
+      [](WiFiEvent_t event, WiFiEventInfo_t info) {
+        NetworkEvents::notify(NetworkEvents::WIFI_STATE);
+      },
+      ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
 }
 
 void ConnectionManager::enableNetwork(bool enable) {
@@ -58,13 +74,20 @@ void ConnectionManager::loop() {
 
   if (!portalActive) {
     beginAutoConnect();
-    wifiManager.process();
+    if (fastConnectActive) {
+      updateFastConnect();
+    } else {
+      wifiManager.process();
+    }
   }
 
   if (WiFi.status() != WL_CONNECTED) {
-    retryWiFiConnection();
+    if (!fastConnectActive) {
+      retryWiFiConnection();
+    }
     return;
   }
+  recordConnectionIfNew();
 
   bool shouldSync =
       millis() - lastSync > NTP_SYNC_INTERVAL_MS || lastSync == 0;
@@ -220,6 +243,19 @@ void ConnectionManager::beginAutoConnect() {
     return;
 
   firstConnectAttempted = true;
+  if (tryFastConnect()) {
+    return;
+  }
+  beginFullConnect();
+}
+
+void ConnectionManager::beginFullConnect() {
+  // 关键逻辑：静态地址配置会跨会话保留，完整连接前必须恢复 DHCP，
+  // 才能拿到新租约并刷新快速回连缓存。全零地址表示启用 DHCP。
+  if (staticIpActive) {
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    staticIpActive = false;
+  }
   configurePortal(false);
 
   String password = ConfigPortal::getAPPassword();
@@ -276,6 +312,10 @@ uint32_t ConnectionManager::getNextScheduledWorkDelayMs(uint32_t now) const {
 }
 
 void ConnectionManager::powerOffNetwork() {
+  if (networkEnabled) {
+    Metrics::add(Metrics::WIFI_SESSIONS);
+    Metrics::add(Metrics::WIFI_SESSION_MS, millis() - lastNetworkPowerOnTime);
+  }
   // 先确认门户真实处于激活状态，再调用关闭接口，避免 WiFiManager
   // 内部空指针解引用。
   stopPortalIfActive();
@@ -287,6 +327,7 @@ void ConnectionManager::powerOffNetwork() {
   lastReconnectAttempt = 0;
   networkEnabled = false;
   systemPortalActive = false;
+  fastConnectActive = false;
   Serial.println("WiFi Power Off to save energy");
 }
 
@@ -295,10 +336,15 @@ void ConnectionManager::powerOnNetwork() {
   firstConnectAttempted = false;
   lastReconnectAttempt = 0;
   lastNetworkPowerOnTime = millis();
+  connectStartMs = lastNetworkPowerOnTime;
+  connectRecorded = false;
+  gotIpAtMs = 0;
   WiFi.mode(WIFI_STA);
   WiFi.setSleep(true);
   esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
   Serial.println("WiFi Power On for sync");
+  // 定时同步、手动配网和系统门户都经由这里上电，统一在此唤醒网络任务。
+  NetworkEvents::notify(NetworkEvents::POWER_ON);
 }
 
 void ConnectionManager::retryWiFiConnection() {
@@ -2,11 +2,24 @@
 
 #include "../drivers/RtcDriver.h"
 #include "ConfigManager.h"
+#include <Preferences.h>
 #include <WiFi.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <time.h>
 
+// 上一次 DHCP 成功时的 AP 与租约信息，用于下次定向快速连接。
+struct WiFiLeaseCache {
+  uint8_t version;
+  uint8_t channel;
+  uint8_t bssid[6];
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint32_t leaseExpiry; // RTC 软件时钟秒数
+};
+
 class ConnectionManager {
 public:
   ConnectionManager();
@@ -26,7 +39,10 @@ public:
   bool isConfigPortalActive() const;
 
 private:
+  static const uint8_t CONNECT_HISTOGRAM_BUCKETS = 6;
+
   void beginAutoConnect();
+  void beginFullConnect();
   void configurePortal(bool manual);
   uint32_t getRtcSyncRetryInterval() const;
   void powerOffNetwork();
@@ -34,6 +50,16 @@ private:
   void retryWiFiConnection();
   void stopPortalIfActive();
 
+  // 快速回连：缓存 BSSID/信道/静态租约，失败再回退完整扫描 + DHCP。
+  void loadLeaseCache();
+  bool isLeaseCacheUsable() const;
+  bool tryFastConnect();
+  void updateFastConnect();
+  void recordConnectionIfNew();
+  void saveLeaseCache();
+  void invalidateLeaseCache();
+  void logConnectHistogram(bool fast, uint32_t elapsedMs);
+
   ConfigManager *configMgr;
   RtcDriver *rtcDriver;
   unsigned long lastSyncTime = 0;
@@ -47,6 +73,19 @@ private:
   bool systemPortalActive = false;
   mutable SemaphoreHandle_t networkMutex = nullptr;
   DateTime ntpTime;
+
+  Preferences leasePrefs;
+  bool leasePrefsReady = false;
+  WiFiLeaseCache leaseCache = {};
+  bool leaseCacheValid = false;
+  bool fastConnectActive = false;
+  bool staticIpActive = false;
+  bool connectRecorded = false;
+  uint32_t connectStartMs = 0;
+  volatile uint32_t gotIpAtMs = 0;
+  uint16_t fastConnectHistogram[CONNECT_HISTOGRAM_BUCKETS] = {};
+  uint16_t fullConnectHistogram[CONNECT_HISTOGRAM_BUCKETS] = {};
+  uint16_t fastConnectFallbacks = 0;
   void lockNetwork() const;
   void unlockNetwork() const;
 };
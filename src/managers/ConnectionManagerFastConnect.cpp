@@ -0,0 +1,182 @@
+#include "ConnectionManager.h"
+#include <esp_wifi.h>
+
+namespace {
+constexpr uint8_t LEASE_CACHE_VERSION = 1;
+constexpr uint32_t FAST_CONNECT_TIMEOUT_MS = 4000UL;
+// 关键逻辑：ESP32 拿不到路由器下发的真实租期，这里按常见 24 小时租期
+// 取一半作为缓存有效期；过期后强制走一次 DHCP 续租，避免静态地址与
+// 其他设备冲突。
+constexpr uint32_t LEASE_VALIDITY_SEC = 12UL * 3600UL;
+// RTC 尚未对时（仍停留在 2000 年默认值）时不信任租约过期判断。
+constexpr time_t MIN_TRUSTED_TIME = 1704067200; // 2024-01-01
+constexpr uint32_t CONNECT_BUCKET_LIMITS_MS[] = {500UL,  1000UL, 2000UL,
+                                                 4000UL, 8000UL, UINT32_MAX};
+constexpr const char *CONNECT_BUCKET_LABELS[] = {"<0.5s", "<1s", "<2s",
+                                                 "<4s",   "<8s", ">=8s"};
+
+uint8_t getConnectBucket(uint32_t elapsedMs) {
+  uint8_t bucket = 0;
+  while (elapsedMs >= CONNECT_BUCKET_LIMITS_MS[bucket]) {
+    bucket++;
+  }
+  return bucket;
+}
+
+void printHistogram(const char *name, const uint16_t *histogram,
+                    uint8_t count) {
+  Serial.printf("[WiFi][connect] %s:", name);
+  for (uint8_t i = 0; i < count; ++i) {
+    Serial.printf(" %s=%u", CONNECT_BUCKET_LABELS[i], histogram[i]);
+  }
+  Serial.println();
+}
+
+bool readStoredStationConfig(char *ssid, size_t ssidSize, char *password,
+                             size_t passwordSize) {
+  wifi_config_t conf;
+  if (esp_wifi_get_config(WIFI_IF_STA, &conf) != ESP_OK ||
+      conf.sta.ssid[0] == '\0') {
+    return false;
+  }
+  // ssid/password 在 esp-idf 中不保证以 '\0' 结尾，需要按固定长度拷贝。
+  snprintf(ssid, ssidSize, "%.*s", static_cast<int>(sizeof(conf.sta.ssid)),
+           reinterpret_cast<const char *>(conf.sta.ssid));
+  snprintf(password, passwordSize, "%.*s",
+           static_cast<int>(sizeof(conf.sta.password)),
+           reinterpret_cast<const char *>(conf.sta.password));
+  return true;
+}
+} // namespace
+
+void ConnectionManager::loadLeaseCache() {
+  leasePrefsReady = leasePrefs.begin("wifi_lease", false);
+  leaseCacheValid = false;
+  if (!leasePrefsReady) {
+    return;
+  }
+  WiFiLeaseCache stored;
+  size_t length = leasePrefs.getBytes("lease", &stored, sizeof(stored));
+  if (length != sizeof(stored) || stored.version != LEASE_CACHE_VERSION ||
+      stored.channel == 0 || stored.ip == 0) {
+    return;
+  }
+  leaseCache = stored;
+  leaseCacheValid = true;
+}
+
+bool ConnectionManager::isLeaseCacheUsable() const {
+  if (!leaseCacheValid || rtcDriver == nullptr) {
+    return false;
+  }
+  time_t now = rtcDriver->getSoftwareTimeAsTimeT();
+  return now >= MIN_TRUSTED_TIME &&
+         static_cast<uint32_t>(now) < leaseCache.leaseExpiry;
+}
+
+bool ConnectionManager::tryFastConnect() {
+  if (!isLeaseCacheUsable()) {
+    return false;
+  }
+
+  char ssid[33];
+  char password[65];
+  if (!readStoredStationConfig(ssid, sizeof(ssid), password,
+                               sizeof(password))) {
+    return false;
+  }
+
+  // 关键逻辑：定向连接跳过全信道扫描，静态配置跳过 DHCP 握手；
+  // 两者都来自上一次 DHCP 成功时的实测值，超时后再回退完整流程。
+  WiFi.config(IPAddress(leaseCache.ip), IPAddress(leaseCache.gateway),
+              IPAddress(leaseCache.subnet), IPAddress(leaseCache.dns));
+  WiFi.begin(ssid, password, leaseCache.channel, leaseCache.bssid, true);
+  fastConnectActive = true;
+  staticIpActive = true;
+  Serial.printf("WiFi fast connect: ch=%u\n", leaseCache.channel);
+  return true;
+}
+
+void ConnectionManager::updateFastConnect() {
+  if (WiFi.status() == WL_CONNECTED) {
+    fastConnectActive = false;
+    return;
+  }
+  if (millis() - connectStartMs < FAST_CONNECT_TIMEOUT_MS) {
+    return;
+  }
+
+  Serial.println("WiFi fast connect timeout, falling back to full scan");
+  fastConnectActive = false;
+  fastConnectFallbacks++;
+  invalidateLeaseCache();
+  WiFi.disconnect(false, false);
+  beginFullConnect();
+}
+
+void ConnectionManager::recordConnectionIfNew() {
+  if (connectRecorded) {
+    return;
+  }
+  connectRecorded = true;
+  uint32_t connectedAt = gotIpAtMs != 0 ? gotIpAtMs : millis();
+  uint32_t elapsedMs = connectedAt - connectStartMs;
+  logConnectHistogram(staticIpActive, elapsedMs);
+  if (!staticIpActive) {
+    saveLeaseCache();
+  }
+}
+
+void ConnectionManager::saveLeaseCache() {
+  if (!leasePrefsReady || rtcDriver == nullptr) {
+    return;
+  }
+  time_t now = rtcDriver->getSoftwareTimeAsTimeT();
+  if (now < MIN_TRUSTED_TIME) {
+    return;
+  }
+
+  WiFiLeaseCache cache = {};
+  cache.version = LEASE_CACHE_VERSION;
+  cache.channel = static_cast<uint8_t>(WiFi.channel());
+  const uint8_t *bssid = WiFi.BSSID();
+  if (bssid == nullptr || cache.channel == 0) {
+    return;
+  }
+  memcpy(cache.bssid, bssid, sizeof(cache.bssid));
+  cache.ip = static_cast<uint32_t>(WiFi.localIP());
+  cache.gateway = static_cast<uint32_t>(WiFi.gatewayIP());
+  cache.subnet = static_cast<uint32_t>(WiFi.subnetMask());
+  cache.dns = static_cast<uint32_t>(WiFi.dnsIP(0));
+  cache.leaseExpiry = static_cast<uint32_t>(now) + LEASE_VALIDITY_SEC;
+  if (cache.ip == 0) {
+    return;
+  }
+
+  leaseCache = cache;
+  leaseCacheValid = true;
+  leasePrefs.putBytes("lease", &cache, sizeof(cache));
+}
+
+void ConnectionManager::invalidateLeaseCache() {
+  if (!leaseCacheValid) {
+    return;
+  }
+  leaseCacheValid = false;
+  if (leasePrefsReady) {
+    leasePrefs.remove("lease");
+  }
+}
+
+void ConnectionManager::logConnectHistogram(bool fast, uint32_t elapsedMs) {
+  uint16_t *histogram = fast ? fastConnectHistogram : fullConnectHistogram;
+  uint8_t bucket = getConnectBucket(elapsedMs);
+  if (histogram[bucket] < UINT16_MAX) {
+    histogram[bucket]++;
+  }
+  Serial.printf("[WiFi][connect] path=%s elapsed=%lums fallbacks=%u\n",
+                fast ? "fast" : "full", (unsigned long)elapsedMs,
+                fastConnectFallbacks);
+  printHistogram("fast", fastConnectHistogram, CONNECT_HISTOGRAM_BUCKETS);
+  printHistogram("full", fullConnectHistogram, CONNECT_HISTOGRAM_BUCKETS);
+}
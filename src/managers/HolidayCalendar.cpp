@@ -1,9 +1,7 @@
 #include "HolidayCalendar.h"
+#include "HttpTransport.h"
 #include <ArduinoJson.h>
-#include <HTTPClient.h>
 #include <SPIFFS.h>
-#include <WiFi.h>
-#include <WiFiClientSecure.h>
 
 HolidayCalendar::HolidayCalendar() {
   cacheMutex = xSemaphoreCreateMutex();
@@ -287,7 +285,7 @@ bool HolidayCalendar::shouldFetchYear(const HolidayYearCache &cache) const {
   if (cache.loaded) {
     return false;
   }
-  if (WiFi.status() != WL_CONNECTED) {
+  if (!HttpTransportRegistry::get().isAvailable()) {
     return false;
   }
   return cache.lastFetchAttemptMs == 0 ||
@@ -329,28 +327,24 @@ bool HolidayCalendar::tryFetchYearBody(uint16_t fullYear, String &body) const {
     return false;
   }
 
-  WiFiClientSecure client;
-  client.setInsecure();
-
-  HTTPClient http;
-  if (!http.begin(client, getRemoteUrl(fullYear))) {
-    Serial.printf("Holiday request begin failed: %u\n", fullYear);
+  String url = getRemoteUrl(fullYear);
+  const HttpHeader headers[] = {{"Accept-Encoding", "identity"},
+                                {"Authorization", apiToken.c_str()}};
+  HttpRequest request = {url.c_str(), "Holiday request", headers, 2, 8000};
+  HttpResponseInfo info;
+  body = "";
+  bool received = HttpTransportRegistry::get().get(
+      request, info, [&body, &info](const uint8_t *data, size_t len) {
+        if (body.length() == 0 && info.contentLength > 0) {
+          body.reserve(info.contentLength);
+        }
+        return body.concat(reinterpret_cast<const char *>(data), len);
+      });
+  if (!received) {
+    Serial.printf("Holiday request failed: %u, %d\n", fullYear,
+                  info.statusCode);
     return false;
   }
-
-  http.setReuse(false);
-  http.setTimeout(8000);
-  http.addHeader("Accept-Encoding", "identity");
-  http.addHeader("Authorization", apiToken);
-  int httpCode = http.GET();
-  if (httpCode != HTTP_CODE_OK) {
-    Serial.printf("Holiday request failed: %d\n", httpCode);
-    http.end();
-    return false;
-  }
-
-  body = http.getString();
-  http.end();
   return body.length() > 0;
 }
 
@@ -0,0 +1,229 @@
+#include "HttpTransport.h"
+#include "../utils/Metrics.h"
+#include <HTTPClient.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+
+namespace {
+constexpr uint32_t HTTP_DEFAULT_TIMEOUT_MS = 8000UL;
+constexpr uint32_t HTTP_POLL_DELAY_MS = 10UL;
+constexpr size_t HTTP_READ_CHUNK_SIZE = 256;
+constexpr const char *HTTP_RECORD_ROOT = "/replay";
+
+ArduinoHttpTransport defaultTransport;
+HttpTransport *activeTransport = &defaultTransport;
+
+uint32_t hashUrl(const char *url) {
+  uint32_t hash = 2166136261UL;
+  for (const char *p = url; p != nullptr && *p != '\0'; ++p) {
+    hash ^= static_cast<uint8_t>(*p);
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+bool readBody(HTTPClient &http, const HttpRequest &request,
+              const HttpChunkCallback &onChunk) {
+  // 兼容不同 Arduino-ESP32 内核：
+  // 某些版本 getStreamPtr() 返回 WiFiClient*，某些版本内部改成了
+  // NetworkClient*。两者都继承自 Client，因此这里统一收敛到 Client*，
+  // 避免因为平台升级/降级导致编译直接中断。
+  Client *stream = http.getStreamPtr();
+  if (stream == nullptr) {
+    Serial.printf("%s stream is null\n", request.requestName);
+    return false;
+  }
+
+  uint32_t timeoutMs =
+      request.timeoutMs == 0 ? HTTP_DEFAULT_TIMEOUT_MS : request.timeoutMs;
+  uint32_t lastDataTime = millis();
+  size_t totalBytes = 0;
+  while (http.connected() || stream->available()) {
+    int availableBytes = stream->available();
+    if (availableBytes <= 0) {
+      if (!stream->connected() && !http.connected()) {
+        break;
+      }
+      if (millis() - lastDataTime >= timeoutMs) {
+        Serial.printf("%s payload read timeout\n", request.requestName);
+        return false;
+      }
+      vTaskDelay(pdMS_TO_TICKS(HTTP_POLL_DELAY_MS));
+      continue;
+    }
+
+    uint8_t buffer[HTTP_READ_CHUNK_SIZE];
+    size_t chunkSize = static_cast<size_t>(availableBytes);
+    if (chunkSize > sizeof(buffer)) {
+      chunkSize = sizeof(buffer);
+    }
+
+    int readLen =
+        stream->readBytes(reinterpret_cast<char *>(buffer), chunkSize);
+    if (readLen <= 0) {
+      Serial.printf("%s payload read failed\n", request.requestName);
+      return false;
+    }
+    if (!onChunk(buffer, static_cast<size_t>(readLen))) {
+      return false;
+    }
+    totalBytes += static_cast<size_t>(readLen);
+    Metrics::add(Metrics::HTTP_CLIENT_RX_BYTES, static_cast<uint32_t>(readLen));
+    lastDataTime = millis();
+  }
+
+  return totalBytes > 0;
+}
+} // namespace
+
+bool ArduinoHttpTransport::isAvailable() const {
+  return WiFi.status() == WL_CONNECTED;
+}
+
+bool ArduinoHttpTransport::get(const HttpRequest &request,
+                               HttpResponseInfo &info,
+                               const HttpChunkCallback &onChunk) {
+  WiFiClientSecure client;
+  client.setInsecure();
+
+  HTTPClient http;
+  if (!http.begin(client, request.url)) {
+    Serial.printf("%s begin failed: %s\n", request.requestName, request.url);
+    info.statusCode = -1;
+    return false;
+  }
+
+  // 强制请求非复用连接，避免在 ESP32 的 TLS 连接回收边界上留下悬空 socket；
+  // HTTP/1.0 同时保证服务器不会使用 chunked 编码，响应体可以直接按流读取。
+  http.useHTTP10(true);
+  http.setTimeout(request.timeoutMs == 0 ? HTTP_DEFAULT_TIMEOUT_MS
+                                         : request.timeoutMs);
+  http.setReuse(false);
+  for (uint8_t i = 0; i < request.headerCount; ++i) {
+    http.addHeader(request.headers[i].name, request.headers[i].value);
+  }
+
+  const char *collected[] = {"Content-Encoding"};
+  http.collectHeaders(collected, 1);
+
+  info.statusCode = http.GET();
+  if (info.statusCode <= 0) {
+    Serial.printf("%s HTTP GET failed, error: %s\n", request.requestName,
+                  http.errorToString(info.statusCode).c_str());
+    http.end();
+    return false;
+  }
+  if (info.statusCode != HTTP_CODE_OK) {
+    Serial.printf("%s HTTP code: %d\n", request.requestName, info.statusCode);
+    http.end();
+    return false;
+  }
+
+  info.contentLength = http.getSize();
+  info.gzip = http.header("Content-Encoding").indexOf("gzip") > -1;
+
+#if HTTP_RECORD_ENABLE
+  // 录制模式：边读边把原始响应体写入 SPIFFS，供之后离线回放。
+  File recording = SPIFFS.open(
+      HttpTransportRegistry::recordingPath(HTTP_RECORD_ROOT, request.url),
+      FILE_WRITE);
+  if (recording) {
+    recording.printf("%d %d\n", info.statusCode, info.gzip ? 1 : 0);
+  }
+  bool ok = readBody(http, request,
+                     [&recording, &onChunk](const uint8_t *data, size_t len) {
+                       if (recording) {
+                         recording.write(data, len);
+                       }
+                       return onChunk(data, len);
+                     });
+  if (recording) {
+    recording.close();
+  }
+#else
+  bool ok = readBody(http, request, onChunk);
+#endif
+  http.end();
+  return ok;
+}
+
+ReplayHttpTransport::ReplayHttpTransport(fs::FS &fs, const char *root)
+    : fs(fs), root(root) {}
+
+bool ReplayHttpTransport::get(const HttpRequest &request,
+                              HttpResponseInfo &info,
+                              const HttpChunkCallback &onChunk) {
+  requestCount++;
+  if (options.latencyMs > 0) {
+    vTaskDelay(pdMS_TO_TICKS(options.latencyMs));
+  }
+  if (options.failEvery > 0 && requestCount % options.failEvery == 0) {
+    Serial.printf("%s replay injected failure: %d\n", request.requestName,
+                  options.failStatus);
+    info.statusCode = options.failStatus;
+    return false;
+  }
+
+  String path = HttpTransportRegistry::recordingPath(root, request.url);
+  File file = fs.open(path, FILE_READ);
+  if (!file) {
+    Serial.printf("%s replay missing: %s\n", request.requestName,
+                  path.c_str());
+    info.statusCode = -1;
+    return false;
+  }
+
+  String statusLine = file.readStringUntil('\n');
+  int gzip = 0;
+  if (sscanf(statusLine.c_str(), "%d %d", &info.statusCode, &gzip) < 1) {
+    Serial.printf("%s replay header invalid: %s\n", request.requestName,
+                  path.c_str());
+    file.close();
+    info.statusCode = -1;
+    return false;
+  }
+  info.gzip = gzip != 0;
+  info.contentLength = static_cast<int>(file.size() - file.position());
+  if (info.statusCode != 200) {
+    file.close();
+    return false;
+  }
+
+  uint8_t buffer[512];
+  size_t chunkSize = options.chunkSize == 0 || options.chunkSize > sizeof(buffer)
+                         ? sizeof(buffer)
+                         : options.chunkSize;
+  size_t totalBytes = 0;
+  while (true) {
+    size_t readLen = file.read(buffer, chunkSize);
+    if (readLen == 0) {
+      break;
+    }
+    if (!onChunk(buffer, readLen)) {
+      file.close();
+      return false;
+    }
+    totalBytes += readLen;
+    if (options.chunkDelayMs > 0) {
+      vTaskDelay(pdMS_TO_TICKS(options.chunkDelayMs));
+    }
+  }
+  file.close();
+  return totalBytes > 0;
+}
+
+namespace HttpTransportRegistry {
+HttpTransport &get() { return *activeTransport; }
+
+void set(HttpTransport *transport) {
+  activeTransport = transport == nullptr ? &defaultTransport : transport;
+}
+
+String recordingPath(const char *root, const char *url) {
+  char name[16];
+  snprintf(name, sizeof(name), "/%08lx.http",
+           static_cast<unsigned long>(hashUrl(url)));
+  return String(root) + name;
+}
+} // namespace HttpTransportRegistry
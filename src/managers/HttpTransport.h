@@ -0,0 +1,53 @@
+#pragma once
+
+#include "HttpTransportBase.h"
+#include <Arduino.h>
+#include <FS.h>
+
+#ifndef HTTP_REPLAY_ENABLE
+#define HTTP_REPLAY_ENABLE 0
+#endif
+
+#ifndef HTTP_RECORD_ENABLE
+#define HTTP_RECORD_ENABLE 0
+#endif
+
+class ArduinoHttpTransport : public HttpTransport {
+public:
+  bool isAvailable() const override;
+  bool get(const HttpRequest &request, HttpResponseInfo &info,
+           const HttpChunkCallback &onChunk) override;
+};
+
+// 从文件系统回放录制的响应。文件格式：首行 "<status> <gzip 0|1>\n"，
+// 其后为原始响应体。可配置响应延迟、分块大小和按序号注入失败。
+class ReplayHttpTransport : public HttpTransport {
+public:
+  struct Options {
+    uint32_t latencyMs = 0;
+    size_t chunkSize = 256;
+    uint32_t chunkDelayMs = 0;
+    // 每 failEvery 次请求失败一次，0 表示不注入失败。
+    uint16_t failEvery = 0;
+    int failStatus = -1;
+  };
+
+  explicit ReplayHttpTransport(fs::FS &fs, const char *root = "/replay");
+  void setOptions(const Options &options) { this->options = options; }
+  bool isAvailable() const override { return true; }
+  bool get(const HttpRequest &request, HttpResponseInfo &info,
+           const HttpChunkCallback &onChunk) override;
+
+private:
+  fs::FS &fs;
+  const char *root;
+  Options options;
+  uint32_t requestCount = 0;
+};
+
+namespace HttpTransportRegistry {
+HttpTransport &get();
+void set(HttpTransport *transport);
+// 录制与回放共用同一套文件命名：按 URL 的 FNV-1a 哈希生成文件名。
+String recordingPath(const char *root, const char *url);
+} // namespace HttpTransportRegistry
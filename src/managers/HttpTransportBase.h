@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+// 传输接口与请求/响应描述不依赖 Arduino：设备上的 HTTPS 与 SPIFFS 回放实现
+// 见 HttpTransport.h，主机测试可直接实现这个接口回放录制的响应。
+struct HttpHeader {
+  const char *name;
+  const char *value;
+};
+
+struct HttpRequest {
+  const char *url;
+  const char *requestName;
+  const HttpHeader *headers;
+  uint8_t headerCount;
+  uint32_t timeoutMs;
+};
+
+struct HttpResponseInfo {
+  int statusCode = 0;
+  int contentLength = -1;
+  bool gzip = false;
+};
+
+// 响应体按块回调；返回 false 表示调用方主动中止读取。
+using HttpChunkCallback = std::function<bool(const uint8_t *, size_t)>;
+
+// 关键逻辑：天气和节假日请求都只依赖这个接口，
+// 设备上走真实 HTTPS，调试时可切换成从文件系统回放录制响应，
+// 这样解析、缓存和批量调度逻辑不必连真实 API 也能反复验证。
+class HttpTransport {
+public:
+  virtual ~HttpTransport() {}
+  virtual bool isAvailable() const = 0;
+  // 成功收到完整响应体返回 true；info.statusCode <= 0 表示传输层错误。
+  virtual bool get(const HttpRequest &request, HttpResponseInfo &info,
+                   const HttpChunkCallback &onChunk) = 0;
+};
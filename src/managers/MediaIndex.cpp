@@ -0,0 +1,535 @@
+#include "MediaIndex.h"
+#include "../drivers/SharedSPIBus.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+const char MEDIA_INDEX_DIR[] = "/.index";
+const char MEDIA_INDEX_PATH[] = "/.index/media.idx";
+const char MEDIA_RECORDS_TMP[] = "/.index/media.tmp";
+const char MEDIA_PATHS_TMP[] = "/.index/paths.tmp";
+constexpr uint32_t MEDIA_INDEX_MAGIC = 0x3158494DUL; // "MIX1"
+constexpr uint16_t MEDIA_INDEX_VERSION = 4;
+constexpr size_t MAX_PATH_LENGTH = 255;
+constexpr size_t MAX_PENDING_DIRS = 64;
+constexpr uint32_t MAX_TRACKS = 4096;
+constexpr size_t POOL_COPY_CHUNK = 512;
+// 重扫在后台任务里执行，每批目录项或记录只短暂持有总线，
+// 期间刷屏、音频预读和 Web 请求都能插队。
+constexpr size_t SCAN_ENTRIES_PER_LOCK = 16;
+constexpr uint32_t SCAN_RECORDS_PER_LOCK = 32;
+constexpr size_t POOL_CHUNKS_PER_LOCK = 8;
+const char UNKNOWN_ARTIST[] = "Unknown Artist";
+
+struct Header {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t count;
+  uint32_t poolLength;
+};
+
+struct PreviousEntry {
+  uint32_t pathHash;
+  uint32_t index;
+};
+
+struct ScanState {
+  File previous;
+  File records;
+  File paths;
+  std::vector<PreviousEntry> previousEntries;
+  uint32_t previousCount = 0;
+  uint32_t count = 0;
+  uint32_t poolLength = 0;
+  uint32_t reused = 0;
+  uint16_t directories = 0;
+  uint16_t skipped = 0;
+  bool changed = false;
+  bool failed = false;
+  // 只读比对：不写临时文件，发现第一处变化即停止遍历。
+  bool dryRun = false;
+  DirEntry entry;
+};
+
+bool scanStopped(const ScanState &scan) {
+  return scan.failed || scan.count >= MAX_TRACKS ||
+         (scan.dryRun && scan.changed);
+}
+
+void resetWalk(ScanState &scan) {
+  scan.count = 0;
+  scan.poolLength = 0;
+  scan.reused = 0;
+  scan.directories = 0;
+  scan.skipped = 0;
+}
+
+bool readHeader(File &file, Header &header) {
+  if (!file || file.read(reinterpret_cast<uint8_t *>(&header),
+                         sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  // 记录长度随版本固定，文件总长必须与头部声明完全一致，截断的索引直接作废。
+  return header.magic == MEDIA_INDEX_MAGIC &&
+         header.version == MEDIA_INDEX_VERSION &&
+         header.recordSize == sizeof(MediaIndex::Record) &&
+         header.count <= MAX_TRACKS &&
+         file.size() == sizeof(Header) +
+                            header.count * sizeof(MediaIndex::Record) +
+                            header.poolLength;
+}
+
+uint32_t hashPath(const char *path, size_t length) {
+  uint32_t hash = 2166136261UL; // FNV-1a
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(path[i])) * 16777619UL;
+  }
+  return hash;
+}
+
+bool isIndexedAudio(const char *name, size_t length) {
+  return length > 4 && strcasecmp(name + length - 4, ".mp3") == 0;
+}
+
+bool isSkippedDirectory(const char *name) {
+  // 隐藏目录包括索引自身和 Web 删除用的 /.trash。
+  return name[0] == '.' || strcmp(name, "System Volume Information") == 0;
+}
+
+// 按 UTF-8 字符边界截断，避免半个汉字进入定长标签字段。
+void copyUtf8(char *dest, size_t size, const char *src, size_t length) {
+  if (length >= size) {
+    length = size - 1;
+    while (length > 0 && (static_cast<uint8_t>(src[length]) & 0xC0) == 0x80) {
+      --length;
+    }
+  }
+  memcpy(dest, src, length);
+  dest[length] = '\0';
+}
+
+bool readRecordAt(File &file, uint32_t index, MediaIndex::Record &record) {
+  return file.seek(sizeof(Header) + index * sizeof(MediaIndex::Record)) &&
+         file.read(reinterpret_cast<uint8_t *>(&record), sizeof(record)) ==
+             sizeof(record);
+}
+
+void loadPreviousEntries(ScanState &scan) {
+  scan.previousEntries.reserve(scan.previousCount);
+  MediaIndex::Record record;
+  uint32_t i = 0;
+  bool readable = true;
+  while (readable && i < scan.previousCount) {
+    SharedSPIBus::Guard spiGuard;
+    // 读完头部后顺序读取，文件游标自然前进到下一条记录。
+    for (uint32_t n = 0; n < SCAN_RECORDS_PER_LOCK && i < scan.previousCount;
+         ++n, ++i) {
+      if (scan.previous.read(reinterpret_cast<uint8_t *>(&record),
+                             sizeof(record)) != sizeof(record)) {
+        readable = false;
+        break;
+      }
+      scan.previousEntries.push_back(PreviousEntry{record.pathHash, i});
+    }
+  }
+  std::sort(scan.previousEntries.begin(), scan.previousEntries.end(),
+            [](const PreviousEntry &a, const PreviousEntry &b) {
+              return a.pathHash < b.pathHash;
+            });
+}
+
+bool reusePrevious(ScanState &scan, uint32_t hash, size_t pathLength,
+                   MediaIndex::Record &record) {
+  PreviousEntry key{hash, 0};
+  auto it = std::lower_bound(
+      scan.previousEntries.begin(), scan.previousEntries.end(), key,
+      [](const PreviousEntry &a, const PreviousEntry &b) {
+        return a.pathHash < b.pathHash;
+      });
+  // 关键逻辑：哈希、路径长度、大小和修改时间同时相等才视为同一文件未变化，
+  // 沿用旧记录即可保留已解析的时长与标签，不必再读取音频文件本身。
+  for (; it != scan.previousEntries.end() && it->pathHash == hash; ++it) {
+    if (!readRecordAt(scan.previous, it->index, record)) {
+      return false;
+    }
+    if (record.pathLength == pathLength &&
+        record.size == static_cast<uint32_t>(scan.entry.size) &&
+        record.mtime == static_cast<uint32_t>(scan.entry.lastWrite)) {
+      if (it->index != scan.count) {
+        scan.changed = true;
+      }
+      ++scan.reused;
+      return true;
+    }
+  }
+  return false;
+}
+
+void appendTrack(ScanState &scan, const char *path, size_t pathLength) {
+  MediaIndex::Record record;
+  uint32_t hash = hashPath(path, pathLength);
+  if (!reusePrevious(scan, hash, pathLength, record)) {
+    memset(&record, 0, sizeof(record));
+    const char *name = strrchr(path, '/') + 1;
+    copyUtf8(record.title, sizeof(record.title), name, strlen(name) - 4);
+    record.size = static_cast<uint32_t>(scan.entry.size);
+    record.mtime = static_cast<uint32_t>(scan.entry.lastWrite);
+    scan.changed = true;
+  }
+  if (scan.dryRun) {
+    ++scan.count;
+    return;
+  }
+  record.pathHash = hash;
+  record.pathOffset = scan.poolLength;
+  record.pathLength = static_cast<uint16_t>(pathLength);
+  if (scan.records.write(reinterpret_cast<const uint8_t *>(&record),
+                         sizeof(record)) != sizeof(record) ||
+      scan.paths.write(reinterpret_cast<const uint8_t *>(path), pathLength) !=
+          pathLength) {
+    scan.failed = true;
+    return;
+  }
+  scan.poolLength += pathLength;
+  ++scan.count;
+}
+
+void visitEntry(ScanState &scan, const String &dir, size_t prefixLength,
+                std::vector<String> &pending) {
+  char path[MAX_PATH_LENGTH + 1];
+  size_t nameLength = strlen(scan.entry.name);
+  if (prefixLength + 1 + nameLength > MAX_PATH_LENGTH) {
+    ++scan.skipped;
+    return;
+  }
+  memcpy(path, dir.c_str(), prefixLength);
+  path[prefixLength] = '/';
+  memcpy(path + prefixLength + 1, scan.entry.name, nameLength + 1);
+  size_t pathLength = prefixLength + 1 + nameLength;
+
+  if (scan.entry.isDirectory) {
+    if (isSkippedDirectory(scan.entry.name)) {
+      return;
+    }
+    if (pending.size() >= MAX_PENDING_DIRS) {
+      ++scan.skipped;
+      return;
+    }
+    pending.push_back(String(path));
+  } else if (isIndexedAudio(scan.entry.name, nameLength)) {
+    appendTrack(scan, path, pathLength);
+  }
+}
+
+void walkCard(SDCardDriver *sd, ScanState &scan) {
+  // 关键逻辑：新旧索引已占 3 个文件句柄，播放中的曲目和界面读索引还要各占一个，
+  // 因此不做递归嵌套打开目录，而是每次只开一个目录，子目录压栈稍后遍历。
+  std::vector<String> pending;
+  pending.push_back("/");
+  while (!pending.empty() && !scanStopped(scan)) {
+    String dir = pending.back();
+    pending.pop_back();
+    SDDirectoryCursor cursor;
+    bool opened;
+    {
+      SharedSPIBus::Guard spiGuard;
+      opened = cursor.open(sd, dir.c_str());
+    }
+    if (!opened) {
+      continue;
+    }
+    ++scan.directories;
+    size_t prefixLength = dir.length() > 1 ? dir.length() : 0;
+    size_t firstChild = pending.size();
+    bool more = true;
+    while (more && !scanStopped(scan)) {
+      SharedSPIBus::Guard spiGuard;
+      for (size_t n = 0; n < SCAN_ENTRIES_PER_LOCK && !scanStopped(scan); ++n) {
+        if (!cursor.next(scan.entry)) {
+          more = false;
+          break;
+        }
+        visitEntry(scan, dir, prefixLength, pending);
+      }
+    }
+    {
+      SharedSPIBus::Guard spiGuard;
+      cursor.close();
+    }
+    // 子目录逆序入栈，出栈时仍按目录中的原始顺序遍历。
+    std::reverse(pending.begin() + firstChild, pending.end());
+  }
+}
+
+bool appendPathPool(SDCardDriver *sd, ScanState &scan) {
+  File pool;
+  {
+    SharedSPIBus::Guard spiGuard;
+    scan.paths.close();
+    pool = sd->open(MEDIA_PATHS_TMP, FILE_READ);
+  }
+  uint8_t buffer[POOL_COPY_CHUNK];
+  uint32_t copied = 0;
+  bool copying = static_cast<bool>(pool);
+  while (copying && copied < scan.poolLength) {
+    SharedSPIBus::Guard spiGuard;
+    for (size_t n = 0; n < POOL_CHUNKS_PER_LOCK && copied < scan.poolLength;
+         ++n) {
+      size_t length = pool.read(buffer, sizeof(buffer));
+      if (length == 0 || scan.records.write(buffer, length) != length) {
+        copying = false;
+        break;
+      }
+      copied += length;
+    }
+  }
+  SharedSPIBus::Guard spiGuard;
+  if (pool) {
+    pool.close();
+  }
+  return copied == scan.poolLength;
+}
+
+// 调用方持有总线：写头部并替换正式索引。
+bool commitIndex(SDCardDriver *sd, ScanState &scan) {
+  Header header{MEDIA_INDEX_MAGIC, MEDIA_INDEX_VERSION,
+                sizeof(MediaIndex::Record), scan.count, scan.poolLength};
+  bool ok = scan.records.seek(0) &&
+            scan.records.write(reinterpret_cast<const uint8_t *>(&header),
+                               sizeof(header)) == sizeof(header);
+  scan.records.close();
+  if (scan.previous) {
+    scan.previous.close();
+  }
+  // 关键逻辑：完整写好临时文件后才替换正式索引；替换中途掉电只会丢失索引，
+  // 下次进入音乐页按全新扫描重建，不会读到半截记录。
+  ok = ok && (!sd->exists(MEDIA_INDEX_PATH) || sd->remove(MEDIA_INDEX_PATH)) &&
+       sd->rename(MEDIA_RECORDS_TMP, MEDIA_INDEX_PATH);
+  sd->remove(MEDIA_PATHS_TMP);
+  return ok;
+}
+
+void discardScan(SDCardDriver *sd, ScanState &scan) {
+  if (scan.previous)
+    scan.previous.close();
+  if (scan.records)
+    scan.records.close();
+  if (scan.paths)
+    scan.paths.close();
+  sd->remove(MEDIA_RECORDS_TMP);
+  sd->remove(MEDIA_PATHS_TMP);
+}
+} // namespace
+
+MediaIndex::MediaIndex(SDCardDriver *sd) : sd(sd) {}
+
+bool MediaIndex::load() {
+  count = 0;
+  poolLength = 0;
+  if (sd == nullptr || !sd->isMounted()) {
+    return false;
+  }
+  File file = sd->open(MEDIA_INDEX_PATH, FILE_READ);
+  Header header;
+  bool ok = readHeader(file, header);
+  if (file) {
+    file.close();
+  }
+  if (ok) {
+    count = header.count;
+    poolLength = header.poolLength;
+  }
+  return ok;
+}
+
+bool MediaIndex::rescan() {
+  uint32_t startMs = millis();
+  ScanState scan;
+  {
+    SharedSPIBus::Guard spiGuard;
+    if (sd == nullptr || !sd->isMounted()) {
+      return false;
+    }
+    if (!sd->exists(MEDIA_INDEX_DIR) && !sd->mkdir(MEDIA_INDEX_DIR)) {
+      Serial.println("[Music][index] cannot create /.index");
+      return false;
+    }
+    Header previousHeader;
+    scan.previous = sd->open(MEDIA_INDEX_PATH, FILE_READ);
+    if (readHeader(scan.previous, previousHeader)) {
+      scan.previousCount = previousHeader.count;
+    } else {
+      // 旧索引缺失、版本不符或已损坏：按全新扫描处理，并强制写出新文件。
+      if (scan.previous)
+        scan.previous.close();
+      scan.changed = true;
+    }
+  }
+  loadPreviousEntries(scan);
+
+  // 关键逻辑：先只读遍历一遍与旧索引比对，卡内容未变的常见情况下
+  // 只有目录读取，不再每次改写 media.tmp / paths.tmp。
+  // FAT 目录的修改时间不随子目录内文件变化而更新，不能用来跳过遍历。
+  if (!scan.changed) {
+    scan.dryRun = true;
+    walkCard(sd, scan);
+    if (!scan.changed && scan.count == scan.previousCount) {
+      SharedSPIBus::Guard spiGuard;
+      scan.previous.close();
+      Serial.printf("[Music][index] tracks=%lu dirs=%u skipped=%u "
+                    "unchanged in %lums\n",
+                    static_cast<unsigned long>(scan.count), scan.directories,
+                    scan.skipped,
+                    static_cast<unsigned long>(millis() - startMs));
+      return true;
+    }
+    scan.dryRun = false;
+    scan.changed = true;
+    resetWalk(scan);
+  }
+
+  {
+    SharedSPIBus::Guard spiGuard;
+    Header placeholder = {};
+    scan.records = sd->open(MEDIA_RECORDS_TMP, FILE_WRITE);
+    scan.paths = sd->open(MEDIA_PATHS_TMP, FILE_WRITE);
+    if (!scan.records || !scan.paths ||
+        scan.records.write(reinterpret_cast<const uint8_t *>(&placeholder),
+                           sizeof(placeholder)) != sizeof(placeholder)) {
+      discardScan(sd, scan);
+      Serial.println("[Music][index] cannot open temporary index files");
+      return false;
+    }
+  }
+
+  walkCard(sd, scan);
+  if (scan.failed || !appendPathPool(sd, scan)) {
+    SharedSPIBus::Guard spiGuard;
+    discardScan(sd, scan);
+    Serial.println("[Music][index] write failed, keeping previous index");
+    return false;
+  }
+
+  {
+    // 替换文件与更新计数在同一次持锁内完成，读者不会看到新文件配旧计数。
+    SharedSPIBus::Guard spiGuard;
+    if (!commitIndex(sd, scan)) {
+      discardScan(sd, scan);
+      Serial.println("[Music][index] commit failed");
+      load();
+      return false;
+    }
+    count = scan.count;
+    poolLength = scan.poolLength;
+  }
+  Serial.printf("[Music][index] tracks=%lu reused=%lu new=%lu dirs=%u "
+                "skipped=%u rewritten in %lums\n",
+                static_cast<unsigned long>(scan.count),
+                static_cast<unsigned long>(scan.reused),
+                static_cast<unsigned long>(scan.count - scan.reused),
+                scan.directories, scan.skipped,
+                static_cast<unsigned long>(millis() - startMs));
+  return true;
+}
+
+size_t MediaIndex::readTracks(uint32_t first, size_t maxCount,
+                              TrackInfo *out) const {
+  if (first >= count || maxCount == 0 || sd == nullptr || !sd->isMounted()) {
+    return 0;
+  }
+  File file = sd->open(MEDIA_INDEX_PATH, FILE_READ);
+  if (!file) {
+    return 0;
+  }
+  size_t loaded = 0;
+  Record record;
+  char path[MAX_PATH_LENGTH + 1];
+  while (loaded < maxCount && first + loaded < count) {
+    if (!readRecordAt(file, first + loaded, record) ||
+        record.pathLength > MAX_PATH_LENGTH ||
+        !file.seek(getPoolOffset() + record.pathOffset) ||
+        file.read(reinterpret_cast<uint8_t *>(path), record.pathLength) !=
+            record.pathLength) {
+      break;
+    }
+    path[record.pathLength] = '\0';
+    record.title[TITLE_SIZE - 1] = '\0';
+    record.artist[ARTIST_SIZE - 1] = '\0';
+    TrackInfo &track = out[loaded];
+    track.title = record.title;
+    track.artist = record.artist[0] != '\0' ? record.artist : UNKNOWN_ARTIST;
+    track.path = path;
+    track.duration = (record.durationMs + 500) / 1000;
+    ++loaded;
+  }
+  file.close();
+  return loaded;
+}
+
+bool MediaIndex::readRecord(uint32_t index, Record &record) const {
+  if (index >= count || sd == nullptr || !sd->isMounted()) {
+    return false;
+  }
+  File file = sd->open(MEDIA_INDEX_PATH, FILE_READ);
+  bool ok = file && readRecordAt(file, index, record);
+  if (file) {
+    file.close();
+  }
+  return ok;
+}
+
+bool MediaIndex::findPending(uint32_t &cursor, uint32_t maxScan,
+                             Record &record, String &path) const {
+  if (cursor >= count || sd == nullptr || !sd->isMounted()) {
+    return false;
+  }
+  File file = sd->open(MEDIA_INDEX_PATH, FILE_READ);
+  if (!file || !file.seek(sizeof(Header) + cursor * sizeof(Record))) {
+    return false;
+  }
+  bool found = false;
+  uint32_t end = count - cursor > maxScan ? cursor + maxScan : count;
+  for (; cursor < end; ++cursor) {
+    if (file.read(reinterpret_cast<uint8_t *>(&record), sizeof(record)) !=
+        sizeof(record)) {
+      cursor = count;
+      break;
+    }
+    if ((record.flags & FLAG_TAGS_PARSED) == 0 ||
+        (record.flags & FLAG_SEEK_SCAN) != 0) {
+      found = true;
+      break;
+    }
+  }
+  char buffer[MAX_PATH_LENGTH + 1];
+  found = found && record.pathLength <= MAX_PATH_LENGTH &&
+          file.seek(getPoolOffset() + record.pathOffset) &&
+          file.read(reinterpret_cast<uint8_t *>(buffer), record.pathLength) ==
+              record.pathLength;
+  file.close();
+  if (found) {
+    buffer[record.pathLength] = '\0';
+    path = buffer;
+  }
+  return found;
+}
+
+bool MediaIndex::updateRecord(uint32_t index, const Record &record) {
+  if (index >= count || sd == nullptr || !sd->isMounted()) {
+    return false;
+  }
+  File file = sd->open(MEDIA_INDEX_PATH, "r+");
+  if (!file) {
+    return false;
+  }
+  bool ok = file.seek(sizeof(Header) + index * sizeof(Record)) &&
+            file.write(reinterpret_cast<const uint8_t *>(&record),
+                       sizeof(record)) == sizeof(record);
+  file.close();
+  return ok;
+}
+
+uint32_t MediaIndex::getPoolOffset() const {
+  return sizeof(Header) + count * sizeof(Record);
+}
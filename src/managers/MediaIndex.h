@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../drivers/SDCardDriver.h"
+#include "../utils/Mp3Metadata.h"
+#include <Arduino.h>
+
+struct TrackInfo {
+  String title;
+  String artist;
+  String path;
+  uint32_t duration; // in seconds
+};
+
+// SD 卡媒体索引：/.index/media.idx 由 [头部][定长记录表][路径字符串池] 组成。
+// 记录按遍历顺序编号，界面按序号直接 seek 读取，不再把整张播放列表放进内存。
+// 重新扫描时按路径哈希匹配旧记录，大小与修改时间都未变的条目原样沿用
+// 已解析的时长和标签，只有新增或变化的文件需要重新解析。
+class MediaIndex {
+public:
+  static constexpr size_t TITLE_SIZE = 48;
+  static constexpr size_t ARTIST_SIZE = 32;
+  static constexpr size_t TOC_SIZE = 100;
+  static constexpr uint8_t FLAG_TAGS_PARSED = 0x01;
+  // toc 有效：来自 Xing 头或已完成的逐帧扫描；否则按 CBR 线性定位。
+  static constexpr uint8_t FLAG_SEEK_TOC = 0x02;
+  // VBR 文件等待后台逐帧扫描生成帧级锚点，缺少 TOC 时一并生成。
+  static constexpr uint8_t FLAG_SEEK_SCAN = 0x04;
+
+  struct Record {
+    uint32_t pathHash;
+    uint32_t pathOffset; // 相对字符串池起点
+    uint16_t pathLength;
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t durationMs; // 未解析时为 0
+    uint32_t audioStart; // 首帧在文件中的偏移
+    uint32_t audioLength;
+    uint16_t encoderDelay; // LAME 无缝播放信息，单位为采样
+    uint16_t encoderPadding;
+    char title[TITLE_SIZE];
+    char artist[ARTIST_SIZE];
+    uint8_t toc[TOC_SIZE];
+    Mp3Metadata::SeekTable seek;
+  };
+  static_assert(sizeof(Record) == 36 + TITLE_SIZE + ARTIST_SIZE + TOC_SIZE +
+                                      sizeof(Mp3Metadata::SeekTable),
+                "media index record layout must not contain padding");
+
+  explicit MediaIndex(SDCardDriver *sd);
+
+  // 只读取并校验头部；索引缺失或损坏时计数为 0。调用方需已挂载 SD。
+  bool load();
+  // 遍历整张卡并增量重建索引，供后台任务调用：内部按批次短暂持有总线，
+  // 调用方不得持锁。先只读比对，内容未变化时不写任何文件。
+  bool rescan();
+  uint32_t getCount() const { return count; }
+  // 从 first 开始读取最多 maxCount 条，返回实际读到的条数。
+  size_t readTracks(uint32_t first, size_t maxCount, TrackInfo *out) const;
+  bool readTrack(uint32_t index, TrackInfo &track) const {
+    return readTracks(index, 1, &track) == 1;
+  }
+  bool readRecord(uint32_t index, Record &record) const;
+  // 后台解析用：从 cursor 起最多检查 maxScan 条记录，找到尚未解析标签
+  // 或等待逐帧扫描的记录时返回 true 且 cursor 指向它；
+  // 否则 cursor 前进到已检查位置之后。
+  bool findPending(uint32_t &cursor, uint32_t maxScan, Record &record,
+                   String &path) const;
+  // 原地改写一条记录；两次 rescan 之间记录序号保持不变，
+  // 重扫进行中不得调用，否则写入可能落在即将被替换的旧文件上。
+  bool updateRecord(uint32_t index, const Record &record);
+
+private:
+  SDCardDriver *sd;
+  uint32_t count = 0;
+  uint32_t poolLength = 0;
+
+  uint32_t getPoolOffset() const;
+};
@@ -1,23 +1,84 @@
 #include "MusicManager.h"
+#include "../drivers/SharedSPIBus.h"
+#include "../utils/Mp3Metadata.h"
+
+namespace {
+// 后台解析节奏：空闲时快速补齐列表，播放时放慢，单步只读文件头尾几 KB，
+// 不会长时间占用 SPI 总线让解码器断流。
+constexpr uint32_t METADATA_STEP_IDLE_MS = 150;
+constexpr uint32_t METADATA_STEP_PLAYING_MS = 2000;
+constexpr uint32_t METADATA_MAX_SCAN_RECORDS = 32;
+constexpr size_t METADATA_HEAD_WINDOW = 4096;
+constexpr size_t METADATA_FRAME_WINDOW = 2048;
+constexpr size_t FRAME_SCAN_CHUNK = 8192;
+// 精确定位时从锚点顺着帧头前进，每次读一块；一个锚点间隔通常几十 KB。
+constexpr size_t SEEK_WALK_CHUNK = 4096;
+// 剩余时间小于该值时预排下一首；留足读索引和预开文件的时间。
+constexpr uint32_t GAPLESS_LEAD_MS = 4000;
+// 重扫任务避开音频任务所在的核心，以最低优先级运行，只在空闲时推进遍历。
+constexpr uint32_t RESCAN_TASK_STACK = 6144;
+constexpr UBaseType_t RESCAN_TASK_PRIORITY = 1;
+constexpr BaseType_t RESCAN_TASK_CORE = 0;
+
+static_assert(MediaIndex::TITLE_SIZE == Mp3Metadata::TITLE_SIZE &&
+                  MediaIndex::ARTIST_SIZE == Mp3Metadata::ARTIST_SIZE &&
+                  MediaIndex::TOC_SIZE == Mp3Metadata::TOC_SIZE,
+              "index fields must match the parser output");
+} // namespace
 
 MusicManager::MusicManager(AudioDriver *audio, SDCardDriver *sd,
                            ConfigManager *config)
-    : audio(audio), sd(sd), config(config) {}
+    : audio(audio), sd(sd), config(config), index(sd) {}
 
 void MusicManager::init() {
-  if (!sd->begin()) {
-    playlist.clear();
+  SharedSPIBus::Guard spiGuard;
+  if (!storageHeld) {
+    storageHeld = sd->acquire();
+  }
+  if (!storageHeld) {
     currentTrackIndex = -1;
+    currentTrack = TrackInfo{};
+    indexLoaded = false;
     return;
   }
-  scanSD();
-  if (!playlist.empty()) {
-    currentTrackIndex = 0;
+  finishRescan();
+  // 关键逻辑：进入页面只读索引头部，列表立即可用；卡内容的比对交给后台任务，
+  // 不在 UI 线程上遍历整张卡。
+  if (!indexLoaded && !rescanRunning) {
+    index.load();
+    indexLoaded = true;
+    applyIndexChange();
   }
+  if (currentTrackIndex == -1 && getTrackCount() > 0) {
+    selectTrack(0);
+  }
+  rescanLibrary();
+}
+
+void MusicManager::releaseStorage() {
+  if (!storageHeld) {
+    return;
+  }
+  cancelQueuedTrack();
+  storageHeld = false;
+  sd->release();
 }
 
 void MusicManager::update() {
-  audio->loop();
+  if (rescanFinished) {
+    SharedSPIBus::Guard spiGuard;
+    finishRescan();
+  }
+  int32_t pendingSeek = pendingSeekSeconds;
+  if (pendingSeek >= 0) {
+    pendingSeekSeconds = -1;
+    seek(static_cast<uint32_t>(pendingSeek));
+  }
+  if (audio->consumeHandoff()) {
+    adoptQueuedTrack();
+  }
+  updateMetadata(millis());
+  prepareNextTrack();
 
   // Check if song finished
   if (currentTrackIndex != -1 && !audio->isPlaying() &&
@@ -30,39 +91,78 @@ void MusicManager::update() {
   }
 }
 
-void MusicManager::scanSD() {
-  playlist.clear();
-  std::vector<FileInfo> files = sd->listDir("/");
-  for (const auto &file : files) {
-    if (!file.isDirectory && file.name.endsWith(".mp3")) {
-      TrackInfo track;
-      track.title = file.name;
-      // Remove extension for title
-      int dotIdx = track.title.lastIndexOf('.');
-      if (dotIdx > 0)
-        track.title = track.title.substring(0, dotIdx);
+void MusicManager::rescanLibrary() {
+  if (rescanRunning || !storageHeld) {
+    return;
+  }
+  rescanRunning = true;
+  rescanFinished = false;
+  if (xTaskCreatePinnedToCore(rescanTaskEntry, "MediaRescan",
+                              RESCAN_TASK_STACK, this, RESCAN_TASK_PRIORITY,
+                              nullptr, RESCAN_TASK_CORE) != pdPASS) {
+    rescanRunning = false;
+    Serial.println("[Music][index] cannot start rescan task");
+  }
+}
+
+void MusicManager::rescanTaskEntry(void *param) {
+  MusicManager *self = static_cast<MusicManager *>(param);
+  // 任务自持一份挂载引用，重扫途中离开音乐页也不会被空闲卸载打断。
+  if (self->sd->acquire()) {
+    self->index.rescan();
+    self->sd->release();
+  }
+  self->rescanFinished = true;
+  vTaskDelete(nullptr);
+}
+
+void MusicManager::finishRescan() {
+  if (!rescanFinished) {
+    return;
+  }
+  rescanFinished = false;
+  rescanRunning = false;
+  indexLoaded = true;
+  applyIndexChange();
+}
+
+void MusicManager::applyIndexChange() {
+  // 重扫后记录序号可能整体移动：预排、解析游标和逐帧扫描都按旧序号记录，
+  // 一律作废后从头开始。
+  cancelQueuedTrack();
+  metadataCursor = 0;
+  metadataComplete = false;
+  scanTrackIndex = -1;
+  scanPath = String();
+  ++indexGeneration;
 
-      track.artist = "Unknown Artist";
-      track.path = file.name.startsWith("/") ? file.name : "/" + file.name;
-      track.duration = 0; // Duration will be known once played or parsed
-      playlist.push_back(track);
+  if (currentTrackIndex >= getTrackCount()) {
+    currentTrackIndex = -1;
+    currentTrack = TrackInfo{};
+    if (getTrackCount() > 0) {
+      selectTrack(0);
     }
+  } else if (currentTrackIndex != -1) {
+    selectTrack(currentTrackIndex);
   }
+}
 
-  if (currentTrackIndex >= (int)playlist.size()) {
-    currentTrackIndex = playlist.empty() ? -1 : 0;
+size_t MusicManager::loadTracks(int first, size_t maxCount, TrackInfo *out) {
+  if (first < 0) {
+    return 0;
   }
+  SharedSPIBus::Guard spiGuard;
+  return index.readTracks(static_cast<uint32_t>(first), maxCount, out);
 }
 
-void MusicManager::playTrack(int index) {
-  if (index >= 0 && index < (int)playlist.size()) {
-    currentTrackIndex = index;
-    loadTrack(index);
+void MusicManager::playTrack(int trackIndex) {
+  if (trackIndex >= 0 && trackIndex < getTrackCount()) {
+    loadTrack(trackIndex);
   }
 }
 
 void MusicManager::togglePlay() {
-  if (currentTrackIndex == -1 && !playlist.empty()) {
+  if (currentTrackIndex == -1 && getTrackCount() > 0) {
     playTrack(0);
   } else if (audio->isPlaying()) {
     audio->pause();
@@ -74,26 +174,123 @@ void MusicManager::togglePlay() {
 }
 
 void MusicManager::nextTrack() {
-  if (playlist.empty())
+  int count = getTrackCount();
+  if (count == 0)
     return;
-  currentTrackIndex = (currentTrackIndex + 1) % playlist.size();
-  loadTrack(currentTrackIndex);
+  loadTrack((currentTrackIndex + 1) % count);
 }
 
 void MusicManager::prevTrack() {
-  if (playlist.empty())
+  int count = getTrackCount();
+  if (count == 0)
     return;
-  currentTrackIndex =
-      (currentTrackIndex - 1 + playlist.size()) % playlist.size();
-  loadTrack(currentTrackIndex);
+  loadTrack((currentTrackIndex - 1 + count) % count);
 }
 
-void MusicManager::stop() { audio->stop(); }
+void MusicManager::stop() {
+  cancelQueuedTrack();
+  audio->stop();
+}
 
 void MusicManager::seek(uint32_t seconds) {
-  // Audio library usually doesn't have a simple seek(seconds) for all formats,
-  // but some versions have audio.setTimeOffset(seconds).
-  // For now, let's keep it simple as the HTML design's seek is optional.
+  if (currentTrackIndex == -1) {
+    return;
+  }
+  const MediaIndex::Record &record = currentRecord;
+  if (record.durationMs == 0 || record.audioLength == 0) {
+    // 元数据尚未解析：退回解码库按平均码率估算的定位。
+    audio->seekToSeconds(seconds);
+    return;
+  }
+  uint32_t positionMs = seconds * 1000UL;
+  if (positionMs >= record.durationMs) {
+    positionMs = record.durationMs - 1;
+  }
+  uint32_t offset;
+  const char *method = "frame";
+  if (!findFrameOffset(positionMs, offset)) {
+    // 锚点尚未扫描或已与文件不符：按 TOC 或线性比例粗定位。
+    offset = Mp3Metadata::seekOffsetForTime(
+        currentSeekToc(), record.audioLength, positionMs, record.durationMs);
+    method = currentSeekToc() != nullptr ? "toc" : "linear";
+  }
+  bool ok = audio->seekToByte(record.audioStart + offset);
+#if ENABLE_SERIAL_DEBUG
+  Serial.printf("[Music][seek] %lus -> byte %lu (%s) ok=%d\n",
+                static_cast<unsigned long>(seconds),
+                static_cast<unsigned long>(record.audioStart + offset), method,
+                ok);
+#else
+  (void)method;
+  (void)ok;
+#endif
+}
+
+void MusicManager::seekBy(int32_t deltaSeconds) {
+  uint32_t total = getTotalSeconds();
+  if (currentTrackIndex == -1 || total == 0) {
+    return;
+  }
+  int32_t target = static_cast<int32_t>(getElapsedSeconds()) + deltaSeconds;
+  if (target < 0) {
+    target = 0;
+  } else if (target >= static_cast<int32_t>(total)) {
+    target = static_cast<int32_t>(total) - 1;
+  }
+  seek(static_cast<uint32_t>(target));
+}
+
+bool MusicManager::requestSeek(uint32_t seconds) {
+  if (currentTrackIndex == -1) {
+    return false;
+  }
+  pendingSeekSeconds = static_cast<int32_t>(seconds);
+  return true;
+}
+
+bool MusicManager::findFrameOffset(uint32_t positionMs, uint32_t &offset) {
+  const MediaIndex::Record &record = currentRecord;
+  uint32_t target = Mp3Metadata::frameForTime(record.seek, positionMs,
+                                              record.encoderDelay);
+  uint32_t frames;
+  if (!Mp3Metadata::planSeek(record.seek, target, offset, frames)) {
+    return false;
+  }
+  if (frames == 0) {
+    return true;
+  }
+  // 关键逻辑：VBR 从目标前最近的锚点顺着帧头走到目标帧，最多读一个
+  // 锚点间隔的数据，落点就是目标帧帧头，不再受 TOC 1% 粒度的限制。
+  uint8_t *chunk = static_cast<uint8_t *>(malloc(SEEK_WALK_CHUNK));
+  if (chunk == nullptr) {
+    return false;
+  }
+  Mp3Metadata::FrameWalker walker;
+  walker.begin(offset, frames);
+  {
+    SharedSPIBus::Guard spiGuard;
+    File file = sd->open(currentTrack.path.c_str(), FILE_READ);
+    uint32_t readOffset = offset;
+    while (file && !walker.isDone() &&
+           file.seek(record.audioStart + readOffset)) {
+      size_t length = file.read(chunk, SEEK_WALK_CHUNK);
+      uint32_t next = length > 0 ? walker.feed(chunk, length, readOffset)
+                                 : readOffset;
+      if (next == readOffset) {
+        break; // 读到文件末尾或剩余数据不够一个帧头
+      }
+      readOffset = next;
+    }
+    if (file) {
+      file.close();
+    }
+  }
+  free(chunk);
+  if (!walker.isDone() || walker.lostSync()) {
+    return false;
+  }
+  offset = walker.position();
+  return true;
 }
 
 void MusicManager::setVolume(int vol) {
@@ -112,13 +309,43 @@ void MusicManager::toggleLoopMode() {
     loopMode = LOOP_NONE;
   else
     loopMode = LOOP_ALL;
+  // 循环模式决定下一首是谁，已预排的曲目作废后按新模式重新挑选。
+  cancelQueuedTrack();
 }
 
 bool MusicManager::isPlaying() const { return audio->isPlaying(); }
 
-uint32_t MusicManager::getElapsedSeconds() const { return audio->getElapsed(); }
+uint32_t MusicManager::getElapsedSeconds() const {
+  return getElapsedMs() / 1000;
+}
+
+uint32_t MusicManager::getElapsedMs() const {
+  // 关键逻辑：解码库对 VBR 文件按平均码率推算时间，定位后会明显漂移；
+  // 索引里有布局信息时，改用解码器实际消费到的字节位置反查 TOC。
+  const MediaIndex::Record &record = currentRecord;
+  uint32_t position = audio->getStreamPosition();
+  if (currentTrackIndex == -1 || record.durationMs == 0 ||
+      record.audioLength == 0 || position <= record.audioStart) {
+    return audio->getElapsed() * 1000;
+  }
+  // 有帧级布局（CBR 或已扫描锚点）时精确到帧，否则按 TOC 估算。
+  uint32_t elapsedMs;
+  if (!Mp3Metadata::timeForOffset(record.seek, position - record.audioStart,
+                                  record.encoderDelay, elapsedMs)) {
+    elapsedMs = Mp3Metadata::timeForSeekOffset(
+        currentSeekToc(), record.audioLength, position - record.audioStart,
+        record.durationMs);
+  }
+  return elapsedMs < record.durationMs ? elapsedMs : record.durationMs;
+}
 
-uint32_t MusicManager::getTotalSeconds() const { return audio->getDuration(); }
+uint32_t MusicManager::getTotalSeconds() const {
+  // Xing/VBRI 帧数得到的时长是精确值，解码库的估算只在尚未解析时兜底。
+  if (currentRecord.durationMs > 0) {
+    return (currentRecord.durationMs + 500) / 1000;
+  }
+  return audio->getDuration();
+}
 
 String MusicManager::formatTime(uint32_t seconds) {
   uint32_t m = seconds / 60;
@@ -128,8 +355,314 @@ String MusicManager::formatTime(uint32_t seconds) {
   return String(buf);
 }
 
-void MusicManager::loadTrack(int index) {
-  if (index >= 0 && index < (int)playlist.size()) {
-    audio->playFromSD(playlist[index].path.c_str());
+void MusicManager::updateMetadata(unsigned long now) {
+  uint32_t interval =
+      audio->isPlaying() ? METADATA_STEP_PLAYING_MS : METADATA_STEP_IDLE_MS;
+  // 重扫期间记录序号随时可能切换，暂停写回，等新索引生效后从头继续。
+  if (metadataComplete || rescanRunning ||
+      now - lastMetadataStepMs < interval) {
+    return;
+  }
+  lastMetadataStepMs = now;
+
+  SharedSPIBus::Guard spiGuard;
+  if (!sd->isMounted()) {
+    return;
+  }
+  if (scanTrackIndex != -1) {
+    continueFrameScan();
+    return;
+  }
+  // 正在播放的曲目插队扫描：锚点就绪后拖动进度即可帧级精确定位。
+  if ((currentRecord.flags & MediaIndex::FLAG_SEEK_SCAN) != 0 &&
+      currentTrack.path.length() > 0) {
+    beginFrameScan(static_cast<uint32_t>(currentTrackIndex), currentRecord,
+                   currentTrack.path);
+    return;
+  }
+  MediaIndex::Record record;
+  String path;
+  if (!index.findPending(metadataCursor, METADATA_MAX_SCAN_RECORDS, record,
+                         path)) {
+    if (metadataCursor >= index.getCount()) {
+      metadataComplete = true;
+    }
+    return;
+  }
+
+  uint32_t trackIndex = metadataCursor;
+  if ((record.flags & MediaIndex::FLAG_TAGS_PARSED) == 0) {
+    bool parsed = parseTrackMetadata(path, record);
+    // 解析失败也写回已解析标记，坏文件不会在每次进入页面时被反复读取。
+    if (!storeMetadata(trackIndex, record)) {
+      return;
+    }
+#if ENABLE_SERIAL_DEBUG
+    Serial.printf("[Music][meta] #%lu %s %lums ok=%d\n",
+                  static_cast<unsigned long>(trackIndex), path.c_str(),
+                  static_cast<unsigned long>(record.durationMs), parsed);
+#else
+    (void)parsed;
+#endif
+  }
+  if ((record.flags & MediaIndex::FLAG_SEEK_SCAN) == 0) {
+    ++metadataCursor;
+    return;
+  }
+  // 游标停在本条，后续每步读一块数据，直到锚点和 TOC 生成完毕。
+  beginFrameScan(trackIndex, record, path);
+}
+
+void MusicManager::beginFrameScan(uint32_t trackIndex,
+                                  const MediaIndex::Record &record,
+                                  const String &path) {
+  scanTrackIndex = static_cast<int>(trackIndex);
+  scanRecord = record;
+  scanPath = path;
+  scanOffset = record.audioStart;
+  frameScanner.begin(record.audioStart, record.audioLength, record.durationMs,
+                     record.seek);
+}
+
+bool MusicManager::storeMetadata(uint32_t trackIndex,
+                                 const MediaIndex::Record &record) {
+  if (!index.updateRecord(trackIndex, record)) {
+    Serial.println("[Music][meta] index write failed, parser stopped");
+    metadataComplete = true;
+    scanTrackIndex = -1;
+    return false;
+  }
+  lastParsedTrack = static_cast<int>(trackIndex);
+  ++metadataGeneration;
+  if (lastParsedTrack == queuedTrackIndex) {
+    queuedRecord = record;
+  }
+  if (lastParsedTrack == currentTrackIndex) {
+    currentRecord = record;
+    currentTrack.title = record.title;
+    if (record.artist[0] != '\0') {
+      currentTrack.artist = record.artist;
+    }
+    currentTrack.duration = (record.durationMs + 500) / 1000;
+  }
+  return true;
+}
+
+void MusicManager::continueFrameScan() {
+  uint8_t *chunk = static_cast<uint8_t *>(malloc(FRAME_SCAN_CHUNK));
+  if (chunk == nullptr) {
+    return; // 内存紧张时下一步再试
+  }
+  File file = sd->open(scanPath.c_str(), FILE_READ);
+  size_t length = 0;
+  if (file && file.seek(scanOffset)) {
+    length = file.read(chunk, FRAME_SCAN_CHUNK);
+  }
+  if (file) {
+    file.close();
+  }
+  uint32_t previousOffset = scanOffset;
+  if (length > 0) {
+    scanOffset = frameScanner.feed(chunk, length, scanOffset);
+  }
+  free(chunk);
+
+  if (frameScanner.isDone()) {
+    finishFrameScan(true);
+  } else if (length == 0 || scanOffset == previousOffset) {
+    // 文件比 Xing 头声明的短或读取失败：放弃 TOC，按线性比例定位。
+    finishFrameScan(false);
+  }
+}
+
+void MusicManager::finishFrameScan(bool complete) {
+  scanRecord.flags &= ~MediaIndex::FLAG_SEEK_SCAN;
+  // Xing 头自带的 TOC 直接保留，扫描只补缺失的；锚点中途放弃也照样写回，
+  // 已扫描部分的定位仍是精确的。
+  if (complete && (scanRecord.flags & MediaIndex::FLAG_SEEK_TOC) == 0) {
+    frameScanner.finish(scanRecord.toc);
+    scanRecord.flags |= MediaIndex::FLAG_SEEK_TOC;
+  }
+  frameScanner.finishAnchors(scanRecord.seek);
+  uint32_t trackIndex = static_cast<uint32_t>(scanTrackIndex);
+  scanTrackIndex = -1;
+  scanPath = String();
+  // 插队扫描的当前曲目不推进游标，游标前面的曲目仍按顺序解析。
+  if (storeMetadata(trackIndex, scanRecord) && trackIndex == metadataCursor) {
+    metadataCursor = trackIndex + 1;
+  }
+#if ENABLE_SERIAL_DEBUG
+  Serial.printf("[Music][meta] #%lu frame scan %s\n",
+                static_cast<unsigned long>(trackIndex),
+                complete ? "done" : "abandoned");
+#endif
+}
+
+const uint8_t *MusicManager::currentSeekToc() const {
+  return (currentRecord.flags & MediaIndex::FLAG_SEEK_TOC) != 0
+             ? currentRecord.toc
+             : nullptr;
+}
+
+bool MusicManager::parseTrackMetadata(const String &path,
+                                      MediaIndex::Record &record) {
+  record.flags |= MediaIndex::FLAG_TAGS_PARSED;
+  File file = sd->open(path.c_str(), FILE_READ);
+  if (!file) {
+    return false;
+  }
+  uint8_t *window = static_cast<uint8_t *>(malloc(METADATA_HEAD_WINDOW));
+  if (window == nullptr) {
+    file.close();
+    record.flags &= ~MediaIndex::FLAG_TAGS_PARSED; // 内存不足时留待下次重试
+    return false;
+  }
+
+  uint32_t fileSize = file.size();
+  Mp3Metadata::Tags tags = {};
+  size_t length = file.read(window, METADATA_HEAD_WINDOW);
+  uint32_t tagSize = Mp3Metadata::parseId3v2(window, length, tags);
+
+  uint32_t audioEnd = fileSize;
+  uint8_t tail[Mp3Metadata::ID3V1_SIZE];
+  if (fileSize >= tagSize + sizeof(tail) &&
+      file.seek(fileSize - sizeof(tail)) &&
+      file.read(tail, sizeof(tail)) == sizeof(tail) &&
+      Mp3Metadata::parseId3v1(tail, sizeof(tail), tags)) {
+    audioEnd -= sizeof(tail);
+  }
+
+  // 关键逻辑：ID3v2 较小时首帧已在头部窗口内，直接复用；
+  // 带大封面的文件再到标签末尾补读一小段，不读中间的图片数据。
+  Mp3Metadata::StreamInfo stream;
+  bool found;
+  if (tagSize + METADATA_FRAME_WINDOW <= length) {
+    found = Mp3Metadata::parseStream(window + tagSize, length - tagSize,
+                                     tagSize, audioEnd, stream);
+  } else {
+    length = file.seek(tagSize) ? file.read(window, METADATA_FRAME_WINDOW) : 0;
+    found =
+        Mp3Metadata::parseStream(window, length, tagSize, audioEnd, stream);
+  }
+  free(window);
+  file.close();
+
+  if (tags.title[0] != '\0') {
+    memcpy(record.title, tags.title, sizeof(record.title));
+  }
+  if (tags.artist[0] != '\0') {
+    memcpy(record.artist, tags.artist, sizeof(record.artist));
+  }
+  if (found) {
+    record.durationMs = stream.durationMs;
+    record.audioStart = stream.firstFrameOffset;
+    record.audioLength = stream.audioLength;
+    record.encoderDelay = stream.encoderDelay;
+    record.encoderPadding = stream.encoderPadding;
+    Mp3Metadata::initSeekTable(stream, record.seek);
+    if (stream.hasToc) {
+      memcpy(record.toc, stream.toc, sizeof(record.toc));
+      record.flags |= MediaIndex::FLAG_SEEK_TOC;
+    }
+    // Xing TOC 的字节比例只有 1/256 精度，VBR 一律补扫帧级锚点。
+    if (stream.vbr) {
+      record.flags |= MediaIndex::FLAG_SEEK_SCAN;
+    }
+  }
+  return found;
+}
+
+void MusicManager::selectTrack(int trackIndex) {
+  SharedSPIBus::Guard spiGuard;
+  currentTrackIndex = trackIndex;
+  if (!index.readTrack(static_cast<uint32_t>(trackIndex), currentTrack)) {
+    currentTrack = TrackInfo{};
+  }
+  if (!index.readRecord(static_cast<uint32_t>(trackIndex), currentRecord)) {
+    currentRecord = MediaIndex::Record{};
+  }
+}
+
+void MusicManager::loadTrack(int trackIndex) {
+  if (trackIndex < 0 || trackIndex >= getTrackCount()) {
+    return;
+  }
+  cancelQueuedTrack();
+  if (trackIndex != currentTrackIndex || currentTrack.path.length() == 0) {
+    selectTrack(trackIndex);
+  }
+  if (currentTrack.path.length() > 0) {
+    audio->playFromSD(currentTrack.path.c_str());
+  }
+}
+
+int MusicManager::followingTrackIndex() const {
+  int count = getTrackCount();
+  if (count == 0 || currentTrackIndex == -1) {
+    return -1;
+  }
+  return loopMode == LOOP_ONE ? currentTrackIndex
+                              : (currentTrackIndex + 1) % count;
+}
+
+void MusicManager::prepareNextTrack() {
+  if (nextPrepared || currentTrackIndex == -1 || !audio->isPlaying()) {
+    return;
+  }
+  uint32_t totalMs = currentRecord.durationMs > 0
+                         ? currentRecord.durationMs
+                         : audio->getDuration() * 1000;
+  uint32_t elapsedMs = getElapsedMs();
+  if (totalMs == 0 || elapsedMs + GAPLESS_LEAD_MS < totalMs) {
+    return;
+  }
+  // 每首曲目只尝试一次；失败时退回播完后再加载的旧路径。
+  nextPrepared = true;
+  int next = followingTrackIndex();
+  if (next == -1) {
+    return;
+  }
+
+  SharedSPIBus::Guard spiGuard;
+  TrackInfo track;
+  MediaIndex::Record record;
+  if (!sd->isMounted() ||
+      !index.readTrack(static_cast<uint32_t>(next), track) ||
+      !index.readRecord(static_cast<uint32_t>(next), record)) {
+    return;
+  }
+  // 关键逻辑：边界前就打开文件并预填首批数据，目录查找、首簇定位和首次
+  // 读盘都提前完成，文件已被删除或损坏时也在这里发现；切歌瞬间解码器
+  // 直接接管这份打开的文件，而不是重新打开。
+  if (!audio->queueNextFromSD(track.path.c_str())) {
+    Serial.printf("[Music][gapless] next track unreadable: %s\n",
+                  track.path.c_str());
+    return;
+  }
+  queuedTrackIndex = next;
+  queuedTrack = track;
+  queuedRecord = record;
+#if ENABLE_SERIAL_DEBUG
+  Serial.printf("[Music][gapless] queued #%d with %lums left\n", next,
+                static_cast<unsigned long>(totalMs - elapsedMs));
+#endif
+}
+
+void MusicManager::adoptQueuedTrack() {
+  if (queuedTrackIndex == -1) {
+    return;
+  }
+  currentTrackIndex = queuedTrackIndex;
+  currentTrack = queuedTrack;
+  currentRecord = queuedRecord;
+  queuedTrackIndex = -1;
+  nextPrepared = false;
+}
+
+void MusicManager::cancelQueuedTrack() {
+  if (queuedTrackIndex != -1) {
+    audio->clearQueued();
   }
+  queuedTrackIndex = -1;
+  nextPrepared = false;
 }
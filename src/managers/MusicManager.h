@@ -3,29 +3,34 @@
 #include "../drivers/AudioDriver.h"
 #include "../drivers/SDCardDriver.h"
 #include "ConfigManager.h"
+#include "MediaIndex.h"
+#include "../utils/Mp3Metadata.h"
 #include <Arduino.h>
-#include <vector>
 
 enum LoopMode { LOOP_NONE, LOOP_ALL, LOOP_ONE };
 
-struct TrackInfo {
-  String title;
-  String artist;
-  String path;
-  uint32_t duration; // in seconds
-};
-
 class MusicManager {
 public:
   MusicManager(AudioDriver *audio, SDCardDriver *sd, ConfigManager *config);
 
   void init();
   void update();
+  // 离开音乐页且未在播放时交还 SD 挂载引用，卡在空闲超时后自行卸载。
+  void releaseStorage();
 
   // Playlist management
-  void scanSD();
-  const std::vector<TrackInfo> &getPlaylist() const { return playlist; }
+  // 在后台任务中增量重扫整张卡；完成后由 update() 在 UI 线程切换到新索引。
+  void rescanLibrary();
+  // 每次切换到新索引加一；界面据此重读整页播放列表。
+  uint32_t getIndexGeneration() const { return indexGeneration; }
+  int getTrackCount() const { return static_cast<int>(index.getCount()); }
+  // 播放列表按需从 SD 索引分页读取，返回实际读到的条数。
+  size_t loadTracks(int first, size_t maxCount, TrackInfo *out);
+  const TrackInfo &getCurrentTrack() const { return currentTrack; }
   int getCurrentTrackIndex() const { return currentTrackIndex; }
+  // 后台解析每写回一条时长/标签，代数加一；界面据此判断是否需要重绘列表。
+  uint32_t getMetadataGeneration() const { return metadataGeneration; }
+  int getLastParsedTrack() const { return lastParsedTrack; }
 
   // Playback control
   void playTrack(int index);
@@ -33,7 +38,12 @@ public:
   void nextTrack();
   void prevTrack();
   void stop();
+  // CBR 按帧长、已扫描锚点的 VBR 从锚点逐帧前进，精确落到目标帧；
+  // 其余按 TOC 或线性比例粗定位，解码器在下一个帧头处重新同步。
   void seek(uint32_t seconds);
+  void seekBy(int32_t deltaSeconds);
+  // 供 Web 任务调用：只登记目标位置，由 update() 在 UI 线程执行定位。
+  bool requestSeek(uint32_t seconds);
 
   // Volume & Loop
   void setVolume(int vol);
@@ -51,13 +61,60 @@ private:
   AudioDriver *audio;
   SDCardDriver *sd;
   ConfigManager *config;
+  bool storageHeld = false;
+  bool indexLoaded = false;
+
+  // 后台重扫：任务只改写索引文件与计数，序号相关的状态由 UI 线程收尾。
+  volatile bool rescanRunning = false;
+  volatile bool rescanFinished = false;
+  uint32_t indexGeneration = 0;
+  volatile int32_t pendingSeekSeconds = -1;
 
-  std::vector<TrackInfo> playlist;
+  MediaIndex index;
+  TrackInfo currentTrack;
+  MediaIndex::Record currentRecord = {};
   int currentTrackIndex = -1;
   LoopMode loopMode = LOOP_ALL;
 
   unsigned long lastUpdate = 0;
   uint32_t elapsedSeconds = 0;
 
-  void loadTrack(int index);
+  uint32_t metadataCursor = 0;
+  bool metadataComplete = false;
+  unsigned long lastMetadataStepMs = 0;
+  uint32_t metadataGeneration = 0;
+  int lastParsedTrack = -1;
+
+  // 缺少 TOC 的 VBR 文件逐帧扫描进度；同一时刻只扫描一首。
+  int scanTrackIndex = -1;
+  uint32_t scanOffset = 0;
+  String scanPath;
+  MediaIndex::Record scanRecord;
+  Mp3Metadata::FrameScanner frameScanner;
+
+  // 无缝播放：当前曲目剩余不足预读提前量时解析并预排下一首。
+  bool nextPrepared = false;
+  int queuedTrackIndex = -1;
+  TrackInfo queuedTrack;
+  MediaIndex::Record queuedRecord;
+
+  static void rescanTaskEntry(void *param);
+  void finishRescan();
+  void applyIndexChange();
+  void prepareNextTrack();
+  void adoptQueuedTrack();
+  void cancelQueuedTrack();
+  int followingTrackIndex() const;
+  uint32_t getElapsedMs() const;
+  void updateMetadata(unsigned long now);
+  bool parseTrackMetadata(const String &path, MediaIndex::Record &record);
+  bool storeMetadata(uint32_t trackIndex, const MediaIndex::Record &record);
+  void beginFrameScan(uint32_t trackIndex, const MediaIndex::Record &record,
+                      const String &path);
+  void continueFrameScan();
+  void finishFrameScan(bool complete);
+  const uint8_t *currentSeekToc() const;
+  bool findFrameOffset(uint32_t positionMs, uint32_t &offset);
+  void selectTrack(int trackIndex);
+  void loadTrack(int trackIndex);
 };
@@ -0,0 +1,36 @@
+#include "NetworkEvents.h"
+#include <freertos/task.h>
+
+namespace {
+EventGroupHandle_t networkEventGroup = nullptr;
+} // namespace
+
+namespace NetworkEvents {
+
+void begin() {
+  if (networkEventGroup == nullptr) {
+    networkEventGroup = xEventGroupCreate();
+  }
+}
+
+void notify(EventBits_t bits) {
+  if (networkEventGroup == nullptr) {
+    return;
+  }
+  xEventGroupSetBits(networkEventGroup, bits);
+}
+
+EventBits_t wait(EventBits_t mask, TickType_t timeoutTicks) {
+  if (networkEventGroup == nullptr) {
+    vTaskDelay(timeoutTicks == portMAX_DELAY ? pdMS_TO_TICKS(500)
+                                             : timeoutTicks);
+    return 0;
+  }
+  // 关键逻辑：退出时清除已命中的位，同一事件只唤醒一次；
+  // 不在 mask 内的位保留到下一次关心它的等待。
+  return xEventGroupWaitBits(networkEventGroup, mask, pdTRUE, pdFALSE,
+                             timeoutTicks) &
+         mask;
+}
+
+} // namespace NetworkEvents
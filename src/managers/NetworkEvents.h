@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+// 网络任务的唤醒源。networkTask 阻塞在事件组上，只有这些事件或
+// 活跃期的轮询超时才会让 Core 0 上的网络任务恢复执行。
+namespace NetworkEvents {
+
+constexpr EventBits_t POWER_ON = 1UL << 0;
+constexpr EventBits_t WIFI_STATE = 1UL << 1;
+constexpr EventBits_t SCREEN_CHANGED = 1UL << 2;
+constexpr EventBits_t ALL = POWER_ON | WIFI_STATE | SCREEN_CHANGED;
+
+void begin();
+void notify(EventBits_t bits);
+EventBits_t wait(EventBits_t mask, TickType_t timeoutTicks);
+
+} // namespace NetworkEvents
@@ -0,0 +1,160 @@
+#include "RadioPresetStore.h"
+#include "../utils/Crc32.h"
+#include <stddef.h>
+
+namespace {
+constexpr uint32_t RADIO_BLOB_MAGIC = 0x31504452UL; // "RDP1"
+constexpr uint8_t RADIO_BLOB_VERSION = 1;
+} // namespace
+
+void RadioPresetStore::clear() {
+  memset(&image, 0, sizeof(image));
+  image.header.magic = RADIO_BLOB_MAGIC;
+  image.header.version = RADIO_BLOB_VERSION;
+}
+
+bool RadioPresetStore::decode(size_t length) {
+  const Header &header = image.header;
+  size_t fixedLength = sizeof(Header) + sizeof(image.presets);
+  if (length < fixedLength || header.magic != RADIO_BLOB_MAGIC ||
+      header.version != RADIO_BLOB_VERSION ||
+      header.arenaLength > ARENA_SIZE ||
+      length != fixedLength + header.arenaLength ||
+      header.nameCount > RADIO_PRESET_COUNT ||
+      header.nameCount * ENTRY_SIZE > header.arenaLength ||
+      header.crc != computeCrc()) {
+    return false;
+  }
+  // 条目表记录的名称总长必须正好填满名称区，防止越界读取；单条长度
+  // 也不能超过 MAX_NAME_BYTES，findName 按这个上限准备栈缓冲。
+  size_t names = header.nameCount * ENTRY_SIZE;
+  for (uint8_t i = 0; i < header.nameCount; ++i) {
+    if (entryLength(i) > MAX_NAME_BYTES) {
+      return false;
+    }
+    names += entryLength(i);
+  }
+  return names == header.arenaLength;
+}
+
+size_t RadioPresetStore::encode() {
+  image.header.magic = RADIO_BLOB_MAGIC;
+  image.header.version = RADIO_BLOB_VERSION;
+  image.header.crc = computeCrc();
+  return getHeaderedLength();
+}
+
+uint16_t RadioPresetStore::getPreset(uint8_t index) const {
+  return index < RADIO_PRESET_COUNT ? image.presets[index] : 0;
+}
+
+void RadioPresetStore::setPreset(uint8_t index, uint16_t frequency) {
+  if (index < RADIO_PRESET_COUNT) {
+    image.presets[index] = frequency;
+  }
+}
+
+bool RadioPresetStore::findName(uint16_t frequency, String &name) const {
+  int index = findEntry(frequency);
+  if (index < 0) {
+    return false;
+  }
+  size_t offset = nameOffset(index);
+  uint8_t length = entryLength(index);
+  char buffer[MAX_NAME_BYTES + 1];
+  memcpy(buffer, image.arena + offset, length);
+  buffer[length] = '\0';
+  name = buffer;
+  return true;
+}
+
+bool RadioPresetStore::assignName(uint16_t frequency, const String &name) {
+  size_t length = name.length();
+  if (length > MAX_NAME_BYTES) {
+    return false;
+  }
+  int existing = findEntry(frequency);
+  size_t reclaimed =
+      existing >= 0 ? ENTRY_SIZE + entryLength(existing) : 0;
+  if (length > 0 &&
+      (image.header.nameCount - (existing >= 0 ? 1 : 0) >=
+           RADIO_PRESET_COUNT ||
+       image.header.arenaLength - reclaimed + ENTRY_SIZE + length >
+           ARENA_SIZE)) {
+    return false;
+  }
+  if (existing >= 0) {
+    removeEntry(existing);
+  }
+  if (length == 0) {
+    return true;
+  }
+
+  // 关键逻辑：新条目追加在条目表末尾，先把整个名称区后移一个条目宽度，
+  // 再把台名追加到名称区末尾，名称区始终保持紧凑无空洞。
+  size_t entriesEnd = image.header.nameCount * ENTRY_SIZE;
+  size_t namesLength = image.header.arenaLength - entriesEnd;
+  memmove(image.arena + entriesEnd + ENTRY_SIZE, image.arena + entriesEnd,
+          namesLength);
+  image.arena[entriesEnd] = static_cast<uint8_t>(frequency & 0xFF);
+  image.arena[entriesEnd + 1] = static_cast<uint8_t>(frequency >> 8);
+  image.arena[entriesEnd + 2] = static_cast<uint8_t>(length);
+  memcpy(image.arena + entriesEnd + ENTRY_SIZE + namesLength, name.c_str(),
+         length);
+  image.header.nameCount++;
+  image.header.arenaLength += ENTRY_SIZE + length;
+  return true;
+}
+
+size_t RadioPresetStore::getHeaderedLength() const {
+  return sizeof(Header) + sizeof(image.presets) + image.header.arenaLength;
+}
+
+uint32_t RadioPresetStore::computeCrc() const {
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&image);
+  // CRC 覆盖头部中除 crc 以外的字段，以及预设和已用名称区。
+  uint32_t crc = Crc32::update(0, bytes, offsetof(Header, crc));
+  return Crc32::update(crc, reinterpret_cast<const uint8_t *>(image.presets),
+                       sizeof(image.presets) + image.header.arenaLength);
+}
+
+uint16_t RadioPresetStore::entryFrequency(uint8_t index) const {
+  const uint8_t *entry = image.arena + index * ENTRY_SIZE;
+  return static_cast<uint16_t>(entry[0] | (entry[1] << 8));
+}
+
+uint8_t RadioPresetStore::entryLength(uint8_t index) const {
+  return image.arena[index * ENTRY_SIZE + 2];
+}
+
+size_t RadioPresetStore::nameOffset(uint8_t index) const {
+  size_t offset = image.header.nameCount * ENTRY_SIZE;
+  for (uint8_t i = 0; i < index; ++i) {
+    offset += entryLength(i);
+  }
+  return offset;
+}
+
+int RadioPresetStore::findEntry(uint16_t frequency) const {
+  for (uint8_t i = 0; i < image.header.nameCount; ++i) {
+    if (entryFrequency(i) == frequency) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void RadioPresetStore::removeEntry(uint8_t index) {
+  size_t offset = nameOffset(index);
+  uint8_t length = entryLength(index);
+  size_t arenaLength = image.header.arenaLength;
+  // 先删台名再删条目：两段 memmove 都只搬动其后的数据。
+  memmove(image.arena + offset, image.arena + offset + length,
+          arenaLength - offset - length);
+  arenaLength -= length;
+  size_t entryStart = index * ENTRY_SIZE;
+  memmove(image.arena + entryStart, image.arena + entryStart + ENTRY_SIZE,
+          arenaLength - entryStart - ENTRY_SIZE);
+  image.header.nameCount--;
+  image.header.arenaLength = arenaLength - ENTRY_SIZE;
+}
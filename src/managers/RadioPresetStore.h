@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+
+static const uint8_t RADIO_PRESET_COUNT = 50;
+
+// 电台预设与台名的紧凑存储。内存布局即 NVS blob 布局：
+// [头部][50 个预设频率][名称区]，名称区前半是 {频率, 长度} 条目表，
+// 后半按条目顺序紧挨着存放 UTF-8 台名。加载/保存只需一次 getBytes/putBytes，
+// 台名不再各自占用一块堆内存。
+class RadioPresetStore {
+public:
+  // 台名最多 24 个字符，UTF-8 每字符最多 4 字节。名称区按 50 个满长台名
+  // 加各自的 {频率, 长度} 条目预留（再补齐到 4 字节，结构体尾部不留填充），
+  // 校验通过的任意一组台名都放得下。
+  static constexpr size_t MAX_NAME_CHARS = 24;
+  static constexpr size_t MAX_NAME_BYTES = MAX_NAME_CHARS * 4;
+  static constexpr size_t ENTRY_SIZE = 3;
+  static constexpr size_t ARENA_SIZE =
+      (RADIO_PRESET_COUNT * (ENTRY_SIZE + MAX_NAME_BYTES) + 3) & ~size_t(3);
+
+  void clear();
+  uint8_t *raw() { return reinterpret_cast<uint8_t *>(&image); }
+  size_t capacity() const { return sizeof(image); }
+  // 校验 raw() 中已读入的 length 字节；失败时内容不可用，需由调用方 clear()。
+  bool decode(size_t length);
+  // 刷新头部长度与 CRC，返回需要写入 NVS 的有效字节数。
+  size_t encode();
+
+  uint16_t getPreset(uint8_t index) const;
+  void setPreset(uint8_t index, uint16_t frequency);
+  bool findName(uint16_t frequency, String &name) const;
+  // 空名称表示删除该频率的台名；名称区放不下时返回 false 且不做修改。
+  bool assignName(uint16_t frequency, const String &name);
+  uint8_t getNameCount() const { return image.header.nameCount; }
+  uint16_t getArenaUsed() const { return image.header.arenaLength; }
+
+private:
+  struct Header {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t nameCount;
+    uint16_t arenaLength;
+    uint32_t crc;
+  };
+
+  struct Image {
+    Header header;
+    uint16_t presets[RADIO_PRESET_COUNT];
+    uint8_t arena[ARENA_SIZE];
+  };
+  static_assert(ARENA_SIZE <= UINT16_MAX && MAX_NAME_BYTES <= UINT8_MAX,
+                "arena length and entry length must fit their header fields");
+  static_assert(sizeof(Header) == 12 &&
+                    sizeof(Image) == sizeof(Header) +
+                                         RADIO_PRESET_COUNT * 2 + ARENA_SIZE,
+                "radio blob layout must not contain padding");
+
+  Image image;
+
+  size_t getHeaderedLength() const;
+  uint32_t computeCrc() const;
+  uint16_t entryFrequency(uint8_t index) const;
+  uint8_t entryLength(uint8_t index) const;
+  size_t nameOffset(uint8_t index) const;
+  int findEntry(uint16_t frequency) const;
+  void removeEntry(uint8_t index);
+};
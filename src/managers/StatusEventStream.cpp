@@ -0,0 +1,279 @@
+#include "StatusEventStream.h"
+#include <lwip/sockets.h>
+#include <stdarg.h>
+
+namespace {
+constexpr size_t SSE_EVENT_MAX = 256;
+constexpr size_t SSE_WRITE_BUDGET = 512;
+constexpr uint32_t SSE_KEEPALIVE_MS = 15000;
+const char SSE_RESPONSE_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "X-Accel-Buffering: no\r\n\r\n";
+const char SSE_KEEPALIVE[] = ": ping\n\n";
+
+// 向定长缓冲追加格式化文本，溢出后保持 length >= size 供调用方判定丢弃。
+void appendFormat(char *buffer, size_t size, size_t &length,
+                  const char *format, ...) {
+  if (length >= size) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + length, size - length, format, args);
+  va_end(args);
+  length = written < 0 ? size : length + static_cast<size_t>(written);
+}
+
+// WiFiClient::write 在发送窗口占满时会 select 重试直至超时，这里直接用
+// MSG_DONTWAIT 发送：只写出发送缓冲当前放得下的部分，放不下时返回 0。
+// 连接出错返回 -1。
+int writeNonBlocking(WiFiClient &socket, const uint8_t *data, size_t length) {
+  int fd = socket.fd();
+  if (fd < 0) {
+    return -1;
+  }
+  ssize_t sent = send(fd, data, length, MSG_DONTWAIT);
+  if (sent >= 0) {
+    return static_cast<int>(sent);
+  }
+  return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+}
+} // namespace
+
+bool StatusEventStream::addClient(WiFiClient &client, uint32_t intervalMs) {
+  Client *slot = nullptr;
+  for (Client &candidate : clients) {
+    if (!candidate.used) {
+      slot = &candidate;
+      break;
+    }
+  }
+  if (slot == nullptr) {
+    return false;
+  }
+  if (intervalMs < MIN_INTERVAL_MS)
+    intervalMs = MIN_INTERVAL_MS;
+  if (intervalMs > MAX_INTERVAL_MS)
+    intervalMs = MAX_INTERVAL_MS;
+
+  // 关键逻辑：响应头直接写 socket，并保留 WiFiClient 副本；
+  // WebServer 结束本次请求时只释放自己的引用，连接由这里继续持有。
+  client.setNoDelay(true);
+  client.write(reinterpret_cast<const uint8_t *>(SSE_RESPONSE_HEADER),
+               sizeof(SSE_RESPONSE_HEADER) - 1);
+  slot->socket = client;
+  slot->used = true;
+  slot->dirty = FIELD_ALL;
+  slot->intervalMs = intervalMs;
+  slot->lastEventMs = millis() - intervalMs;
+  slot->lastWriteMs = millis();
+  slot->eventId = 0;
+  slot->dropped = 0;
+  slot->head = 0;
+  slot->pending = 0;
+  ++clientCount;
+  Serial.printf("[Web][sse] client added interval=%lums clients=%u\n",
+                static_cast<unsigned long>(intervalMs), clientCount);
+  return true;
+}
+
+void StatusEventStream::publishDevice(const DeviceStatus &status) {
+  uint8_t changed = 0;
+  portENTER_CRITICAL(&statusMux);
+  if (strcmp(device.screen, status.screen) != 0)
+    changed |= FIELD_SCREEN;
+  if (device.batteryPercent != status.batteryPercent ||
+      device.batteryMillivolts / 10 != status.batteryMillivolts / 10)
+    changed |= FIELD_BATTERY;
+  if (device.wifiConnected != status.wifiConnected)
+    changed |= FIELD_WIFI;
+  if (device.weatherGeneration != status.weatherGeneration)
+    changed |= FIELD_WEATHER;
+  if (device.alarmRinging != status.alarmRinging)
+    changed |= FIELD_ALARM;
+  device = status;
+  pendingDirty |= changed;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+void StatusEventStream::publishUpload(bool active, size_t bytes) {
+  portENTER_CRITICAL(&statusMux);
+  if (uploadActive != active || uploadBytes != bytes) {
+    uploadActive = active;
+    uploadBytes = bytes;
+    pendingDirty |= FIELD_UPLOAD;
+  }
+  portEXIT_CRITICAL(&statusMux);
+}
+
+void StatusEventStream::service(uint32_t now) {
+  if (clientCount == 0) {
+    return;
+  }
+  portENTER_CRITICAL(&statusMux);
+  uint8_t changed = pendingDirty;
+  pendingDirty = 0;
+  portEXIT_CRITICAL(&statusMux);
+
+  char event[SSE_EVENT_MAX];
+  for (Client &client : clients) {
+    if (!client.used) {
+      continue;
+    }
+    if (!client.socket.connected()) {
+      dropClient(client, "disconnected");
+      continue;
+    }
+    client.dirty |= changed;
+    // 合并窗口内的多次变化只产生一个事件，事件只携带变化过的字段。
+    if (client.dirty != 0 && now - client.lastEventMs >= client.intervalMs) {
+      size_t length = formatEvent(client, client.dirty, event, sizeof(event));
+      if (enqueue(client, event, length)) {
+        client.dirty = 0;
+        client.lastEventMs = now;
+      } else {
+        // 缓冲已满说明客户端跟不上：丢弃积压，下一次改发全量快照。
+        ++client.dropped;
+        discardQueuedEvents(client);
+        client.dirty = FIELD_ALL;
+      }
+    } else if (client.pending == 0 &&
+               now - client.lastWriteMs >= SSE_KEEPALIVE_MS) {
+      enqueue(client, SSE_KEEPALIVE, sizeof(SSE_KEEPALIVE) - 1);
+    }
+    if (!drain(client, now)) {
+      dropClient(client, "write failed");
+    }
+  }
+}
+
+void StatusEventStream::closeAll() {
+  for (Client &client : clients) {
+    if (client.used) {
+      dropClient(client, "closed");
+    }
+  }
+}
+
+size_t StatusEventStream::formatEvent(Client &client, uint8_t fields,
+                                      char *buffer, size_t size) {
+  portENTER_CRITICAL(&statusMux);
+  DeviceStatus status = device;
+  bool active = uploadActive;
+  size_t bytes = uploadBytes;
+  portEXIT_CRITICAL(&statusMux);
+
+  size_t length = 0;
+  appendFormat(buffer, size, length, "id: %lu\nevent: %s\ndata: {",
+               static_cast<unsigned long>(++client.eventId),
+               fields == FIELD_ALL ? "snapshot" : "delta");
+  const char *separator = "";
+  if (fields & FIELD_SCREEN) {
+    appendFormat(buffer, size, length, "%s\"screen\":\"%s\"", separator,
+                 status.screen);
+    separator = ",";
+  }
+  if (fields & FIELD_BATTERY) {
+    appendFormat(buffer, size, length,
+                 "%s\"battery\":{\"percent\":%d,\"mv\":%u}", separator,
+                 status.batteryPercent,
+                 static_cast<unsigned>(status.batteryMillivolts));
+    separator = ",";
+  }
+  if (fields & FIELD_WIFI) {
+    appendFormat(buffer, size, length, "%s\"wifi\":%s", separator,
+                 status.wifiConnected ? "true" : "false");
+    separator = ",";
+  }
+  if (fields & FIELD_WEATHER) {
+    appendFormat(buffer, size, length, "%s\"weather\":%lu", separator,
+                 static_cast<unsigned long>(status.weatherGeneration));
+    separator = ",";
+  }
+  if (fields & FIELD_ALARM) {
+    appendFormat(buffer, size, length, "%s\"alarm\":%s", separator,
+                 status.alarmRinging ? "true" : "false");
+    separator = ",";
+  }
+  if (fields & FIELD_UPLOAD) {
+    appendFormat(buffer, size, length,
+                 "%s\"upload\":{\"active\":%s,\"bytes\":%lu}", separator,
+                 active ? "true" : "false", static_cast<unsigned long>(bytes));
+  }
+  appendFormat(buffer, size, length, "}\n\n");
+  return length < size ? length : 0;
+}
+
+bool StatusEventStream::enqueue(Client &client, const char *data,
+                                size_t length) {
+  if (length == 0 || CLIENT_BUFFER_SIZE - client.pending < length) {
+    return false;
+  }
+  size_t tail = (client.head + client.pending) % CLIENT_BUFFER_SIZE;
+  for (size_t i = 0; i < length; ++i) {
+    client.ring[(tail + i) % CLIENT_BUFFER_SIZE] =
+        static_cast<uint8_t>(data[i]);
+  }
+  client.pending += length;
+  return true;
+}
+
+void StatusEventStream::discardQueuedEvents(Client &client) {
+  // 关键逻辑：队首事件可能已写出一部分，直接清空会让客户端收到半个事件
+  // 再接上下一个，解析出错。只保留队首事件到它的 "\n\n" 结尾（事件
+  // 数据是单行 JSON，内部不会出现空行），其后的整条事件全部丢弃。
+  char previous = 0;
+  for (size_t i = 0; i < client.pending; ++i) {
+    char current =
+        static_cast<char>(client.ring[(client.head + i) % CLIENT_BUFFER_SIZE]);
+    if (previous == '\n' && current == '\n') {
+      client.pending = i + 1;
+      return;
+    }
+    previous = current;
+  }
+}
+
+bool StatusEventStream::drain(Client &client, uint32_t now) {
+  // 每轮最多写出固定字节数，且只写发送缓冲放得下的部分：单个客户端的
+  // TCP 发送窗口占满时只影响它自己的积压，不会阻塞 Web 任务。
+  size_t budget = SSE_WRITE_BUDGET;
+  while (client.pending > 0 && budget > 0) {
+    size_t contiguous = CLIENT_BUFFER_SIZE - client.head;
+    size_t chunk = client.pending < contiguous ? client.pending : contiguous;
+    if (chunk > budget)
+      chunk = budget;
+    int written =
+        writeNonBlocking(client.socket, client.ring + client.head, chunk);
+    if (written < 0) {
+      return false;
+    }
+    if (written == 0) {
+      break;
+    }
+    client.head = (client.head + written) % CLIENT_BUFFER_SIZE;
+    client.pending -= written;
+    client.lastWriteMs = now;
+    budget -= written;
+  }
+  if (client.pending == 0) {
+    client.head = 0;
+  }
+  return true;
+}
+
+void StatusEventStream::dropClient(Client &client, const char *reason) {
+  client.socket.stop();
+  client.socket = WiFiClient();
+  client.used = false;
+  client.pending = 0;
+  client.head = 0;
+  if (clientCount > 0)
+    --clientCount;
+  Serial.printf("[Web][sse] client %s events=%lu dropped=%lu clients=%u\n",
+                reason, static_cast<unsigned long>(client.eventId),
+                static_cast<unsigned long>(client.dropped), clientCount);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+
+// 设备可观察状态的快照，UI 主循环和 Web 任务各自填写自己负责的字段。
+struct DeviceStatus {
+  const char *screen = "";
+  int8_t batteryPercent = -1;
+  uint16_t batteryMillivolts = 0;
+  bool wifiConnected = false;
+  uint32_t weatherGeneration = 0;
+  bool alarmRinging = false;
+};
+
+// 系统页的 Server-Sent Events 通道：状态变化只记录脏位，按客户端各自的
+// 合并间隔生成增量事件，事件先进入每个客户端独立的环形缓冲再限量写出，
+// 慢客户端只会丢失中间态并在下一次事件里收到全量快照，不会卡住 Web 任务。
+class StatusEventStream {
+public:
+  static constexpr uint8_t MAX_CLIENTS = 3;
+  static constexpr size_t CLIENT_BUFFER_SIZE = 1024;
+  static constexpr uint32_t DEFAULT_INTERVAL_MS = 500;
+  static constexpr uint32_t MIN_INTERVAL_MS = 100;
+  static constexpr uint32_t MAX_INTERVAL_MS = 10000;
+
+  bool addClient(WiFiClient &client, uint32_t intervalMs);
+  void publishDevice(const DeviceStatus &status);
+  void publishUpload(bool active, size_t bytes);
+  void service(uint32_t now);
+  void closeAll();
+  bool hasClients() const { return clientCount > 0; }
+
+private:
+  enum Field : uint8_t {
+    FIELD_SCREEN = 1 << 0,
+    FIELD_BATTERY = 1 << 1,
+    FIELD_WIFI = 1 << 2,
+    FIELD_WEATHER = 1 << 3,
+    FIELD_ALARM = 1 << 4,
+    FIELD_UPLOAD = 1 << 5,
+    FIELD_ALL = 0x3F
+  };
+
+  struct Client {
+    WiFiClient socket;
+    bool used = false;
+    uint8_t dirty = 0;
+    uint32_t intervalMs = DEFAULT_INTERVAL_MS;
+    uint32_t lastEventMs = 0;
+    uint32_t lastWriteMs = 0;
+    uint32_t eventId = 0;
+    uint32_t dropped = 0;
+    uint8_t ring[CLIENT_BUFFER_SIZE];
+    size_t head = 0;
+    size_t pending = 0;
+  };
+
+  Client clients[MAX_CLIENTS];
+  uint8_t clientCount = 0;
+  DeviceStatus device;
+  bool uploadActive = false;
+  size_t uploadBytes = 0;
+  uint8_t pendingDirty = 0;
+  portMUX_TYPE statusMux = portMUX_INITIALIZER_UNLOCKED;
+
+  size_t formatEvent(Client &client, uint8_t fields, char *buffer,
+                     size_t size);
+  bool enqueue(Client &client, const char *data, size_t length);
+  void discardQueuedEvents(Client &client);
+  // 返回 false 表示连接已出错，调用方应移除该客户端。
+  bool drain(Client &client, uint32_t now);
+  void dropClient(Client &client, const char *reason);
+};
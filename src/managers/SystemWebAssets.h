@@ -0,0 +1,1777 @@
+#pragma once
+
+// Generated by scripts/build_web_assets.py from web/. Do not edit.
+
+#include <Arduino.h>
+
+struct SystemWebAsset {
+  const char *path;
+  const char *contentType;
+  const uint8_t *gzipData;
+  size_t gzipLength;
+  const char *etag;
+  const uint8_t *plainData;
+  size_t plainLength;
+  const char *plainEtag;
+};
+
+// index.html: 20838 -> 7100 bytes
+const uint8_t WEB_ASSET_INDEX_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3c, 0x69, 0x77, 0x1b, 0x55,
+    0x96, 0xdf, 0xf9, 0x15, 0x45, 0xa5, 0x27, 0x47, 0x85, 0x4b, 0xab, 0xb3, 0x21, 0xb9, 0xe4, 0x21,
+    0x01, 0x0e, 0x0c, 0x5b, 0x0e, 0xce, 0x34, 0x1f, 0xd2, 0x9e, 0x73, 0xca, 0xaa, 0x27, 0xab, 0xda,
+    0x52, 0x95, 0xba, 0xaa, 0xe4, 0x05, 0x45, 0xe7, 0x04, 0x66, 0x80, 0xb0, 0x38, 0xa4, 0x3b, 0x61,
+    0x09, 0x49, 0x93, 0x0e, 0x13, 0x20, 0x74, 0x0f, 0x21, 0xdd, 0x34, 0x21, 0x04, 0xa7, 0x39, 0x67,
+    0x7e, 0x4a, 0xb7, 0x25, 0xdb, 0x9f, 0x98, 0x9f, 0x30, 0x77, 0x79, 0xb5, 0x69, 0xb1, 0x1d, 0xa6,
+    0xfb, 0xcb, 0x9c, 0x9c, 0xc8, 0xaa, 0xf7, 0xee, 0xbb, 0xef, 0xee, 0xf7, 0xbe, 0xa5, 0x34, 0xf3,
+    0xb0, 0xe5, 0xd6, 0x82, 0xb5, 0xb6, 0x50, 0x1a, 0x41, 0xab, 0x59, 0x7d, 0x68, 0x06, 0xff, 0x28,
+    0x4d, 0xd3, 0x59, 0x34, 0xd4, 0x97, 0x1b, 0xd9, 0x13, 0xcf, 0xab, 0xd8, 0x26, 0x4c, 0xab, 0xfa,
+    0x90, 0xa2, 0xcc, 0xb4, 0x44, 0x60, 0x2a, 0xb5, 0x86, 0xe9, 0xf9, 0x22, 0x30, 0xd4, 0x4e, 0x50,
+    0xcf, 0x1e, 0x53, 0xe3, 0x0e, 0xc7, 0x6c, 0x09, 0x43, 0x5d, 0xb6, 0xc5, 0x4a, 0xdb, 0xf5, 0x02,
+    0x55, 0xa9, 0xb9, 0x4e, 0x20, 0x1c, 0x00, 0x5c, 0xb1, 0xad, 0xa0, 0x61, 0x58, 0x62, 0xd9, 0xae,
+    0x89, 0x2c, 0x3d, 0xe8, 0xb6, 0x63, 0x07, 0xb6, 0xd9, 0xcc, 0xfa, 0x35, 0xb3, 0x29, 0x8c, 0x22,
+    0x63, 0x09, 0xec, 0xa0, 0x29, 0xaa, 0xfd, 0x4f, 0x6e, 0x0e, 0x6e, 0xff, 0xb9, 0xff, 0xc7, 0x77,
+    0x07, 0x1f, 0xdc, 0xd9, 0xf9, 0xcd, 0x35, 0xe5, 0xbf, 0xbf, 0x55, 0xb6, 0xbe, 0xfe, 0x7e, 0xeb,
+    0xfb, 0x6b, 0xdb, 0xb7, 0xfe, 0xb2, 0x75, 0xff, 0xd6, 0x4c, 0x9e, 0xc1, 0x70, 0x80, 0x1f, 0xac,
+    0xf1, 0x37, 0x45, 0x29, 0x7b, 0xae, 0x1b, 0x74, 0xb3, 0x59, 0xdb, 0x59, 0x2a, 0x1f, 0x28, 0x1e,
+    0x2d, 0x15, 0x4a, 0x66, 0x25, 0x9b, 0x6d, 0x75, 0x02, 0x61, 0x95, 0x0f, 0x1c, 0x39, 0x72, 0xb4,
+    0x70, 0xec, 0x30, 0x3c, 0x37, 0x6d, 0x47, 0x94, 0x0f, 0x58, 0x05, 0xeb, 0xb0, 0x65, 0xc1, 0x63,
+    0xdb, 0x6c, 0x0b, 0xaf, 0x7c, 0xa0, 0x7e, 0x14, 0xfe, 0x95, 0xe0, 0xb9, 0x66, 0x7a, 0x00, 0x5d,
+    0xaf, 0xd7, 0xe1, 0xbb, 0x59, 0xab, 0x01, 0xf1, 0x80, 0xeb, 0xd8, 0x61, 0xd3, 0x5a, 0x80, 0x06,
+    0x0b, 0x84, 0x82, 0xd0, 0x0b, 0x87, 0x4a, 0xd3, 0xc5, 0x63, 0x3d, 0x9a, 0xf5, 0x91, 0xee, 0x82,
+    0xbb, 0x9a, 0xf5, 0xed, 0x97, 0x6d, 0x67, 0xb1, 0xbc, 0xe0, 0x7a, 0x96, 0xf0, 0xb2, 0xd0, 0xd2,
+    0x5b, 0x70, 0xad, 0xb5, 0x6e, 0xcb, 0xf4, 0x16, 0x6d, 0xa7, 0x5c, 0xa8, 0x2c, 0x98, 0xb5, 0xa5,
+    0x45, 0xcf, 0xed, 0x38, 0x56, 0x79, 0xd9, 0xf4, 0x32, 0x72, 0x5e, 0xad, 0x52, 0x73, 0x9b, 0xae,
+    0x27, 0x9b, 0x80, 0x6e, 0xad, 0x52, 0x07, 0x89, 0x95, 0x8b, 0x87, 0xdb, 0xab, 0xf9, 0x62, 0xee,
+    0xb0, 0xe2, 0xaf, 0xf9, 0x81, 0x68, 0x65, 0x3b, 0xb6, 0x9e, 0x35, 0xdb, 0xed, 0xa6, 0xc8, 0x72,
+    0x83, 0xae, 0x9e, 0x84, 0xd9, 0x9e, 0x04, 0x6a, 0x94, 0xb9, 0x13, 0xaa, 0xee, 0x9b, 0x8e, 0x9f,
+    0xf5, 0x85, 0x67, 0xd7, 0x99, 0xa4, 0x85, 0x4e, 0x10, 0xb8, 0x0e, 0x08, 0xb8, 0xdd, 0x09, 0x74,
+    0x5f, 0x34, 0x45, 0x2d, 0xe8, 0x12, 0x5e, 0xdb, 0x69, 0x00, 0x54, 0xd0, 0xcb, 0xf9, 0x0d, 0xd1,
+    0x6c, 0x76, 0x2d, 0xdb, 0x6f, 0x37, 0xcd, 0xb5, 0xf2, 0xa2, 0x67, 0x5b, 0x15, 0xfc, 0xc8, 0x02,
+    0x6e, 0x68, 0x09, 0x44, 0x16, 0xe8, 0xea, 0xb4, 0x1c, 0xbf, 0x5c, 0x2a, 0x16, 0xda, 0xab, 0x4a,
+    0xcb, 0x76, 0x5a, 0xe6, 0x6a, 0xa6, 0xa0, 0x17, 0xeb, 0x40, 0x33, 0x3c, 0x65, 0x1b, 0xc2, 0x5e,
+    0x6c, 0x00, 0xa1, 0x85, 0xc2, 0x72, 0x83, 0x27, 0x35, 0x7d, 0xdb, 0x12, 0xdd, 0x04, 0x9f, 0x07,
+    0x8a, 0xc5, 0xe2, 0xb1, 0xd2, 0x51, 0xc9, 0x22, 0x89, 0xb4, 0x6d, 0x5a, 0x16, 0x8a, 0xa9, 0x74,
+    0x08, 0x90, 0x16, 0xe1, 0xa3, 0xd2, 0x76, 0x7d, 0xb0, 0x02, 0xd7, 0x29, 0xfb, 0x81, 0x5d, 0x5b,
+    0x5a, 0xab, 0x04, 0x6e, 0x1b, 0xa4, 0x35, 0x01, 0xbb, 0xd2, 0x28, 0x12, 0x1f, 0x28, 0x6d, 0x51,
+    0x2e, 0x1e, 0x83, 0xf1, 0xa1, 0x80, 0x15, 0xa2, 0x13, 0xf1, 0xf6, 0x72, 0x8e, 0xb9, 0x3c, 0xc4,
+    0x9a, 0xd9, 0x2e, 0x1f, 0x93, 0x3d, 0x52, 0x38, 0x5d, 0xd6, 0x14, 0xcc, 0x25, 0xc9, 0xab, 0x2d,
+    0x58, 0x87, 0x45, 0x31, 0xa9, 0xa7, 0xc0, 0x03, 0xb1, 0xb6, 0x4d, 0x0f, 0x4c, 0xa0, 0x12, 0x88,
+    0xd5, 0x20, 0x6b, 0x36, 0xed, 0x45, 0xa7, 0xdc, 0x14, 0xf5, 0x20, 0x62, 0xa4, 0x58, 0x44, 0x46,
+    0x4a, 0x40, 0x88, 0xd4, 0xbc, 0x67, 0x5a, 0x76, 0xc7, 0xa7, 0xd9, 0x88, 0xee, 0xc4, 0x94, 0x39,
+    0xb3, 0x16, 0xd8, 0xcb, 0x42, 0x4f, 0x34, 0x95, 0x1b, 0xee, 0xb2, 0xf0, 0xba, 0x09, 0x09, 0x25,
+    0xe5, 0x57, 0x3a, 0x32, 0x5d, 0x3a, 0x74, 0xa4, 0xd7, 0x32, 0x6d, 0xa7, 0x1b, 0x4e, 0x38, 0x5d,
+    0x20, 0xa6, 0x57, 0xd9, 0x87, 0x40, 0x42, 0xc7, 0xb0, 0x21, 0x7c, 0x28, 0xfc, 0x13, 0xcf, 0xea,
+    0x83, 0xc6, 0x41, 0xa8, 0x91, 0x14, 0x1c, 0xd7, 0x11, 0x3d, 0xd9, 0x28, 0xc9, 0x88, 0xfa, 0x16,
+    0x9a, 0x6e, 0x6d, 0xa9, 0x97, 0x43, 0x07, 0x8f, 0xda, 0xea, 0x4d, 0xb1, 0x5a, 0xf9, 0x65, 0x07,
+    0x74, 0x52, 0x5f, 0xcb, 0x4a, 0x1f, 0x2e, 0x83, 0x2c, 0xc0, 0x77, 0x17, 0x44, 0xb0, 0x22, 0x84,
+    0x53, 0x21, 0x61, 0x64, 0x6d, 0x30, 0x18, 0xbf, 0x8c, 0x5e, 0x22, 0x3c, 0x12, 0x73, 0xf1, 0x48,
+    0xa4, 0x14, 0xf0, 0x02, 0xe0, 0xb1, 0x55, 0x2e, 0x15, 0x42, 0x61, 0x34, 0x4a, 0xb1, 0x43, 0xc4,
+    0x7a, 0x2c, 0x1d, 0x46, 0xd5, 0xf8, 0x9d, 0x85, 0x6e, 0xd2, 0x19, 0xc8, 0x6d, 0xb5, 0x50, 0xbf,
+    0x68, 0x2f, 0x05, 0xa5, 0xd0, 0xcb, 0xa1, 0x7b, 0x76, 0x47, 0x9c, 0x09, 0x5b, 0x35, 0xa9, 0x82,
+    0x32, 0xaa, 0xc4, 0x77, 0x9b, 0xb6, 0xa5, 0x70, 0x27, 0x3a, 0xbc, 0x36, 0xa4, 0x1f, 0x52, 0x59,
+    0xa4, 0xc4, 0x63, 0x23, 0x34, 0xa3, 0x6d, 0x4a, 0x05, 0xa2, 0x05, 0xed, 0xc7, 0x53, 0x3c, 0xd1,
+    0x16, 0x66, 0x90, 0x29, 0xe9, 0x29, 0x67, 0xd1, 0x58, 0x2a, 0x64, 0x97, 0x9e, 0xbb, 0x92, 0x96,
+    0x30, 0x75, 0xa1, 0xfe, 0xc6, 0x08, 0x13, 0x01, 0xb2, 0x2b, 0x1e, 0x40, 0xe0, 0x07, 0xd3, 0xd2,
+    0x34, 0x17, 0x44, 0x73, 0xd4, 0xb4, 0x51, 0xe4, 0xd2, 0x84, 0xa6, 0x0f, 0x1d, 0x2a, 0x1c, 0x3e,
+    0xd4, 0x23, 0xcf, 0x3f, 0x8d, 0x31, 0xdd, 0x40, 0xcb, 0x9d, 0xd7, 0x13, 0x0d, 0x6d, 0xd3, 0xf7,
+    0x57, 0x40, 0x18, 0xa9, 0xc6, 0xc0, 0x6e, 0x89, 0x54, 0x83, 0xd3, 0x69, 0x2d, 0x08, 0x6f, 0x3e,
+    0x8c, 0x1e, 0x0f, 0x20, 0xda, 0x63, 0x09, 0xc9, 0x3e, 0x8a, 0x8e, 0x91, 0xb0, 0x68, 0xb4, 0x70,
+    0x8c, 0x1e, 0x6c, 0xaf, 0x05, 0xe6, 0x6a, 0x5f, 0xc4, 0x76, 0x13, 0x26, 0x9e, 0x5b, 0x08, 0x9c,
+    0x3d, 0x28, 0x1a, 0x9a, 0x73, 0x24, 0xca, 0x86, 0x04, 0x1e, 0x43, 0xf7, 0x9d, 0x1e, 0xe7, 0xbe,
+    0x95, 0x5a, 0xc7, 0xf3, 0x61, 0x50, 0xdb, 0xb5, 0x51, 0x1f, 0xd2, 0x18, 0x60, 0xe6, 0x5c, 0xdb,
+    0xb3, 0xc1, 0x58, 0xd6, 0x46, 0xad, 0x90, 0xd3, 0x45, 0x24, 0x8f, 0xe4, 0xa4, 0x61, 0x57, 0xec,
+    0xe9, 0xc4, 0x45, 0x8e, 0x13, 0x4a, 0xca, 0xf0, 0xb9, 0x69, 0x08, 0xcb, 0x81, 0xba, 0xa8, 0x59,
+    0x35, 0x93, 0x07, 0xf9, 0x2d, 0x13, 0x82, 0x77, 0xc8, 0x02, 0x78, 0x8f, 0x82, 0x72, 0x4e, 0x04,
+    0xc6, 0xe9, 0xc8, 0x78, 0x9b, 0xb6, 0x1f, 0x8c, 0x1a, 0x0c, 0xda, 0x5c, 0x2f, 0x87, 0xe6, 0xf6,
+    0x20, 0x8a, 0x25, 0x4b, 0x8d, 0x7c, 0xa6, 0x84, 0x28, 0x2c, 0x73, 0xcd, 0x1f, 0x35, 0xe9, 0xc3,
+    0x48, 0x4d, 0xda, 0x7c, 0x09, 0x72, 0xc8, 0x7e, 0x23, 0xf8, 0xe9, 0x09, 0x1e, 0x10, 0x33, 0x54,
+    0x8a, 0x18, 0xaa, 0xdb, 0x4d, 0xb1, 0x1f, 0x6f, 0x4c, 0x39, 0xa1, 0x62, 0x76, 0x02, 0x37, 0xfe,
+    0xd8, 0xd5, 0xef, 0x22, 0x06, 0x31, 0x9f, 0x14, 0x2a, 0x51, 0x42, 0xe7, 0xb0, 0x10, 0x89, 0xe9,
+    0x80, 0x30, 0x45, 0xad, 0x0e, 0x01, 0x09, 0x09, 0x2a, 0x37, 0x4d, 0x3f, 0xc8, 0xd6, 0x1a, 0x76,
+    0xd3, 0x8a, 0xf2, 0x8a, 0xa4, 0xd7, 0x0f, 0xcc, 0xa0, 0xe3, 0x77, 0xd3, 0xca, 0xa9, 0x8c, 0x06,
+    0xba, 0xde, 0x81, 0xc0, 0x05, 0x24, 0xdd, 0x28, 0x1f, 0xd6, 0xed, 0x55, 0x61, 0x55, 0x3c, 0xca,
+    0x83, 0x18, 0x41, 0x2b, 0x89, 0x68, 0x9a, 0x48, 0x00, 0xd3, 0xdc, 0x97, 0xcc, 0xba, 0x05, 0xc8,
+    0xba, 0xc7, 0xc6, 0x65, 0x5d, 0x14, 0xa3, 0x42, 0x01, 0x3a, 0xad, 0x58, 0xb4, 0x1e, 0x17, 0x82,
+    0xbb, 0x1d, 0xac, 0x41, 0x60, 0x96, 0x06, 0x9f, 0x15, 0xcb, 0x20, 0x10, 0x9f, 0x52, 0x47, 0x85,
+    0x52, 0x21, 0xd3, 0x95, 0x2b, 0xf9, 0xcc, 0x1a, 0x13, 0x0c, 0x95, 0x04, 0x44, 0xb5, 0x70, 0x74,
+    0xb1, 0x97, 0x6b, 0xb9, 0x16, 0xd4, 0x74, 0x48, 0x90, 0xe5, 0xb9, 0xed, 0x54, 0x06, 0xaa, 0x0c,
+    0x31, 0x67, 0x3b, 0x50, 0x43, 0xa6, 0x6b, 0x23, 0x49, 0xfd, 0xa3, 0x8f, 0x8e, 0x53, 0xcd, 0x70,
+    0x42, 0x1a, 0xd2, 0x18, 0xe5, 0x99, 0xa1, 0xf9, 0x73, 0x6e, 0x5b, 0x38, 0x29, 0x8b, 0x93, 0x7a,
+    0x21, 0xb0, 0xee, 0x70, 0x9c, 0x60, 0x99, 0x82, 0xed, 0x64, 0x0e, 0x61, 0xa2, 0xd5, 0x31, 0xdc,
+    0xec, 0x9a, 0x3a, 0x12, 0x73, 0x2a, 0x8d, 0x69, 0x99, 0xdd, 0xb2, 0x54, 0xc4, 0x84, 0xa4, 0x98,
+    0x94, 0x75, 0xfd, 0xdd, 0x73, 0x2b, 0xb9, 0x8b, 0x70, 0x62, 0xf7, 0xac, 0x24, 0x50, 0x15, 0xa3,
+    0x6a, 0xe2, 0x9f, 0x5b, 0xc2, 0xb2, 0xcd, 0x4c, 0xac, 0xfe, 0xa3, 0x48, 0x80, 0xd6, 0x95, 0xf5,
+    0xdc, 0x78, 0x57, 0x00, 0x0f, 0xe8, 0x71, 0x71, 0x26, 0xcb, 0x2a, 0xf2, 0x81, 0x44, 0xe1, 0x65,
+    0x42, 0xe9, 0x15, 0x1b, 0x09, 0xa6, 0xaa, 0xa8, 0xda, 0x8a, 0xca, 0xab, 0x63, 0xb2, 0xce, 0x49,
+    0x57, 0x57, 0xc4, 0x0b, 0x96, 0x30, 0xf5, 0xa6, 0xbb, 0x42, 0x78, 0x53, 0x35, 0xd6, 0x4a, 0x03,
+    0xf4, 0x97, 0xa5, 0xba, 0x01, 0x0c, 0x80, 0x02, 0x41, 0xaa, 0x98, 0x21, 0xc6, 0x38, 0xc1, 0x4e,
+    0x26, 0x9d, 0x5d, 0x7e, 0x62, 0xbf, 0xc2, 0xb3, 0x22, 0x10, 0x78, 0x9b, 0x00, 0x81, 0x5a, 0x18,
+    0x9c, 0x53, 0x95, 0x0f, 0x0a, 0x6f, 0x26, 0x2f, 0x57, 0x0a, 0x33, 0x79, 0x5e, 0xcb, 0xcc, 0x60,
+    0x81, 0x0e, 0x7f, 0x2c, 0x7b, 0x59, 0xa9, 0x81, 0x03, 0xfb, 0x86, 0x4a, 0x52, 0xe4, 0x75, 0x08,
+    0x49, 0xa0, 0x3a, 0xd3, 0x28, 0x0e, 0xaf, 0x45, 0x60, 0x78, 0xb1, 0x3a, 0x83, 0x4c, 0xca, 0x41,
+    0xf0, 0x55, 0xe5, 0xf5, 0xc7, 0x0c, 0xb3, 0x1d, 0x76, 0x70, 0x9d, 0xa5, 0x2a, 0x96, 0x19, 0x98,
+    0x50, 0xee, 0x2f, 0xc2, 0xc2, 0x28, 0x70, 0x2d, 0xd7, 0x57, 0xab, 0x3b, 0x9f, 0xbd, 0xbf, 0x73,
+    0xfd, 0x1b, 0xe5, 0x14, 0x3c, 0xcd, 0xe4, 0x79, 0x50, 0x1a, 0x43, 0x62, 0x88, 0xd9, 0x34, 0xbd,
+    0x16, 0x8e, 0xf9, 0xe0, 0x3b, 0x98, 0x7d, 0xe7, 0xb5, 0x75, 0x5a, 0xff, 0xec, 0x31, 0x08, 0xa5,
+    0x01, 0x63, 0x06, 0xef, 0xbf, 0xb1, 0xf9, 0xfd, 0x9d, 0xad, 0x5b, 0xd7, 0xb7, 0x2e, 0xbc, 0xbe,
+    0xe7, 0x18, 0x34, 0x6f, 0x17, 0xc6, 0x5c, 0xba, 0xb3, 0x73, 0xed, 0xeb, 0xc1, 0xd5, 0x7b, 0x7b,
+    0x53, 0xd6, 0xb6, 0x61, 0x8e, 0xc7, 0x4e, 0x3e, 0x9d, 0x84, 0x9c, 0xc9, 0x83, 0x3c, 0xaa, 0x33,
+    0xed, 0x48, 0xa4, 0x9d, 0x05, 0x55, 0xb1, 0x2d, 0x43, 0xe5, 0xa5, 0xdf, 0x1c, 0x85, 0x43, 0xb5,
+    0xba, 0xf5, 0xd6, 0x9d, 0xc1, 0xd9, 0x57, 0xb6, 0x7f, 0xf8, 0x78, 0x70, 0xfe, 0xd3, 0xcd, 0xbb,
+    0x5f, 0xfe, 0xf5, 0xec, 0x67, 0x33, 0xf9, 0x76, 0x75, 0x26, 0xcf, 0x62, 0xa7, 0xe5, 0x24, 0x18,
+    0x8a, 0x9c, 0x5a, 0x16, 0xae, 0x84, 0x86, 0x25, 0x38, 0x24, 0xe2, 0x6a, 0x52, 0x89, 0xa8, 0x5d,
+    0x6e, 0x01, 0xf5, 0x95, 0xd2, 0xb2, 0x86, 0xe7, 0x34, 0x69, 0xd5, 0xcd, 0x1f, 0x7e, 0xdb, 0xff,
+    0xf2, 0xc3, 0xfe, 0xd5, 0x9b, 0xb0, 0xb2, 0xec, 0xdf, 0x78, 0x43, 0x79, 0xfe, 0xe7, 0x73, 0x3f,
+    0x6e, 0xbc, 0xb3, 0x79, 0x77, 0x7d, 0xf3, 0x2f, 0xbf, 0xdd, 0xfe, 0xe6, 0x7d, 0x65, 0xee, 0xf1,
+    0x13, 0x50, 0x5b, 0xfe, 0xed, 0xec, 0xab, 0x4c, 0x1f, 0x61, 0x4d, 0xab, 0x19, 0x32, 0xb2, 0x22,
+    0x4b, 0x02, 0xe6, 0xd4, 0x37, 0x97, 0xc5, 0x29, 0x56, 0x34, 0x63, 0x8f, 0xe4, 0x23, 0xc7, 0x23,
+    0xb1, 0x21, 0x2f, 0xcf, 0x42, 0x82, 0x8e, 0xd8, 0xc1, 0x6c, 0xad, 0x4e, 0x9c, 0x85, 0xb1, 0x83,
+    0xeb, 0x20, 0x72, 0x54, 0xee, 0xed, 0xfe, 0x27, 0x1f, 0x6f, 0xde, 0x7b, 0x7b, 0xe7, 0xfa, 0x77,
+    0x89, 0x19, 0xa4, 0xb0, 0xc6, 0x88, 0x2e, 0xb4, 0xa4, 0xdd, 0x84, 0x95, 0x32, 0xb2, 0x51, 0x69,
+    0xed, 0x5c, 0xfc, 0xf7, 0xfe, 0x7f, 0xde, 0xee, 0xbf, 0xfb, 0xd5, 0xce, 0xd9, 0x37, 0x07, 0x6f,
+    0x7f, 0xd1, 0x7f, 0xfd, 0x35, 0x00, 0x64, 0x2b, 0xfb, 0xdb, 0xd9, 0x57, 0x58, 0x56, 0xca, 0xe0,
+    0x77, 0xdf, 0x6d, 0x5d, 0xb9, 0xd5, 0xbf, 0xff, 0x9e, 0xf2, 0xdc, 0xc9, 0x69, 0x65, 0x70, 0xee,
+    0xfd, 0xed, 0xfb, 0xff, 0x35, 0x58, 0xff, 0xa4, 0x7f, 0xe1, 0xfc, 0xd6, 0x47, 0xff, 0xd1, 0x3f,
+    0x7f, 0x6d, 0xeb, 0xd2, 0x35, 0xc6, 0xf3, 0xe3, 0xc6, 0xb9, 0x9c, 0x17, 0x38, 0x3f, 0x6e, 0xbc,
+    0xf9, 0xc0, 0xf2, 0x7d, 0x4c, 0xf2, 0xb2, 0xbb, 0x80, 0x89, 0xe3, 0x9f, 0x22, 0x61, 0x42, 0x1f,
+    0x8a, 0x98, 0x85, 0x12, 0xcf, 0x91, 0x10, 0x1f, 0xae, 0x3b, 0x00, 0x5d, 0xdd, 0xf5, 0x5a, 0x34,
+    0xd4, 0x83, 0xa8, 0x06, 0x30, 0xe2, 0x49, 0x68, 0x88, 0xe6, 0x84, 0xb2, 0x1f, 0x60, 0xa8, 0xa8,
+    0x55, 0xa8, 0xa8, 0x25, 0xf7, 0x54, 0xd3, 0x03, 0xa8, 0x05, 0xab, 0xc4, 0x76, 0x00, 0x14, 0x74,
+    0xc0, 0x15, 0xf3, 0xad, 0xb6, 0x58, 0xd4, 0x73, 0xad, 0xf6, 0xb4, 0xaa, 0x78, 0xe2, 0x57, 0x1d,
+    0xdb, 0x13, 0xd6, 0x6e, 0xb2, 0xa9, 0xb2, 0x98, 0x37, 0xef, 0xde, 0x4b, 0xca, 0x38, 0x21, 0x1a,
+    0xa4, 0x32, 0x64, 0x7d, 0x17, 0x33, 0x91, 0xb1, 0x63, 0x17, 0x2b, 0x09, 0xf5, 0x9c, 0x8a, 0x2e,
+    0x23, 0xc6, 0x12, 0x21, 0x3b, 0x69, 0x06, 0x0d, 0xb5, 0x9a, 0xdf, 0x4d, 0xc1, 0x52, 0x18, 0xa2,
+    0xee, 0x09, 0xbf, 0xf1, 0x24, 0x13, 0xd0, 0x3f, 0xf7, 0x2d, 0xc8, 0x7f, 0x9c, 0x6a, 0x27, 0x08,
+    0xbf, 0xd3, 0x6e, 0xba, 0xa6, 0xb5, 0x6f, 0xd1, 0x4b, 0x70, 0x7a, 0xde, 0x97, 0x7c, 0x37, 0xef,
+    0xbe, 0xb5, 0xb9, 0xf1, 0xbb, 0x09, 0x02, 0x1d, 0xa6, 0x2b, 0xe2, 0xfe, 0xd9, 0xa4, 0xc5, 0x8d,
+    0x52, 0x9f, 0x68, 0x61, 0x62, 0xfd, 0xc0, 0x73, 0x9d, 0x45, 0x90, 0xb1, 0x32, 0xf8, 0xe6, 0xed,
+    0x9d, 0xb3, 0xd7, 0x30, 0x6f, 0x51, 0xcb, 0x44, 0xa9, 0x75, 0x9c, 0xe3, 0xc2, 0xa9, 0x35, 0x80,
+    0xc8, 0x25, 0x90, 0xda, 0xc6, 0xd9, 0xfe, 0xe7, 0x6f, 0x87, 0x43, 0xd3, 0xb2, 0x1b, 0x55, 0xcf,
+    0x02, 0x0e, 0x9c, 0xeb, 0xb4, 0x98, 0xc1, 0xfe, 0xed, 0x8f, 0x06, 0x1f, 0xfc, 0x8e, 0xc7, 0x6e,
+    0x7d, 0x7f, 0x71, 0xf0, 0xf1, 0xd5, 0x84, 0xce, 0x76, 0xb1, 0x18, 0x99, 0x39, 0x76, 0xb1, 0x98,
+    0x44, 0x52, 0x19, 0x0d, 0x2a, 0x83, 0x2f, 0x3f, 0xdd, 0xfe, 0xe1, 0x4a, 0x7f, 0xfd, 0xbd, 0xcd,
+    0xfb, 0xeb, 0xfd, 0x6b, 0xf7, 0x36, 0xef, 0x9d, 0xef, 0xdf, 0xbf, 0xd8, 0x7f, 0x73, 0x5d, 0x81,
+    0xea, 0x4b, 0x59, 0x7a, 0xea, 0x65, 0x65, 0xf3, 0x87, 0xeb, 0x3b, 0xaf, 0x5c, 0x1c, 0xdc, 0xbc,
+    0xde, 0xff, 0xf8, 0xed, 0x07, 0x8e, 0x14, 0x2f, 0x32, 0x71, 0x93, 0x03, 0x45, 0x42, 0x1f, 0x0a,
+    0x56, 0x19, 0x32, 0x99, 0x03, 0x8f, 0xb4, 0x5c, 0xa9, 0x02, 0x61, 0x40, 0xe1, 0xce, 0x27, 0xbf,
+    0xde, 0x3a, 0xff, 0xc6, 0x0c, 0x2f, 0x87, 0x63, 0xae, 0xe7, 0x02, 0xd1, 0x06, 0x3e, 0xdd, 0x36,
+    0x09, 0x63, 0xd9, 0x6c, 0x76, 0xc0, 0xc6, 0x8a, 0x05, 0xb5, 0x5a, 0xc8, 0x15, 0x95, 0xe7, 0x9e,
+    0x7a, 0x79, 0x26, 0xcf, 0x5d, 0xc3, 0x20, 0x25, 0x02, 0x29, 0xed, 0x06, 0x72, 0x98, 0x40, 0x0e,
+    0xef, 0x06, 0x02, 0x02, 0x52, 0xab, 0xc5, 0x5c, 0x21, 0x0d, 0x93, 0x67, 0x22, 0xe1, 0x0b, 0x33,
+    0x90, 0x66, 0x67, 0x4e, 0x88, 0x25, 0x65, 0xe7, 0xc3, 0x73, 0xfd, 0xb3, 0x1b, 0xd2, 0x31, 0x22,
+    0x66, 0x4e, 0x35, 0xd0, 0xfd, 0xdc, 0x26, 0x58, 0x2f, 0x3b, 0x0b, 0x6f, 0x02, 0xa8, 0xb8, 0xfd,
+    0x67, 0xa8, 0x05, 0xf8, 0x6b, 0xae, 0xc2, 0xa4, 0x87, 0xd5, 0xf1, 0xa8, 0xc7, 0x39, 0x5d, 0x84,
+    0xfb, 0x38, 0x74, 0x85, 0x68, 0x6b, 0x0d, 0x51, 0x5b, 0x5a, 0x70, 0x57, 0x41, 0x2b, 0xf7, 0xcf,
+    0x83, 0x5d, 0x40, 0x8c, 0xed, 0x6f, 0xdc, 0x0b, 0x71, 0xee, 0x03, 0xd9, 0x73, 0xae, 0xe3, 0x8e,
+    0x22, 0x03, 0x1c, 0xfd, 0x73, 0x77, 0x40, 0x5d, 0x10, 0xf6, 0xc0, 0x5e, 0x1e, 0x9c, 0xc6, 0x39,
+    0xb7, 0x1e, 0x3c, 0x07, 0xab, 0xb1, 0x51, 0xd4, 0xdb, 0xf7, 0xbf, 0xda, 0xf9, 0xed, 0x65, 0x20,
+    0x35, 0x85, 0x74, 0xa2, 0x53, 0x37, 0xa6, 0xab, 0x6c, 0x2f, 0x50, 0xda, 0x40, 0x94, 0xec, 0x5f,
+    0x58, 0x07, 0xbb, 0x9f, 0x8e, 0xf3, 0x12, 0x95, 0xdc, 0xae, 0x33, 0x39, 0x33, 0xed, 0xe9, 0x72,
+    0x5c, 0x7b, 0xed, 0xe2, 0x71, 0x54, 0x96, 0x8d, 0xfa, 0x5a, 0xff, 0xdb, 0x3f, 0xb1, 0x27, 0x40,
+    0x2a, 0x86, 0x9a, 0x68, 0x49, 0x38, 0x0a, 0xd6, 0x3a, 0x1b, 0x1f, 0xf5, 0xaf, 0x7c, 0x0c, 0xc1,
+    0xad, 0x7f, 0xee, 0xf6, 0xe0, 0x9b, 0x77, 0xb7, 0x3f, 0x3f, 0xd7, 0xbf, 0x7c, 0xf3, 0xc7, 0x8d,
+    0x2b, 0x5b, 0xef, 0x5d, 0xde, 0xfa, 0xe2, 0xde, 0xf6, 0xf5, 0x9b, 0x5b, 0x37, 0xee, 0x21, 0xd8,
+    0x0f, 0xb7, 0x06, 0x97, 0xbe, 0x7b, 0xf0, 0x5c, 0x4d, 0xb4, 0xfe, 0x1f, 0x1c, 0xf0, 0xc6, 0x17,
+    0x83, 0xdb, 0x97, 0x14, 0xe0, 0x88, 0x29, 0x4e, 0xa8, 0x6d, 0x45, 0x40, 0x6e, 0x11, 0x1e, 0x35,
+    0x87, 0x5a, 0x0b, 0xb7, 0x8c, 0x54, 0x5a, 0x19, 0xd4, 0x5c, 0x58, 0x32, 0x88, 0x00, 0xda, 0xdd,
+    0x7a, 0x5d, 0x55, 0x60, 0x4d, 0x50, 0x13, 0x68, 0xe2, 0xc2, 0x33, 0xd4, 0xc1, 0xd5, 0xdf, 0x73,
+    0xa9, 0x33, 0xc1, 0xa0, 0xab, 0xdb, 0x6f, 0xbd, 0xda, 0x7f, 0xe5, 0x8d, 0xc1, 0x07, 0x9f, 0x8e,
+    0x9d, 0xbc, 0x81, 0x1b, 0x01, 0xe6, 0xda, 0x3f, 0x68, 0xf2, 0x49, 0x96, 0x5a, 0x6b, 0x0a, 0xd3,
+    0x7b, 0x89, 0xf9, 0x1e, 0x35, 0xd4, 0xc1, 0xdd, 0xd7, 0x76, 0x2e, 0xdf, 0x90, 0x12, 0x63, 0x82,
+    0xf7, 0xe5, 0x56, 0x84, 0xf5, 0x29, 0x66, 0x68, 0x12, 0xd6, 0x58, 0x1a, 0x29, 0xc4, 0x49, 0x57,
+    0x48, 0x5a, 0xec, 0x4c, 0x9e, 0x4b, 0x78, 0xee, 0x7a, 0x28, 0x51, 0xf5, 0x9a, 0xb1, 0xa5, 0xc7,
+    0xcd, 0xb4, 0x58, 0x3e, 0x2e, 0x97, 0xed, 0x91, 0x57, 0xa4, 0x57, 0xf3, 0x69, 0x8b, 0xa7, 0x3e,
+    0xf2, 0xb6, 0x18, 0xc1, 0x29, 0x3c, 0x17, 0x42, 0xe4, 0xe8, 0x6e, 0xed, 0x44, 0xbb, 0x58, 0xa5,
+    0x39, 0xdb, 0xa1, 0x1c, 0xa2, 0x9e, 0xa7, 0x51, 0x06, 0x2f, 0xc1, 0xd2, 0x54, 0x55, 0x68, 0x81,
+    0x08, 0x2b, 0x95, 0xc4, 0xd2, 0x91, 0x6b, 0xc0, 0x0b, 0xeb, 0x5b, 0x9f, 0xdf, 0x4e, 0x48, 0x2b,
+    0x1e, 0x18, 0xca, 0x2a, 0x90, 0xf8, 0xa5, 0xac, 0x87, 0xa9, 0x0c, 0x37, 0x01, 0xd4, 0x89, 0x59,
+    0x9c, 0xc0, 0x4e, 0x98, 0x4e, 0x4d, 0x00, 0x4b, 0xfd, 0x77, 0xdf, 0x1f, 0xdc, 0x39, 0x17, 0xfb,
+    0xca, 0x1e, 0x4e, 0xc6, 0x63, 0x5d, 0xa7, 0x6e, 0x63, 0xd1, 0xba, 0x75, 0xfd, 0x56, 0xff, 0xd6,
+    0x47, 0xc3, 0x8e, 0x96, 0xf8, 0x7c, 0x68, 0xc6, 0xaf, 0x79, 0x76, 0x3b, 0x40, 0x25, 0xc1, 0x72,
+    0xd9, 0x0f, 0x14, 0x8c, 0x47, 0xc2, 0xe8, 0xd2, 0xda, 0xaa, 0x7c, 0x7a, 0x5e, 0xe7, 0x95, 0x02,
+    0x7e, 0x0b, 0xeb, 0x53, 0x78, 0x50, 0xfd, 0xb6, 0x5d, 0xaf, 0xfb, 0xe5, 0x3c, 0xf5, 0x52, 0x5d,
+    0x0a, 0xfd, 0x18, 0x37, 0xcb, 0x4e, 0xa7, 0xd9, 0xd4, 0xdb, 0x60, 0x92, 0x65, 0x35, 0xaf, 0xf6,
+    0x2a, 0x11, 0x5e, 0xdc, 0xf4, 0x33, 0x4e, 0xab, 0x60, 0x32, 0xaa, 0xae, 0x6e, 0xde, 0x3d, 0x8b,
+    0x9f, 0xf7, 0xde, 0xa1, 0xef, 0x6f, 0xc2, 0x67, 0xff, 0xca, 0x15, 0x6a, 0xb9, 0x84, 0xdf, 0x5f,
+    0xfb, 0x52, 0x9d, 0x8f, 0x47, 0xfe, 0xcc, 0xe0, 0x24, 0xe6, 0x7a, 0x46, 0xd5, 0x72, 0x6b, 0x9d,
+    0x96, 0x70, 0x82, 0xdc, 0xaf, 0x3a, 0xc2, 0x5b, 0x9b, 0x93, 0xed, 0x99, 0x10, 0x40, 0x8b, 0x47,
+    0x91, 0x69, 0x19, 0x2d, 0xe1, 0xfb, 0xb8, 0x40, 0xad, 0x76, 0xb9, 0x55, 0x34, 0x8d, 0x9f, 0x65,
+    0x54, 0xde, 0xae, 0x52, 0xb5, 0x8a, 0x68, 0xe6, 0x50, 0x5b, 0x27, 0xe4, 0xc9, 0xa4, 0x84, 0xc6,
+    0x66, 0x92, 0x2f, 0x06, 0xe5, 0x1c, 0x2c, 0x01, 0x32, 0x2a, 0xee, 0x6c, 0x01, 0xbc, 0x2f, 0x82,
+    0x53, 0x76, 0x4b, 0xb8, 0x9d, 0x20, 0x93, 0xd1, 0x8c, 0x6a, 0x0a, 0xce, 0x13, 0x2d, 0x77, 0x59,
+    0x84, 0xa0, 0x7a, 0xa9, 0x54, 0x28, 0x68, 0xc4, 0xbf, 0xe9, 0xaf, 0x39, 0x35, 0xa5, 0xde, 0x71,
+    0x38, 0x64, 0x63, 0x7d, 0x29, 0xfc, 0x20, 0xd3, 0xf1, 0x9a, 0x3a, 0xa7, 0x69, 0xdf, 0xe8, 0xf6,
+    0x34, 0x49, 0x20, 0x64, 0xdd, 0x36, 0x7c, 0x11, 0x86, 0xb9, 0x62, 0xda, 0x81, 0x52, 0x17, 0x41,
+    0xad, 0x91, 0x04, 0xc5, 0x6d, 0x63, 0x16, 0x67, 0x60, 0x4a, 0x98, 0x70, 0x48, 0xee, 0x97, 0xbe,
+    0xeb, 0x64, 0xb4, 0x8a, 0x5d, 0xcf, 0x3c, 0x1c, 0xb5, 0xb9, 0x4b, 0x5a, 0xd0, 0x00, 0x0f, 0x57,
+    0x1c, 0xb1, 0xa2, 0x3c, 0xe1, 0x79, 0x20, 0x2c, 0x1c, 0x9a, 0x93, 0xac, 0x9e, 0x39, 0xa3, 0x6e,
+    0x7f, 0xf5, 0xed, 0xe0, 0x8f, 0xaf, 0xf6, 0x6f, 0xfc, 0x71, 0xfb, 0xcf, 0x9f, 0x02, 0x8b, 0x9e,
+    0x08, 0x3a, 0x1e, 0xaf, 0xed, 0x7b, 0xa3, 0xc4, 0x73, 0xa1, 0xfc, 0xb4, 0x73, 0xa2, 0xd1, 0x71,
+    0x96, 0xfc, 0x0c, 0x16, 0xb5, 0x21, 0xe5, 0x60, 0x7d, 0x8f, 0x83, 0xe9, 0xe4, 0x1c, 0x77, 0x25,
+    0xa3, 0xe5, 0x02, 0x28, 0x87, 0xd0, 0x60, 0x32, 0xd3, 0x47, 0xb4, 0xa9, 0xe7, 0xc0, 0x1c, 0x72,
+    0x9e, 0xe9, 0x58, 0x6e, 0x6b, 0xa8, 0x2b, 0xe7, 0x37, 0xed, 0x9a, 0xc8, 0x94, 0xf4, 0x63, 0x9a,
+    0x5e, 0x43, 0x9c, 0x46, 0xb1, 0x70, 0xe8, 0xd8, 0xe1, 0xa3, 0x47, 0x2a, 0x10, 0x2b, 0x15, 0x88,
+    0x94, 0x78, 0xb2, 0x5c, 0xd0, 0x81, 0x28, 0xcf, 0x16, 0xbe, 0x81, 0x47, 0x45, 0x5e, 0xa6, 0x52,
+    0x09, 0xe7, 0x14, 0x8e, 0x65, 0x10, 0x72, 0xdc, 0xa6, 0x63, 0xe8, 0x29, 0x42, 0xa3, 0x23, 0x65,
+    0x39, 0xdc, 0x64, 0xd5, 0x74, 0xdc, 0x90, 0x35, 0x00, 0xb2, 0x6a, 0x44, 0x8d, 0x3a, 0x89, 0x0f,
+    0x45, 0x82, 0x4b, 0x04, 0x20, 0xdb, 0x04, 0xb9, 0x91, 0x5c, 0xcc, 0x76, 0x1b, 0x40, 0x33, 0xbc,
+    0x36, 0x90, 0x58, 0x88, 0x44, 0xc6, 0xae, 0x43, 0xa7, 0xc6, 0xcd, 0x78, 0xbc, 0x1d, 0x6a, 0x03,
+    0x14, 0x64, 0xa8, 0x79, 0x48, 0xc4, 0x79, 0x5a, 0x31, 0xe5, 0x59, 0x4c, 0xb3, 0xe8, 0x06, 0x86,
+    0x3a, 0x05, 0x85, 0xb5, 0x6b, 0x89, 0x7f, 0x7d, 0xf1, 0xe9, 0x13, 0x90, 0x03, 0xc0, 0x81, 0x9c,
+    0x20, 0x43, 0x5e, 0x96, 0xc3, 0x7e, 0x6d, 0x4a, 0x3d, 0x28, 0xa5, 0x0a, 0xee, 0x3b, 0x65, 0x5b,
+    0xf0, 0x2c, 0xf9, 0x56, 0xa7, 0x24, 0x4b, 0x19, 0x64, 0x61, 0x56, 0x3d, 0x58, 0xb7, 0x1d, 0xb3,
+    0x69, 0x14, 0xd5, 0xb2, 0x0a, 0x8a, 0x0a, 0xbc, 0xb5, 0xd8, 0x66, 0x3a, 0xcd, 0x20, 0xb2, 0x86,
+    0xd8, 0xbc, 0xba, 0x2d, 0x11, 0x34, 0x5c, 0xab, 0xac, 0x9e, 0x7c, 0x61, 0xee, 0x94, 0xaa, 0xe3,
+    0x26, 0x57, 0x99, 0x14, 0xab, 0x55, 0xe4, 0x14, 0x3c, 0x14, 0x6c, 0xb7, 0x26, 0xec, 0x65, 0xdc,
+    0x63, 0x8e, 0x04, 0x0d, 0x56, 0x84, 0xb3, 0x6a, 0xd2, 0x1e, 0x18, 0xb0, 0x57, 0x33, 0xd1, 0x1e,
+    0x05, 0xda, 0x91, 0xd6, 0x05, 0x90, 0xa9, 0x29, 0x39, 0xa2, 0x3a, 0x2d, 0xed, 0x8c, 0xfa, 0x2a,
+    0x71, 0x2c, 0xe9, 0xf8, 0x43, 0x84, 0x8d, 0xca, 0x29, 0xcf, 0x70, 0xb3, 0x29, 0x31, 0xb0, 0x1d,
+    0x73, 0x4f, 0x6e, 0x09, 0x8c, 0xca, 0x39, 0x28, 0xe5, 0x52, 0x2d, 0xa4, 0xa6, 0x92, 0x9c, 0x24,
+    0x21, 0x67, 0xe5, 0x43, 0xc8, 0x56, 0xb9, 0xd0, 0xeb, 0x8d, 0x31, 0x66, 0x58, 0x2d, 0x65, 0x38,
+    0x18, 0xeb, 0x7e, 0x07, 0x96, 0xdb, 0xbe, 0xaf, 0x75, 0x51, 0xaa, 0x4c, 0x2f, 0xf7, 0xb0, 0x3f,
+    0x85, 0xdd, 0x14, 0x37, 0xa2, 0xa7, 0xb4, 0x34, 0x90, 0x65, 0x17, 0xec, 0x82, 0x1e, 0x65, 0x63,
+    0x85, 0x07, 0xd0, 0x43, 0xe8, 0x72, 0x1a, 0x91, 0x12, 0x11, 0x81, 0x4e, 0xfb, 0x02, 0xfb, 0x36,
+    0x79, 0xa6, 0xd6, 0x65, 0x89, 0x0f, 0xe9, 0x0e, 0x4b, 0x3a, 0xe1, 0xf9, 0xe5, 0xae, 0x2a, 0x83,
+    0x55, 0xf6, 0x14, 0x24, 0x1b, 0xb0, 0x04, 0xbc, 0x0a, 0x60, 0xd7, 0xa8, 0x86, 0xcc, 0x23, 0x2e,
+    0xb5, 0xc7, 0x7a, 0xfe, 0x97, 0xb9, 0x17, 0x9e, 0xcf, 0xf9, 0xe4, 0x68, 0x76, 0x7d, 0x8d, 0x51,
+    0xa7, 0x67, 0xc6, 0x40, 0x75, 0x12, 0x08, 0xca, 0x80, 0xb0, 0xbb, 0xe3, 0x03, 0xeb, 0x63, 0xcd,
+    0x26, 0x04, 0x34, 0xce, 0xe3, 0xaa, 0x96, 0x03, 0xe7, 0x7b, 0xc2, 0x44, 0x8e, 0x9b, 0x43, 0xb1,
+    0x2f, 0x70, 0x17, 0x17, 0x9b, 0x10, 0xfb, 0xe4, 0x1e, 0x9c, 0x0e, 0x9d, 0x10, 0x0e, 0x0c, 0x03,
+    0x30, 0x83, 0x5f, 0x4d, 0x46, 0x9d, 0xd8, 0x20, 0x7e, 0x40, 0xf4, 0xc8, 0x0f, 0xa8, 0x3d, 0x47,
+    0xdb, 0x8f, 0x3c, 0x11, 0x32, 0xf7, 0xc0, 0x73, 0x71, 0x83, 0x51, 0x0d, 0x8f, 0xe5, 0x2d, 0xeb,
+    0x09, 0x3c, 0xeb, 0xc0, 0x69, 0x85, 0x23, 0xbc, 0x0c, 0x54, 0x43, 0x76, 0x6d, 0x49, 0xd5, 0x31,
+    0xdc, 0x47, 0x02, 0x93, 0xc0, 0x49, 0x1a, 0x34, 0x8d, 0x72, 0x4f, 0x24, 0xdc, 0x85, 0x8e, 0xdd,
+    0xb4, 0x1e, 0x87, 0x9c, 0x97, 0x69, 0x99, 0xfe, 0x92, 0xee, 0x42, 0xc4, 0xc4, 0xb3, 0xbc, 0x30,
+    0x70, 0x41, 0x29, 0x65, 0x44, 0xb4, 0xd6, 0x3c, 0x28, 0xe1, 0xc4, 0x13, 0x4d, 0x81, 0x4f, 0x19,
+    0xa8, 0x39, 0x96, 0x55, 0x3c, 0x68, 0x58, 0x65, 0x09, 0x3c, 0x4f, 0xd7, 0x68, 0x30, 0x7d, 0xaa,
+    0x15, 0xfc, 0x8c, 0x48, 0xcf, 0x60, 0x04, 0xd2, 0x6d, 0xc7, 0x12, 0xab, 0x5a, 0x94, 0xe0, 0xa8,
+    0xe8, 0x98, 0x88, 0x9a, 0x7a, 0xd5, 0x30, 0x6a, 0x51, 0x11, 0x33, 0x11, 0x96, 0x7a, 0x01, 0x96,
+    0xfe, 0xe6, 0x86, 0xca, 0x40, 0xd9, 0x4a, 0xcf, 0xc2, 0x32, 0x8e, 0xbb, 0x60, 0xf9, 0xa6, 0x43,
+    0xbc, 0x1e, 0xcc, 0x14, 0x67, 0x66, 0x98, 0xaa, 0x70, 0xf0, 0x18, 0xa9, 0x92, 0x34, 0xd4, 0x58,
+    0x2e, 0x12, 0x32, 0x14, 0xe9, 0x82, 0x1d, 0x18, 0x84, 0xa3, 0x42, 0x24, 0x87, 0x61, 0x99, 0x6f,
+    0xb1, 0xa8, 0xfd, 0x5f, 0xdf, 0x54, 0xa7, 0x38, 0xfe, 0xa2, 0x98, 0x64, 0x27, 0x41, 0x6a, 0xbd,
+    0x28, 0x85, 0xe1, 0xc5, 0x9b, 0xa4, 0x4a, 0x80, 0x3d, 0xd6, 0x08, 0x74, 0x68, 0x5d, 0xcc, 0x2f,
+    0x48, 0xae, 0x51, 0x20, 0x1c, 0xa3, 0xf6, 0x22, 0xf9, 0x8f, 0xc4, 0xcd, 0xd2, 0xaa, 0x62, 0xd4,
+    0x4b, 0x31, 0xaf, 0x21, 0x96, 0x33, 0x06, 0x30, 0xfd, 0x3c, 0x2d, 0x91, 0x33, 0x23, 0x9c, 0x24,
+    0x68, 0x42, 0xd8, 0x14, 0x51, 0x78, 0xa8, 0x75, 0x9c, 0xcc, 0x29, 0x83, 0x95, 0x88, 0x0e, 0xd2,
+    0xb0, 0x9a, 0xc2, 0xd3, 0xf9, 0xe4, 0xd7, 0xa8, 0x9b, 0x4d, 0x3f, 0x36, 0x1a, 0xb6, 0xd5, 0x49,
+    0x0a, 0x0b, 0x6d, 0xbb, 0x22, 0xcd, 0x33, 0x61, 0x3d, 0x58, 0x26, 0xd2, 0x49, 0xb1, 0x3a, 0x95,
+    0x61, 0xcc, 0xb3, 0x78, 0x16, 0x81, 0x5f, 0x38, 0x99, 0xc8, 0x21, 0xac, 0x65, 0x89, 0x28, 0x6a,
+    0x4c, 0x54, 0x48, 0xf8, 0xbd, 0xb2, 0x97, 0xaf, 0x48, 0x1e, 0x62, 0x45, 0x10, 0xfc, 0x90, 0x2e,
+    0x40, 0xb9, 0x1e, 0xed, 0x8c, 0x67, 0x42, 0xf6, 0x70, 0xd5, 0x2b, 0xab, 0x33, 0xb9, 0x17, 0xae,
+    0x55, 0x9a, 0x5c, 0x59, 0xd1, 0x6a, 0xe9, 0x04, 0x9e, 0xa9, 0xc2, 0x40, 0x08, 0xc9, 0x9c, 0x3e,
+    0xa9, 0x46, 0x8d, 0xdd, 0x01, 0x1f, 0x87, 0xdd, 0x01, 0x17, 0x92, 0x7b, 0x38, 0x1a, 0x82, 0x24,
+    0x65, 0x85, 0x1a, 0x51, 0xa5, 0x87, 0x40, 0x96, 0xd9, 0x63, 0x34, 0x40, 0x24, 0x07, 0xe3, 0x5a,
+    0xaa, 0x12, 0xd6, 0x26, 0xe6, 0x42, 0x53, 0x58, 0x7b, 0xfa, 0x97, 0x84, 0x1b, 0xf1, 0xb0, 0xb0,
+    0x3d, 0xf4, 0x31, 0x64, 0x2f, 0x27, 0xa2, 0xe6, 0xc9, 0x3e, 0x85, 0xa1, 0x8a, 0x81, 0x8d, 0x21,
+    0x1c, 0xa1, 0xe3, 0xe3, 0x0d, 0x8f, 0x3d, 0xe9, 0x42, 0x20, 0x49, 0x14, 0x7e, 0x55, 0xb9, 0x81,
+    0x77, 0x9b, 0x64, 0x01, 0x47, 0xb3, 0x34, 0x34, 0x08, 0x80, 0xd6, 0x5c, 0x60, 0x7a, 0x78, 0xe1,
+    0x45, 0x2d, 0xa8, 0x50, 0xd1, 0x94, 0xd5, 0xa9, 0x24, 0x48, 0x6b, 0x04, 0x84, 0x91, 0xed, 0xce,
+    0x43, 0xf7, 0x34, 0xe3, 0xd7, 0x19, 0xc7, 0xbc, 0x11, 0x13, 0x90, 0x83, 0x55, 0x99, 0x0d, 0xb4,
+    0x96, 0xc1, 0x3f, 0x5b, 0x66, 0x3b, 0xc3, 0x9e, 0x87, 0x7e, 0x26, 0xd5, 0x2e, 0xcd, 0x75, 0x2f,
+    0x1e, 0x25, 0x5c, 0x2e, 0xb1, 0x70, 0x8b, 0xda, 0x5a, 0xe6, 0xea, 0xb3, 0x02, 0x56, 0x3c, 0x0d,
+    0xe3, 0xc8, 0xa1, 0xa8, 0x91, 0xd9, 0x27, 0x82, 0x6a, 0x51, 0x63, 0x6a, 0x2d, 0xcf, 0x87, 0x30,
+    0xfd, 0xd7, 0x5f, 0xeb, 0xdf, 0xfa, 0x2e, 0x46, 0x36, 0xca, 0x29, 0x93, 0x10, 0x2b, 0xab, 0x66,
+    0xa4, 0xe6, 0x08, 0x39, 0x81, 0xc5, 0x9d, 0xeb, 0xd9, 0xc1, 0xda, 0x9e, 0x21, 0x3d, 0x04, 0x9c,
+    0x60, 0x8d, 0x0d, 0x7b, 0xb1, 0xb1, 0xa7, 0x38, 0x10, 0x68, 0xc4, 0x0e, 0xa9, 0x31, 0x65, 0x84,
+    0x6d, 0x6e, 0xdb, 0x87, 0x05, 0xb6, 0x8d, 0xe4, 0xe8, 0x04, 0x91, 0x32, 0x64, 0x63, 0xaf, 0xae,
+    0xee, 0xfc, 0xe1, 0xc3, 0xcd, 0x8d, 0x0f, 0xfb, 0xaf, 0x9d, 0xdb, 0xba, 0xf7, 0xb9, 0x74, 0x29,
+    0xd9, 0x2f, 0xed, 0x57, 0x47, 0xcd, 0xeb, 0x52, 0x3e, 0x7a, 0x88, 0x44, 0x4f, 0xc4, 0x4e, 0x75,
+    0xeb, 0xf3, 0xef, 0x77, 0x2e, 0xdf, 0x90, 0x86, 0x93, 0x0c, 0x0f, 0x68, 0x29, 0x50, 0xbe, 0x53,
+    0x5c, 0xd0, 0x8b, 0x18, 0x93, 0x12, 0x91, 0xa7, 0xa7, 0x07, 0x1e, 0xc8, 0x3a, 0x5e, 0x54, 0xad,
+    0x1d, 0x87, 0xc4, 0x1c, 0xe7, 0x6e, 0x62, 0x62, 0x25, 0xe6, 0x67, 0xc5, 0x88, 0x92, 0x08, 0xc3,
+    0x6a, 0x32, 0x7e, 0x48, 0x7a, 0x81, 0x74, 0x5d, 0x76, 0x70, 0xe8, 0x92, 0xed, 0x74, 0x27, 0xad,
+    0xa7, 0xa5, 0x42, 0xa0, 0x3c, 0xbc, 0x83, 0xf0, 0x97, 0x24, 0xb7, 0xdd, 0xf1, 0x1b, 0x99, 0xae,
+    0x0d, 0x25, 0xab, 0xde, 0x28, 0x3f, 0xaa, 0xb7, 0xe0, 0x6f, 0x0d, 0x22, 0xb4, 0xde, 0x2e, 0x53,
+    0x2a, 0xd0, 0x57, 0xca, 0xc5, 0xd2, 0x51, 0x5d, 0x94, 0x91, 0xee, 0xde, 0x30, 0x37, 0xa3, 0x25,
+    0x2e, 0x16, 0xd4, 0x61, 0x94, 0x4d, 0x4c, 0x33, 0xb6, 0x24, 0xe7, 0xe3, 0xd4, 0x31, 0x38, 0xe3,
+    0xa8, 0x2d, 0x77, 0x00, 0x38, 0x4f, 0x66, 0xd8, 0x50, 0x65, 0xa4, 0xe5, 0x25, 0xf8, 0x44, 0x13,
+    0xe3, 0x6e, 0x35, 0x0c, 0xdd, 0xd1, 0x5e, 0x42, 0x14, 0xbe, 0x69, 0xad, 0x54, 0x65, 0x30, 0x5a,
+    0x73, 0xe3, 0xea, 0x8c, 0x0b, 0x63, 0xea, 0xa3, 0x3d, 0x05, 0x9d, 0x85, 0x40, 0xb0, 0x86, 0xc1,
+    0xf3, 0x6b, 0x51, 0x9e, 0xe1, 0xc1, 0x63, 0xf2, 0x0c, 0x9f, 0x10, 0x8e, 0x26, 0x9a, 0xf8, 0x4c,
+    0x70, 0x8f, 0x4c, 0xc3, 0x9b, 0x20, 0x71, 0xaa, 0xa1, 0xe7, 0xff, 0xc7, 0xb9, 0x86, 0xb7, 0x75,
+    0xf6, 0x9b, 0x6c, 0x24, 0xf4, 0x3f, 0x3a, 0xdb, 0xf0, 0x34, 0xbb, 0xa7, 0x1b, 0xb9, 0x1f, 0xf5,
+    0x13, 0xf3, 0x8d, 0x9c, 0x41, 0x97, 0x58, 0x1e, 0x24, 0xe3, 0xf0, 0x8d, 0xcf, 0xbd, 0xcd, 0xff,
+    0xf4, 0x69, 0x75, 0xf0, 0xd5, 0xbb, 0xfd, 0x1b, 0x5f, 0xa8, 0x7a, 0x61, 0x5e, 0x87, 0x87, 0x77,
+    0xde, 0xe8, 0xdf, 0xfa, 0x68, 0xf0, 0xe1, 0xb5, 0xc1, 0xd5, 0x6b, 0xaa, 0x5e, 0xc4, 0xa6, 0xfe,
+    0xb7, 0x9f, 0x6e, 0xde, 0xbf, 0x4a, 0x1b, 0x65, 0xa5, 0xf9, 0xf9, 0xb8, 0xfe, 0x04, 0x5b, 0x31,
+    0xaa, 0x3c, 0xcf, 0xb0, 0x83, 0x60, 0xdf, 0x69, 0xc0, 0x47, 0x7f, 0x01, 0x09, 0xbb, 0x89, 0xac,
+    0x47, 0x99, 0x1b, 0x4f, 0xc3, 0x65, 0x12, 0xf7, 0xb3, 0xcf, 0x84, 0x88, 0xf6, 0xd4, 0xac, 0x67,
+    0x48, 0x4c, 0x72, 0x8c, 0xf4, 0xbb, 0x70, 0x91, 0x8f, 0x57, 0xa6, 0x8c, 0xa1, 0xd0, 0xc0, 0x03,
+    0x7d, 0xf0, 0x1f, 0xec, 0xdd, 0xd7, 0x2c, 0xbe, 0xc1, 0xb0, 0x32, 0xfd, 0x4d, 0xca, 0x02, 0x4c,
+    0x83, 0x4e, 0xb0, 0x7b, 0x65, 0x00, 0xe9, 0xb6, 0xe3, 0x53, 0x40, 0x18, 0x14, 0xf6, 0xca, 0x01,
+    0x4c, 0xdd, 0x4a, 0x82, 0xd2, 0xbf, 0x43, 0x16, 0x18, 0x13, 0xa6, 0x87, 0x82, 0x14, 0x1b, 0xa3,
+    0x1f, 0xef, 0xba, 0xce, 0xcb, 0xa0, 0x7d, 0xd2, 0x73, 0x5b, 0xb6, 0x8f, 0xcc, 0x35, 0x33, 0xa7,
+    0xd3, 0x11, 0x5c, 0xde, 0xea, 0xd0, 0xf4, 0x74, 0x73, 0x84, 0x42, 0xd5, 0xe6, 0xd3, 0x11, 0x8d,
+    0x1d, 0xdd, 0x1f, 0x0e, 0xca, 0x91, 0x36, 0xfd, 0x61, 0x59, 0x8d, 0x92, 0x0e, 0xd4, 0x2e, 0x0b,
+    0x2f, 0x78, 0x51, 0x8e, 0x48, 0x6d, 0x09, 0x7a, 0xb8, 0x95, 0x5c, 0x3c, 0x52, 0x28, 0x14, 0x74,
+    0x4b, 0xe0, 0x1e, 0x98, 0x25, 0x79, 0x20, 0xd3, 0xad, 0xd7, 0xf1, 0x66, 0xe9, 0x63, 0x78, 0xbf,
+    0x81, 0x96, 0x17, 0xab, 0x41, 0xa6, 0xa8, 0x17, 0x75, 0x1c, 0xa4, 0xe5, 0x18, 0x9e, 0x3a, 0x69,
+    0x7b, 0x4e, 0x6e, 0x87, 0xe2, 0xc6, 0x9b, 0xe9, 0x79, 0x20, 0xdc, 0x4e, 0xbd, 0x0e, 0x76, 0xa4,
+    0x69, 0xba, 0xcb, 0x78, 0x8c, 0xc9, 0x38, 0x69, 0x87, 0xb0, 0x26, 0xec, 0x66, 0x46, 0x52, 0x91,
+    0xb3, 0x3a, 0x1e, 0xed, 0x98, 0x3c, 0x42, 0x93, 0xf1, 0x94, 0x68, 0x52, 0x5e, 0x4d, 0x18, 0x12,
+    0x9f, 0xf4, 0x60, 0x9e, 0x67, 0x8e, 0xba, 0x32, 0x64, 0xce, 0xf0, 0x25, 0xb7, 0x40, 0xad, 0x86,
+    0x44, 0x17, 0xb6, 0x02, 0xd3, 0x0e, 0x1a, 0x7f, 0x88, 0xc1, 0x02, 0x15, 0xd8, 0x0e, 0x4d, 0x14,
+    0x8d, 0xf4, 0x29, 0x28, 0x45, 0xbe, 0x63, 0xe2, 0xa1, 0x90, 0x6f, 0x48, 0xf6, 0xc2, 0x81, 0x04,
+    0xf4, 0x22, 0x49, 0x1e, 0x83, 0x9a, 0xa6, 0xe5, 0x16, 0x45, 0x80, 0x0b, 0x65, 0x47, 0x34, 0x49,
+    0x1a, 0x05, 0x4d, 0x6f, 0xd7, 0x5a, 0xc4, 0x32, 0x3e, 0xff, 0xdc, 0x16, 0x2b, 0x14, 0x0e, 0x1e,
+    0x4b, 0x88, 0x46, 0xe2, 0xce, 0x35, 0xa9, 0x88, 0x7d, 0xa4, 0x04, 0x46, 0x1a, 0x36, 0x45, 0x79,
+    0x8c, 0x7c, 0x2d, 0xca, 0x63, 0x80, 0x32, 0x07, 0x4b, 0xd6, 0xa7, 0x9d, 0xa0, 0x78, 0x84, 0xbd,
+    0xe5, 0x91, 0x12, 0x0b, 0x8f, 0xae, 0x45, 0x66, 0x78, 0xa7, 0xd5, 0x5c, 0xcd, 0x64, 0xa5, 0x4c,
+    0x71, 0xd7, 0xb5, 0xa8, 0xcb, 0x70, 0xf0, 0xc8, 0x74, 0xe9, 0xe8, 0x91, 0xa3, 0x5a, 0xda, 0x9b,
+    0xe8, 0x1d, 0xa0, 0x68, 0xbb, 0x34, 0xcc, 0xaf, 0x99, 0xfc, 0x2f, 0x72, 0xa7, 0xff, 0x2d, 0x37,
+    0x3f, 0xf5, 0xb3, 0xbc, 0x0e, 0xab, 0xcf, 0xfd, 0xee, 0xc6, 0x22, 0xc4, 0xf1, 0xa6, 0xbb, 0x90,
+    0x39, 0x8d, 0x94, 0xb2, 0x0e, 0xe6, 0x35, 0x1d, 0x31, 0x4f, 0xa9, 0x39, 0x68, 0x83, 0xf8, 0x3a,
+    0xae, 0xb0, 0x89, 0xac, 0x39, 0x2f, 0x8d, 0x75, 0x96, 0x5f, 0x4d, 0x1a, 0xb7, 0x31, 0x4b, 0xbb,
+    0x0a, 0x53, 0xea, 0x41, 0x32, 0x5d, 0x75, 0x0a, 0xff, 0xec, 0xb6, 0x8d, 0x3a, 0xec, 0x38, 0xbb,
+    0x4e, 0xaf, 0x6a, 0x63, 0xdc, 0x29, 0x59, 0x0f, 0x52, 0x7b, 0x54, 0xa9, 0xc9, 0xe8, 0xc5, 0x15,
+    0x61, 0xa3, 0x7c, 0x14, 0x8a, 0xc1, 0xe9, 0x82, 0x2c, 0xfd, 0x74, 0xaf, 0x5c, 0x82, 0x5a, 0xf0,
+    0x48, 0x49, 0xf7, 0xcb, 0x43, 0x34, 0x40, 0x1e, 0xe8, 0x69, 0x7b, 0xfb, 0x2d, 0x86, 0x1c, 0xba,
+    0x0f, 0x11, 0xcd, 0x47, 0xe7, 0x37, 0xe3, 0x39, 0xa0, 0x7b, 0x13, 0x5a, 0x05, 0x6b, 0xa6, 0xf8,
+    0xaa, 0x83, 0x26, 0xd3, 0x73, 0x62, 0x34, 0x58, 0xae, 0x68, 0xc7, 0x60, 0xf1, 0x25, 0x82, 0x71,
+    0xb0, 0x41, 0xd8, 0x1b, 0x0f, 0xa0, 0x9b, 0x01, 0x5a, 0x54, 0x86, 0x24, 0xa1, 0x17, 0xa0, 0x2b,
+    0x06, 0xa4, 0x53, 0xff, 0xf1, 0x80, 0x2d, 0xe8, 0x4a, 0x50, 0x1a, 0x9e, 0xe3, 0x8f, 0x07, 0xf6,
+    0x65, 0x77, 0x65, 0xa8, 0x32, 0x4c, 0x9e, 0xca, 0xef, 0x51, 0x1b, 0x86, 0x8c, 0xd3, 0x80, 0xd8,
+    0xb7, 0x64, 0x43, 0x54, 0x1d, 0xee, 0x56, 0xde, 0x85, 0x6b, 0xb8, 0xc9, 0x05, 0x5e, 0x9d, 0x14,
+    0xe2, 0xd4, 0x26, 0xaf, 0x03, 0xfd, 0xb6, 0x89, 0x7b, 0x3f, 0x11, 0x60, 0x6a, 0xdb, 0x26, 0xa4,
+    0x26, 0x17, 0x75, 0xe7, 0x8b, 0x85, 0x02, 0x1e, 0xc5, 0x3c, 0x89, 0xb7, 0xaf, 0x33, 0x45, 0x30,
+    0x79, 0xbc, 0x38, 0xa2, 0x26, 0xdd, 0x76, 0xaf, 0x92, 0x8d, 0x3c, 0x3a, 0xb9, 0x72, 0xa6, 0x86,
+    0x78, 0xd9, 0x5c, 0x3a, 0xc4, 0x2d, 0xb1, 0xe6, 0x91, 0x02, 0x6c, 0xe2, 0xf6, 0x5d, 0xd7, 0xc4,
+    0x49, 0x70, 0x23, 0x46, 0x93, 0xaa, 0x0b, 0x22, 0x66, 0x74, 0xde, 0x0b, 0x4c, 0xe6, 0x5a, 0x00,
+    0xdb, 0x25, 0xd5, 0xb6, 0xed, 0x38, 0xd1, 0xa6, 0x4e, 0xd2, 0x52, 0xd9, 0xb4, 0x6d, 0x67, 0x21,
+    0x1c, 0x42, 0x08, 0x5f, 0xf4, 0xa5, 0xf1, 0xa7, 0xee, 0x18, 0x68, 0xa9, 0x85, 0x3f, 0xc5, 0x2b,
+    0xd9, 0x4f, 0xe7, 0xaf, 0x8b, 0x1d, 0x4f, 0x58, 0xb3, 0x50, 0xcd, 0xfd, 0x89, 0xcf, 0xf6, 0x7f,
+    0xdc, 0x78, 0x87, 0xef, 0x50, 0x44, 0xb7, 0x27, 0xa0, 0x98, 0x8c, 0x4f, 0xfe, 0x09, 0x7f, 0xea,
+    0x1a, 0xc1, 0x18, 0xfc, 0xb2, 0xff, 0xa7, 0xe0, 0x4f, 0x1f, 0x3a, 0xb8, 0xb6, 0x83, 0x57, 0xf1,
+    0x38, 0xdc, 0x85, 0xeb, 0x17, 0xdc, 0xc2, 0x65, 0x59, 0x53, 0x02, 0xf2, 0x5f, 0xb2, 0x01, 0x42,
+    0xcd, 0xab, 0xda, 0x2c, 0x37, 0x52, 0x15, 0x55, 0xd4, 0xca, 0xa4, 0xc2, 0x70, 0xcd, 0x15, 0x1d,
+    0x64, 0x41, 0x79, 0x09, 0xb0, 0xb3, 0xf0, 0x7f, 0x8a, 0x30, 0x95, 0xe3, 0xae, 0xa9, 0xa8, 0x31,
+    0x45, 0x05, 0x46, 0x75, 0xb4, 0x74, 0x5a, 0xdf, 0x85, 0x54, 0xb4, 0x71, 0x66, 0x03, 0x5b, 0xc2,
+    0x92, 0x3b, 0x1f, 0x9f, 0x4a, 0x52, 0xe7, 0x69, 0xfa, 0x94, 0x79, 0x2d, 0x5b, 0x9c, 0x3f, 0x73,
+    0x06, 0xa1, 0x27, 0xa8, 0x9a, 0x2e, 0x10, 0x46, 0xba, 0xa6, 0x57, 0x08, 0x8c, 0xd3, 0xf3, 0x74,
+    0xba, 0x88, 0x12, 0xd5, 0xc3, 0x23, 0xc6, 0x8a, 0xe5, 0x76, 0x27, 0x5a, 0x02, 0x1d, 0x56, 0xed,
+    0xfb, 0x34, 0x6f, 0xe8, 0xf4, 0x4e, 0xab, 0xd0, 0xac, 0x1c, 0xc7, 0x73, 0x39, 0xda, 0x18, 0xa6,
+    0xf7, 0x6d, 0xfc, 0xe8, 0x14, 0x8e, 0x9a, 0x1c, 0xf0, 0xa1, 0xde, 0x0a, 0x44, 0x17, 0x91, 0x89,
+    0x9e, 0x1f, 0x36, 0x0c, 0x3c, 0x4f, 0x67, 0xe3, 0x8b, 0xee, 0x4f, 0x6a, 0x29, 0xdf, 0x26, 0x60,
+    0x9c, 0x7b, 0x38, 0x86, 0x45, 0x37, 0x0e, 0x27, 0x06, 0x30, 0x3c, 0xd9, 0x8a, 0x48, 0x7f, 0x98,
+    0xf4, 0x17, 0x4a, 0xaa, 0xd3, 0x36, 0x92, 0xc5, 0xf5, 0xf6, 0x0f, 0x97, 0xf0, 0x56, 0xd0, 0xdd,
+    0xb7, 0x70, 0x8b, 0x86, 0x4b, 0xec, 0xa4, 0xba, 0x62, 0x2c, 0x09, 0xa5, 0xe1, 0x3d, 0xfc, 0x00,
+    0xdc, 0x5a, 0x1e, 0x0e, 0xe0, 0x8b, 0x56, 0xa8, 0xb7, 0xb6, 0xdb, 0x8e, 0x62, 0x27, 0x8b, 0x14,
+    0x8c, 0x83, 0xbb, 0xd0, 0x2c, 0x59, 0xdf, 0x29, 0xca, 0xa4, 0xaa, 0xab, 0xc5, 0x83, 0x07, 0x13,
+    0x8d, 0xe0, 0xe5, 0xb1, 0x85, 0x6a, 0x09, 0x7c, 0x49, 0x62, 0xc8, 0x64, 0x0b, 0x7a, 0x16, 0xab,
+    0xfe, 0x8e, 0x93, 0x89, 0x2c, 0x02, 0x17, 0x6e, 0xc9, 0x70, 0xd1, 0x69, 0x6b, 0x3d, 0x56, 0x53,
+    0x18, 0xbf, 0x51, 0x7a, 0x09, 0x2e, 0x01, 0x6f, 0x5c, 0xc6, 0x0c, 0xbb, 0x47, 0xd4, 0x53, 0x8e,
+    0x1c, 0x6b, 0xe4, 0x88, 0xf8, 0x81, 0x97, 0xf7, 0x54, 0xf3, 0xec, 0x27, 0x1e, 0xf3, 0x9d, 0xd0,
+    0x28, 0x20, 0x27, 0xc3, 0x3e, 0x51, 0x61, 0xd9, 0x1e, 0x9d, 0x6a, 0xac, 0xcd, 0xaa, 0xff, 0x73,
+    0xed, 0xe2, 0x2b, 0x0a, 0xed, 0xf8, 0x4f, 0x45, 0xce, 0x37, 0x42, 0x29, 0x1e, 0x90, 0xef, 0x95,
+    0x66, 0x10, 0x26, 0x49, 0x6c, 0xf4, 0xb2, 0x85, 0x3c, 0xf3, 0x55, 0x19, 0x22, 0x49, 0xcc, 0x30,
+    0x2d, 0x7c, 0x2f, 0x5c, 0x2d, 0x47, 0x87, 0xf2, 0x90, 0x82, 0x8e, 0xab, 0xc9, 0xf8, 0x4e, 0xe7,
+    0x5b, 0x74, 0x86, 0x8f, 0xf6, 0x90, 0x1e, 0xaf, 0x25, 0xe0, 0x92, 0x86, 0x3a, 0x78, 0xf3, 0x62,
+    0x7f, 0xe3, 0x6c, 0x6a, 0x15, 0x48, 0xca, 0x23, 0x07, 0x19, 0x36, 0x01, 0xbc, 0x00, 0xe2, 0x8b,
+    0x68, 0x57, 0xc8, 0x59, 0x9a, 0xc8, 0xb6, 0x49, 0x4e, 0xe4, 0x2c, 0x8d, 0x3f, 0x54, 0xe1, 0xae,
+    0x24, 0xb3, 0xea, 0xe6, 0xdd, 0xb7, 0xb7, 0xef, 0xdf, 0x97, 0x3d, 0x50, 0xe8, 0xd4, 0x53, 0xf7,
+    0x03, 0x2c, 0x77, 0xc5, 0xd9, 0xe3, 0x86, 0x00, 0x45, 0x93, 0xa4, 0x34, 0x10, 0x93, 0xd6, 0x9b,
+    0xc0, 0xf6, 0xce, 0x1b, 0xeb, 0xfd, 0x5f, 0xdf, 0xef, 0x5f, 0x58, 0x67, 0xce, 0xf1, 0x4d, 0x27,
+    0x58, 0x3f, 0x44, 0xb1, 0x55, 0x1b, 0x5e, 0x29, 0xf7, 0xcf, 0xdd, 0x06, 0x7f, 0x1e, 0x5c, 0xba,
+    0xb3, 0xf5, 0x87, 0xcb, 0xf1, 0x90, 0x53, 0x9e, 0xe9, 0xf3, 0x4e, 0x5c, 0x54, 0xc6, 0x8f, 0xcf,
+    0xa9, 0x51, 0x88, 0xc5, 0x51, 0xcf, 0xe1, 0x95, 0xa3, 0x0c, 0xbd, 0x85, 0xaf, 0xd3, 0x19, 0x16,
+    0xa5, 0xf1, 0x9f, 0xd3, 0xd2, 0xc2, 0x75, 0xe4, 0x5d, 0x24, 0xad, 0x8b, 0x21, 0x29, 0x71, 0x2f,
+    0x2b, 0x1d, 0xc4, 0x68, 0x74, 0x25, 0x06, 0xc1, 0x7a, 0x42, 0x1b, 0x3d, 0x79, 0x8a, 0x00, 0xe2,
+    0x9b, 0x5a, 0x5a, 0x8e, 0xae, 0x6a, 0xe5, 0xe4, 0x4d, 0x2d, 0x23, 0x9e, 0xdc, 0xe0, 0xe0, 0x39,
+    0xab, 0xd2, 0xe5, 0xad, 0xb2, 0x4a, 0xf7, 0x09, 0x87, 0x50, 0x44, 0x85, 0x69, 0x3c, 0xec, 0xcc,
+    0x19, 0x35, 0x01, 0x15, 0xdd, 0x42, 0xd3, 0x86, 0xaf, 0x04, 0x21, 0xeb, 0xb2, 0x2c, 0x48, 0x5d,
+    0xba, 0xd2, 0x72, 0xae, 0x43, 0x07, 0x61, 0x06, 0x87, 0xc9, 0xa6, 0xeb, 0x0b, 0x16, 0x11, 0xc4,
+    0xfb, 0x50, 0x1c, 0x99, 0xf1, 0x64, 0x0c, 0x9d, 0xd0, 0x27, 0xc7, 0x76, 0x77, 0x27, 0x29, 0xbc,
+    0x7d, 0xb4, 0x37, 0x55, 0x28, 0x93, 0x31, 0x7b, 0xa4, 0xd1, 0xbd, 0x71, 0x79, 0x0b, 0x01, 0x6f,
+    0x5f, 0x50, 0x6a, 0x01, 0xc2, 0xf0, 0x82, 0x00, 0x62, 0x4c, 0x5d, 0x11, 0x4f, 0xab, 0x47, 0x1d,
+    0xbd, 0x30, 0xae, 0xca, 0xac, 0xdd, 0x8b, 0xc3, 0xca, 0xb3, 0x74, 0x3a, 0x4d, 0x01, 0xa6, 0x8a,
+    0x9f, 0x55, 0xa3, 0x58, 0x28, 0x1d, 0x9a, 0xc5, 0xaf, 0x79, 0xfc, 0x36, 0xa5, 0x3e, 0xa3, 0x96,
+    0xf1, 0x49, 0x86, 0x22, 0x7a, 0x1f, 0xdd, 0xe7, 0x14, 0xc7, 0xdf, 0x69, 0xf3, 0x8d, 0xbe, 0x32,
+    0x06, 0xc2, 0xc8, 0x0d, 0x7c, 0xdd, 0x07, 0xa2, 0x48, 0xff, 0xf5, 0xcb, 0x8a, 0x3a, 0xc5, 0x6d,
+    0x2b, 0x1e, 0x58, 0xfe, 0x33, 0xc7, 0xdb, 0x3e, 0xb4, 0xe7, 0x95, 0xed, 0xaf, 0xbe, 0x8f, 0x7a,
+    0x70, 0x0f, 0x47, 0x76, 0x3c, 0x73, 0x3c, 0x8f, 0x15, 0x9e, 0x9c, 0x81, 0x12, 0xb5, 0xba, 0xf3,
+    0xd1, 0xbb, 0x83, 0xab, 0xf7, 0x94, 0x43, 0xcf, 0xc0, 0x00, 0x9a, 0x9f, 0xef, 0x2f, 0xbd, 0x08,
+    0xa3, 0x9e, 0x76, 0x69, 0xd4, 0xd3, 0x2f, 0x9c, 0x9c, 0x53, 0x75, 0x19, 0xc7, 0x42, 0x28, 0x08,
+    0x50, 0x4f, 0x38, 0x74, 0x23, 0xe6, 0xa4, 0xf0, 0xe6, 0x44, 0x0d, 0xe0, 0x76, 0xae, 0x7f, 0x07,
+    0xe8, 0x75, 0x75, 0x70, 0xfe, 0xe6, 0xf6, 0xfa, 0x05, 0x85, 0x8e, 0x60, 0x01, 0xb2, 0x86, 0xb3,
+    0x3d, 0xf5, 0x72, 0xbe, 0x28, 0x8e, 0x8c, 0x16, 0xe2, 0x40, 0xab, 0x3a, 0x15, 0xf3, 0xc7, 0x02,
+    0xe0, 0xad, 0x08, 0x66, 0xf2, 0xf8, 0x8f, 0x1b, 0xe7, 0xa0, 0xf4, 0xdb, 0xba, 0x74, 0x6d, 0xf0,
+    0xde, 0xb9, 0x1f, 0x37, 0xde, 0x94, 0x3a, 0xdf, 0x45, 0x43, 0x92, 0x3b, 0xce, 0xb1, 0xf8, 0x2b,
+    0x1a, 0xea, 0xa4, 0xf2, 0x38, 0x36, 0x05, 0xbc, 0x8c, 0x92, 0x36, 0x8e, 0x71, 0xe5, 0x91, 0x6f,
+    0xe5, 0x17, 0xa2, 0xb7, 0x0e, 0xb4, 0xd1, 0x00, 0x91, 0x8c, 0x44, 0xdd, 0x38, 0x62, 0x24, 0x83,
+    0x56, 0xba, 0x14, 0x1c, 0x7e, 0xa4, 0xf4, 0x47, 0x27, 0xef, 0x0f, 0xe3, 0xd7, 0x33, 0x67, 0x28,
+    0xd3, 0xd9, 0x60, 0xd0, 0x1d, 0x0b, 0xaa, 0x3b, 0xcc, 0xc1, 0x23, 0x6d, 0xbf, 0xf8, 0x05, 0x90,
+    0x22, 0xcb, 0x46, 0xbe, 0x85, 0xa3, 0xf2, 0xdd, 0x4d, 0xb4, 0xd2, 0xf7, 0xce, 0x45, 0x97, 0x20,
+    0x60, 0x5d, 0x29, 0x8c, 0x54, 0xb1, 0x90, 0x28, 0x39, 0xb2, 0x69, 0x42, 0x64, 0x2b, 0xd7, 0x12,
+    0x24, 0x38, 0x72, 0xf1, 0xc9, 0xf7, 0x9b, 0x3c, 0xe2, 0x5c, 0xd5, 0x93, 0x97, 0x7c, 0xba, 0x75,
+    0xcf, 0x6d, 0x95, 0xe9, 0x34, 0x23, 0x70, 0xcb, 0x38, 0x3d, 0x5d, 0x65, 0xc0, 0x6c, 0xc4, 0x88,
+    0x12, 0x65, 0x6b, 0x4f, 0xa7, 0xfa, 0x3e, 0x92, 0xd3, 0xb8, 0xf0, 0x9b, 0x08, 0xda, 0x49, 0xe1,
+    0x8e, 0x04, 0x79, 0x95, 0xdf, 0xd1, 0xe9, 0xdf, 0x7e, 0x1d, 0xbb, 0xde, 0xba, 0x09, 0xbd, 0x4a,
+    0x2e, 0xc0, 0xc1, 0xf2, 0x25, 0xb7, 0x8d, 0x8f, 0xb6, 0xfe, 0xf0, 0x76, 0x7f, 0xfd, 0xeb, 0xc1,
+    0xc5, 0xcf, 0x76, 0x2e, 0xdf, 0xf8, 0xdb, 0xd9, 0x57, 0x55, 0x9d, 0x2e, 0x73, 0x22, 0x8f, 0xfb,
+    0x65, 0x98, 0xf0, 0x0d, 0xf1, 0x4b, 0xd5, 0xf9, 0x64, 0xee, 0x86, 0x09, 0x65, 0x03, 0x8a, 0x03,
+    0x18, 0xdf, 0x83, 0xd5, 0x26, 0x5f, 0x37, 0x88, 0xa3, 0xa4, 0x36, 0x36, 0x6e, 0x4f, 0x1c, 0x48,
+    0x6f, 0x35, 0xb3, 0x5d, 0xd1, 0xd7, 0x1c, 0x94, 0x75, 0x8b, 0x50, 0x8e, 0x1b, 0xc6, 0x18, 0x34,
+    0x5a, 0x32, 0x18, 0xf7, 0xe8, 0xb2, 0x0f, 0x1d, 0x21, 0xc9, 0x57, 0xf0, 0x76, 0x99, 0x46, 0x82,
+    0x30, 0x71, 0xf1, 0x0b, 0x81, 0xda, 0xee, 0x97, 0x8d, 0x50, 0xe2, 0xf4, 0x77, 0xcc, 0x19, 0x5d,
+    0x4a, 0xbe, 0x89, 0x63, 0x3d, 0xc8, 0xf3, 0x2a, 0x22, 0x57, 0xa2, 0xab, 0xfd, 0xaa, 0x96, 0xa4,
+    0x94, 0x5f, 0x65, 0xdb, 0x9d, 0x54, 0x82, 0x91, 0x5b, 0x3d, 0xc9, 0x37, 0xd8, 0xc6, 0x8d, 0xf2,
+    0x3b, 0x0b, 0x2d, 0x3b, 0x88, 0x05, 0xc9, 0x52, 0x6c, 0x7b, 0xf4, 0xf7, 0x71, 0x51, 0x37, 0x3b,
+    0x4d, 0xdc, 0xeb, 0x1c, 0x67, 0x3c, 0xc3, 0xdb, 0xc6, 0xa9, 0xf9, 0x6c, 0xaa, 0x0f, 0xc8, 0xa2,
+    0x4e, 0x17, 0xe6, 0xc7, 0x12, 0xe3, 0x09, 0x58, 0x38, 0x91, 0x09, 0xc9, 0xf7, 0x10, 0xbf, 0xfd,
+    0x13, 0xbf, 0xf3, 0x86, 0x3e, 0x12, 0x49, 0x5a, 0xbe, 0x1a, 0xf8, 0x93, 0x44, 0x2d, 0x37, 0xd3,
+    0xc7, 0xc8, 0x9a, 0x7b, 0x50, 0xd8, 0xfc, 0x3a, 0xe0, 0x38, 0x69, 0xc7, 0xaf, 0x1b, 0xfd, 0xa4,
+    0xc9, 0x79, 0xc7, 0x2d, 0xed, 0x47, 0xb8, 0xb7, 0x56, 0x96, 0x27, 0x31, 0x63, 0x77, 0xe2, 0xa0,
+    0x68, 0x0b, 0xb7, 0xd4, 0x46, 0xe0, 0x46, 0xb6, 0xe2, 0x34, 0x1d, 0x77, 0xd4, 0xca, 0x13, 0xb6,
+    0xde, 0x74, 0xdc, 0x45, 0x2b, 0x4f, 0xd8, 0x6e, 0xd3, 0xc3, 0x5d, 0xb3, 0xf2, 0x2e, 0xdb, 0x6c,
+    0x7a, 0xb8, 0x23, 0x56, 0x1e, 0xb7, 0x4d, 0xd6, 0x43, 0xe9, 0x45, 0x6f, 0x82, 0xf1, 0x2f, 0x39,
+    0x0d, 0x8b, 0x31, 0x8a, 0x72, 0x6d, 0xe1, 0xf9, 0x20, 0x3a, 0xb9, 0x6b, 0x33, 0x41, 0x5b, 0xc9,
+    0xcd, 0x9a, 0xb4, 0xdc, 0x92, 0x9b, 0x36, 0xe5, 0x31, 0xbb, 0x38, 0xbc, 0x09, 0x9e, 0xdc, 0x7a,
+    0x29, 0x8f, 0xd9, 0x8b, 0x61, 0xa8, 0xe4, 0x1b, 0x17, 0x04, 0x95, 0x7a, 0x05, 0x23, 0x66, 0x3e,
+    0xf9, 0x0e, 0x45, 0x0c, 0x17, 0xbe, 0x54, 0x11, 0xc1, 0x91, 0x18, 0xf0, 0x7d, 0x92, 0x11, 0x09,
+    0xf4, 0x12, 0x76, 0x44, 0x2f, 0xcd, 0xec, 0x61, 0x46, 0x18, 0xc4, 0x26, 0xd3, 0x73, 0xe6, 0xcc,
+    0x64, 0x1a, 0xb4, 0x64, 0xd2, 0xb8, 0x7e, 0x6b, 0xfb, 0xd6, 0x0d, 0x7e, 0xc5, 0x83, 0xdf, 0xec,
+    0xc0, 0xbc, 0xc1, 0xef, 0x91, 0x5c, 0x38, 0xbf, 0x75, 0xe5, 0x6e, 0xff, 0xb5, 0xaf, 0xfb, 0x57,
+    0x6f, 0x6e, 0xdd, 0xfb, 0x61, 0xf0, 0xde, 0xed, 0xc1, 0xfa, 0x2d, 0x48, 0x26, 0xfd, 0x57, 0xae,
+    0x0e, 0xbe, 0xfc, 0x64, 0x70, 0xe5, 0xcf, 0x83, 0xf7, 0x6f, 0xc7, 0x39, 0x23, 0xa1, 0x32, 0x5e,
+    0x64, 0xa5, 0x95, 0x18, 0xc7, 0xcf, 0xd4, 0x7b, 0x9e, 0xfb, 0x70, 0x95, 0x78, 0xf9, 0x26, 0xc3,
+    0x42, 0xf2, 0x8d, 0xc7, 0x7d, 0x8c, 0x8f, 0xe3, 0xd0, 0x5e, 0x05, 0x2d, 0x97, 0xb2, 0x9b, 0x77,
+    0xbf, 0xc4, 0x8d, 0xb5, 0x7b, 0x9f, 0xed, 0x5c, 0x3d, 0xdb, 0x5f, 0x7f, 0x65, 0xeb, 0xf3, 0xdf,
+    0xfc, 0xf5, 0xec, 0x67, 0x2a, 0x5d, 0xbe, 0x7e, 0xe0, 0xd2, 0x68, 0xe8, 0x20, 0x01, 0x94, 0x9f,
+    0xbe, 0x41, 0x1c, 0x27, 0xc8, 0x44, 0x05, 0x56, 0x49, 0xdc, 0x75, 0xee, 0x41, 0xb8, 0x63, 0xb2,
+    0xfa, 0xb7, 0xde, 0x19, 0x9c, 0xbb, 0xa0, 0x4a, 0x21, 0x24, 0xde, 0x76, 0xfd, 0x3b, 0x87, 0xe9,
+    0xa1, 0xfb, 0xfe, 0x89, 0xc9, 0xc6, 0xc5, 0xe8, 0x14, 0x1d, 0x32, 0x42, 0x8f, 0x4d, 0xfb, 0xb2,
+    0x14, 0x01, 0x73, 0xa7, 0xf7, 0x68, 0x55, 0x69, 0x10, 0x91, 0xc7, 0xaf, 0xa0, 0x58, 0xf8, 0xf7,
+    0x01, 0xe2, 0x7d, 0x5a, 0xfa, 0xd1, 0x00, 0xa3, 0xdb, 0x8b, 0xcf, 0x9d, 0xf1, 0xb8, 0x8e, 0xde,
+    0x6b, 0x40, 0x46, 0xe4, 0x19, 0x1d, 0xcb, 0x9d, 0x7f, 0xb0, 0x64, 0x96, 0x7e, 0xbd, 0x64, 0x19,
+    0xef, 0xcc, 0x17, 0x0a, 0x05, 0x35, 0x3e, 0xab, 0x47, 0xc5, 0x19, 0xa1, 0x38, 0x5e, 0x58, 0xf8,
+    0x25, 0xdd, 0x39, 0xf1, 0x7d, 0x7b, 0xd1, 0xc9, 0xf0, 0x34, 0x3a, 0x5d, 0x9f, 0x6e, 0xe3, 0x2f,
+    0xdb, 0xc9, 0xda, 0x80, 0x56, 0x45, 0xd1, 0xad, 0x2c, 0xda, 0xf5, 0x3a, 0xcd, 0xb0, 0x39, 0xbf,
+    0xe6, 0x09, 0xe1, 0xc0, 0xba, 0x31, 0xab, 0xea, 0xb2, 0x69, 0xc1, 0x0c, 0x60, 0xe6, 0xb5, 0xd9,
+    0xf4, 0x63, 0x0e, 0x9c, 0x00, 0x7f, 0xa8, 0x64, 0x4a, 0xfd, 0x27, 0x58, 0x8f, 0xc6, 0xd0, 0x2b,
+    0x76, 0xdd, 0x9e, 0x55, 0x5f, 0xb2, 0x9f, 0xb4, 0x31, 0x73, 0xf3, 0x2f, 0x21, 0x00, 0x00, 0x35,
+    0x0c, 0xae, 0xfe, 0x5e, 0x36, 0xcc, 0xe3, 0x2e, 0x88, 0x1c, 0x41, 0x29, 0x48, 0x93, 0x1b, 0x6a,
+    0xbc, 0x5e, 0xe1, 0x54, 0x74, 0x71, 0x1d, 0xf2, 0x21, 0x18, 0x2d, 0xef, 0xa1, 0x49, 0x68, 0xd6,
+    0xcb, 0xc1, 0x83, 0xa9, 0x47, 0xf9, 0xdb, 0x5f, 0x29, 0x24, 0xac, 0x0e, 0x58, 0x7a, 0x24, 0x4e,
+    0xfd, 0xd2, 0x83, 0x16, 0xd6, 0x02, 0x28, 0xf3, 0x70, 0xad, 0xa6, 0xd1, 0xc2, 0x49, 0xae, 0x3b,
+    0x52, 0xbf, 0xe8, 0x90, 0x76, 0xa4, 0xe4, 0xd6, 0x9e, 0x5c, 0x76, 0x84, 0x87, 0xa1, 0x63, 0x4c,
+    0xd5, 0x31, 0xdb, 0x90, 0xa6, 0xc0, 0x58, 0x59, 0x49, 0xda, 0x64, 0x50, 0x4b, 0x34, 0x03, 0x33,
+    0x82, 0xc3, 0x78, 0x99, 0xb2, 0x1a, 0xb4, 0xa7, 0x71, 0x16, 0x9d, 0x3a, 0x3e, 0x4f, 0x5c, 0x8f,
+    0xd2, 0x93, 0x67, 0xf0, 0x7a, 0xe2, 0x74, 0x4c, 0x8f, 0x4f, 0x0c, 0xe6, 0xc7, 0x58, 0x73, 0x65,
+    0xac, 0xd7, 0xa2, 0x3d, 0xcf, 0xe4, 0xc3, 0x77, 0xab, 0x66, 0xf2, 0xf2, 0xf7, 0x45, 0xf2, 0xfc,
+    0xab, 0x8a, 0xff, 0x0b, 0xe5, 0xf1, 0x94, 0x38, 0x66, 0x51, 0x00, 0x00,
+};
+
+const uint8_t WEB_ASSET_INDEX_HTML_PLAIN[] PROGMEM = {
+    0x3c, 0x21, 0x64, 0x6f, 0x63, 0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x7a, 0x68, 0x2d, 0x43,
+    0x4e, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65,
+    0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d,
+    0x38, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63,
+    0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d,
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74,
+    0x6c, 0x65, 0x3e, 0xe5, 0xa2, 0xa8, 0xe6, 0xb0, 0xb4, 0xe5, 0xb1, 0x8f, 0xe6, 0x97, 0xb6, 0xe9,
+    0x92, 0x9f, 0x20, 0xc2, 0xb7, 0x20, 0xe7, 0xb3, 0xbb, 0xe7, 0xbb, 0x9f, 0xe8, 0xae, 0xbe, 0xe7,
+    0xbd, 0xae, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x7b, 0x2d,
+    0x2d, 0x69, 0x6e, 0x6b, 0x3a, 0x23, 0x31, 0x37, 0x32, 0x30, 0x32, 0x61, 0x3b, 0x2d, 0x2d, 0x6d,
+    0x75, 0x74, 0x65, 0x64, 0x3a, 0x23, 0x36, 0x36, 0x37, 0x30, 0x38, 0x35, 0x3b, 0x2d, 0x2d, 0x6c,
+    0x69, 0x6e, 0x65, 0x3a, 0x23, 0x64, 0x30, 0x64, 0x35, 0x64, 0x64, 0x3b, 0x2d, 0x2d, 0x70, 0x61,
+    0x70, 0x65, 0x72, 0x3a, 0x23, 0x66, 0x37, 0x66, 0x37, 0x66, 0x32, 0x3b, 0x2d, 0x2d, 0x63, 0x61,
+    0x72, 0x64, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x2d, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+    0x3a, 0x23, 0x31, 0x38, 0x35, 0x61, 0x64, 0x62, 0x3b, 0x2d, 0x2d, 0x64, 0x61, 0x6e, 0x67, 0x65,
+    0x72, 0x3a, 0x23, 0x62, 0x34, 0x32, 0x33, 0x31, 0x38, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a,
+    0x7b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x6d, 0x61, 0x72, 0x67,
+    0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
+    0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x29, 0x3b, 0x63, 0x6f, 0x6c,
+    0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x66, 0x6f,
+    0x6e, 0x74, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x2f, 0x31, 0x2e, 0x35, 0x20, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x2d, 0x75, 0x69, 0x2c, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x73, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x2c, 0x22, 0x50, 0x69, 0x6e, 0x67, 0x46, 0x61, 0x6e, 0x67, 0x20, 0x53, 0x43,
+    0x22, 0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x7d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x73,
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x69, 0x6e, 0x68, 0x65, 0x72,
+    0x69, 0x74, 0x7d, 0x2e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+    0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+    0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x32, 0x31, 0x30,
+    0x70, 0x78, 0x20, 0x6d, 0x69, 0x6e, 0x6d, 0x61, 0x78, 0x28, 0x30, 0x2c, 0x31, 0x66, 0x72, 0x29,
+    0x3b, 0x6d, 0x69, 0x6e, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x76,
+    0x68, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x69, 0x64, 0x65, 0x7b, 0x62, 0x61, 0x63,
+    0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31, 0x31, 0x31, 0x38, 0x32, 0x37, 0x3b,
+    0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69,
+    0x6e, 0x67, 0x3a, 0x32, 0x34, 0x70, 0x78, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x70, 0x6f, 0x73,
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x79, 0x3b, 0x74, 0x6f, 0x70,
+    0x3a, 0x30, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x76, 0x68, 0x7d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x69, 0x64, 0x65, 0x20, 0x68, 0x31, 0x7b, 0x66, 0x6f,
+    0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72,
+    0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78, 0x7d,
+    0x2e, 0x6e, 0x61, 0x76, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69,
+    0x64, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x38, 0x70, 0x78, 0x7d, 0x2e, 0x6e, 0x61, 0x76, 0x20, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x30, 0x3b, 0x63,
+    0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x63, 0x62, 0x64, 0x35, 0x65, 0x31, 0x3b, 0x62, 0x61, 0x63,
+    0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x61, 0x72,
+    0x65, 0x6e, 0x74, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x6c,
+    0x65, 0x66, 0x74, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x31, 0x70, 0x78,
+    0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64,
+    0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6e, 0x61,
+    0x76, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2c,
+    0x2e, 0x6e, 0x61, 0x76, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65,
+    0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x62, 0x61, 0x63,
+    0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x36, 0x33, 0x32, 0x34, 0x36, 0x7d,
+    0x6d, 0x61, 0x69, 0x6e, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x33, 0x30, 0x70,
+    0x78, 0x3b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x38, 0x30,
+    0x70, 0x78, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x7d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c,
+    0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62,
+    0x6c, 0x6f, 0x63, 0x6b, 0x7d, 0x2e, 0x68, 0x65, 0x61, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c,
+    0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d,
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65,
+    0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d,
+    0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x36, 0x70,
+    0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a,
+    0x32, 0x30, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x32, 0x7b, 0x6d, 0x61, 0x72,
+    0x67, 0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+    0x32, 0x35, 0x70, 0x78, 0x7d, 0x2e, 0x73, 0x75, 0x62, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+    0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x64, 0x29, 0x3b, 0x6d, 0x61, 0x72,
+    0x67, 0x69, 0x6e, 0x3a, 0x34, 0x70, 0x78, 0x20, 0x30, 0x20, 0x30, 0x7d, 0x2e, 0x63, 0x61, 0x72,
+    0x64, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72,
+    0x28, 0x2d, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a,
+    0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+    0x6c, 0x69, 0x6e, 0x65, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64,
+    0x69, 0x75, 0x73, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+    0x3a, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74,
+    0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x67,
+    0x72, 0x69, 0x64, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64,
+    0x3b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63,
+    0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x28, 0x32, 0x2c,
+    0x6d, 0x69, 0x6e, 0x6d, 0x61, 0x78, 0x28, 0x30, 0x2c, 0x31, 0x66, 0x72, 0x29, 0x29, 0x3b, 0x67,
+    0x61, 0x70, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x7d, 0x2e, 0x72, 0x6f, 0x77, 0x7b, 0x64, 0x69, 0x73,
+    0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x30,
+    0x70, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63,
+    0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a,
+    0x77, 0x72, 0x61, 0x70, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b,
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x67, 0x61, 0x70,
+    0x3a, 0x36, 0x70, 0x78, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x33, 0x34, 0x34, 0x30,
+    0x35, 0x34, 0x7d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x74, 0x65,
+    0x78, 0x74, 0x5d, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x5d, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74,
+    0x79, 0x70, 0x65, 0x3d, 0x74, 0x69, 0x6d, 0x65, 0x5d, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5d, 0x2c, 0x73, 0x65, 0x6c,
+    0x65, 0x63, 0x74, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73,
+    0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x29,
+    0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x38,
+    0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x39, 0x70, 0x78, 0x3b, 0x62,
+    0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x6d,
+    0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x30, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x5d,
+    0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6f, 0x72, 0x64, 0x5d, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25,
+    0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78,
+    0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6c, 0x69, 0x6e,
+    0x65, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66,
+    0x66, 0x66, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x69,
+    0x6e, 0x6b, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x38, 0x70, 0x78, 0x20,
+    0x31, 0x33, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69,
+    0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f,
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x74, 0x6e, 0x2e,
+    0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x29,
+    0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+    0x72, 0x28, 0x2d, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x29, 0x3b, 0x63, 0x6f, 0x6c, 0x6f,
+    0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x7d, 0x2e, 0x62, 0x74, 0x6e, 0x2e, 0x64, 0x61, 0x6e, 0x67,
+    0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x64,
+    0x61, 0x6e, 0x67, 0x65, 0x72, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f,
+    0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x65, 0x63, 0x64, 0x63, 0x61, 0x7d, 0x2e, 0x62, 0x74, 0x6e,
+    0x2e, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x35,
+    0x70, 0x78, 0x20, 0x39, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
+    0x3a, 0x31, 0x33, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6c, 0x69, 0x73, 0x74,
+    0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x67, 0x61,
+    0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x7d, 0x2e, 0x69, 0x74, 0x65, 0x6d, 0x7b, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2d, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x29, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+    0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x2e, 0x64, 0x61, 0x79, 0x73, 0x7b,
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x67, 0x61, 0x70,
+    0x3a, 0x35, 0x70, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x77,
+    0x72, 0x61, 0x70, 0x7d, 0x2e, 0x64, 0x61, 0x79, 0x73, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b,
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x67, 0x61, 0x70,
+    0x3a, 0x33, 0x70, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73,
+    0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
+    0x65, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x66, 0x69, 0x6c,
+    0x65, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x67,
+    0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c,
+    0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x6d, 0x69, 0x6e, 0x6d, 0x61, 0x78, 0x28, 0x30, 0x2c, 0x31, 0x66,
+    0x72, 0x29, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x20, 0x61, 0x75, 0x74,
+    0x6f, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e,
+    0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73,
+    0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x65, 0x61, 0x65, 0x63, 0x66, 0x30, 0x7d, 0x2e, 0x66, 0x69,
+    0x6c, 0x65, 0x3a, 0x6c, 0x61, 0x73, 0x74, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x7b, 0x62, 0x6f,
+    0x72, 0x64, 0x65, 0x72, 0x3a, 0x30, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x33,
+    0x70, 0x78, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x6d,
+    0x75, 0x74, 0x65, 0x64, 0x29, 0x7d, 0x23, 0x74, 0x6f, 0x61, 0x73, 0x74, 0x7b, 0x70, 0x6f, 0x73,
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3b, 0x72, 0x69, 0x67, 0x68,
+    0x74, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x32, 0x30,
+    0x70, 0x78, 0x3b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x33, 0x32, 0x30,
+    0x70, 0x78, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31,
+    0x30, 0x31, 0x38, 0x32, 0x38, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66,
+    0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x20, 0x31, 0x36,
+    0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
+    0x3a, 0x39, 0x70, 0x78, 0x3b, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x30, 0x3b, 0x70,
+    0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x2d, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3a, 0x6e, 0x6f,
+    0x6e, 0x65, 0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x2e, 0x32,
+    0x73, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6f, 0x61, 0x73, 0x74, 0x2e, 0x73, 0x68,
+    0x6f, 0x77, 0x7b, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x31, 0x7d, 0x2e, 0x6d, 0x6f,
+    0x64, 0x61, 0x6c, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x7b, 0x64, 0x69, 0x73,
+    0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69,
+    0x6f, 0x6e, 0x3a, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3b, 0x69, 0x6e, 0x73, 0x65, 0x74, 0x3a, 0x30,
+    0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31, 0x30, 0x31,
+    0x38, 0x32, 0x38, 0x39, 0x39, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d,
+    0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79,
+    0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x7d, 0x2e, 0x6d, 0x6f,
+    0x64, 0x61, 0x6c, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x2e, 0x6f, 0x70, 0x65,
+    0x6e, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x7d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67,
+    0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68,
+    0x3a, 0x6d, 0x69, 0x6e, 0x28, 0x34, 0x33, 0x30, 0x70, 0x78, 0x2c, 0x31, 0x30, 0x30, 0x25, 0x29,
+    0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x31,
+    0x32, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x30, 0x70, 0x78,
+    0x7d, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x20, 0x68, 0x33, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x30, 0x7d, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x61,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66,
+    0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x65, 0x6e, 0x64, 0x3b, 0x67, 0x61, 0x70,
+    0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70,
+    0x3a, 0x31, 0x38, 0x70, 0x78, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6d, 0x65, 0x64, 0x69,
+    0x61, 0x28, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x37, 0x32, 0x30, 0x70,
+    0x78, 0x29, 0x7b, 0x2e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74,
+    0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a,
+    0x31, 0x66, 0x72, 0x7d, 0x61, 0x73, 0x69, 0x64, 0x65, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x73,
+    0x74, 0x61, 0x74, 0x69, 0x63, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x34,
+    0x70, 0x78, 0x7d, 0x61, 0x73, 0x69, 0x64, 0x65, 0x20, 0x68, 0x31, 0x7b, 0x6d, 0x61, 0x72, 0x67,
+    0x69, 0x6e, 0x3a, 0x30, 0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x32, 0x70, 0x78, 0x7d, 0x2e, 0x6e,
+    0x61, 0x76, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b,
+    0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x7d, 0x2e, 0x6e,
+    0x61, 0x76, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x7b, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2d,
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x6e, 0x6f, 0x77, 0x72, 0x61, 0x70, 0x7d, 0x6d, 0x61, 0x69,
+    0x6e, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x38, 0x70, 0x78, 0x7d, 0x2e,
+    0x67, 0x72, 0x69, 0x64, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+    0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x31, 0x66, 0x72, 0x7d, 0x2e,
+    0x66, 0x69, 0x6c, 0x65, 0x7b, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+    0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x31, 0x66, 0x72, 0x20, 0x61,
+    0x75, 0x74, 0x6f, 0x7d, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x2e, 0x73, 0x65, 0x63, 0x6f, 0x6e,
+    0x64, 0x61, 0x72, 0x79, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e,
+    0x65, 0x7d, 0x7d, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x3c,
+    0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x22,
+    0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x61, 0x73, 0x69, 0x64, 0x65, 0x3e, 0x3c, 0x68, 0x31, 0x3e, 0xe5,
+    0xa2, 0xa8, 0xe6, 0xb0, 0xb4, 0xe5, 0xb1, 0x8f, 0xe6, 0x97, 0xb6, 0xe9, 0x92, 0x9f, 0x3c, 0x2f,
+    0x68, 0x31, 0x3e, 0x3c, 0x6e, 0x61, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6e,
+    0x61, 0x76, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x3d, 0x22, 0x74, 0x6f, 0x64, 0x6f, 0x73,
+    0x22, 0x3e, 0xe9, 0xa6, 0x96, 0xe9, 0xa1, 0xb5, 0x20, 0x54, 0x6f, 0x64, 0x6f, 0x3c, 0x2f, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x3d, 0x22, 0x61, 0x6c,
+    0x61, 0x72, 0x6d, 0x73, 0x22, 0x3e, 0xe9, 0x97, 0xb9, 0xe9, 0x92, 0x9f, 0xe9, 0x85, 0x8d, 0xe7,
+    0xbd, 0xae, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x70, 0x61, 0x67,
+    0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x22, 0x3e, 0xe6, 0x96, 0x87, 0xe4, 0xbb, 0xb6,
+    0xe7, 0xae, 0xa1, 0xe7, 0x90, 0x86, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x2d, 0x70, 0x61, 0x67, 0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x3e, 0xe6, 0x94,
+    0xb6, 0xe9, 0x9f, 0xb3, 0xe6, 0x9c, 0xba, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x69, 0x73, 0x22, 0x3e, 0x41, 0x50,
+    0x49, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x6e,
+    0x61, 0x76, 0x3e, 0x3c, 0x70, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62,
+    0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x22, 0x3e, 0xe7, 0x8a, 0xb6, 0xe6, 0x80, 0x81, 0xe8, 0xbf, 0x9e, 0xe6, 0x8e, 0xa5,
+    0xe4, 0xb8, 0xad, 0xe2, 0x80, 0xa6, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x61, 0x73, 0x69, 0x64,
+    0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x61, 0x69, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x6f, 0x64,
+    0x6f, 0x73, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x61, 0x63, 0x74, 0x69, 0x76,
+    0x65, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68,
+    0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0xe9, 0xa6,
+    0x96, 0xe9, 0xa1, 0xb5, 0x20, 0x54, 0x6f, 0x64, 0x6f, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x70,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x3e, 0xe4, 0xbf, 0x9d,
+    0xe5, 0xad, 0x98, 0xe5, 0x9c, 0xa8, 0xe8, 0xae, 0xbe, 0xe5, 0xa4, 0x87, 0x20, 0x4e, 0x56, 0x53,
+    0xef, 0xbc, 0x8c, 0xe4, 0xb8, 0x8d, 0xe4, 0xbe, 0x9d, 0xe8, 0xb5, 0x96, 0x20, 0x53, 0x44, 0x43,
+    0x61, 0x72, 0x64, 0xe3, 0x80, 0x82, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62,
+    0x74, 0x6e, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+    0x73, 0x61, 0x76, 0x65, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x22, 0x3e, 0xe4, 0xbf, 0x9d, 0xe5, 0xad,
+    0x98, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x6f, 0x64, 0x6f, 0x4c, 0x69, 0x73,
+    0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x3e,
+    0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x64,
+    0x64, 0x54, 0x6f, 0x64, 0x6f, 0x22, 0x3e, 0xe6, 0x96, 0xb0, 0xe5, 0xa2, 0x9e, 0xe4, 0xba, 0x8b,
+    0xe9, 0xa1, 0xb9, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x73, 0x65,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x22, 0x3e,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x61, 0x64,
+    0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0xe9, 0x97, 0xb9, 0xe9, 0x92,
+    0x9f, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x70, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x3e, 0xe9, 0x93, 0x83, 0xe5, 0xa3,
+    0xb0, 0xe5, 0x8f, 0xaf, 0xe9, 0x80, 0x89, 0xe6, 0x8b, 0xa9, 0xe5, 0x86, 0x85, 0xe7, 0xbd, 0xae,
+    0xe6, 0x96, 0x87, 0xe4, 0xbb, 0xb6, 0xe3, 0x80, 0x81, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x20,
+    0xe6, 0xa0, 0xb9, 0xe7, 0x9b, 0xae, 0xe5, 0xbd, 0x95, 0x20, 0x4d, 0x50, 0x33, 0x20, 0xe6, 0x88,
+    0x96, 0xe8, 0xbd, 0xac, 0xe6, 0x8d, 0xa2, 0xe5, 0x90, 0x8e, 0xe7, 0x9a, 0x84, 0xe5, 0x8e, 0x9f,
+    0xe7, 0x94, 0x9f, 0xe9, 0x93, 0x83, 0xe5, 0xa3, 0xb0, 0xef, 0xbc, 0x88, 0x2e, 0x72, 0x74, 0x6e,
+    0xef, 0xbc, 0x89, 0xe3, 0x80, 0x82, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62,
+    0x74, 0x6e, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+    0x73, 0x61, 0x76, 0x65, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x22, 0x3e, 0xe4, 0xbf, 0x9d, 0xe5,
+    0xad, 0x98, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x4c,
+    0x69, 0x73, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74,
+    0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+    0x61, 0x64, 0x64, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x22, 0x3e, 0xe6, 0x96, 0xb0, 0xe5, 0xa2, 0x9e,
+    0xe9, 0x97, 0xb9, 0xe9, 0x92, 0x9f, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22,
+    0x3e, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x69, 0x6e, 0x67, 0x74,
+    0x6f, 0x6e, 0x65, 0x46, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x72, 0x6f, 0x77, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x69, 0x6e, 0x67,
+    0x74, 0x6f, 0x6e, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x22, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
+    0x3d, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65, 0x67, 0x2c, 0x2e, 0x6d, 0x70,
+    0x33, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x3c, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x70,
+    0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x3e, 0xe8, 0xbd, 0xac, 0xe6, 0x8d, 0xa2, 0xe4, 0xb8,
+    0xba, 0xe5, 0x8e, 0x9f, 0xe7, 0x94, 0x9f, 0xe9, 0x93, 0x83, 0xe5, 0xa3, 0xb0, 0x3c, 0x2f, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66,
+    0x69, 0x6c, 0x65, 0x73, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x68, 0x32,
+    0x3e, 0x53, 0x44, 0x43, 0x61, 0x72, 0x64, 0x20, 0xe6, 0x96, 0x87, 0xe4, 0xbb, 0xb6, 0xe7, 0xae,
+    0xa1, 0xe7, 0x90, 0x86, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x70, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65,
+    0x50, 0x61, 0x74, 0x68, 0x22, 0x3e, 0x2f, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x62, 0x74, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68,
+    0x46, 0x69, 0x6c, 0x65, 0x73, 0x22, 0x3e, 0xe5, 0x88, 0xb7, 0xe6, 0x96, 0xb0, 0x3c, 0x2f, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x3c, 0x66,
+    0x6f, 0x72, 0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x6f,
+    0x72, 0x6d, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e,
+    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c,
+    0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c,
+    0x65, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x3c, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x70,
+    0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x3e, 0xe4, 0xb8, 0x8a, 0xe4, 0xbc, 0xa0, 0x3c, 0x2f,
+    0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x3c, 0x2f,
+    0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x63, 0x61, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x4c, 0x69,
+    0x73, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x3c, 0x73, 0x74,
+    0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x53, 0x44, 0x20, 0xe6, 0xb5, 0x8b, 0xe9, 0x80, 0x9f, 0x3c, 0x2f,
+    0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72,
+    0x75, 0x6e, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x22, 0x3e, 0xe5, 0xbc, 0x80,
+    0xe5, 0xa7, 0x8b, 0xe6, 0xb5, 0x8b, 0xe9, 0x80, 0x9f, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f,
+    0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x70, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x62, 0x65, 0x6e, 0x63, 0x68,
+    0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x3e, 0xe5, 0xb0, 0x9a, 0xe6, 0x97, 0xa0, 0xe6,
+    0xb5, 0x8b, 0xe9, 0x80, 0x9f, 0xe7, 0xbb, 0x93, 0xe6, 0x9e, 0x9c, 0x3c, 0x2f, 0x70, 0x3e, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x68, 0x32, 0x3e, 0xe6, 0x94, 0xb6, 0xe9, 0x9f, 0xb3, 0xe6, 0x9c, 0xba, 0x3c, 0x2f, 0x68, 0x32,
+    0x3e, 0x3c, 0x70, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x3e,
+    0xe6, 0xad, 0xa5, 0xe8, 0xbf, 0x9b, 0xe5, 0x8d, 0x95, 0xe4, 0xbd, 0x8d, 0xe5, 0x9f, 0xba, 0xe4,
+    0xba, 0x8e, 0xe5, 0xbd, 0x93, 0xe5, 0x89, 0x8d, 0x20, 0x31, 0x30, 0x30, 0x20, 0x6b, 0x48, 0x7a,
+    0x20, 0xe4, 0xbf, 0xa1, 0xe9, 0x81, 0x93, 0xe6, 0xa8, 0xa1, 0xe5, 0x9e, 0x8b, 0xe3, 0x80, 0x82,
+    0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f,
+    0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x70, 0x72, 0x69,
+    0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x52, 0x61,
+    0x64, 0x69, 0x6f, 0x22, 0x3e, 0xe4, 0xbf, 0x9d, 0xe5, 0xad, 0x98, 0x3c, 0x2f, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x20, 0x67, 0x72, 0x69, 0x64, 0x22,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xe5,
+    0x8d, 0x95, 0xe6, 0xad, 0xa5, 0xe9, 0xa2, 0x91, 0xe7, 0x8e, 0x87, 0x3c, 0x73, 0x65, 0x6c, 0x65,
+    0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x53, 0x74, 0x65, 0x70,
+    0x22, 0x3e, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+    0x22, 0x31, 0x30, 0x22, 0x3e, 0x30, 0x2e, 0x31, 0x20, 0x4d, 0x48, 0x7a, 0x3c, 0x2f, 0x6f, 0x70,
+    0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x22, 0x3e, 0x30, 0x2e, 0x32, 0x20, 0x4d, 0x48, 0x7a, 0x3c,
+    0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x30, 0x22, 0x3e, 0x30, 0x2e, 0x35, 0x20, 0x4d,
+    0x48, 0x7a, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x3c, 0x6f, 0x70, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x22, 0x3e, 0x31,
+    0x2e, 0x30, 0x20, 0x4d, 0x48, 0x7a, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x3c,
+    0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x53, 0x65,
+    0x65, 0x6b, 0x20, 0xe9, 0x98, 0x88, 0xe5, 0x80, 0xbc, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x54, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f,
+    0x6c, 0x64, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+    0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x31,
+    0x35, 0x22, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x72, 0x6f, 0x77, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22,
+    0x72, 0x61, 0x64, 0x69, 0x6f, 0x42, 0x61, 0x73, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
+    0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3e, 0xe4, 0xbd, 0x8e, 0xe9, 0x9f,
+    0xb3, 0xe5, 0xa2, 0x9e, 0xe5, 0xbc, 0xba, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77,
+    0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x64,
+    0x69, 0x6f, 0x4d, 0x6f, 0x6e, 0x6f, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68,
+    0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3e, 0xe5, 0xbc, 0xba, 0xe5, 0x88, 0xb6, 0xe5, 0x8d,
+    0x95, 0xe5, 0xa3, 0xb0, 0xe9, 0x81, 0x93, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x53, 0x6f, 0x66, 0x74, 0x4d, 0x75, 0x74,
+    0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f,
+    0x78, 0x22, 0x3e, 0xe8, 0xbd, 0xaf, 0xe9, 0x9d, 0x99, 0xe9, 0x9f, 0xb3, 0x3c, 0x2f, 0x6c, 0x61,
+    0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22,
+    0x3e, 0x3c, 0x68, 0x33, 0x3e, 0xe9, 0xa2, 0x91, 0xe7, 0x8e, 0x87, 0xe4, 0xb8, 0xad, 0xe6, 0x96,
+    0x87, 0xe5, 0x90, 0x8d, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
+    0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x22, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x61, 0x70, 0x69, 0x73, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+    0x3e, 0x3c, 0x68, 0x32, 0x3e, 0x41, 0x50, 0x49, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x70, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x22, 0x3e, 0xe5, 0xb7, 0xb2, 0xe4,
+    0xbf, 0x9d, 0xe5, 0xad, 0x98, 0xe7, 0x9a, 0x84, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0xe4,
+    0xb8, 0x8d, 0xe4, 0xbc, 0x9a, 0xe5, 0x9b, 0x9e, 0xe4, 0xbc, 0xa0, 0xe5, 0x88, 0xb0, 0xe6, 0xb5,
+    0x8f, 0xe8, 0xa7, 0x88, 0xe5, 0x99, 0xa8, 0xef, 0xbc, 0x9b, 0xe7, 0x95, 0x99, 0xe7, 0xa9, 0xba,
+    0xe8, 0xa1, 0xa8, 0xe7, 0xa4, 0xba, 0xe4, 0xb8, 0x8d, 0xe4, 0xbf, 0xae, 0xe6, 0x94, 0xb9, 0xe3,
+    0x80, 0x82, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x70,
+    0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65,
+    0x41, 0x70, 0x69, 0x73, 0x22, 0x3e, 0xe4, 0xbf, 0x9d, 0xe5, 0xad, 0x98, 0x3c, 0x2f, 0x62, 0x75,
+    0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x20, 0x67, 0x72, 0x69, 0x64,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+    0xe5, 0xa4, 0xa9, 0xe6, 0xb0, 0x94, 0x20, 0x41, 0x50, 0x49, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e,
+    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x65, 0x61, 0x74, 0x68,
+    0x65, 0x72, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d,
+    0x70, 0x6c, 0x65, 0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63,
+    0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0xe6, 0x9c, 0xaa, 0xe9, 0x85, 0x8d, 0xe7,
+    0xbd, 0xae, 0x22, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xe8, 0x8a, 0x82, 0xe5, 0x81, 0x87,
+    0xe6, 0x97, 0xa5, 0x20, 0x41, 0x50, 0x49, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x3c, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x68, 0x6f, 0x6c, 0x69, 0x64, 0x61, 0x79, 0x54,
+    0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65,
+    0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+    0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0xe6, 0x9c, 0xaa, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0x22,
+    0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f,
+    0x77, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x6c,
+    0x65, 0x61, 0x72, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3e, 0xe6, 0xb8, 0x85, 0xe9,
+    0x99, 0xa4, 0xe5, 0xa4, 0xa9, 0xe6, 0xb0, 0x94, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x3c, 0x2f,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x48, 0x6f, 0x6c, 0x69, 0x64, 0x61, 0x79,
+    0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78,
+    0x22, 0x3e, 0xe6, 0xb8, 0x85, 0xe9, 0x99, 0xa4, 0xe8, 0x8a, 0x82, 0xe5, 0x81, 0x87, 0xe6, 0x97,
+    0xa5, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x6d, 0x61, 0x69, 0x6e, 0x3e, 0x0a, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74,
+    0x6f, 0x61, 0x73, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x42, 0x61, 0x63, 0x6b, 0x64,
+    0x72, 0x6f, 0x70, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61,
+    0x6c, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x22, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x22, 0x3e, 0x3c,
+    0x68, 0x33, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x54, 0x69, 0x74, 0x6c,
+    0x65, 0x22, 0x3e, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x3c, 0x70, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d,
+    0x6f, 0x64, 0x61, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x6c,
+    0x61, 0x62, 0x65, 0x6c, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x49, 0x6e,
+    0x70, 0x75, 0x74, 0x57, 0x72, 0x61, 0x70, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22,
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x3e, 0xe6, 0x96,
+    0xb0, 0xe5, 0x90, 0x8d, 0xe7, 0xa7, 0xb0, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64,
+    0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65,
+    0x6c, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6d, 0x6f,
+    0x64, 0x61, 0x6c, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x3e, 0x3c, 0x62, 0x75,
+    0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x22,
+    0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c,
+    0x22, 0x3e, 0xe5, 0x8f, 0x96, 0xe6, 0xb6, 0x88, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x62, 0x74, 0x6e, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x22, 0x3e, 0xe7,
+    0xa1, 0xae, 0xe5, 0xae, 0x9a, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f,
+    0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x7b, 0x74, 0x6f, 0x64, 0x6f, 0x73, 0x3a, 0x5b,
+    0x5d, 0x2c, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x3a, 0x5b, 0x5d, 0x2c, 0x72, 0x69, 0x6e, 0x67,
+    0x74, 0x6f, 0x6e, 0x65, 0x73, 0x3a, 0x5b, 0x22, 0x73, 0x70, 0x69, 0x66, 0x66, 0x73, 0x3a, 0x2f,
+    0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x6d, 0x70, 0x33, 0x22, 0x5d, 0x2c, 0x72, 0x61, 0x64, 0x69,
+    0x6f, 0x3a, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x3a, 0x22, 0x2f, 0x22, 0x7d,
+    0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x79, 0x73, 0x3d, 0x5b,
+    0x22, 0xe6, 0x97, 0xa5, 0x22, 0x2c, 0x22, 0xe4, 0xb8, 0x80, 0x22, 0x2c, 0x22, 0xe4, 0xba, 0x8c,
+    0x22, 0x2c, 0x22, 0xe4, 0xb8, 0x89, 0x22, 0x2c, 0x22, 0xe5, 0x9b, 0x9b, 0x22, 0x2c, 0x22, 0xe4,
+    0xba, 0x94, 0x22, 0x2c, 0x22, 0xe5, 0x85, 0xad, 0x22, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x20, 0x24, 0x3d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x3d, 0x3e,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+    0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x29,
+    0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x61, 0x73, 0x74, 0x3d,
+    0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x65, 0x6c, 0x3d, 0x24, 0x28, 0x22, 0x23, 0x74, 0x6f, 0x61, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x65,
+    0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x6d, 0x65,
+    0x73, 0x73, 0x61, 0x67, 0x65, 0x3b, 0x65, 0x6c, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69,
+    0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x22, 0x29, 0x3b, 0x73,
+    0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x65, 0x6c,
+    0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76,
+    0x65, 0x28, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x22, 0x29, 0x2c, 0x32, 0x32, 0x30, 0x30, 0x29, 0x7d,
+    0x3b, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x75, 0x72, 0x6c, 0x2c, 0x6f,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3d, 0x7b, 0x7d, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
+    0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x75, 0x72, 0x6c, 0x2c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+    0x73, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x61, 0x77,
+    0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x6a, 0x73, 0x6f,
+    0x6e, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+    0x2e, 0x6f, 0x6b, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72,
+    0x72, 0x6f, 0x72, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x7c, 0x7c, 0x22, 0xe8, 0xaf, 0xb7, 0xe6, 0xb1, 0x82, 0xe5, 0xa4, 0xb1, 0xe8, 0xb4, 0xa5, 0x22,
+    0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x7d, 0x0a, 0x20,
+    0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x49, 0x6e, 0x43, 0x68, 0x75, 0x6e, 0x6b, 0x73, 0x28, 0x66,
+    0x69, 0x6c, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x44, 0x61,
+    0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e,
+    0x67, 0x28, 0x33, 0x36, 0x29, 0x2b, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f,
+    0x6d, 0x28, 0x29, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x33, 0x36, 0x29,
+    0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x32, 0x2c, 0x38, 0x29, 0x2c, 0x63, 0x68, 0x75, 0x6e,
+    0x6b, 0x3d, 0x31, 0x30, 0x34, 0x38, 0x35, 0x37, 0x36, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x6f, 0x66,
+    0x66, 0x73, 0x65, 0x74, 0x3d, 0x30, 0x2c, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x73, 0x3d, 0x30,
+    0x3b, 0x66, 0x6f, 0x72, 0x28, 0x3b, 0x3b, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65,
+    0x6e, 0x64, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x6f, 0x66, 0x66, 0x73,
+    0x65, 0x74, 0x2b, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x2c, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x73, 0x69,
+    0x7a, 0x65, 0x29, 0x2c, 0x6c, 0x61, 0x73, 0x74, 0x3d, 0x65, 0x6e, 0x64, 0x3e, 0x3d, 0x66, 0x69,
+    0x6c, 0x65, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x6e, 0x65, 0x77,
+    0x20, 0x46, 0x6f, 0x72, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3b, 0x64, 0x61, 0x74, 0x61,
+    0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x2c, 0x66,
+    0x69, 0x6c, 0x65, 0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74,
+    0x2c, 0x65, 0x6e, 0x64, 0x29, 0x2c, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x29,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x72, 0x6c, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69,
+    0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3f, 0x70, 0x61,
+    0x74, 0x68, 0x3d, 0x22, 0x2b, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f,
+    0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61,
+    0x74, 0x68, 0x29, 0x2b, 0x22, 0x26, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x49, 0x64, 0x3d, 0x22,
+    0x2b, 0x69, 0x64, 0x2b, 0x22, 0x26, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x2b, 0x6f,
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x28, 0x6c, 0x61, 0x73, 0x74, 0x3f, 0x22, 0x26, 0x66, 0x69,
+    0x6e, 0x61, 0x6c, 0x3d, 0x31, 0x22, 0x3a, 0x22, 0x22, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x63,
+    0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x3d, 0x61, 0x77, 0x61, 0x69,
+    0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x75, 0x72, 0x6c, 0x2c, 0x7b, 0x6d,
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0x62, 0x6f, 0x64,
+    0x79, 0x3a, 0x64, 0x61, 0x74, 0x61, 0x7d, 0x29, 0x3b, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d,
+    0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x3b,
+    0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x73, 0x3d, 0x30, 0x3b, 0x69, 0x66, 0x28, 0x6c, 0x61, 0x73,
+    0x74, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x7d,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x7b, 0x69, 0x66, 0x28,
+    0x2b, 0x2b, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x73, 0x3e, 0x33, 0x29, 0x74, 0x68, 0x72, 0x6f,
+    0x77, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65,
+    0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x75,
+    0x70, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3f, 0x75, 0x70, 0x6c,
+    0x6f, 0x61, 0x64, 0x49, 0x64, 0x3d, 0x22, 0x2b, 0x69, 0x64, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x26, 0x26, 0x6f, 0x66,
+    0x66, 0x73, 0x65, 0x74, 0x3e, 0x30, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x3b, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x2e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x3f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2e, 0x72, 0x65,
+    0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x3a, 0x30, 0x7d, 0x7d, 0x7d, 0x0a, 0x20, 0x20, 0x61, 0x73,
+    0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x75, 0x6e,
+    0x28, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29,
+    0x7b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x74,
+    0x6f, 0x61, 0x73, 0x74, 0x28, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x7d, 0x63, 0x61,
+    0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+    0x6c, 0x65, 0x2e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x3b,
+    0x74, 0x6f, 0x61, 0x73, 0x74, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x6d, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x29, 0x7d, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x64, 0x61,
+    0x74, 0x61, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7b, 0x6d, 0x65, 0x74, 0x68, 0x6f,
+    0x64, 0x3a, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+    0x3a, 0x7b, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x22,
+    0x3a, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73,
+    0x6f, 0x6e, 0x22, 0x7d, 0x2c, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73,
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7d, 0x7d,
+    0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x68, 0x6f, 0x77,
+    0x50, 0x61, 0x67, 0x65, 0x28, 0x69, 0x64, 0x29, 0x7b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41,
+    0x6c, 0x6c, 0x28, 0x22, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x29, 0x2e, 0x66, 0x6f,
+    0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x65, 0x6c, 0x3d, 0x3e, 0x65, 0x6c, 0x2e, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x22, 0x61,
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x2c, 0x65, 0x6c, 0x2e, 0x69, 0x64, 0x3d, 0x3d, 0x3d, 0x69,
+    0x64, 0x29, 0x29, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65,
+    0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x2e,
+    0x6e, 0x61, 0x76, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x29, 0x2e, 0x66, 0x6f, 0x72,
+    0x45, 0x61, 0x63, 0x68, 0x28, 0x65, 0x6c, 0x3d, 0x3e, 0x65, 0x6c, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x22, 0x61, 0x63,
+    0x74, 0x69, 0x76, 0x65, 0x22, 0x2c, 0x65, 0x6c, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
+    0x2e, 0x70, 0x61, 0x67, 0x65, 0x3d, 0x3d, 0x3d, 0x69, 0x64, 0x29, 0x29, 0x7d, 0x0a, 0x20, 0x20,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+    0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x2e, 0x6e, 0x61, 0x76, 0x20,
+    0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x29, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68,
+    0x28, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3d, 0x3e, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+    0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x73, 0x68, 0x6f,
+    0x77, 0x50, 0x61, 0x67, 0x65, 0x28, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x64, 0x61, 0x74,
+    0x61, 0x73, 0x65, 0x74, 0x2e, 0x70, 0x61, 0x67, 0x65, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x44, 0x61,
+    0x79, 0x73, 0x28, 0x6d, 0x61, 0x73, 0x6b, 0x2c, 0x6f, 0x6e, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
+    0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x6f, 0x78, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x62, 0x6f, 0x78, 0x2e, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x61, 0x79, 0x73, 0x22, 0x3b, 0x64,
+    0x61, 0x79, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x6e, 0x61, 0x6d,
+    0x65, 0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x6c,
+    0x61, 0x62, 0x65, 0x6c, 0x22, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x22, 0x29, 0x3b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63,
+    0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x63,
+    0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x42, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x28, 0x6d,
+    0x61, 0x73, 0x6b, 0x26, 0x28, 0x31, 0x3c, 0x3c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x29, 0x3b,
+    0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c,
+    0x6f, 0x6e, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x29, 0x3b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e,
+    0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x62, 0x69, 0x74, 0x3d, 0x69, 0x6e, 0x64, 0x65,
+    0x78, 0x3b, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x69,
+    0x6e, 0x70, 0x75, 0x74, 0x2c, 0x22, 0xe5, 0x91, 0xa8, 0x22, 0x2b, 0x6e, 0x61, 0x6d, 0x65, 0x29,
+    0x3b, 0x62, 0x6f, 0x78, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x6c, 0x61, 0x62, 0x65,
+    0x6c, 0x29, 0x7d, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x6f, 0x78, 0x7d,
+    0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x44, 0x61, 0x79, 0x73, 0x28, 0x62, 0x6f, 0x78, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x6d, 0x61,
+    0x73, 0x6b, 0x3d, 0x30, 0x3b, 0x62, 0x6f, 0x78, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+    0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x22, 0x29, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x63, 0x68, 0x65, 0x63,
+    0x6b, 0x65, 0x64, 0x29, 0x6d, 0x61, 0x73, 0x6b, 0x7c, 0x3d, 0x31, 0x3c, 0x3c, 0x4e, 0x75, 0x6d,
+    0x62, 0x65, 0x72, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65,
+    0x74, 0x2e, 0x62, 0x69, 0x74, 0x29, 0x7d, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x6d, 0x61, 0x73, 0x6b, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x69, 0x74, 0x65, 0x6d, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x74,
+    0x2c, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x2c, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x3d,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x22, 0x29, 0x3b, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
+    0x22, 0x2b, 0x28, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x3f, 0x22, 0x20, 0x64, 0x61, 0x6e, 0x67,
+    0x65, 0x72, 0x22, 0x3a, 0x22, 0x22, 0x29, 0x3b, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x74,
+    0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3b, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+    0x74, 0x65, 0x78, 0x74, 0x3b, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c,
+    0x69, 0x63, 0x6b, 0x22, 0x2c, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x29, 0x3b, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x7d, 0x0a, 0x20, 0x20, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x54, 0x6f,
+    0x64, 0x6f, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x73, 0x74,
+    0x3d, 0x24, 0x28, 0x22, 0x23, 0x74, 0x6f, 0x64, 0x6f, 0x4c, 0x69, 0x73, 0x74, 0x22, 0x29, 0x3b,
+    0x6c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x43, 0x68, 0x69, 0x6c,
+    0x64, 0x72, 0x65, 0x6e, 0x28, 0x29, 0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x74, 0x6f, 0x64,
+    0x6f, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x74, 0x6f, 0x64, 0x6f,
+    0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x63, 0x61, 0x72, 0x64, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76,
+    0x22, 0x29, 0x3b, 0x63, 0x61, 0x72, 0x64, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72,
+    0x6f, 0x77, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29,
+    0x3b, 0x72, 0x6f, 0x77, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+    0x72, 0x6f, 0x77, 0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c,
+    0x65, 0x64, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x22, 0x29, 0x3b, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d,
+    0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3b, 0x65, 0x6e, 0x61, 0x62, 0x6c,
+    0x65, 0x64, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x74, 0x6f, 0x64, 0x6f, 0x2e,
+    0x65, 0x3b, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e,
+    0x67, 0x65, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x65, 0x3d, 0x65,
+    0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x29, 0x3b,
+    0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x74, 0x69, 0x6d, 0x65, 0x2e,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3b, 0x74, 0x69, 0x6d, 0x65,
+    0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x74, 0x6f,
+    0x64, 0x6f, 0x2e, 0x68, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x32,
+    0x2c, 0x22, 0x30, 0x22, 0x29, 0x2b, 0x22, 0x3a, 0x22, 0x2b, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+    0x28, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x6d, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72,
+    0x74, 0x28, 0x32, 0x2c, 0x22, 0x30, 0x22, 0x29, 0x3b, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
+    0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x5b, 0x74, 0x6f,
+    0x64, 0x6f, 0x2e, 0x68, 0x2c, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x6d, 0x5d, 0x3d, 0x74, 0x69, 0x6d,
+    0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x3a,
+    0x22, 0x29, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x7d, 0x29,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78,
+    0x74, 0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x6d, 0x61, 0x78, 0x4c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x3d, 0x36, 0x34, 0x3b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x63, 0x3b, 0x63, 0x6f, 0x6e,
+    0x74, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72,
+    0x3d, 0x22, 0xe4, 0xba, 0x8b, 0xe9, 0xa1, 0xb9, 0xe5, 0x86, 0x85, 0xe5, 0xae, 0xb9, 0x22, 0x3b,
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x63, 0x3d, 0x63, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+    0x28, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x29, 0x3b, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69,
+    0x74, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x6f,
+    0x77, 0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x69, 0x67, 0x68, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x68, 0x69,
+    0x67, 0x68, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f,
+    0x78, 0x22, 0x3b, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d,
+    0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x70, 0x3b, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68,
+    0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x70,
+    0x3d, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x29, 0x3b, 0x70,
+    0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x68,
+    0x69, 0x67, 0x68, 0x2c, 0x22, 0xe9, 0xab, 0x98, 0xe4, 0xbc, 0x98, 0xe5, 0x85, 0x88, 0xe7, 0xba,
+    0xa7, 0x22, 0x29, 0x3b, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x65,
+    0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x74, 0x69, 0x6d, 0x65, 0x2c, 0x63, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x2c, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x2c, 0x69, 0x74, 0x65,
+    0x6d, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28, 0x22, 0xe7, 0xa7, 0xbb, 0xe9, 0x99, 0xa4, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x74, 0x6f, 0x64, 0x6f,
+    0x73, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x31,
+    0x29, 0x3b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x28, 0x29, 0x7d,
+    0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61,
+    0x79, 0x42, 0x6f, 0x78, 0x3d, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x44, 0x61, 0x79, 0x73, 0x28, 0x74,
+    0x6f, 0x64, 0x6f, 0x2e, 0x77, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x6f, 0x64, 0x6f, 0x2e, 0x77,
+    0x3d, 0x72, 0x65, 0x61, 0x64, 0x44, 0x61, 0x79, 0x73, 0x28, 0x64, 0x61, 0x79, 0x42, 0x6f, 0x78,
+    0x29, 0x29, 0x3b, 0x63, 0x61, 0x72, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x72,
+    0x6f, 0x77, 0x2c, 0x64, 0x61, 0x79, 0x42, 0x6f, 0x78, 0x29, 0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e,
+    0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x61, 0x72, 0x64, 0x29, 0x7d, 0x29, 0x7d, 0x0a,
+    0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x54, 0x6f,
+    0x64, 0x6f, 0x28, 0x29, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x74, 0x6f, 0x64, 0x6f, 0x73,
+    0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7b, 0x69, 0x64, 0x3a, 0x30, 0x2c, 0x68, 0x3a, 0x39, 0x2c,
+    0x6d, 0x3a, 0x30, 0x2c, 0x63, 0x3a, 0x22, 0x22, 0x2c, 0x70, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x2c, 0x77, 0x3a, 0x31, 0x32, 0x37, 0x2c, 0x65, 0x3a, 0x74, 0x72, 0x75, 0x65, 0x7d, 0x29, 0x3b,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x28, 0x29, 0x7d, 0x0a, 0x20,
+    0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x6c, 0x6f, 0x61, 0x64, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x28, 0x29, 0x7b, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x2e, 0x74, 0x6f, 0x64, 0x6f, 0x73, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x74, 0x6f, 0x64, 0x6f,
+    0x73, 0x22, 0x29, 0x3b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x28,
+    0x29, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x69,
+    0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+    0x29, 0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65,
+    0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x3e,
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x4f,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x2c,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x3d, 0x3d, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x29, 0x29, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x6c,
+    0x65, 0x63, 0x74, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x28, 0x29, 0x7b, 0x63,
+    0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x3d, 0x24, 0x28, 0x22, 0x23, 0x61, 0x6c,
+    0x61, 0x72, 0x6d, 0x4c, 0x69, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x72,
+    0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x28, 0x29,
+    0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x2e, 0x66, 0x6f,
+    0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2c, 0x69, 0x6e, 0x64,
+    0x65, 0x78, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x61, 0x72, 0x64,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x63,
+    0x61, 0x72, 0x64, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69,
+    0x74, 0x65, 0x6d, 0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x6f, 0x77, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x72, 0x6f, 0x77,
+    0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x65,
+    0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65,
+    0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3b, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x63,
+    0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x65, 0x3b, 0x65,
+    0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x65, 0x3d, 0x65, 0x6e, 0x61,
+    0x62, 0x6c, 0x65, 0x64, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x29, 0x3b, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28,
+    0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x74, 0x79,
+    0x70, 0x65, 0x3d, 0x22, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3b, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x3d, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x61, 0x6c, 0x61, 0x72,
+    0x6d, 0x2e, 0x68, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x32, 0x2c,
+    0x22, 0x30, 0x22, 0x29, 0x2b, 0x22, 0x3a, 0x22, 0x2b, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+    0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x6d, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72,
+    0x74, 0x28, 0x32, 0x2c, 0x22, 0x30, 0x22, 0x29, 0x3b, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
+    0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x5b, 0x61, 0x6c,
+    0x61, 0x72, 0x6d, 0x2e, 0x68, 0x2c, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x6d, 0x5d, 0x3d, 0x74,
+    0x69, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28,
+    0x22, 0x3a, 0x22, 0x29, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29,
+    0x7d, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x3d,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45,
+    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x29,
+    0x3b, 0x5b, 0x5b, 0x22, 0xe6, 0xaf, 0x8f, 0xe5, 0xa4, 0xa9, 0x22, 0x2c, 0x30, 0x5d, 0x2c, 0x5b,
+    0x22, 0xe6, 0x8c, 0x87, 0xe5, 0xae, 0x9a, 0xe6, 0x98, 0x9f, 0xe6, 0x9c, 0x9f, 0x22, 0x2c, 0x31,
+    0x5d, 0x2c, 0x5b, 0x22, 0xe5, 0xb7, 0xa5, 0xe4, 0xbd, 0x9c, 0xe6, 0x97, 0xa5, 0x22, 0x2c, 0x32,
+    0x5d, 0x5d, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x74, 0x65, 0x6d, 0x3d,
+    0x3e, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6e, 0x65, 0x77, 0x20,
+    0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x69, 0x74, 0x65, 0x6d, 0x5b, 0x30, 0x5d, 0x2c, 0x69,
+    0x74, 0x65, 0x6d, 0x5b, 0x31, 0x5d, 0x2c, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x2c, 0x4e, 0x75, 0x6d,
+    0x62, 0x65, 0x72, 0x28, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x72, 0x29, 0x3d, 0x3d, 0x3d, 0x69,
+    0x74, 0x65, 0x6d, 0x5b, 0x31, 0x5d, 0x29, 0x29, 0x29, 0x3b, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+    0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x61,
+    0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x72, 0x3d, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x72, 0x65,
+    0x70, 0x65, 0x61, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x6e, 0x64, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e,
+    0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x73, 0x29,
+    0x3b, 0x73, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x73, 0x3d, 0x73, 0x6f, 0x75,
+    0x6e, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x28, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x74, 0x69, 0x6d,
+    0x65, 0x2c, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x2c, 0x73, 0x6f, 0x75, 0x6e, 0x64, 0x2c, 0x69,
+    0x74, 0x65, 0x6d, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28, 0x22, 0xe7, 0xa7, 0xbb, 0xe9, 0x99,
+    0xa4, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x6c,
+    0x61, 0x72, 0x6d, 0x73, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x69, 0x6e, 0x64, 0x65,
+    0x78, 0x2c, 0x31, 0x29, 0x3b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x41, 0x6c, 0x61, 0x72, 0x6d,
+    0x73, 0x28, 0x29, 0x7d, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x64, 0x61, 0x79, 0x42, 0x6f, 0x78, 0x3d, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x44, 0x61,
+    0x79, 0x73, 0x28, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x77, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x61,
+    0x6c, 0x61, 0x72, 0x6d, 0x2e, 0x77, 0x3d, 0x72, 0x65, 0x61, 0x64, 0x44, 0x61, 0x79, 0x73, 0x28,
+    0x64, 0x61, 0x79, 0x42, 0x6f, 0x78, 0x29, 0x29, 0x3b, 0x63, 0x61, 0x72, 0x64, 0x2e, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x28, 0x72, 0x6f, 0x77, 0x2c, 0x64, 0x61, 0x79, 0x42, 0x6f, 0x78, 0x29,
+    0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x61, 0x72,
+    0x64, 0x29, 0x7d, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x6c, 0x61, 0x72, 0x6d,
+    0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5b, 0x61, 0x6c, 0x61, 0x72, 0x6d,
+    0x73, 0x2c, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x5d, 0x3d, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x2e, 0x61, 0x6c, 0x6c, 0x28, 0x5b,
+    0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x61, 0x6c,
+    0x61, 0x72, 0x6d, 0x73, 0x22, 0x29, 0x2c, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22,
+    0x2f, 0x61, 0x70, 0x69, 0x2f, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x22, 0x29,
+    0x5d, 0x29, 0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x3d,
+    0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x69, 0x6e,
+    0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x3d, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73,
+    0x3b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x28, 0x29, 0x7d,
+    0x0a, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x52, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e,
+    0x65, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x61,
+    0x74, 0x65, 0x3d, 0x31, 0x36, 0x30, 0x30, 0x30, 0x2c, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x64,
+    0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x66, 0x66, 0x6c, 0x69,
+    0x6e, 0x65, 0x41, 0x75, 0x64, 0x69, 0x6f, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x31,
+    0x2c, 0x31, 0x2c, 0x72, 0x61, 0x74, 0x65, 0x29, 0x2e, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x41,
+    0x75, 0x64, 0x69, 0x6f, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66,
+    0x69, 0x6c, 0x65, 0x2e, 0x61, 0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28,
+    0x29, 0x29, 0x2c, 0x6f, 0x66, 0x66, 0x6c, 0x69, 0x6e, 0x65, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x4f,
+    0x66, 0x66, 0x6c, 0x69, 0x6e, 0x65, 0x41, 0x75, 0x64, 0x69, 0x6f, 0x43, 0x6f, 0x6e, 0x74, 0x65,
+    0x78, 0x74, 0x28, 0x31, 0x2c, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x63, 0x65, 0x69, 0x6c, 0x28, 0x64,
+    0x65, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x2e, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2a,
+    0x72, 0x61, 0x74, 0x65, 0x29, 0x2c, 0x72, 0x61, 0x74, 0x65, 0x29, 0x2c, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x3d, 0x6f, 0x66, 0x66, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x29, 0x3b,
+    0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3d, 0x64, 0x65,
+    0x63, 0x6f, 0x64, 0x65, 0x64, 0x3b, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x63, 0x6f, 0x6e,
+    0x6e, 0x65, 0x63, 0x74, 0x28, 0x6f, 0x66, 0x66, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x64, 0x65, 0x73,
+    0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+    0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73,
+    0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x3d, 0x28, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6f, 0x66,
+    0x66, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x52, 0x65, 0x6e, 0x64, 0x65,
+    0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x29, 0x2e, 0x67, 0x65, 0x74, 0x43, 0x68, 0x61, 0x6e, 0x6e,
+    0x65, 0x6c, 0x44, 0x61, 0x74, 0x61, 0x28, 0x30, 0x29, 0x2c, 0x70, 0x63, 0x6d, 0x3d, 0x6e, 0x65,
+    0x77, 0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 0x69, 0x65, 0x77, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x41,
+    0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+    0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2a, 0x32, 0x29, 0x29, 0x3b, 0x73, 0x61,
+    0x6d, 0x70, 0x6c, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3d, 0x3e, 0x70, 0x63, 0x6d,
+    0x2e, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2a,
+    0x32, 0x2c, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x4d, 0x61, 0x74,
+    0x68, 0x2e, 0x6d, 0x61, 0x78, 0x28, 0x2d, 0x31, 0x2c, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69,
+    0x6e, 0x28, 0x31, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x29, 0x2a, 0x33, 0x32, 0x37, 0x36,
+    0x37, 0x29, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x72,
+    0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5c, 0x2e, 0x5b, 0x5e, 0x2e, 0x5d, 0x2b, 0x24,
+    0x2f, 0x2c, 0x22, 0x22, 0x29, 0x2c, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x46,
+    0x6f, 0x72, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x28, 0x29, 0x3b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61,
+    0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x2c, 0x6e, 0x65, 0x77,
+    0x20, 0x42, 0x6c, 0x6f, 0x62, 0x28, 0x5b, 0x70, 0x63, 0x6d, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x5d, 0x29, 0x2c, 0x6e, 0x61, 0x6d, 0x65, 0x2b, 0x22, 0x2e, 0x70, 0x63, 0x6d, 0x22, 0x29,
+    0x3b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22,
+    0x2f, 0x61, 0x70, 0x69, 0x2f, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x2f, 0x63,
+    0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x3f, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x2b, 0x65, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+    0x28, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x2b, 0x22, 0x26, 0x72, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x2b,
+    0x72, 0x61, 0x74, 0x65, 0x2c, 0x7b, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x22, 0x50, 0x4f,
+    0x53, 0x54, 0x22, 0x2c, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x64, 0x61, 0x74, 0x61, 0x7d, 0x29, 0x3b,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x3d,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f,
+    0x61, 0x70, 0x69, 0x2f, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x22, 0x29, 0x3b,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x28, 0x29, 0x7d, 0x0a,
+    0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x41, 0x6c,
+    0x61, 0x72, 0x6d, 0x28, 0x29, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x6c, 0x61, 0x72,
+    0x6d, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7b, 0x68, 0x3a, 0x37, 0x2c, 0x6d, 0x3a, 0x33,
+    0x30, 0x2c, 0x65, 0x3a, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x72, 0x3a, 0x32, 0x2c, 0x77, 0x3a, 0x36,
+    0x32, 0x2c, 0x73, 0x3a, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f,
+    0x6e, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x7d, 0x29, 0x3b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x41,
+    0x6c, 0x61, 0x72, 0x6d, 0x73, 0x28, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63,
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x61,
+    0x64, 0x69, 0x6f, 0x28, 0x29, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69,
+    0x6f, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28,
+    0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x29, 0x3b, 0x24, 0x28,
+    0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x53, 0x74, 0x65, 0x70, 0x22, 0x29, 0x2e, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e,
+    0x73, 0x74, 0x65, 0x70, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x54, 0x68,
+    0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e, 0x74, 0x68, 0x72, 0x65,
+    0x73, 0x68, 0x6f, 0x6c, 0x64, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x42,
+    0x61, 0x73, 0x73, 0x22, 0x29, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e, 0x62, 0x61, 0x73, 0x73, 0x3b, 0x24,
+    0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x4d, 0x6f, 0x6e, 0x6f, 0x22, 0x29, 0x2e, 0x63,
+    0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64,
+    0x69, 0x6f, 0x2e, 0x6d, 0x6f, 0x6e, 0x6f, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69,
+    0x6f, 0x53, 0x6f, 0x66, 0x74, 0x4d, 0x75, 0x74, 0x65, 0x22, 0x29, 0x2e, 0x63, 0x68, 0x65, 0x63,
+    0x6b, 0x65, 0x64, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e,
+    0x73, 0x6f, 0x66, 0x74, 0x4d, 0x75, 0x74, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c,
+    0x69, 0x73, 0x74, 0x3d, 0x24, 0x28, 0x22, 0x23, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c,
+    0x69, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61,
+    0x63, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x28, 0x29, 0x3b, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x6f, 0x77, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x29, 0x3b, 0x72, 0x6f,
+    0x77, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x6f, 0x77,
+    0x22, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63,
+    0x79, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6e, 0x22, 0x29,
+    0x3b, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x79, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x28, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x79, 0x2f, 0x31, 0x30, 0x30, 0x29, 0x2e, 0x74,
+    0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x31, 0x29, 0x2b, 0x22, 0x20, 0x4d, 0x48, 0x7a, 0x22,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3b, 0x6e, 0x61, 0x6d, 0x65,
+    0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3b, 0x6e, 0x61, 0x6d,
+    0x65, 0x2e, 0x6d, 0x61, 0x78, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x32, 0x34, 0x3b, 0x6e,
+    0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x3b, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x29, 0x3b, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x66, 0x72, 0x65,
+    0x71, 0x75, 0x65, 0x6e, 0x63, 0x79, 0x2c, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x3b, 0x6c, 0x69, 0x73,
+    0x74, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x72, 0x6f, 0x77, 0x29, 0x7d, 0x29, 0x7d,
+    0x0a, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x70, 0x69, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x61, 0x70, 0x69, 0x2d,
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x77,
+    0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x29, 0x2e, 0x70, 0x6c,
+    0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x77,
+    0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64,
+    0x3f, 0x22, 0xe5, 0xb7, 0xb2, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0xef, 0xbc, 0x8c, 0xe7, 0x95,
+    0x99, 0xe7, 0xa9, 0xba, 0xe4, 0xb8, 0x8d, 0xe4, 0xbf, 0xae, 0xe6, 0x94, 0xb9, 0x22, 0x3a, 0x22,
+    0xe6, 0x9c, 0xaa, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0x22, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x68,
+    0x6f, 0x6c, 0x69, 0x64, 0x61, 0x79, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x29, 0x2e, 0x70, 0x6c,
+    0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x68,
+    0x6f, 0x6c, 0x69, 0x64, 0x61, 0x79, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64,
+    0x3f, 0x22, 0xe5, 0xb7, 0xb2, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0xef, 0xbc, 0x8c, 0xe7, 0x95,
+    0x99, 0xe7, 0xa9, 0xba, 0xe4, 0xb8, 0x8d, 0xe4, 0xbf, 0xae, 0xe6, 0x94, 0xb9, 0x22, 0x3a, 0x22,
+    0xe6, 0x9c, 0xaa, 0xe9, 0x85, 0x8d, 0xe7, 0xbd, 0xae, 0x22, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28,
+    0x6e, 0x61, 0x6d, 0x65, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6c, 0x65, 0x61,
+    0x6e, 0x3d, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74,
+    0x68, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x3f, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x73, 0x6c, 0x69, 0x63,
+    0x65, 0x28, 0x31, 0x29, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x3d, 0x3d, 0x22, 0x2f,
+    0x22, 0x3f, 0x22, 0x2f, 0x22, 0x2b, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x3a, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x2b, 0x22, 0x2f, 0x22, 0x2b, 0x63, 0x6c, 0x65, 0x61, 0x6e,
+    0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x69, 0x6c,
+    0x65, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x3d, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x73, 0x70, 0x6c,
+    0x69, 0x74, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70,
+    0x61, 0x72, 0x74, 0x73, 0x5b, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+    0x68, 0x2d, 0x31, 0x5d, 0x7c, 0x7c, 0x70, 0x61, 0x74, 0x68, 0x7d, 0x0a, 0x20, 0x20, 0x61, 0x73,
+    0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69,
+    0x74, 0x65, 0x6d, 0x73, 0x3d, 0x5b, 0x5d, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x2c, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x30, 0x3b, 0x64, 0x6f, 0x7b, 0x64, 0x61, 0x74,
+    0x61, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28,
+    0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x3f, 0x70, 0x61, 0x74, 0x68,
+    0x3d, 0x22, 0x2b, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70,
+    0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68,
+    0x29, 0x2b, 0x22, 0x26, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x2b, 0x6f, 0x66, 0x66,
+    0x73, 0x65, 0x74, 0x29, 0x3b, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28,
+    0x2e, 0x2e, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x29, 0x3b, 0x6f,
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6e, 0x65, 0x78, 0x74, 0x7d,
+    0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6e, 0x65, 0x78, 0x74, 0x21,
+    0x3d, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x66, 0x69, 0x6c, 0x65,
+    0x50, 0x61, 0x74, 0x68, 0x22, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x3b, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x3d, 0x24, 0x28, 0x22, 0x23, 0x66, 0x69, 0x6c, 0x65,
+    0x4c, 0x69, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x70, 0x6c,
+    0x61, 0x63, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x28, 0x29, 0x3b, 0x69, 0x66,
+    0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x21, 0x3d, 0x3d, 0x22, 0x2f,
+    0x22, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x70, 0x3d, 0x69, 0x74, 0x65, 0x6d,
+    0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28, 0x22, 0xe8, 0xbf, 0x94, 0xe5, 0x9b, 0x9e, 0xe4, 0xb8,
+    0x8a, 0xe7, 0xba, 0xa7, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74,
+    0x68, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x2e, 0x66, 0x69, 0x6c,
+    0x74, 0x65, 0x72, 0x28, 0x42, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x29, 0x3b, 0x70, 0x61, 0x72,
+    0x74, 0x73, 0x2e, 0x70, 0x6f, 0x70, 0x28, 0x29, 0x3b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70,
+    0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x22, 0x2b, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6a, 0x6f,
+    0x69, 0x6e, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x2e, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3e, 0x31, 0x26, 0x26,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x65, 0x6e, 0x64, 0x73, 0x57,
+    0x69, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x29, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70,
+    0x61, 0x74, 0x68, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x73,
+    0x6c, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2c, 0x2d, 0x31, 0x29, 0x3b, 0x72, 0x75, 0x6e, 0x28, 0x6c,
+    0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x29, 0x7d, 0x29, 0x3b, 0x6c, 0x69, 0x73, 0x74,
+    0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x75, 0x70, 0x29, 0x7d, 0x69, 0x74, 0x65, 0x6d,
+    0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x3d, 0x3e,
+    0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x66, 0x69, 0x6c, 0x65,
+    0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68,
+    0x28, 0x22, 0x2f, 0x22, 0x29, 0x3f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x3a,
+    0x6a, 0x6f, 0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61,
+    0x6d, 0x65, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x6f, 0x77, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x72, 0x6f, 0x77, 0x2e,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x22,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x28, 0x22, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x22, 0x29, 0x3b, 0x6e, 0x61, 0x6d,
+    0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x28, 0x66,
+    0x69, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x3f, 0x22, 0xf0,
+    0x9f, 0x93, 0x81, 0x20, 0x22, 0x3a, 0x22, 0x22, 0x29, 0x2b, 0x66, 0x69, 0x6c, 0x65, 0x4e, 0x61,
+    0x6d, 0x65, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x3b, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28,
+    0x22, 0x73, 0x70, 0x61, 0x6e, 0x22, 0x29, 0x3b, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72,
+    0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3b, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x74,
+    0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x66, 0x69, 0x6c, 0x65, 0x2e,
+    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x3f, 0x22, 0xe7, 0x9b, 0xae, 0xe5, 0xbd,
+    0x95, 0x22, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2b, 0x22, 0x20, 0x42,
+    0x22, 0x3b, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x6e, 0x61, 0x6d,
+    0x65, 0x2c, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x2e,
+    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x29, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6d, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28,
+    0x22, 0xe6, 0x89, 0x93, 0xe5, 0xbc, 0x80, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x70, 0x61, 0x74, 0x68, 0x3b, 0x72, 0x75,
+    0x6e, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x29, 0x7d, 0x29, 0x29, 0x3b,
+    0x65, 0x6c, 0x73, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x3d,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45,
+    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x61, 0x22, 0x29, 0x3b, 0x6c, 0x69, 0x6e, 0x6b,
+    0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20,
+    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x3b, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x74, 0x65, 0x78, 0x74,
+    0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0xe4, 0xb8, 0x8b, 0xe8, 0xbd, 0xbd, 0x22,
+    0x3b, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69,
+    0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3f,
+    0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2b, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49,
+    0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x3b,
+    0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x29,
+    0x7d, 0x72, 0x6f, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6d,
+    0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x28, 0x22, 0xe9, 0x87, 0x8d, 0xe5, 0x91, 0xbd, 0xe5, 0x90,
+    0x8d, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x6f, 0x70, 0x65, 0x6e, 0x52, 0x65, 0x6e, 0x61, 0x6d,
+    0x65, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x29, 0x2c, 0x69, 0x74, 0x65, 0x6d, 0x42, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x28, 0x22, 0xe7, 0xa7, 0xbb, 0xe5, 0x88, 0xb0, 0xe5, 0x9b, 0x9e, 0xe6, 0x94,
+    0xb6, 0xe7, 0xab, 0x99, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x6f, 0x70, 0x65, 0x6e, 0x54, 0x72,
+    0x61, 0x73, 0x68, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29,
+    0x3b, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x72, 0x6f, 0x77,
+    0x29, 0x7d, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x6f, 0x70, 0x65, 0x6e, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2c,
+    0x74, 0x65, 0x78, 0x74, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x2c,
+    0x6f, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x29, 0x7b, 0x24, 0x28, 0x22, 0x23, 0x6d,
+    0x6f, 0x64, 0x61, 0x6c, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x22, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74,
+    0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3b, 0x24, 0x28,
+    0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x54, 0x65, 0x78, 0x74, 0x22, 0x29, 0x2e, 0x74, 0x65,
+    0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x3b, 0x24,
+    0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x57, 0x72, 0x61,
+    0x70, 0x22, 0x29, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+    0x79, 0x3d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x3d, 0x3d, 0x6e,
+    0x75, 0x6c, 0x6c, 0x3f, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x3a, 0x22, 0x67, 0x72, 0x69, 0x64,
+    0x22, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74,
+    0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x61,
+    0x6c, 0x75, 0x65, 0x7c, 0x7c, 0x22, 0x22, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61,
+    0x6c, 0x42, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x22, 0x29, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x22, 0x6f, 0x70, 0x65, 0x6e, 0x22,
+    0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+    0x72, 0x6d, 0x22, 0x29, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x28, 0x29, 0x3d,
+    0x3e, 0x7b, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x29, 0x3b, 0x6f,
+    0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64,
+    0x61, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29,
+    0x7d, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c,
+    0x6f, 0x73, 0x65, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x29, 0x7b, 0x24, 0x28, 0x22, 0x23, 0x6d,
+    0x6f, 0x64, 0x61, 0x6c, 0x42, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x22, 0x29, 0x2e, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28,
+    0x22, 0x6f, 0x70, 0x65, 0x6e, 0x22, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61,
+    0x6c, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x22, 0x29, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d,
+    0x61, 0x72, 0x6b, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x64, 0x61,
+    0x74, 0x61, 0x2e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x29, 0x7b, 0x24, 0x28, 0x22, 0x23, 0x62, 0x65,
+    0x6e, 0x63, 0x68, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x29, 0x2e, 0x74, 0x65, 0x78,
+    0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0xe5, 0xb0, 0x9a, 0xe6, 0x97, 0xa0,
+    0xe6, 0xb5, 0x8b, 0xe9, 0x80, 0x9f, 0xe7, 0xbb, 0x93, 0xe6, 0x9e, 0x9c, 0x22, 0x3b, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x7d, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x4c,
+    0x61, 0x62, 0x65, 0x6c, 0x3d, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x3e, 0x73, 0x69, 0x7a, 0x65, 0x3e,
+    0x3d, 0x31, 0x30, 0x32, 0x34, 0x3f, 0x73, 0x69, 0x7a, 0x65, 0x2f, 0x31, 0x30, 0x32, 0x34, 0x2b,
+    0x22, 0x4b, 0x22, 0x3a, 0x73, 0x69, 0x7a, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62,
+    0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+    0x73, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3d, 0x3e, 0x73, 0x69, 0x7a,
+    0x65, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e, 0x73, 0x69, 0x7a,
+    0x65, 0x29, 0x2b, 0x22, 0x20, 0xe5, 0x86, 0x99, 0x20, 0x22, 0x2b, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+    0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x4b, 0x42, 0x70, 0x73, 0x2b, 0x22, 0x20, 0x2f, 0x20, 0xe8,
+    0xaf, 0xbb, 0x20, 0x22, 0x2b, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x4b,
+    0x42, 0x70, 0x73, 0x2b, 0x22, 0x20, 0x4b, 0x42, 0x2f, 0x73, 0x22, 0x29, 0x3b, 0x62, 0x6c, 0x6f,
+    0x63, 0x6b, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0xe9, 0x9a, 0x8f, 0xe6, 0x9c, 0xba,
+    0x20, 0x34, 0x4b, 0x20, 0x22, 0x2b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f,
+    0x6d, 0x52, 0x65, 0x61, 0x64, 0x49, 0x6f, 0x70, 0x73, 0x2b, 0x22, 0x20, 0x49, 0x4f, 0x50, 0x53,
+    0x22, 0x2c, 0x22, 0xe7, 0x9b, 0xae, 0xe5, 0xbd, 0x95, 0x20, 0x22, 0x2b, 0x64, 0x61, 0x74, 0x61,
+    0x2e, 0x64, 0x69, 0x72, 0x45, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x50, 0x65, 0x72, 0x53, 0x65,
+    0x63, 0x2b, 0x22, 0x20, 0xe9, 0xa1, 0xb9, 0x2f, 0x73, 0x22, 0x2c, 0x22, 0xe6, 0x8e, 0xa8, 0xe8,
+    0x8d, 0x90, 0x20, 0x22, 0x2b, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x63, 0x6b,
+    0x48, 0x7a, 0x2f, 0x31, 0x65, 0x36, 0x29, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28,
+    0x31, 0x29, 0x2b, 0x22, 0x20, 0x4d, 0x48, 0x7a, 0x20, 0x2f, 0x20, 0x22, 0x2b, 0x73, 0x69, 0x7a,
+    0x65, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x2b, 0x22, 0x42, 0xef, 0xbc, 0x88, 0xe5, 0xb7, 0xb2,
+    0xe7, 0x94, 0x9f, 0xe6, 0x95, 0x88, 0xef, 0xbc, 0x89, 0x22, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23,
+    0x62, 0x65, 0x6e, 0x63, 0x68, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x29, 0x2e, 0x74,
+    0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+    0x73, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x20, 0xc2, 0xb7, 0x20, 0x22, 0x29, 0x7d, 0x0a,
+    0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x28, 0x29,
+    0x7b, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b,
+    0x28, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22,
+    0x2f, 0x61, 0x70, 0x69, 0x2f, 0x73, 0x64, 0x2f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72,
+    0x6b, 0x22, 0x29, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x6f, 0x70, 0x65, 0x6e, 0x52, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x70, 0x61, 0x74, 0x68,
+    0x29, 0x7b, 0x6f, 0x70, 0x65, 0x6e, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x22, 0xe9, 0x87, 0x8d,
+    0xe5, 0x91, 0xbd, 0xe5, 0x90, 0x8d, 0x22, 0x2c, 0x66, 0x69, 0x6c, 0x65, 0x4e, 0x61, 0x6d, 0x65,
+    0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x2c, 0x66, 0x69, 0x6c, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x28,
+    0x70, 0x61, 0x74, 0x68, 0x29, 0x2c, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28,
+    0x21, 0x6e, 0x61, 0x6d, 0x65, 0x7c, 0x7c, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x69, 0x6e, 0x63, 0x6c,
+    0x75, 0x64, 0x65, 0x73, 0x28, 0x22, 0x2f, 0x22, 0x29, 0x7c, 0x7c, 0x6e, 0x61, 0x6d, 0x65, 0x2e,
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x22, 0x5c, 0x5c, 0x22, 0x29, 0x29, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6f, 0x61, 0x73, 0x74, 0x28, 0x22, 0xe5, 0x90, 0x8d,
+    0xe7, 0xa7, 0xb0, 0xe6, 0x97, 0xa0, 0xe6, 0x95, 0x88, 0x22, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x3d, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x73, 0x6c, 0x69, 0x63,
+    0x65, 0x28, 0x30, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d,
+    0x66, 0x69, 0x6c, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x2e, 0x6c,
+    0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b, 0x72, 0x75, 0x6e, 0x28, 0x61, 0x73, 0x79, 0x6e, 0x63,
+    0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65,
+    0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x72,
+    0x65, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2c, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x28, 0x7b, 0x66, 0x72, 0x6f, 0x6d, 0x3a, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x74, 0x6f,
+    0x3a, 0x62, 0x61, 0x73, 0x65, 0x2b, 0x6e, 0x61, 0x6d, 0x65, 0x7d, 0x29, 0x29, 0x3b, 0x61, 0x77,
+    0x61, 0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x28, 0x29, 0x7d,
+    0x2c, 0x22, 0xe5, 0xb7, 0xb2, 0xe9, 0x87, 0x8d, 0xe5, 0x91, 0xbd, 0xe5, 0x90, 0x8d, 0x22, 0x29,
+    0x7d, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+    0x70, 0x65, 0x6e, 0x54, 0x72, 0x61, 0x73, 0x68, 0x28, 0x70, 0x61, 0x74, 0x68, 0x29, 0x7b, 0x6f,
+    0x70, 0x65, 0x6e, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x22, 0xe7, 0xa7, 0xbb, 0xe5, 0x88, 0xb0,
+    0xe5, 0x9b, 0x9e, 0xe6, 0x94, 0xb6, 0xe7, 0xab, 0x99, 0x22, 0x2c, 0x22, 0xe6, 0x96, 0x87, 0xe4,
+    0xbb, 0xb6, 0xe5, 0xb0, 0x86, 0xe7, 0xa7, 0xbb, 0xe5, 0x8a, 0xa8, 0xe5, 0x88, 0xb0, 0x20, 0x2e,
+    0x74, 0x72, 0x61, 0x73, 0x68, 0xef, 0xbc, 0x8c, 0xe4, 0xb8, 0x8d, 0xe4, 0xbc, 0x9a, 0xe7, 0xab,
+    0x8b, 0xe5, 0x8d, 0xb3, 0xe6, 0x93, 0xa6, 0xe9, 0x99, 0xa4, 0xe3, 0x80, 0x82, 0x22, 0x2c, 0x6e,
+    0x75, 0x6c, 0x6c, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x75, 0x6e, 0x28, 0x61, 0x73, 0x79, 0x6e,
+    0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75,
+    0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2f,
+    0x74, 0x72, 0x61, 0x73, 0x68, 0x22, 0x2c, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x28, 0x7b, 0x70, 0x61, 0x74, 0x68, 0x7d, 0x29, 0x29, 0x3b, 0x61, 0x77, 0x61, 0x69,
+    0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x28, 0x29, 0x7d, 0x2c, 0x22,
+    0xe5, 0xb7, 0xb2, 0xe7, 0xa7, 0xbb, 0xe5, 0x88, 0xb0, 0xe5, 0x9b, 0x9e, 0xe6, 0x94, 0xb6, 0xe7,
+    0xab, 0x99, 0x22, 0x29, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64,
+    0x61, 0x6c, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x22, 0x2c, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x29, 0x3b,
+    0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x42, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f,
+    0x70, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x61,
+    0x72, 0x67, 0x65, 0x74, 0x3d, 0x3d, 0x3d, 0x24, 0x28, 0x22, 0x23, 0x6d, 0x6f, 0x64, 0x61, 0x6c,
+    0x42, 0x61, 0x63, 0x6b, 0x64, 0x72, 0x6f, 0x70, 0x22, 0x29, 0x29, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+    0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x29, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22,
+    0x23, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x64, 0x6f, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x22, 0x2c, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x64, 0x6f, 0x29, 0x3b, 0x24, 0x28, 0x22,
+    0x23, 0x73, 0x61, 0x76, 0x65, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64,
+    0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63,
+    0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x75, 0x6e, 0x28, 0x28, 0x29,
+    0x3d, 0x3e, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f,
+    0x74, 0x6f, 0x64, 0x6f, 0x73, 0x22, 0x2c, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x74, 0x6f, 0x64, 0x6f, 0x73, 0x29, 0x29,
+    0x2c, 0x22, 0x54, 0x6f, 0x64, 0x6f, 0x20, 0xe5, 0xb7, 0xb2, 0xe4, 0xbf, 0x9d, 0xe5, 0xad, 0x98,
+    0x22, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22, 0x23, 0x61, 0x64, 0x64, 0x41, 0x6c,
+    0x61, 0x72, 0x6d, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x61,
+    0x64, 0x64, 0x41, 0x6c, 0x61, 0x72, 0x6d, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x72, 0x69, 0x6e,
+    0x67, 0x74, 0x6f, 0x6e, 0x65, 0x46, 0x6f, 0x72, 0x6d, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x73, 0x75,
+    0x62, 0x6d, 0x69, 0x74, 0x22, 0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75,
+    0x6c, 0x74, 0x28, 0x29, 0x3b, 0x72, 0x75, 0x6e, 0x28, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29,
+    0x3d, 0x3e, 0x7b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x52, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x65, 0x28, 0x24, 0x28, 0x22, 0x23, 0x72, 0x69, 0x6e,
+    0x67, 0x74, 0x6f, 0x6e, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x22, 0x29, 0x2e, 0x66, 0x69, 0x6c, 0x65,
+    0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f,
+    0x6e, 0x65, 0x46, 0x6f, 0x72, 0x6d, 0x22, 0x29, 0x2e, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29,
+    0x7d, 0x2c, 0x22, 0xe9, 0x93, 0x83, 0xe5, 0xa3, 0xb0, 0xe5, 0xb7, 0xb2, 0xe8, 0xbd, 0xac, 0xe6,
+    0x8d, 0xa2, 0x22, 0x29, 0x7d, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x73, 0x61, 0x76, 0x65, 0x41,
+    0x6c, 0x61, 0x72, 0x6d, 0x73, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x75, 0x6e, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x65, 0x71,
+    0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x61, 0x6c, 0x61, 0x72, 0x6d,
+    0x73, 0x22, 0x2c, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x73, 0x29, 0x29, 0x2c, 0x22, 0xe9,
+    0x97, 0xb9, 0xe9, 0x92, 0x9f, 0xe5, 0xb7, 0xb2, 0xe4, 0xbf, 0x9d, 0xe5, 0xad, 0x98, 0x22, 0x29,
+    0x29, 0x3b, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22, 0x23, 0x73, 0x61, 0x76, 0x65, 0x52, 0x61, 0x64,
+    0x69, 0x6f, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
+    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29,
+    0x3d, 0x3e, 0x72, 0x75, 0x6e, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
+    0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x22, 0x2c, 0x6a,
+    0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x7b, 0x73, 0x74, 0x65, 0x70,
+    0x3a, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69,
+    0x6f, 0x53, 0x74, 0x65, 0x70, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x2c, 0x74,
+    0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x3a, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28,
+    0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x54, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f,
+    0x6c, 0x64, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x2c, 0x62, 0x61, 0x73, 0x73,
+    0x3a, 0x24, 0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x42, 0x61, 0x73, 0x73, 0x22, 0x29,
+    0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x6d, 0x6f, 0x6e, 0x6f, 0x3a, 0x24, 0x28,
+    0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x4d, 0x6f, 0x6e, 0x6f, 0x22, 0x29, 0x2e, 0x63, 0x68,
+    0x65, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x73, 0x6f, 0x66, 0x74, 0x4d, 0x75, 0x74, 0x65, 0x3a, 0x24,
+    0x28, 0x22, 0x23, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x53, 0x6f, 0x66, 0x74, 0x4d, 0x75, 0x74, 0x65,
+    0x22, 0x29, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x73, 0x74, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x3a, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x72, 0x61, 0x64, 0x69, 0x6f, 0x2e,
+    0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x7d, 0x29, 0x29, 0x2c, 0x22, 0xe6, 0x94, 0xb6,
+    0xe9, 0x9f, 0xb3, 0xe6, 0x9c, 0xba, 0xe8, 0xae, 0xbe, 0xe7, 0xbd, 0xae, 0xe5, 0xb7, 0xb2, 0xe4,
+    0xbf, 0x9d, 0xe5, 0xad, 0x98, 0x22, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x41, 0x70, 0x69, 0x73,
+    0x28, 0x29, 0x7b, 0x72, 0x75, 0x6e, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x65, 0x71, 0x75, 0x65,
+    0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x61, 0x70, 0x69, 0x2d, 0x73, 0x65, 0x74,
+    0x74, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x2c, 0x6a, 0x73, 0x6f, 0x6e, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x28, 0x7b, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x54, 0x6f, 0x6b, 0x65, 0x6e,
+    0x3a, 0x24, 0x28, 0x22, 0x23, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x54, 0x6f, 0x6b, 0x65,
+    0x6e, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x68, 0x6f, 0x6c, 0x69, 0x64, 0x61,
+    0x79, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x3a, 0x24, 0x28, 0x22, 0x23, 0x68, 0x6f, 0x6c, 0x69, 0x64,
+    0x61, 0x79, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x29, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c,
+    0x63, 0x6c, 0x65, 0x61, 0x72, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x3a, 0x24, 0x28, 0x22,
+    0x23, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x29, 0x2e,
+    0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x48, 0x6f, 0x6c,
+    0x69, 0x64, 0x61, 0x79, 0x3a, 0x24, 0x28, 0x22, 0x23, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x48, 0x6f,
+    0x6c, 0x69, 0x64, 0x61, 0x79, 0x22, 0x29, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x7d,
+    0x29, 0x29, 0x2c, 0x22, 0x41, 0x50, 0x49, 0x20, 0xe8, 0xae, 0xbe, 0xe7, 0xbd, 0xae, 0xe5, 0xb7,
+    0xb2, 0xe4, 0xbf, 0x9d, 0xe5, 0xad, 0x98, 0x22, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22,
+    0x23, 0x73, 0x61, 0x76, 0x65, 0x41, 0x70, 0x69, 0x73, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c,
+    0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x24, 0x28, 0x22,
+    0x23, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x29, 0x2e,
+    0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x7c, 0x7c, 0x24, 0x28, 0x22, 0x23, 0x63, 0x6c, 0x65,
+    0x61, 0x72, 0x48, 0x6f, 0x6c, 0x69, 0x64, 0x61, 0x79, 0x22, 0x29, 0x2e, 0x63, 0x68, 0x65, 0x63,
+    0x6b, 0x65, 0x64, 0x29, 0x6f, 0x70, 0x65, 0x6e, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x28, 0x22, 0xe7,
+    0xa1, 0xae, 0xe8, 0xae, 0xa4, 0xe6, 0xb8, 0x85, 0xe9, 0x99, 0xa4, 0x20, 0x54, 0x6f, 0x6b, 0x65,
+    0x6e, 0x22, 0x2c, 0x22, 0xe6, 0xb8, 0x85, 0xe9, 0x99, 0xa4, 0xe5, 0x90, 0x8e, 0xe7, 0x9b, 0xb8,
+    0xe5, 0x85, 0xb3, 0xe5, 0x9c, 0xa8, 0xe7, 0xba, 0xbf, 0xe6, 0x95, 0xb0, 0xe6, 0x8d, 0xae, 0xe5,
+    0xb0, 0x86, 0xe5, 0x81, 0x9c, 0xe6, 0xad, 0xa2, 0xe6, 0x9b, 0xb4, 0xe6, 0x96, 0xb0, 0xe3, 0x80,
+    0x82, 0x22, 0x2c, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x41,
+    0x70, 0x69, 0x73, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73,
+    0x74, 0x41, 0x70, 0x69, 0x73, 0x28, 0x29, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x24, 0x28, 0x22,
+    0x23, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x22, 0x29, 0x2e,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+    0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x75, 0x6e,
+    0x28, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x29, 0x29, 0x3b, 0x24, 0x28, 0x22,
+    0x23, 0x72, 0x75, 0x6e, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x22, 0x29, 0x2e,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+    0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x72, 0x75, 0x6e,
+    0x28, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x24, 0x28, 0x22, 0x23, 0x62,
+    0x65, 0x6e, 0x63, 0x68, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x22, 0x29, 0x2e, 0x74, 0x65,
+    0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0xe6, 0xb5, 0x8b, 0xe9, 0x80,
+    0x9f, 0xe4, 0xb8, 0xad, 0xef, 0xbc, 0x8c, 0xe7, 0xba, 0xa6, 0xe9, 0x9c, 0x80, 0xe5, 0x8d, 0x81,
+    0xe7, 0xa7, 0x92, 0xe2, 0x80, 0xa6, 0x22, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x72, 0x65, 0x6e, 0x64,
+    0x65, 0x72, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x28, 0x61, 0x77, 0x61, 0x69,
+    0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f,
+    0x73, 0x64, 0x2f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x22, 0x2c, 0x7b, 0x6d,
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x7d, 0x29, 0x29, 0x7d,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x7b, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b,
+    0x28, 0x29, 0x3b, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x7d, 0x7d,
+    0x2c, 0x22, 0xe6, 0xb5, 0x8b, 0xe9, 0x80, 0x9f, 0xe5, 0xae, 0x8c, 0xe6, 0x88, 0x90, 0x22, 0x29,
+    0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x6f, 0x72, 0x6d,
+    0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x2c, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x72, 0x75, 0x6e, 0x28,
+    0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
+    0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x49, 0x6e, 0x43, 0x68, 0x75, 0x6e, 0x6b, 0x73, 0x28, 0x24,
+    0x28, 0x22, 0x23, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x22, 0x29, 0x2e,
+    0x66, 0x69, 0x6c, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x75, 0x70,
+    0x6c, 0x6f, 0x61, 0x64, 0x46, 0x6f, 0x72, 0x6d, 0x22, 0x29, 0x2e, 0x72, 0x65, 0x73, 0x65, 0x74,
+    0x28, 0x29, 0x3b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c,
+    0x65, 0x73, 0x28, 0x29, 0x7d, 0x2c, 0x22, 0xe6, 0x96, 0x87, 0xe4, 0xbb, 0xb6, 0xe5, 0xb7, 0xb2,
+    0xe4, 0xb8, 0x8a, 0xe4, 0xbc, 0xa0, 0x22, 0x29, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x28, 0x29, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63,
+    0x65, 0x3d, 0x7b, 0x7d, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3f, 0x69,
+    0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x31, 0x30, 0x30, 0x30, 0x22, 0x29, 0x3b, 0x63,
+    0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3d, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x3d, 0x3e, 0x7b, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x61, 0x73, 0x73, 0x69, 0x67,
+    0x6e, 0x28, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2c, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x29,
+    0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x3d, 0x5b, 0x64, 0x65,
+    0x76, 0x69, 0x63, 0x65, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x7c, 0x7c, 0x22, 0x2d, 0x22,
+    0x2c, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x3f,
+    0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2e, 0x70,
+    0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x2b, 0x22, 0x25, 0x22, 0x3a, 0x22, 0x2d, 0x22, 0x2c, 0x64,
+    0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x77, 0x69, 0x66, 0x69, 0x3f, 0x22, 0x57, 0x69, 0x46, 0x69,
+    0x20, 0xe5, 0xb7, 0xb2, 0xe8, 0xbf, 0x9e, 0xe6, 0x8e, 0xa5, 0x22, 0x3a, 0x22, 0x57, 0x69, 0x46,
+    0x69, 0x20, 0xe6, 0x9c, 0xaa, 0xe8, 0xbf, 0x9e, 0xe6, 0x8e, 0xa5, 0x22, 0x5d, 0x3b, 0x69, 0x66,
+    0x28, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x29, 0x70, 0x61,
+    0x72, 0x74, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0xe9, 0x97, 0xb9, 0xe9, 0x92, 0x9f,
+    0xe5, 0x93, 0x8d, 0xe9, 0x93, 0x83, 0xe4, 0xb8, 0xad, 0x22, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x64,
+    0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x26, 0x26, 0x64, 0x65,
+    0x76, 0x69, 0x63, 0x65, 0x2e, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x61, 0x63, 0x74, 0x69,
+    0x76, 0x65, 0x29, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0xe4,
+    0xb8, 0x8a, 0xe4, 0xbc, 0xa0, 0x20, 0x22, 0x2b, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x28, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64,
+    0x2e, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2f, 0x31, 0x30, 0x32, 0x34, 0x29, 0x2b, 0x22, 0x20, 0x4b,
+    0x42, 0x22, 0x29, 0x3b, 0x24, 0x28, 0x22, 0x23, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x53, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x22, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x3d, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x20,
+    0xc2, 0xb7, 0x20, 0x22, 0x29, 0x7d, 0x3b, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
+    0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x22, 0x2c, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72,
+    0x29, 0x3b, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x64, 0x65, 0x6c, 0x74, 0x61,
+    0x22, 0x2c, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x29, 0x7d, 0x0a, 0x20, 0x20, 0x77, 0x61, 0x74,
+    0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x72, 0x75,
+    0x6e, 0x28, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x61, 0x77, 0x61, 0x69,
+    0x74, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x2e, 0x61, 0x6c, 0x6c, 0x28, 0x5b, 0x6c,
+    0x6f, 0x61, 0x64, 0x54, 0x6f, 0x64, 0x6f, 0x73, 0x28, 0x29, 0x2c, 0x6c, 0x6f, 0x61, 0x64, 0x41,
+    0x6c, 0x61, 0x72, 0x6d, 0x73, 0x28, 0x29, 0x2c, 0x6c, 0x6f, 0x61, 0x64, 0x52, 0x61, 0x64, 0x69,
+    0x6f, 0x28, 0x29, 0x2c, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x70, 0x69, 0x73, 0x28, 0x29, 0x5d, 0x29,
+    0x3b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x73,
+    0x28, 0x29, 0x3b, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x42, 0x65, 0x6e,
+    0x63, 0x68, 0x6d, 0x61, 0x72, 0x6b, 0x28, 0x29, 0x7d, 0x29, 0x3b, 0x0a, 0x3c, 0x2f, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f,
+    0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+};
+
+const SystemWebAsset SYSTEM_WEB_ASSETS[] = {
+    {"/", "text/html; charset=utf-8", WEB_ASSET_INDEX_HTML, sizeof(WEB_ASSET_INDEX_HTML), "\"6d44b20740c16c53\"", WEB_ASSET_INDEX_HTML_PLAIN, sizeof(WEB_ASSET_INDEX_HTML_PLAIN), "\"6d44b20740c16c53-identity\""},
+};
+
+constexpr size_t SYSTEM_WEB_ASSET_COUNT =
+    sizeof(SYSTEM_WEB_ASSETS) / sizeof(SYSTEM_WEB_ASSETS[0]);
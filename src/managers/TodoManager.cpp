@@ -77,13 +77,20 @@ bool TodoManager::saveTodosFromJSON(const String& json) {
     JsonDocument doc;
     DeserializationError error = deserializeJson(doc, json);
     
-    if (error || !doc.is<JsonArray>() || doc.size() > 20) {
+    if (error || !doc.is<JsonArray>()) {
         Serial.printf("Todo config parse failed: %s\n", error.c_str());
         return false;
     }
 
     std::vector<TodoConfig> updated;
-    JsonArray array = doc.as<JsonArray>();
+    return parseTodosJSON(doc.as<JsonArray>(), updated) && applyTodos(updated);
+}
+
+bool TodoManager::parseTodosJSON(JsonArray array, std::vector<TodoConfig>& updated) {
+    updated.clear();
+    if (array.size() > 20) {
+        return false;
+    }
     int fallbackId = millis();
     for (JsonObject obj : array) {
         TodoConfig item;
@@ -97,7 +104,10 @@ bool TodoManager::saveTodosFromJSON(const String& json) {
         if (a.hour != b.hour) return a.hour < b.hour;
         return a.minute < b.minute;
     });
+    return true;
+}
 
+bool TodoManager::applyTodos(const std::vector<TodoConfig>& updated) {
     std::vector<TodoConfig> previous = todos;
     todos = updated;
     if (save()) {
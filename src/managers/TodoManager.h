@@ -36,6 +36,10 @@ public:
     // For Web/Config
     String getTodosJSON();
     bool saveTodosFromJSON(const String& json);
+    // 批量配置：先校验整份数据，全部通过后再落盘
+    bool parseTodosJSON(JsonArray array, std::vector<TodoConfig>& updated);
+    bool applyTodos(const std::vector<TodoConfig>& updated);
+    const std::vector<TodoConfig>& getTodoConfigs() const { return todos; }
 
 private:
     Preferences prefs;
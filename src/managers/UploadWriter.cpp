@@ -0,0 +1,170 @@
+#include "UploadWriter.h"
+#include "../drivers/SharedSPIBus.h"
+#include "../utils/Crc32.h"
+
+namespace {
+constexpr uint32_t UPLOAD_WRITER_STACK = 4096;
+constexpr UBaseType_t UPLOAD_WRITER_PRIORITY = 2;
+constexpr BaseType_t UPLOAD_WRITER_CORE = 0;
+constexpr uint32_t UPLOAD_BLOCK_WAIT_MS = 5000;
+constexpr uint16_t DRAIN_MARKER_LENGTH = 0;
+constexpr size_t UPLOAD_SECTOR_SIZE = 512;
+} // namespace
+
+bool UploadWriter::begin() {
+  if (writerTask != nullptr) {
+    return true;
+  }
+  fullBlocks = xQueueCreate(2, sizeof(Block));
+  freeBlocks = xQueueCreate(2, sizeof(uint8_t));
+  drained = xSemaphoreCreateBinary();
+  if (fullBlocks == nullptr || freeBlocks == nullptr || drained == nullptr) {
+    return false;
+  }
+  return xTaskCreatePinnedToCore(writerTaskEntry, "UploadWriter",
+                                 UPLOAD_WRITER_STACK, this,
+                                 UPLOAD_WRITER_PRIORITY, &writerTask,
+                                 UPLOAD_WRITER_CORE) == pdPASS;
+}
+
+bool UploadWriter::start(File &target, size_t offset, uint32_t crcSeed) {
+  if (writerTask == nullptr || active) {
+    return false;
+  }
+  file = target;
+  active = true;
+  failed = false;
+  committedBytes = 0;
+  crc32 = crcSeed;
+  startOffset = offset;
+  startMs = millis();
+  lastRateKBps = 0;
+  // finish() 返回前写入任务一定已排空并停在队列上等待，这里重置队列安全。
+  xQueueReset(freeBlocks);
+  xQueueReset(fullBlocks);
+  uint8_t second = 1;
+  xQueueSend(freeBlocks, &second, 0);
+  fillIndex = 0;
+  fillLength = 0;
+  blockSize = SharedSPIBus::transferSizeFor(SharedSPIBus::DEVICE_SD);
+  if (blockSize > BLOCK_SIZE) {
+    blockSize = BLOCK_SIZE;
+  }
+  blockSize -= blockSize % UPLOAD_SECTOR_SIZE;
+  if (blockSize == 0) {
+    blockSize = UPLOAD_SECTOR_SIZE;
+  }
+  // 关键逻辑：续传偏移不一定落在块边界，首块只填到下一个块边界，
+  // 之后每次落盘都是整块对齐写入，避免 FAT 读改写首尾扇区。
+  fillLimit = blockSize - offset % blockSize;
+  return true;
+}
+
+bool UploadWriter::write(const uint8_t *data, size_t length) {
+  if (!active) {
+    return false;
+  }
+  while (length > 0 && !failed) {
+    size_t space = fillLimit - fillLength;
+    size_t copy = length < space ? length : space;
+    memcpy(buffers[fillIndex] + fillLength, data, copy);
+    fillLength += copy;
+    data += copy;
+    length -= copy;
+    if (fillLength == fillLimit &&
+        (!submitFillBlock() || !acquireFillBlock())) {
+      failed = true;
+    }
+  }
+  return !failed;
+}
+
+bool UploadWriter::finish() {
+  if (!active) {
+    return false;
+  }
+  if (fillLength > 0 && !failed && !submitFillBlock()) {
+    failed = true;
+  }
+  Block marker = {0, DRAIN_MARKER_LENGTH};
+  bool markerQueued =
+      xQueueSend(fullBlocks, &marker, pdMS_TO_TICKS(UPLOAD_BLOCK_WAIT_MS)) ==
+      pdTRUE;
+  bool drainedOk =
+      markerQueued &&
+      xSemaphoreTake(drained, pdMS_TO_TICKS(UPLOAD_BLOCK_WAIT_MS)) == pdTRUE;
+  if (!drainedOk) {
+    // 关键逻辑：超时说明写入任务还卡在某一块上（通常在等共享总线）。此时
+    // 不能放手：调用方随后会关闭文件、卸载卡，下一次 start 还会重置仍在
+    // 使用的队列。先标记失败让写入任务跳过剩余块，再等它写完手上这一块
+    // 并确认排空，之后文件引用和队列才真正空闲。
+    failed = true;
+    Serial.println("[Web][upload] writer drain timed out, aborting");
+    if (!markerQueued) {
+      xQueueSend(fullBlocks, &marker, portMAX_DELAY);
+    }
+    xSemaphoreTake(drained, portMAX_DELAY);
+  }
+  active = false;
+  // 句柄由调用方关闭，这里只释放写入任务持有的引用。
+  file = File();
+
+  uint32_t elapsedMs = millis() - startMs;
+  lastRateKBps = elapsedMs == 0
+                     ? 0
+                     : static_cast<uint32_t>(
+                           static_cast<uint64_t>(committedBytes) * 1000ULL /
+                           1024ULL / elapsedMs);
+  Serial.printf("[Web][upload] offset=%u committed=%u ms=%lu rate=%luKB/s "
+                "crc=%08lx %s\n",
+                static_cast<unsigned>(startOffset),
+                static_cast<unsigned>(committedBytes),
+                static_cast<unsigned long>(elapsedMs),
+                static_cast<unsigned long>(lastRateKBps),
+                static_cast<unsigned long>(crc32),
+                failed ? "failed" : "ok");
+  return !failed;
+}
+
+void UploadWriter::writerTaskEntry(void *param) {
+  static_cast<UploadWriter *>(param)->runWriter();
+}
+
+void UploadWriter::runWriter() {
+  Block block;
+  while (true) {
+    if (xQueueReceive(fullBlocks, &block, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    if (block.length == DRAIN_MARKER_LENGTH) {
+      xSemaphoreGive(drained);
+      continue;
+    }
+    if (!failed) {
+      const uint8_t *data = buffers[block.index];
+      size_t written = 0;
+      {
+        SharedSPIBus::Guard spiGuard;
+        written = file.write(data, block.length);
+      }
+      // CRC 只覆盖真正落盘的字节，续传元数据记录的偏移和校验值始终一致。
+      crc32 = Crc32::update(crc32, data, written);
+      committedBytes = committedBytes + written;
+      failed = written != block.length;
+    }
+    xQueueSend(freeBlocks, &block.index, portMAX_DELAY);
+  }
+}
+
+bool UploadWriter::submitFillBlock() {
+  Block block = {fillIndex, static_cast<uint16_t>(fillLength)};
+  fillLength = 0;
+  fillLimit = blockSize;
+  return xQueueSend(fullBlocks, &block,
+                    pdMS_TO_TICKS(UPLOAD_BLOCK_WAIT_MS)) == pdTRUE;
+}
+
+bool UploadWriter::acquireFillBlock() {
+  return xQueueReceive(freeBlocks, &fillIndex,
+                       pdMS_TO_TICKS(UPLOAD_BLOCK_WAIT_MS)) == pdTRUE;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// 上传写入流水线：Web 任务把任意大小的 HTTP 分块拷入双缓冲，
+// 缓冲写满一整块后交给写入任务落盘，网络接收与 SD 写入互相重叠。
+class UploadWriter {
+public:
+  // 缓冲容量；实际落盘块取 SD 测速推荐的传输大小，不超过该容量。
+  static constexpr size_t BLOCK_SIZE = 8192;
+
+  bool begin();
+  bool start(File &target, size_t offset, uint32_t crcSeed);
+  bool write(const uint8_t *data, size_t length);
+  // 返回前写入任务一定已排空；排空超时则放弃剩余块，但仍等手上的块写完。
+  bool finish();
+  bool isActive() const { return active; }
+  size_t getCommittedBytes() const { return committedBytes; }
+  uint32_t getCrc32() const { return crc32; }
+  uint32_t getLastRateKBps() const { return lastRateKBps; }
+
+private:
+  struct Block {
+    uint8_t index;
+    uint16_t length;
+  };
+
+  uint8_t buffers[2][BLOCK_SIZE];
+  QueueHandle_t fullBlocks = nullptr;
+  QueueHandle_t freeBlocks = nullptr;
+  SemaphoreHandle_t drained = nullptr;
+  TaskHandle_t writerTask = nullptr;
+  File file;
+  bool active = false;
+  volatile bool failed = false;
+  uint8_t fillIndex = 0;
+  size_t fillLength = 0;
+  size_t blockSize = BLOCK_SIZE;
+  size_t fillLimit = BLOCK_SIZE;
+  volatile size_t committedBytes = 0;
+  volatile uint32_t crc32 = 0;
+  size_t startOffset = 0;
+  uint32_t startMs = 0;
+  uint32_t lastRateKBps = 0;
+
+  static void writerTaskEntry(void *param);
+  void runWriter();
+  bool submitFillBlock();
+  bool acquireFillBlock();
+};
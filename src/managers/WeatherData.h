@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint8_t WEATHER_HOURLY_CAPACITY = 12;
+static const uint8_t WEATHER_DAILY_CAPACITY = 7;
+
+// 关键逻辑：天气数据全部使用定长缓冲区和只读常量指针，
+// 刷新时只覆盖内容不触发堆分配，避免 Core 0 更新时在堆上反复申请/释放，
+// 同时让 Core 1 读取的内存地址在整个生命周期内保持稳定。
+struct HourlyData {
+  char time[6]; // HH:MM
+  int temp;
+  int icon_code;
+  const char *icon_str;
+};
+
+struct DailyData {
+  char date[11]; // YYYY-MM-DD
+  char day[6];   // MM-DD
+  int temp_max;
+  int temp_min;
+  int icon_code;
+  const char *icon_str;
+};
+
+struct WeatherData {
+  char city[32];
+  char weather[32]; // 由 icon_code 查表得到的天气描述，未知代码用接口原文
+  char obs_time[24];
+  int temp;
+  int humidity;
+  const char *icon_str; // u8g2 icon character
+  int icon_code;
+
+  char warning_title[96];
+  char warning_text[256];
+
+  HourlyData hourly[WEATHER_HOURLY_CAPACITY];
+  uint8_t hourly_count;
+  DailyData daily[WEATHER_DAILY_CAPACITY];
+  uint8_t daily_count;
+
+  // Forecast (Tomorrow) - Keep for compatibility if needed, but we'll use
+  // daily[1]
+  char forecast_weather[32];
+  int forecast_temp_high;
+  int forecast_temp_low;
+  int forecast_code;
+  const char *forecast_icon_str;
+};
@@ -1,147 +1,115 @@
 #include "WeatherIcons.h"
+#include <stdint.h>
 
-const char *resolveWeatherIcon(int code) {
-  switch (code) {
-  case 100:
-    return "\uf101";
-  case 101:
-    return "\uf102";
-  case 102:
-    return "\uf103";
-  case 103:
-    return "\uf104";
-  case 104:
-    return "\uf105";
-  case 150:
-    return "\uf106";
-  case 151:
-    return "\uf107";
-  case 152:
-    return "\uf108";
-  case 153:
-    return "\uf109";
-  case 300:
-    return "\uf10a";
-  case 301:
-    return "\uf10b";
-  case 302:
-    return "\uf10c";
-  case 303:
-    return "\uf10d";
-  case 304:
-    return "\uf10e";
-  case 305:
-    return "\uf10f";
-  case 306:
-    return "\uf110";
-  case 307:
-    return "\uf111";
-  case 308:
-    return "\uf112";
-  case 309:
-    return "\uf113";
-  case 310:
-    return "\uf114";
-  case 311:
-    return "\uf115";
-  case 312:
-    return "\uf116";
-  case 313:
-    return "\uf117";
-  case 314:
-    return "\uf118";
-  case 315:
-    return "\uf119";
-  case 316:
-    return "\uf11a";
-  case 317:
-    return "\uf11b";
-  case 318:
-    return "\uf11c";
-  case 350:
-    return "\uf11d";
-  case 351:
-    return "\uf11e";
-  case 399:
-    return "\uf11f";
-  case 400:
-    return "\uf120";
-  case 401:
-    return "\uf121";
-  case 402:
-    return "\uf122";
-  case 403:
-    return "\uf123";
-  case 404:
-    return "\uf124";
-  case 405:
-    return "\uf125";
-  case 406:
-    return "\uf126";
-  case 407:
-    return "\uf127";
-  case 408:
-    return "\uf128";
-  case 409:
-    return "\uf129";
-  case 410:
-    return "\uf12a";
-  case 456:
-    return "\uf12b";
-  case 457:
-    return "\uf12c";
-  case 499:
-    return "\uf12d";
-  case 500:
-    return "\uf12e";
-  case 501:
-    return "\uf12f";
-  case 502:
-    return "\uf130";
-  case 503:
-    return "\uf131";
-  case 504:
-    return "\uf132";
-  case 507:
-    return "\uf133";
-  case 508:
-    return "\uf134";
-  case 509:
-    return "\uf135";
-  case 510:
-    return "\uf136";
-  case 511:
-    return "\uf137";
-  case 512:
-    return "\uf138";
-  case 513:
-    return "\uf139";
-  case 514:
-    return "\uf13a";
-  case 515:
-    return "\uf13b";
-  case 800:
-    return "\uf13c";
-  case 801:
-    return "\uf13d";
-  case 802:
-    return "\uf13e";
-  case 803:
-    return "\uf13f";
-  case 804:
-    return "\uf140";
-  case 805:
-    return "\uf141";
-  case 806:
-    return "\uf142";
-  case 807:
-    return "\uf143";
-  case 900:
-    return "\uf144";
-  case 901:
-    return "\uf145";
-  case 999:
-  default:
-    return "\uf146";
+namespace {
+struct WeatherCondition {
+  int16_t code;
+  const char *icon;
+  const char *text;
+};
+
+// 关键逻辑：按图标代码升序排列，查表用二分查找；图标和描述都指向只读常量，
+// 天气刷新时直接保存指针，不再为每条天气描述分配堆内存。
+const WeatherCondition WEATHER_CONDITIONS[] = {
+    {100, "\uf101", "晴"},
+    {101, "\uf102", "多云"},
+    {102, "\uf103", "少云"},
+    {103, "\uf104", "晴间多云"},
+    {104, "\uf105", "阴"},
+    {150, "\uf106", "晴"},
+    {151, "\uf107", "多云"},
+    {152, "\uf108", "少云"},
+    {153, "\uf109", "晴间多云"},
+    {300, "\uf10a", "阵雨"},
+    {301, "\uf10b", "强阵雨"},
+    {302, "\uf10c", "雷阵雨"},
+    {303, "\uf10d", "强雷阵雨"},
+    {304, "\uf10e", "雷阵雨伴有冰雹"},
+    {305, "\uf10f", "小雨"},
+    {306, "\uf110", "中雨"},
+    {307, "\uf111", "大雨"},
+    {308, "\uf112", "极端降雨"},
+    {309, "\uf113", "毛毛雨"},
+    {310, "\uf114", "暴雨"},
+    {311, "\uf115", "大暴雨"},
+    {312, "\uf116", "特大暴雨"},
+    {313, "\uf117", "冻雨"},
+    {314, "\uf118", "小到中雨"},
+    {315, "\uf119", "中到大雨"},
+    {316, "\uf11a", "大到暴雨"},
+    {317, "\uf11b", "暴雨到大暴雨"},
+    {318, "\uf11c", "大暴雨到特大暴雨"},
+    {350, "\uf11d", "阵雨"},
+    {351, "\uf11e", "强阵雨"},
+    {399, "\uf11f", "雨"},
+    {400, "\uf120", "小雪"},
+    {401, "\uf121", "中雪"},
+    {402, "\uf122", "大雪"},
+    {403, "\uf123", "暴雪"},
+    {404, "\uf124", "雨夹雪"},
+    {405, "\uf125", "雨雪天气"},
+    {406, "\uf126", "阵雨夹雪"},
+    {407, "\uf127", "阵雪"},
+    {408, "\uf128", "小到中雪"},
+    {409, "\uf129", "中到大雪"},
+    {410, "\uf12a", "大到暴雪"},
+    {456, "\uf12b", "阵雨夹雪"},
+    {457, "\uf12c", "阵雪"},
+    {499, "\uf12d", "雪"},
+    {500, "\uf12e", "薄雾"},
+    {501, "\uf12f", "雾"},
+    {502, "\uf130", "霾"},
+    {503, "\uf131", "扬沙"},
+    {504, "\uf132", "浮尘"},
+    {507, "\uf133", "沙尘暴"},
+    {508, "\uf134", "强沙尘暴"},
+    {509, "\uf135", "浓雾"},
+    {510, "\uf136", "强浓雾"},
+    {511, "\uf137", "中度霾"},
+    {512, "\uf138", "重度霾"},
+    {513, "\uf139", "严重霾"},
+    {514, "\uf13a", "大雾"},
+    {515, "\uf13b", "特强浓雾"},
+    {800, "\uf13c", "新月"},
+    {801, "\uf13d", "蛾眉月"},
+    {802, "\uf13e", "上弦月"},
+    {803, "\uf13f", "盈凸月"},
+    {804, "\uf140", "满月"},
+    {805, "\uf141", "亏凸月"},
+    {806, "\uf142", "下弦月"},
+    {807, "\uf143", "残月"},
+    {900, "\uf144", "热"},
+    {901, "\uf145", "冷"},
+};
+
+const WeatherCondition UNKNOWN_CONDITION = {999, "\uf146", "未知"};
+
+const WeatherCondition &findCondition(int code) {
+  int low = 0;
+  int high = sizeof(WEATHER_CONDITIONS) / sizeof(WEATHER_CONDITIONS[0]) - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    const WeatherCondition &entry = WEATHER_CONDITIONS[mid];
+    if (entry.code == code) {
+      return entry;
+    }
+    if (entry.code < code) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return UNKNOWN_CONDITION;
+}
+} // namespace
+
+const char *resolveWeatherIcon(int code) { return findCondition(code).icon; }
+
+const char *resolveWeatherText(int code, const char *fallback) {
+  const WeatherCondition &condition = findCondition(code);
+  if (&condition == &UNKNOWN_CONDITION && fallback != nullptr &&
+      fallback[0] != '\0') {
+    return fallback;
   }
+  return condition.text;
 }
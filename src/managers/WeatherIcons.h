@@ -1,3 +1,6 @@
 #pragma once
 
 const char *resolveWeatherIcon(int code);
+// 返回图标代码对应的天气描述（常驻只读区）。表中没有的代码返回
+// fallback（接口给出的原文），fallback 为空时返回"未知"。
+const char *resolveWeatherText(int code, const char *fallback = nullptr);
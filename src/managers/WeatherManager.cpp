@@ -1,11 +1,30 @@
 #include "WeatherManager.h"
+#include "HttpTransport.h"
 #include "WeatherIcons.h"
+#include "WeatherParser.h"
 #include "WeatherRequestHelper.h"
-#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string.h>
 
 namespace {
 constexpr uint32_t WEATHER_UPDATE_INTERVAL_MS = 1800000UL;
 constexpr uint32_t WEATHER_RETRY_INTERVAL_MS = 60000UL;
+
+using WeatherParser::copyUtf8;
+
+bool isApiSuccess(JsonDocument &doc, const char *errorLabel) {
+  const char *code = doc["code"];
+  if (code != nullptr && strcmp(code, "200") == 0) {
+    return true;
+  }
+  if (errorLabel != nullptr) {
+    Serial.printf("%s Code: %s\n", errorLabel, code == nullptr ? "null" : code);
+  }
+  return false;
+}
+
 } // namespace
 
 #define WEATHER_CITY_ID "101280112" // Nansha, Guangzhou
@@ -38,21 +57,22 @@ const char *warning_weather_url =
     "now?location=" WEATHER_CITY_ID "&lang=zh&unit=m";
 
 WeatherManager::WeatherManager() {
-  data.city = "南沙"; // Default city name
-  data.weather = "--";
-  data.temp = 0;
-  data.humidity = 0;
-  data.icon_str = resolveWeatherIcon(999);
-  data.icon_code = 999;
+  memset(&pending, 0, sizeof(pending));
+  copyUtf8(pending.city, sizeof(pending.city), "南沙"); // Default city name
+  copyUtf8(pending.weather, sizeof(pending.weather), "--");
+  pending.temp = 0;
+  pending.humidity = 0;
+  pending.icon_str = resolveWeatherIcon(999);
+  pending.icon_code = 999;
 
-  data.warning_title = "";
-  data.warning_text = "Loading...";
+  copyUtf8(pending.warning_text, sizeof(pending.warning_text), "Loading...");
 
-  data.forecast_weather = "--";
-  data.forecast_temp_high = 0;
-  data.forecast_temp_low = 0;
-  data.forecast_code = 999;
-  data.forecast_icon_str = resolveWeatherIcon(999);
+  copyUtf8(pending.forecast_weather, sizeof(pending.forecast_weather), "--");
+  pending.forecast_temp_high = 0;
+  pending.forecast_temp_low = 0;
+  pending.forecast_code = 999;
+  pending.forecast_icon_str = resolveWeatherIcon(999);
+  memcpy(&published, &pending, sizeof(published));
 }
 
 void WeatherManager::begin(ConfigManager *config) { configMgr = config; }
@@ -74,19 +94,52 @@ void WeatherManager::update() {
   // 避免把失败请求误判成“天气已更新”，导致上层提前关掉 WiFi。
   updateInProgress = true;
   lastAttemptTime = now;
+  logHeapUsage("before");
   bool success = updateWeatherBatch();
+  logHeapUsage("after");
   updateInProgress = false;
 
   if (success) {
     lastUpdate = millis();
+    publish();
     Serial.println("Weather update completed");
   } else {
     Serial.println("Weather update failed");
   }
 }
 
+void WeatherManager::publish() {
+  // 内容与已发布的一致时不推进代数，首页不会因此重复局刷。
+  if (memcmp(&pending, &published, sizeof(published)) == 0) {
+    return;
+  }
+  sequence = sequence + 1;
+  __sync_synchronize();
+  memcpy(&published, &pending, sizeof(published));
+  generation = generation + 1;
+  __sync_synchronize();
+  sequence = sequence + 1;
+}
+
+uint32_t WeatherManager::getSnapshot(WeatherData &out) const {
+  for (;;) {
+    uint32_t before = sequence;
+    if (before & 1U) {
+      taskYIELD();
+      continue;
+    }
+    __sync_synchronize();
+    memcpy(&out, &published, sizeof(out));
+    uint32_t snapshotGeneration = generation;
+    __sync_synchronize();
+    if (sequence == before) {
+      return snapshotGeneration;
+    }
+  }
+}
+
 bool WeatherManager::canStartUpdate(uint32_t now) const {
-  if (updateInProgress || WiFi.status() != WL_CONNECTED) {
+  if (updateInProgress || !HttpTransportRegistry::get().isAvailable()) {
     return false;
   }
 
@@ -99,6 +152,13 @@ bool WeatherManager::canStartUpdate(uint32_t now) const {
 }
 
 bool WeatherManager::updateWeatherBatch() {
+  // 整批请求共用同一份 Token 副本，避免每个接口各自复制一次 String。
+  apiToken[0] = '\0';
+  if (configMgr != nullptr) {
+    configMgr->copyWeatherApiToken(apiToken, sizeof(apiToken));
+  }
+
+  uint32_t batchStartMs = millis();
   bool currentOk = fetchCurrentWeather();
   vTaskDelay(pdMS_TO_TICKS(200));
   bool forecastOk = fetchForecastWeather();
@@ -108,175 +168,99 @@ bool WeatherManager::updateWeatherBatch() {
   bool dailyOk = fetchDailyWeather();
   vTaskDelay(pdMS_TO_TICKS(200));
   fetchWarning();
-  return currentOk && forecastOk && hourlyOk && dailyOk;
+  bool success = currentOk && forecastOk && hourlyOk && dailyOk;
+#if ENABLE_SERIAL_DEBUG
+  // 与每个请求的 [HTTP][bench] 行同格式，含请求间的固定间隔。
+  Serial.printf("[HTTP][bench] weather batch total=%lums %s\n",
+                static_cast<unsigned long>(millis() - batchStartMs),
+                success ? "ok" : "failed");
+#endif
+  return success;
 }
 
 bool WeatherManager::fetchCurrentWeather() {
   bool apiOk = false;
-  String apiToken =
-      configMgr == nullptr ? "" : configMgr->getWeatherApiToken();
   bool requestOk = requestWeatherApi(
-      current_weather_url, "current weather", apiToken.c_str(),
-                                     [this, &apiOk](JsonDocument &doc) {
-    JsonObject now = doc["now"];
-    String code = doc["code"];
-    if (code == "200") {
-      apiOk = true;
-      data.temp = now["temp"].as<int>();
-      data.weather = now["text"].as<String>();
-      data.humidity = now["humidity"].as<int>();
-      data.icon_code = now["icon"].as<int>();
-      data.icon_str = resolveWeatherIcon(data.icon_code);
-
-      // Parse obsTime: 2021-11-15T16:35+08:00 -> 11月15日 16:35
-      String obsTime = now["obsTime"].as<String>();
-      int tIndex = obsTime.indexOf('T');
-      if (tIndex != -1) {
-        String datePart = obsTime.substring(5, tIndex);              // 11-15
-        String timePart = obsTime.substring(tIndex + 1, tIndex + 6); // 16:35
-        int dashIndex = datePart.indexOf('-');
-        if (dashIndex != -1) {
-          data.obs_time = datePart.substring(0, dashIndex) + "月" +
-                          datePart.substring(dashIndex + 1) + "日 " + timePart;
-        } else {
-          data.obs_time = obsTime;
+      current_weather_url, "current weather", apiToken,
+      [this, &apiOk](JsonDocument &doc) {
+        if (!isApiSuccess(doc, "API Error")) {
+          return;
         }
-      }
-    } else {
-      Serial.print("API Error Code: ");
-      Serial.println(code);
-    }
-  });
+        apiOk = true;
+        WeatherParser::fillNow(doc, pending);
+      });
   return requestOk && apiOk;
 }
 
 bool WeatherManager::fetchForecastWeather() {
   bool apiOk = false;
-  String apiToken =
-      configMgr == nullptr ? "" : configMgr->getWeatherApiToken();
   bool requestOk = requestWeatherApi(
-      forecast_weather_url, "forecast weather", apiToken.c_str(),
-                                     [this, &apiOk](JsonDocument &doc) {
-    String code = doc["code"];
-    if (code == "200") {
-      apiOk = true;
-      JsonArray daily = doc["daily"];
-      if (daily.size() >= 2) {
-        JsonObject tomorrow = daily[1];
-
-        data.forecast_weather = tomorrow["textDay"].as<String>();
-        data.forecast_temp_high = tomorrow["tempMax"].as<int>();
-        data.forecast_temp_low = tomorrow["tempMin"].as<int>();
-        data.forecast_code = tomorrow["iconDay"].as<int>();
-        data.forecast_icon_str = resolveWeatherIcon(data.forecast_code);
-      }
-    } else {
-      Serial.print("API Error (Forecast) Code: ");
-      Serial.println(code);
-    }
-  });
+      forecast_weather_url, "forecast weather", apiToken,
+      [this, &apiOk](JsonDocument &doc) {
+        if (!isApiSuccess(doc, "API Error (Forecast)")) {
+          return;
+        }
+        apiOk = true;
+        WeatherParser::fillForecast(doc, pending);
+      });
   return requestOk && apiOk;
 }
 
 bool WeatherManager::fetchHourlyWeather() {
   bool apiOk = false;
-  String apiToken =
-      configMgr == nullptr ? "" : configMgr->getWeatherApiToken();
   bool requestOk = requestWeatherApi(
-      hourly_weather_url, "hourly weather", apiToken.c_str(),
-                                     [this, &apiOk](JsonDocument &doc) {
-    String code = doc["code"];
-    if (code == "200") {
-      apiOk = true;
-      JsonArray hourlyItems = doc["hourly"];
-      data.hourly.clear();
-      // We only take the first 12 hours for the UI
-      for (int i = 0; i < hourlyItems.size() && i < 12; i++) {
-        JsonObject item = hourlyItems[i];
-        HourlyData hData;
-        String fxTime = item["fxTime"].as<String>();
-        // Extract HH:00 from ISO time
-        int tIndex = fxTime.indexOf('T');
-        if (tIndex != -1) {
-          hData.time = fxTime.substring(tIndex + 1, tIndex + 6);
-        } else {
-          hData.time = fxTime;
+      hourly_weather_url, "hourly weather", apiToken,
+      [this, &apiOk](JsonDocument &doc) {
+        if (!isApiSuccess(doc, nullptr)) {
+          return;
         }
-        hData.temp = item["temp"].as<int>();
-        hData.icon_code = item["icon"].as<int>();
-        hData.icon_str = resolveWeatherIcon(hData.icon_code);
-        data.hourly.push_back(hData);
-      }
-    }
-  });
+        apiOk = true;
+        WeatherParser::fillHourly(doc, pending);
+      });
   return requestOk && apiOk;
 }
 
 bool WeatherManager::fetchDailyWeather() {
   bool apiOk = false;
-  String apiToken =
-      configMgr == nullptr ? "" : configMgr->getWeatherApiToken();
   bool requestOk = requestWeatherApi(
-      daily_weather_url, "daily weather", apiToken.c_str(),
-                                     [this, &apiOk](JsonDocument &doc) {
-    String code = doc["code"];
-    if (code == "200") {
-      apiOk = true;
-      JsonArray dailyItems = doc["daily"];
-      data.daily.clear();
-      for (int i = 0; i < dailyItems.size() && i < 7; i++) {
-        JsonObject item = dailyItems[i];
-        DailyData dData;
-        dData.date = item["fxDate"].as<String>();
-
-        // Simple day extraction or mapping if possible,
-        // for now we'll just use the date or a placeholder
-        dData.day = dData.date.substring(5); // MM-DD
-
-        dData.temp_max = item["tempMax"].as<int>();
-        dData.temp_min = item["tempMin"].as<int>();
-        dData.icon_code = item["iconDay"].as<int>();
-        dData.icon_str = resolveWeatherIcon(dData.icon_code);
-        data.daily.push_back(dData);
-      }
-    }
-  });
+      daily_weather_url, "daily weather", apiToken,
+      [this, &apiOk](JsonDocument &doc) {
+        if (!isApiSuccess(doc, nullptr)) {
+          return;
+        }
+        apiOk = true;
+        WeatherParser::fillDaily(doc, pending);
+      });
   return requestOk && apiOk;
 }
 
 bool WeatherManager::fetchWarning() {
   bool apiOk = false;
-  String apiToken =
-      configMgr == nullptr ? "" : configMgr->getWeatherApiToken();
   bool requestOk = requestWeatherApi(
-      warning_weather_url, "weather warning", apiToken.c_str(),
-                                     [this, &apiOk](JsonDocument &doc) {
-    // Note: The warning API response contains an "alerts" array, not "warning".
-    // It also has a metadata.zeroResult flag.
-    String code = doc["code"];
-    if (code == "200") {
-      apiOk = true;
-      JsonArray alerts = doc["alerts"];
-      if (alerts.size() > 0) {
-        JsonObject w = alerts[0];
-        data.warning_title = w["title"].as<String>();
-        data.warning_text = w["text"].as<String>();
-      } else {
-        // Check for metadata.zeroResult if available, otherwise assume no
-        // warnings
-        if (doc["metadata"].is<JsonObject>() &&
-            doc["metadata"]["zeroResult"].as<bool>()) {
-          data.warning_title = "";
-          data.warning_text = "";
-        } else {
-          data.warning_title = "";
-          data.warning_text = "";
+      warning_weather_url, "weather warning", apiToken,
+      [this, &apiOk](JsonDocument &doc) {
+        // Note: The warning API response contains an "alerts" array, not
+        // "warning". An empty array (metadata.zeroResult) means no warnings.
+        if (!isApiSuccess(doc, nullptr)) {
+          pending.warning_title[0] = '\0';
+          copyUtf8(pending.warning_text, sizeof(pending.warning_text),
+                   "Warning info unavailable.");
+          return;
         }
-      }
-    } else {
-      data.warning_title = "";
-      data.warning_text = "Warning info unavailable.";
-    }
-  });
+        apiOk = true;
+        WeatherParser::fillWarning(doc, pending);
+      });
   return requestOk && apiOk;
 }
+
+void WeatherManager::logHeapUsage(const char *stage) const {
+#if ENABLE_SERIAL_DEBUG
+  // 用最大连续块/总空闲估算碎片率，便于长时间运行时对比刷新前后的堆状态。
+  size_t freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  size_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  unsigned fragmentation =
+      freeBytes == 0 ? 0 : 100U - (largestBlock * 100U) / freeBytes;
+  Serial.printf("[Weather][heap] %s free=%u largest=%u frag=%u%%\n", stage,
+                (unsigned)freeBytes, (unsigned)largestBlock, fragmentation);
+#endif
+}
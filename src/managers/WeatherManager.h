@@ -1,49 +1,11 @@
 #pragma once
 
 #include "ConfigManager.h"
+#include "WeatherData.h"
 #include <ArduinoJson.h>
 #include <functional>
-#include <vector>
 
-struct HourlyData {
-  String time;
-  int temp;
-  int icon_code;
-  const char *icon_str;
-};
-
-struct DailyData {
-  String date;
-  String day;
-  int temp_max;
-  int temp_min;
-  int icon_code;
-  const char *icon_str;
-};
-
-struct WeatherData {
-  String city;
-  String weather;
-  String obs_time;
-  int temp;
-  int humidity;
-  const char *icon_str; // u8g2 icon character
-  int icon_code;
-
-  String warning_title;
-  String warning_text;
-
-  std::vector<HourlyData> hourly;
-  std::vector<DailyData> daily;
-
-  // Forecast (Tomorrow) - Keep for compatibility if needed, but we'll use
-  // daily[1]
-  String forecast_weather;
-  int forecast_temp_high;
-  int forecast_temp_low;
-  int forecast_code;
-  const char *forecast_icon_str;
-};
+static const size_t WEATHER_API_TOKEN_SIZE = 72;
 
 class WeatherManager {
 public:
@@ -52,13 +14,23 @@ public:
   void resetUpdateSchedule();
   void update();
   unsigned long getLastUpdate() const { return lastUpdate; }
-  WeatherData data;
+  uint32_t getGeneration() const { return generation; }
+  // 拷贝最近一次发布的整批天气数据，返回其代数。发布进行中时重试，
+  // 读者不会看到新旧字段混杂的数据。
+  uint32_t getSnapshot(WeatherData &out) const;
 
 private:
   ConfigManager *configMgr;
   unsigned long lastUpdate = 0;
+  // 关键逻辑：网络任务只写 pending，整批成功后在序号保护下一次性拷入
+  // published；序号为奇数表示发布进行中。
+  WeatherData pending;
+  WeatherData published;
+  volatile uint32_t sequence = 0;
+  volatile uint32_t generation = 0;
   unsigned long lastAttemptTime = 0;
   bool updateInProgress = false;
+  char apiToken[WEATHER_API_TOKEN_SIZE] = {};
 
   bool canStartUpdate(uint32_t now) const;
   bool updateWeatherBatch();
@@ -67,4 +39,6 @@ private:
   bool fetchHourlyWeather();
   bool fetchDailyWeather();
   bool fetchWarning();
+  void publish();
+  void logHeapUsage(const char *stage) const;
 };
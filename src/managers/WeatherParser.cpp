@@ -0,0 +1,151 @@
+#include "WeatherParser.h"
+#include "WeatherIcons.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace WeatherParser {
+namespace {
+size_t utf8TruncateLength(const char *src, size_t maxLen) {
+  size_t len = strnlen(src, maxLen + 1);
+  if (len <= maxLen) {
+    return len;
+  }
+  // 关键逻辑：截断时回退到 UTF-8 字符起始字节，
+  // 否则中文预警文本被切成半个字符，u8g2 绘制时会出现乱码。
+  len = maxLen;
+  while (len > 0 && (static_cast<uint8_t>(src[len]) & 0xC0) == 0x80) {
+    len--;
+  }
+  return len;
+}
+} // namespace
+
+void copyUtf8(char *dest, size_t size, const char *src) {
+  if (size == 0) {
+    return;
+  }
+  if (src == nullptr) {
+    dest[0] = '\0';
+    return;
+  }
+  size_t len = utf8TruncateLength(src, size - 1);
+  memcpy(dest, src, len);
+  dest[len] = '\0';
+}
+
+namespace {
+// ISO 时间 2021-11-15T16:35+08:00 -> HH:MM
+void extractClock(char *dest, size_t size, const char *isoTime) {
+  const char *tPos = isoTime == nullptr ? nullptr : strchr(isoTime, 'T');
+  copyUtf8(dest, size, tPos == nullptr ? isoTime : tPos + 1);
+  if (tPos != nullptr && size > 5) {
+    dest[5] = '\0';
+  }
+}
+
+// Parse obsTime: 2021-11-15T16:35+08:00 -> 11月15日 16:35
+void formatObsTime(char *dest, size_t size, const char *obsTime) {
+  // 字段缺失时清空，不能让界面继续显示上一批的观测时间。
+  if (obsTime == nullptr) {
+    copyUtf8(dest, size, "");
+    return;
+  }
+  const char *tPos = strchr(obsTime, 'T');
+  if (tPos == nullptr) {
+    copyUtf8(dest, size, obsTime);
+    return;
+  }
+  int month = 0;
+  int day = 0;
+  if (tPos - obsTime >= 10 && sscanf(obsTime + 5, "%2d-%2d", &month, &day) == 2) {
+    snprintf(dest, size, "%02d月%02d日 %.5s", month, day, tPos + 1);
+  } else {
+    copyUtf8(dest, size, obsTime);
+  }
+}
+} // namespace
+
+void fillNow(JsonDocument &doc, WeatherData &data) {
+  JsonObject now = doc["now"];
+  data.temp = now["temp"].as<int>();
+  data.humidity = now["humidity"].as<int>();
+  data.icon_code = now["icon"].as<int>();
+  data.icon_str = resolveWeatherIcon(data.icon_code);
+  copyUtf8(data.weather, sizeof(data.weather),
+           resolveWeatherText(data.icon_code,
+                              now["text"].as<const char *>()));
+  formatObsTime(data.obs_time, sizeof(data.obs_time),
+                now["obsTime"].as<const char *>());
+}
+
+void fillForecast(JsonDocument &doc, WeatherData &data) {
+  JsonArray daily = doc["daily"];
+  if (daily.size() >= 2) {
+    JsonObject tomorrow = daily[1];
+
+    data.forecast_temp_high = tomorrow["tempMax"].as<int>();
+    data.forecast_temp_low = tomorrow["tempMin"].as<int>();
+    data.forecast_code = tomorrow["iconDay"].as<int>();
+    data.forecast_icon_str = resolveWeatherIcon(data.forecast_code);
+    copyUtf8(data.forecast_weather, sizeof(data.forecast_weather),
+             resolveWeatherText(data.forecast_code,
+                                tomorrow["textDay"].as<const char *>()));
+  }
+}
+
+void fillHourly(JsonDocument &doc, WeatherData &data) {
+  JsonArray hourlyItems = doc["hourly"];
+  uint8_t count = 0;
+  // We only take the first 12 hours for the UI
+  for (JsonObject item : hourlyItems) {
+    if (count >= WEATHER_HOURLY_CAPACITY) {
+      break;
+    }
+    HourlyData &hData = data.hourly[count++];
+    extractClock(hData.time, sizeof(hData.time),
+                 item["fxTime"].as<const char *>());
+    hData.temp = item["temp"].as<int>();
+    hData.icon_code = item["icon"].as<int>();
+    hData.icon_str = resolveWeatherIcon(hData.icon_code);
+  }
+  data.hourly_count = count;
+}
+
+void fillDaily(JsonDocument &doc, WeatherData &data) {
+  JsonArray dailyItems = doc["daily"];
+  uint8_t count = 0;
+  for (JsonObject item : dailyItems) {
+    if (count >= WEATHER_DAILY_CAPACITY) {
+      break;
+    }
+    DailyData &dData = data.daily[count++];
+    copyUtf8(dData.date, sizeof(dData.date),
+             item["fxDate"].as<const char *>());
+    // Simple day extraction or mapping if possible,
+    // for now we'll just use the date or a placeholder
+    copyUtf8(dData.day, sizeof(dData.day),
+             strlen(dData.date) > 5 ? dData.date + 5 : dData.date);
+
+    dData.temp_max = item["tempMax"].as<int>();
+    dData.temp_min = item["tempMin"].as<int>();
+    dData.icon_code = item["iconDay"].as<int>();
+    dData.icon_str = resolveWeatherIcon(dData.icon_code);
+  }
+  data.daily_count = count;
+}
+
+void fillWarning(JsonDocument &doc, WeatherData &data) {
+  JsonArray alerts = doc["alerts"];
+  if (alerts.size() > 0) {
+    JsonObject w = alerts[0];
+    copyUtf8(data.warning_title, sizeof(data.warning_title),
+             w["title"].as<const char *>());
+    copyUtf8(data.warning_text, sizeof(data.warning_text),
+             w["text"].as<const char *>());
+  } else {
+    data.warning_title[0] = '\0';
+    data.warning_text[0] = '\0';
+  }
+}
+
+} // namespace WeatherParser
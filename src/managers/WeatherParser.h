@@ -0,0 +1,20 @@
+#pragma once
+
+#include "WeatherData.h"
+#include <ArduinoJson.h>
+
+// 把和风天气各接口的 JsonDocument 填进 WeatherData。只写定长字段、不分配
+// 内存，也不依赖 Arduino，设备上由 WeatherManager 调用，主机测试用同一组
+// 函数核对回放数据。调用前由调用方确认 code 为 "200"。
+namespace WeatherParser {
+// 按 UTF-8 字符边界截断拷贝，src 为空时写入空串。
+void copyUtf8(char *dest, size_t size, const char *src);
+
+void fillNow(JsonDocument &doc, WeatherData &data);
+// 只取明天（daily[1]）作为预报，不足两天时保持原值。
+void fillForecast(JsonDocument &doc, WeatherData &data);
+void fillHourly(JsonDocument &doc, WeatherData &data);
+void fillDaily(JsonDocument &doc, WeatherData &data);
+// alerts 为空表示当前没有预警，清空标题与正文。
+void fillWarning(JsonDocument &doc, WeatherData &data);
+} // namespace WeatherParser
@@ -1,186 +1,115 @@
 #include "WeatherRequestHelper.h"
+#include "HttpTransport.h"
+#include "WeatherResponse.h"
 #include <ArduinoUZlib.h>
-#include <HTTPClient.h>
-#include <WiFi.h>
-#include <WiFiClientSecure.h>
-#include <vector>
+#include <esp_heap_caps.h>
 
 namespace {
-constexpr uint32_t WEATHER_HTTP_TIMEOUT_MS = 8000UL;
-constexpr uint32_t WEATHER_POLL_DELAY_MS = 10UL;
-
-bool deserializePayload(const String &encoding,
-                        const std::vector<uint8_t> &payload,
-                        JsonDocument &doc) {
-  if (payload.empty()) {
-    Serial.println("Weather payload is empty");
+// 直接调用 ArduinoUZlib 自带的 uzlib，解压进调用方给出的缓冲区；
+// ArduinoUZlib::decompress 每次按结果大小 malloc 一块新的输出缓冲区。
+bool inflateGzip(const uint8_t *data, size_t length, uint8_t *out,
+                 size_t capacity, size_t &outLength) {
+  outLength = 0;
+  if (length < 18) { // 10 字节 gzip 头 + 8 字节尾部
     return false;
   }
-
-  if (encoding.indexOf("gzip") > -1) {
-    uint8_t *buffer = nullptr;
-    uint32_t size = 0;
-    // ArduinoUZlib 旧接口错误地要求可写入输入缓冲区，这里传入 vector
-    // 的底层地址，但逻辑上仍按只读输入使用。
-    ArduinoUZlib::decompress(const_cast<uint8_t *>(payload.data()),
-                             payload.size(), buffer, size);
-
-    if (buffer == nullptr || size == 0) {
-      Serial.println("Weather gzip decompress failed");
-      return false;
-    }
-
-    DeserializationError error = deserializeJson(doc, buffer, size);
-    free(buffer);
-    if (error) {
-      Serial.print(F("deserializeJson() failed: "));
-      Serial.println(error.f_str());
-      return false;
-    }
-    return true;
-  }
-
-  DeserializationError error =
-      deserializeJson(doc, payload.data(), payload.size());
-  if (error) {
-    Serial.print(F("deserializeJson() failed: "));
-    Serial.println(error.f_str());
+  // gzip 尾部最后 4 字节是小端的原始长度（ISIZE）。
+  const uint8_t *trailer = data + length - 4;
+  size_t expected = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) |
+                    (static_cast<uint32_t>(trailer[3]) << 24);
+  if (expected == 0 || expected > capacity) {
     return false;
   }
-  return true;
-}
 
-bool readResponsePayload(HTTPClient &http, std::vector<uint8_t> &payload) {
-  // 兼容不同 Arduino-ESP32 内核：
-  // 某些版本 getStreamPtr() 返回 WiFiClient*，某些版本内部改成了
-  // NetworkClient*。两者都继承自 Client，因此这里统一收敛到 Client*，
-  // 避免因为平台升级/降级导致编译直接中断。
-  Client *stream = http.getStreamPtr();
-  if (stream == nullptr) {
-    Serial.println("Weather stream is null");
+  uzlib_init();
+  struct uzlib_uncomp decomp;
+  uzlib_uncompress_init(&decomp, nullptr, 0);
+  decomp.source = data;
+  decomp.source_limit = trailer;
+  decomp.source_read_cb = nullptr;
+  if (uzlib_gzip_parse_header(&decomp) != TINF_OK) {
     return false;
   }
-
-  int contentLength = http.getSize();
-  if (contentLength > 0) {
-    payload.reserve(contentLength);
-  }
-
-  uint32_t lastDataTime = millis();
-  while (http.connected() || stream->available()) {
-    int availableBytes = stream->available();
-    if (availableBytes <= 0) {
-      if (!stream->connected() && !http.connected()) {
-        break;
-      }
-      if (millis() - lastDataTime >= WEATHER_HTTP_TIMEOUT_MS) {
-        Serial.println("Weather payload read timeout");
-        return false;
-      }
-      vTaskDelay(pdMS_TO_TICKS(WEATHER_POLL_DELAY_MS));
-      continue;
-    }
-
-    uint8_t buffer[256];
-    size_t chunkSize = static_cast<size_t>(availableBytes);
-    if (chunkSize > sizeof(buffer)) {
-      chunkSize = sizeof(buffer);
-    }
-
-    int readLen = stream->readBytes(reinterpret_cast<char *>(buffer), chunkSize);
-    if (readLen <= 0) {
-      Serial.println("Weather payload read failed");
-      return false;
-    }
-
-    payload.insert(payload.end(), buffer, buffer + readLen);
-    lastDataTime = millis();
-  }
-
-  return !payload.empty();
+  decomp.dest_start = decomp.dest = out;
+  decomp.dest_limit = out + expected;
+  int res = uzlib_uncompress_chksum(&decomp);
+  outLength = decomp.dest - out;
+  return (res == TINF_DONE || res == TINF_OK) && outLength == expected;
 }
 
-bool beginWeatherRequest(HTTPClient &http, WiFiClientSecure &client,
-                         const char *url, const char *requestName,
-                         const char *apiToken) {
-  if (apiToken == nullptr || apiToken[0] == '\0') {
-    Serial.printf("%s skipped: API token is empty\n", requestName);
-    return false;
-  }
-  if (!http.begin(client, url)) {
-    Serial.printf("%s begin failed: %s\n", requestName, url);
-    return false;
-  }
-
-  // 强制请求非复用连接，避免在 ESP32 的 TLS 连接回收边界上留下悬空 socket。
-  http.useHTTP10(true);
-  http.setTimeout(WEATHER_HTTP_TIMEOUT_MS);
-  http.setReuse(false);
-  http.addHeader("X-QW-Api-Key", apiToken);
-  http.addHeader("Accept-Encoding", "identity");
-
-  const char *headers[] = {"Content-Encoding"};
-  http.collectHeaders(headers, 1);
-  return true;
-}
-
-bool validateHttpResponse(HTTPClient &http, const char *requestName) {
-  int httpCode = http.GET();
-  if (httpCode <= 0) {
-    Serial.printf("%s HTTP GET failed, error: %s\n", requestName,
-                  http.errorToString(httpCode).c_str());
-    http.end();
-    return false;
-  }
-
-  if (httpCode != HTTP_CODE_OK) {
-    Serial.printf("%s HTTP code: %d\n", requestName, httpCode);
-    http.end();
-    return false;
-  }
-
-  return true;
+// 关键逻辑：响应缓冲区常驻（约 20 KB），所有天气请求都在网络任务里串行
+// 执行，共用这一份即可。
+WeatherResponse response(inflateGzip);
+
+void logRequestBenchmark(const char *requestName, size_t bytes,
+                         uint32_t transferMs, uint32_t parseUs,
+                         int32_t parseHeapBytes) {
+#if ENABLE_SERIAL_DEBUG
+  // 统一格式便于从串口日志里批量提取，对比流式解析/缓存等改动前后的耗时。
+  Serial.printf("[HTTP][bench] %s bytes=%u transfer=%lums parse=%luus "
+                "parse_heap=%ld\n",
+                requestName, (unsigned)bytes, (unsigned long)transferMs,
+                (unsigned long)parseUs, (long)parseHeapBytes);
+#endif
 }
 } // namespace
 
 bool requestWeatherApi(const char *url, const char *requestName,
                        const char *apiToken,
                        std::function<void(JsonDocument &)> callback) {
-  if (WiFi.status() != WL_CONNECTED) {
+  HttpTransport &transport = HttpTransportRegistry::get();
+  if (!transport.isAvailable()) {
     Serial.printf("%s skipped: WiFi disconnected\n", requestName);
     return false;
   }
-
-  WiFiClientSecure client;
-  client.setInsecure();
-
-  HTTPClient http;
-  if (!beginWeatherRequest(http, client, url, requestName, apiToken)) {
+  if (apiToken == nullptr || apiToken[0] == '\0') {
+    Serial.printf("%s skipped: API token is empty\n", requestName);
     return false;
   }
 
-  if (!validateHttpResponse(http, requestName)) {
+  const HttpHeader headers[] = {{"X-QW-Api-Key", apiToken},
+                                {"Accept-Encoding", "identity"}};
+  HttpRequest request = {url, requestName, headers, 2, 0};
+  uint32_t transferStart = millis();
+  WeatherResponse::Result result = response.receive(transport, request);
+  uint32_t transferMs = millis() - transferStart;
+  if (result == WeatherResponse::RESULT_TOO_LARGE) {
+    Serial.printf("%s payload exceeds %u bytes\n", requestName,
+                  static_cast<unsigned>(WeatherResponse::BODY_CAPACITY));
     return false;
   }
-
-  std::vector<uint8_t> payload;
-  if (!readResponsePayload(http, payload)) {
-    Serial.printf("%s payload read failed\n", requestName);
-    http.end();
+  if (result != WeatherResponse::RESULT_OK) {
+    if (response.getInfo().statusCode == 200) {
+      Serial.printf("%s payload read failed\n", requestName);
+    }
     return false;
   }
 
+  size_t heapBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  uint32_t parseStart = micros();
   JsonDocument doc;
-  if (!deserializePayload(http.header("Content-Encoding"), payload, doc)) {
+  result = response.parse(doc);
+  if (result != WeatherResponse::RESULT_OK) {
+    if (result == WeatherResponse::RESULT_EMPTY) {
+      Serial.println("Weather payload is empty");
+    } else if (result == WeatherResponse::RESULT_INFLATE_FAILED) {
+      Serial.println("Weather gzip decompress failed");
+    } else {
+      Serial.print(F("deserializeJson() failed: "));
+      Serial.println(response.getJsonError().f_str());
+    }
     Serial.printf("%s payload parse failed\n", requestName);
-    http.end();
     return false;
   }
+  uint32_t parseUs = micros() - parseStart;
+  int32_t parseHeap = static_cast<int32_t>(heapBefore) -
+                      static_cast<int32_t>(
+                          heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  logRequestBenchmark(requestName, response.getBodyLength(), transferMs,
+                      parseUs, parseHeap);
 
   if (callback) {
     callback(doc);
   }
-
-  http.end();
   return true;
 }
@@ -0,0 +1,45 @@
+#include "WeatherResponse.h"
+#include <string.h>
+
+WeatherResponse::Result WeatherResponse::receive(HttpTransport &transport,
+                                                 const HttpRequest &request) {
+  info = HttpResponseInfo();
+  bodyLength = 0;
+  bool overflow = false;
+  bool received = transport.get(
+      request, info, [this, &overflow](const uint8_t *data, size_t len) {
+        if (len > BODY_CAPACITY - bodyLength) {
+          overflow = true;
+          return false;
+        }
+        memcpy(body + bodyLength, data, len);
+        bodyLength += len;
+        return true;
+      });
+  if (overflow) {
+    bodyLength = 0;
+    return RESULT_TOO_LARGE;
+  }
+  return received ? RESULT_OK : RESULT_TRANSPORT_FAILED;
+}
+
+WeatherResponse::Result WeatherResponse::parse(JsonDocument &doc) {
+  jsonError = DeserializationError();
+  if (bodyLength == 0) {
+    return RESULT_EMPTY;
+  }
+  if (!info.gzip) {
+    jsonError = deserializeJson(doc, body, bodyLength);
+    return jsonError ? RESULT_JSON_FAILED : RESULT_OK;
+  }
+
+  size_t inflatedLength = 0;
+  if (inflater == nullptr ||
+      !inflater(body, bodyLength, inflated, sizeof(inflated),
+                inflatedLength) ||
+      inflatedLength == 0) {
+    return RESULT_INFLATE_FAILED;
+  }
+  jsonError = deserializeJson(doc, inflated, inflatedLength);
+  return jsonError ? RESULT_JSON_FAILED : RESULT_OK;
+}
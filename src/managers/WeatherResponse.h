@@ -0,0 +1,48 @@
+#pragma once
+
+#include "HttpTransportBase.h"
+#include <ArduinoJson.h>
+
+// 天气接口单次响应的接收与解析：按块收下响应体，gzip 时先解压，再反序列化
+// 为 JsonDocument。不依赖 Arduino，设备上由 requestWeatherApi 包装计时与
+// 日志，主机测试用回放传输层驱动同一条路径。
+class WeatherResponse {
+public:
+  // 关键逻辑：响应体和解压结果都放在对象内的定长缓冲区里，对象常驻后
+  // 每次刷新只覆盖内容，不再为每个请求申请/释放整块响应。最大的逐小时
+  // 预报约 6 KB，留出余量；超出容量按失败处理而不是截断后解析。
+  static constexpr size_t BODY_CAPACITY = 10 * 1024;
+  static constexpr size_t INFLATE_CAPACITY = 10 * 1024;
+
+  enum Result : uint8_t {
+    RESULT_OK,
+    RESULT_TRANSPORT_FAILED,
+    RESULT_TOO_LARGE,
+    RESULT_EMPTY,
+    RESULT_INFLATE_FAILED,
+    RESULT_JSON_FAILED,
+  };
+
+  // 把 gzip 响应体解压到 out（容量 capacity），失败或放不下返回 false。
+  using GzipInflater = bool (*)(const uint8_t *data, size_t length,
+                                uint8_t *out, size_t capacity,
+                                size_t &outLength);
+
+  explicit WeatherResponse(GzipInflater inflater) : inflater(inflater) {}
+  WeatherResponse(const WeatherResponse &) = delete;
+  WeatherResponse &operator=(const WeatherResponse &) = delete;
+
+  Result receive(HttpTransport &transport, const HttpRequest &request);
+  Result parse(JsonDocument &doc);
+  const HttpResponseInfo &getInfo() const { return info; }
+  size_t getBodyLength() const { return bodyLength; }
+  DeserializationError getJsonError() const { return jsonError; }
+
+private:
+  GzipInflater inflater;
+  HttpResponseInfo info;
+  DeserializationError jsonError;
+  size_t bodyLength = 0;
+  uint8_t body[BODY_CAPACITY];
+  uint8_t inflated[INFLATE_CAPACITY];
+};
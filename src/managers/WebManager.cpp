@@ -1,68 +1,271 @@
 #include "WebManager.h"
 #include "ConfigPortal.h"
-#include "SystemWebPage.h"
+#include "SystemWebAssets.h"
+#include "../drivers/SharedSPIBus.h"
+#include "../utils/AcceptEncoding.h"
+#include "../utils/ByteRange.h"
+#include "../utils/Metrics.h"
 #include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+#include <memory>
+#include <new>
+
+namespace {
+// 批量配置的电台副本放在堆上，栈只需容纳 JSON 解析与各管理器的调用链。
+constexpr uint32_t WEB_SERVER_TASK_STACK = 12288;
+constexpr UBaseType_t WEB_SERVER_TASK_PRIORITY = 1;
+constexpr BaseType_t WEB_SERVER_TASK_CORE = 0;
+constexpr uint32_t WEB_SERVER_POLL_MS = 5;
+constexpr uint32_t WEB_STREAM_STALL_TIMEOUT_MS = 10000;
+constexpr size_t MAX_UPLOAD_BYTES = 32UL * 1024UL * 1024UL;
+constexpr const char *UPLOAD_STAGING_DIR = "/.uploads";
+constexpr uint32_t RINGTONE_DEFAULT_RATE = 16000;
+constexpr uint32_t RINGTONE_MAX_SECONDS = 180;
+constexpr const char *RINGTONE_TEMP_SUFFIX = ".part";
+constexpr const char *WEB_ASSET_CACHE_CONTROL = "public, max-age=31536000";
+constexpr const char *WEB_PAGE_CACHE_CONTROL = "no-cache";
+constexpr size_t LIST_DEFAULT_LIMIT = 100;
+constexpr size_t LIST_MAX_LIMIT = 500;
+constexpr size_t CONFIG_BODY_LIMIT = 8192;
+constexpr size_t BATCH_BODY_LIMIT = 16384;
+constexpr size_t METRICS_BODY_RESERVE = 4096;
+// 测速全程独占总线，距下一次闹钟预唤醒不足该时长时拒绝启动。
+constexpr uint32_t BENCHMARK_ALARM_GUARD_MS = 60000;
+const char *WEB_COLLECTED_HEADERS[] = {"Range", "If-Range", "If-None-Match",
+                                       "Accept-Encoding"};
+
+// 以 chunked 编码输出 JSON 的小缓冲写入器，攒满一批再交给 WebServer，
+// 避免每个字段都产生一个 TCP 分片。
+class ChunkedJsonWriter {
+public:
+  explicit ChunkedJsonWriter(WebServer &server) : server(server) {}
+
+  void begin() {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json; charset=utf-8", "");
+  }
+
+  void raw(const char *text) {
+    while (*text != '\0') {
+      put(*text++);
+    }
+  }
+
+  void string(const char *text) {
+    put('"');
+    for (; *text != '\0'; ++text) {
+      uint8_t c = static_cast<uint8_t>(*text);
+      if (c == '"' || c == '\\') {
+        put('\\');
+        put(static_cast<char>(c));
+      } else if (c < 0x20) {
+        char escaped[7];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        raw(escaped);
+      } else {
+        put(static_cast<char>(c));
+      }
+    }
+    put('"');
+  }
+
+  void number(size_t value) {
+    char text[12];
+    snprintf(text, sizeof(text), "%lu", static_cast<unsigned long>(value));
+    raw(text);
+  }
+
+  void flush() {
+    if (length > 0) {
+      server.sendContent(buffer, length);
+      length = 0;
+    }
+  }
+
+  void end() {
+    flush();
+    server.sendContent("");
+  }
+
+private:
+  WebServer &server;
+  char buffer[1024];
+  size_t length = 0;
+
+  void put(char c) {
+    if (length == sizeof(buffer)) {
+      flush();
+    }
+    buffer[length++] = c;
+  }
+};
+
+String buildFileEtag(size_t size, time_t lastWrite) {
+  char etag[32];
+  snprintf(etag, sizeof(etag), "\"%lx-%lx\"",
+           static_cast<unsigned long>(size),
+           static_cast<unsigned long>(lastWrite));
+  return String(etag);
+}
+} // namespace
 
 WebManager::WebManager(TodoManager *todo, AlarmManager *alarm,
                        ConfigManager *config, SDCardDriver *sd,
-                       ConnectionManager *conn, WeatherManager *weather)
+                       ConnectionManager *conn, WeatherManager *weather,
+                       RtcDriver *rtc, MusicManager *music)
     : server(ConfigPortal::SYSTEM_WEB_PORT), todoMgr(todo), alarmMgr(alarm),
-      configMgr(config), sd(sd), conn(conn), weatherMgr(weather) {}
+      configMgr(config), sd(sd), conn(conn), weatherMgr(weather), rtc(rtc),
+      music(music) {}
 
 void WebManager::begin() {
+  if (stateMutex == nullptr) {
+    stateMutex = xSemaphoreCreateRecursiveMutex();
+  }
   registerRoutes();
+  // WebServer 默认不保留请求头，断点续传需要读取 Range/If-Range。
+  server.collectHeaders(WEB_COLLECTED_HEADERS,
+                        sizeof(WEB_COLLECTED_HEADERS) /
+                            sizeof(WEB_COLLECTED_HEADERS[0]));
+  uploadWriter.begin();
+  if (serverTask == nullptr) {
+    xTaskCreatePinnedToCore(serverTaskEntry, "WebServerTask",
+                            WEB_SERVER_TASK_STACK, this,
+                            WEB_SERVER_TASK_PRIORITY, &serverTask,
+                            WEB_SERVER_TASK_CORE);
+  }
 }
 
 void WebManager::loop() {
   // 关键逻辑：业务 WebServer 只在用户主动开启“系统设置”热点时监听，
   // 避免设备连接家庭 WiFi 同步天气期间把配置接口暴露到局域网。
-  if (conn != nullptr && conn->isSystemPortalActive()) {
-    if (!serverStarted) {
-      server.begin();
-      serverStarted = true;
-      Serial.printf("System web server started on port %u\n",
-                    ConfigPortal::SYSTEM_WEB_PORT);
-    }
+  // UI 循环这里只负责唤醒服务任务，请求处理和文件流都在独立任务中完成，
+  // 下载/上传大文件时不再阻塞刷屏和按键。
+  if (serverTask == nullptr || serverStarted || conn == nullptr ||
+      !conn->isSystemPortalActive()) {
+    return;
+  }
+  serverStarted = true;
+  xTaskNotifyGive(serverTask);
+}
+
+void WebManager::lockState() const {
+  if (stateMutex != nullptr) {
+    xSemaphoreTakeRecursive(stateMutex, portMAX_DELAY);
+  }
+}
+
+void WebManager::unlockState() const {
+  if (stateMutex != nullptr) {
+    xSemaphoreGiveRecursive(stateMutex);
+  }
+}
+
+void WebManager::publishStatus(const DeviceStatus &status) {
+  statusEvents.publishDevice(status);
+}
+
+void WebManager::serverTaskEntry(void *param) {
+  WebManager *self = static_cast<WebManager *>(param);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->serveWhilePortalActive();
+  }
+}
+
+void WebManager::serveWhilePortalActive() {
+  server.begin();
+  Serial.printf("System web server started on port %u\n",
+                ConfigPortal::SYSTEM_WEB_PORT);
+  // 同步 WebServer 一次只处理一个连接，其余连接停留在监听队列，
+  // 因此并发连接数天然有界，单个慢客户端也只占用本任务。
+  while (conn->isSystemPortalActive()) {
     server.handleClient();
+    statusEvents.service(millis());
+    vTaskDelay(pdMS_TO_TICKS(WEB_SERVER_POLL_MS));
+  }
+  statusEvents.closeAll();
+  abortUpload();
+  abortRingtoneConvert();
+  server.stop();
+  serverStarted = false;
+  Serial.println("System web server stopped");
+}
+
+void WebManager::handleStateRoute(void (WebManager::*handler)()) {
+  if (!authorizeRequest()) {
     return;
   }
-  if (serverStarted) {
-    abortUpload();
-    server.stop();
-    serverStarted = false;
-    Serial.println("System web server stopped");
+  // 待办、闹钟和配置同时被 UI 主循环读写，接口处理期间持有状态锁。
+  lockState();
+  (this->*handler)();
+  unlockState();
+}
+
+void WebManager::handleFileRoute(void (WebManager::*handler)()) {
+  // 文件接口不持有状态锁，只在每次 SD 访问时短暂占用共享 SPI 总线。
+  if (authorizeRequest()) {
+    (this->*handler)();
   }
 }
 
 void WebManager::registerRoutes() {
-  server.on("/", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleRoot(); });
+  for (size_t i = 0; i < SYSTEM_WEB_ASSET_COUNT; ++i) {
+    const SystemWebAsset *asset = &SYSTEM_WEB_ASSETS[i];
+    server.on(asset->path, HTTP_GET, [this, asset]() {
+      if (authorizeRequest())
+        handleStaticAsset(*asset);
+    });
+  }
   server.on("/api/todos", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleGetTodos(); });
+            [this]() { handleStateRoute(&WebManager::handleGetTodos); });
   server.on("/api/todos", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleSaveTodos(); });
+            [this]() { handleStateRoute(&WebManager::handleSaveTodos); });
   server.on("/api/alarms", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleGetAlarms(); });
+            [this]() { handleStateRoute(&WebManager::handleGetAlarms); });
   server.on("/api/alarms", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleSaveAlarms(); });
+            [this]() { handleStateRoute(&WebManager::handleSaveAlarms); });
   server.on("/api/radio", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleGetRadio(); });
+            [this]() { handleStateRoute(&WebManager::handleGetRadio); });
   server.on("/api/radio", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleSaveRadio(); });
-  server.on("/api/api-settings", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleGetApiSettings(); });
-  server.on("/api/api-settings", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleSaveApiSettings(); });
+            [this]() { handleStateRoute(&WebManager::handleSaveRadio); });
+  server.on("/api/api-settings", HTTP_GET, [this]() {
+    handleStateRoute(&WebManager::handleGetApiSettings);
+  });
+  server.on("/api/api-settings", HTTP_POST, [this]() {
+    handleStateRoute(&WebManager::handleSaveApiSettings);
+  });
+  server.on("/api/config/batch", HTTP_POST, [this]() {
+    handleStateRoute(&WebManager::handleSaveConfigBatch);
+  });
+  server.on("/api/music/seek", HTTP_POST,
+            [this]() { handleStateRoute(&WebManager::handleMusicSeek); });
+  server.on("/api/events", HTTP_GET, [this]() {
+    if (authorizeRequest())
+      handleStatusEvents();
+  });
+  server.on("/metrics", HTTP_GET, [this]() {
+    if (authorizeRequest())
+      handleMetrics();
+  });
   server.on("/api/files", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleListFiles(); });
+            [this]() { handleFileRoute(&WebManager::handleListFiles); });
   server.on("/api/files/download", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleDownloadFile(); });
+            [this]() { handleFileRoute(&WebManager::handleDownloadFile); });
   server.on("/api/files/rename", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleRenameFile(); });
+            [this]() { handleFileRoute(&WebManager::handleRenameFile); });
   server.on("/api/files/trash", HTTP_POST,
-            [this]() { if (authorizeRequest()) handleTrashFile(); });
+            [this]() { handleFileRoute(&WebManager::handleTrashFile); });
   server.on("/api/ringtones", HTTP_GET,
-            [this]() { if (authorizeRequest()) handleGetRingtones(); });
+            [this]() { handleFileRoute(&WebManager::handleGetRingtones); });
+  server.on("/api/ringtones/convert", HTTP_POST,
+            [this]() { if (authorizeRequest()) handleRingtoneConvertDone(); },
+            [this]() { if (isSystemClient()) handleRingtoneConvert(); });
+  server.on("/api/sd/benchmark", HTTP_GET,
+            [this]() { handleFileRoute(&WebManager::handleGetSDBenchmark); });
+  server.on("/api/sd/benchmark", HTTP_POST,
+            [this]() { handleFileRoute(&WebManager::handleRunSDBenchmark); });
+  server.on("/api/files/upload/status", HTTP_GET,
+            [this]() { handleFileRoute(&WebManager::handleUploadStatus); });
   server.on("/api/files/upload", HTTP_POST,
             [this]() { if (authorizeRequest()) handleUploadDone(); },
             [this]() { if (isSystemClient()) handleFileUpload(); });
@@ -73,8 +276,36 @@ void WebManager::registerRoutes() {
       });
 }
 
-void WebManager::handleRoot() {
-  server.send_P(200, "text/html; charset=utf-8", SYSTEM_WEB_PAGE);
+void WebManager::handleStaticAsset(const SystemWebAsset &asset) {
+  // 关键逻辑：页面入口 "/" 用 no-cache，固件升级后浏览器下一次访问就会
+  // 重新验证并拿到新页面；其余静态资源直接长缓存。两者都带强 ETag，
+  // 重复访问只需一个 304，不再每次经热点重传整页。
+  bool isPage = strcmp(asset.path, "/") == 0;
+  // 只有声明接受 gzip 的客户端才拿压缩体，其余回退原文；两种表示的
+  // ETag 不同，并用 Vary 告诉中间缓存按 Accept-Encoding 区分。
+  bool gzip = server.hasHeader("Accept-Encoding") &&
+              AcceptEncoding::allowsGzip(
+                  server.header("Accept-Encoding").c_str());
+  const char *etag = gzip ? asset.etag : asset.plainEtag;
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Vary", "Accept-Encoding");
+  server.sendHeader("Cache-Control",
+                    isPage ? WEB_PAGE_CACHE_CONTROL : WEB_ASSET_CACHE_CONTROL);
+  if (server.hasHeader("If-None-Match") &&
+      server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
+  }
+  if (gzip) {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.contentType,
+                  reinterpret_cast<const char *>(asset.gzipData),
+                  asset.gzipLength);
+    return;
+  }
+  server.send_P(200, asset.contentType,
+                reinterpret_cast<const char *>(asset.plainData),
+                asset.plainLength);
 }
 
 void WebManager::handleGetTodos() {
@@ -111,13 +342,13 @@ void WebManager::handleGetRadio() {
   doc["mono"] = configMgr->config.radio_force_mono;
   doc["softMute"] = configMgr->config.radio_soft_mute;
   JsonArray stations = doc["stations"].to<JsonArray>();
-  for (int i = 0; i < RADIO_PRESET_COUNT; ++i) {
-    if (configMgr->config.radio_presets[i] == 0)
+  for (uint8_t i = 0; i < RADIO_PRESET_COUNT; ++i) {
+    uint16_t frequency = configMgr->getRadioPreset(i);
+    if (frequency == 0)
       continue;
     JsonObject item = stations.add<JsonObject>();
-    item["frequency"] = configMgr->config.radio_presets[i];
-    item["name"] =
-        configMgr->getRadioName(configMgr->config.radio_presets[i]);
+    item["frequency"] = frequency;
+    item["name"] = configMgr->getRadioName(frequency);
   }
   String json;
   serializeJson(doc, json);
@@ -126,49 +357,82 @@ void WebManager::handleGetRadio() {
 
 void WebManager::handleSaveRadio() {
   JsonDocument doc;
-  if (!parseBody(doc)) {
+  if (!parseBody(doc, CONFIG_BODY_LIMIT) || !doc.is<JsonObject>()) {
     sendResult(400, false, "Radio data is invalid");
     return;
   }
-  int step = doc["step"] | 10;
-  int threshold = doc["threshold"] | 8;
-  if ((step != 10 && step != 20 && step != 50 && step != 100) ||
-      threshold < 0 || threshold > 15) {
-    sendResult(400, false, "Radio range is invalid");
+  std::unique_ptr<RadioSettings> staged(new (std::nothrow) RadioSettings);
+  if (!staged) {
+    sendResult(503, false, "Not enough memory for radio settings");
+    return;
+  }
+  const char *error = stageRadio(doc.as<JsonObjectConst>(), *staged);
+  if (error != nullptr) {
+    sendResult(400, false, error);
+    return;
+  }
+  bool restored = true;
+  if (!configMgr->applyRadioSettings(*staged, restored)) {
+    sendResult(500, false,
+               restored ? "Radio settings could not be saved"
+                        : "Radio settings could not be saved or restored");
+    return;
+  }
+  sendResult(200, true, "Radio settings saved");
+}
+
+void WebManager::handleMusicSeek() {
+  JsonDocument doc;
+  if (!parseBody(doc, CONFIG_BODY_LIMIT) || !doc["position"].is<uint32_t>()) {
+    sendResult(400, false, "Seek position is invalid");
     return;
   }
-  if (!doc["stations"].is<JsonArray>() || doc["stations"].size() > 50) {
-    sendResult(400, false, "Station names are invalid");
+  // 关键逻辑：定位要读 SD 并重启解码，只能在 UI 线程执行；
+  // 这里只登记目标秒数，由 MusicManager::update() 取走后定位。
+  if (!music->requestSeek(doc["position"].as<uint32_t>())) {
+    sendResult(409, false, "No track selected");
     return;
   }
-  JsonArray stations = doc["stations"].as<JsonArray>();
-  for (JsonObject item : stations) {
+  sendResult(200, true, "Seek requested");
+}
+
+const char *WebManager::stageRadio(JsonObjectConst source,
+                                   RadioSettings &staged) {
+  int step = source["step"] | 10;
+  int threshold = source["threshold"] | 8;
+  if ((step != 10 && step != 20 && step != 50 && step != 100) ||
+      threshold < 0 || threshold > 15) {
+    return "Radio range is invalid";
+  }
+  if (!source["stations"].is<JsonArrayConst>() ||
+      source["stations"].size() > 50) {
+    return "Station names are invalid";
+  }
+  JsonArrayConst stations = source["stations"].as<JsonArrayConst>();
+  for (JsonObjectConst item : stations) {
     uint16_t frequency = item["frequency"] | 0;
     String name = item["name"] | "";
     if (frequency < 8750 || frequency > 10800 || frequency % 10 != 0 ||
         !isValidStationName(name)) {
-      sendResult(400, false, "Station name is invalid");
-      return;
+      return "Station name is invalid";
     }
   }
-  configMgr->config.radio_seek_step = step;
-  configMgr->config.radio_seek_threshold = threshold;
-  configMgr->config.radio_bass_boost = doc["bass"] | false;
-  configMgr->config.radio_force_mono = doc["mono"] | false;
-  configMgr->config.radio_soft_mute = doc["softMute"] | true;
-  for (JsonObject item : stations) {
+  configMgr->getRadioSettings(staged);
+  staged.seekStep = step;
+  staged.seekThreshold = threshold;
+  staged.bassBoost = source["bass"] | false;
+  staged.forceMono = source["mono"] | false;
+  staged.softMute = source["softMute"] | true;
+  // 关键逻辑：台名先在副本上分配槽位，存储已满时整份配置直接拒绝，
+  // 不再出现前半部分台名已改、后半部分失败的情况。
+  for (JsonObjectConst item : stations) {
     uint16_t frequency = item["frequency"] | 0;
     String name = item["name"] | "";
-    if (!configMgr->setRadioName(frequency, name)) {
-      sendResult(400, false, "Station name storage is full");
-      return;
+    if (!ConfigManager::assignRadioName(staged, frequency, name)) {
+      return "Station name storage is full";
     }
   }
-  if (!configMgr->saveRadioConfiguration()) {
-    sendResult(500, false, "Radio settings could not be saved");
-    return;
-  }
-  sendResult(200, true, "Radio settings saved");
+  return nullptr;
 }
 
 void WebManager::handleGetApiSettings() {
@@ -183,29 +447,51 @@ void WebManager::handleGetApiSettings() {
 
 void WebManager::handleSaveApiSettings() {
   JsonDocument doc;
-  if (!parseBody(doc)) {
+  if (!parseBody(doc, CONFIG_BODY_LIMIT) || !doc.is<JsonObject>()) {
     sendResult(400, false, "API settings are invalid");
     return;
   }
-  String weather = doc["weatherToken"] | "";
-  String previousWeather = configMgr->getWeatherApiToken();
-  String holiday = doc["holidayToken"] | "";
-  String previousHoliday = configMgr->getHolidayApiToken();
-  if (weather.length() > 160 || holiday.length() > 160) {
-    sendResult(400, false, "API token is too long");
+  ApiTokenUpdate staged;
+  const char *error = stageApiTokens(doc.as<JsonObjectConst>(), staged);
+  if (error != nullptr) {
+    sendResult(400, false, error);
     return;
   }
-  bool clearWeather = doc["clearWeather"] | false;
-  bool clearHoliday = doc["clearHoliday"] | false;
-  bool updateWeather = clearWeather || weather.length() > 0;
-  bool updateHoliday = clearHoliday || holiday.length() > 0;
-  String nextWeather = clearWeather ? "" : weather;
-  String nextHoliday = clearHoliday ? "" : holiday;
-  if (!configMgr->updateApiTokens(nextWeather, updateWeather, nextHoliday,
-                                  updateHoliday)) {
-    sendResult(500, false, "API settings could not be saved");
+  bool restored = true;
+  if (!applyApiTokens(staged, restored)) {
+    sendResult(500, false,
+               restored ? "API settings could not be saved"
+                        : "API settings could not be saved or restored");
     return;
   }
+  sendResult(200, true, "API settings saved");
+}
+
+const char *WebManager::stageApiTokens(JsonObjectConst source,
+                                       ApiTokenUpdate &staged) {
+  String weather = source["weatherToken"] | "";
+  String holiday = source["holidayToken"] | "";
+  if (weather.length() > 160 || holiday.length() > 160) {
+    return "API token is too long";
+  }
+  bool clearWeather = source["clearWeather"] | false;
+  bool clearHoliday = source["clearHoliday"] | false;
+  staged.updateWeather = clearWeather || weather.length() > 0;
+  staged.updateHoliday = clearHoliday || holiday.length() > 0;
+  staged.weather = clearWeather ? "" : weather;
+  staged.holiday = clearHoliday ? "" : holiday;
+  return nullptr;
+}
+
+bool WebManager::applyApiTokens(const ApiTokenUpdate &update,
+                                bool &restored) {
+  String previousWeather = configMgr->getWeatherApiToken();
+  String previousHoliday = configMgr->getHolidayApiToken();
+  if (!configMgr->updateApiTokens(update.weather, update.updateWeather,
+                                  update.holiday, update.updateHoliday,
+                                  restored)) {
+    return false;
+  }
   if (previousWeather != configMgr->getWeatherApiToken() &&
       weatherMgr != nullptr) {
     // 关键逻辑：天气 Token 更新后立刻解除重试节流，
@@ -214,86 +500,407 @@ void WebManager::handleSaveApiSettings() {
   }
   if (previousHoliday != configMgr->getHolidayApiToken())
     alarmMgr->resetHolidayFetchState();
-  sendResult(200, true, "API settings saved");
+  return true;
+}
+
+void WebManager::handleSaveConfigBatch() {
+  JsonDocument doc;
+  if (!parseBody(doc, BATCH_BODY_LIMIT) || !doc.is<JsonObject>()) {
+    sendResult(400, false, "Batch data is invalid");
+    return;
+  }
+  JsonObject root = doc.as<JsonObject>();
+  JsonVariant todosSection = root["todos"];
+  JsonVariant alarmsSection = root["alarms"];
+  JsonVariant radioSection = root["radio"];
+  JsonVariant apiSection = root["apiSettings"];
+  bool hasTodos = !todosSection.isNull();
+  bool hasAlarms = !alarmsSection.isNull();
+  bool hasRadio = !radioSection.isNull();
+  bool hasApi = !apiSection.isNull();
+  if (!hasTodos && !hasAlarms && !hasRadio && !hasApi) {
+    sendResult(400, false, "Batch is empty");
+    return;
+  }
+
+  // 第一阶段：整份文档全部校验、预演完毕才允许触碰任何持久化状态，
+  // 任一分区不合法都直接返回 400，设备上的配置保持原样。
+  std::vector<TodoConfig> todos;
+  std::vector<AlarmConfig> alarms;
+  // 电台副本连同回滚快照约 10KB，只在需要时从堆上分配。
+  std::unique_ptr<RadioSettings> radio;
+  std::unique_ptr<RadioSettings> previousRadio;
+  ApiTokenUpdate apiTokens;
+  if (hasTodos && (!todosSection.is<JsonArray>() ||
+                   !todoMgr->parseTodosJSON(todosSection.as<JsonArray>(),
+                                            todos))) {
+    sendResult(400, false, "Todo data is invalid");
+    return;
+  }
+  if (hasAlarms && (!alarmsSection.is<JsonArray>() ||
+                    !alarmMgr->parseAlarmsJSON(
+                        alarmsSection.as<JsonArray>(), alarms))) {
+    sendResult(400, false, "Alarm data is invalid");
+    return;
+  }
+  if (hasRadio) {
+    radio.reset(new (std::nothrow) RadioSettings);
+    previousRadio.reset(new (std::nothrow) RadioSettings);
+    if (!radio || !previousRadio) {
+      sendResult(503, false, "Not enough memory for radio settings");
+      return;
+    }
+  }
+  const char *error = nullptr;
+  if (hasRadio) {
+    error = radioSection.is<JsonObject>()
+                ? stageRadio(radioSection.as<JsonObjectConst>(), *radio)
+                : "Radio data is invalid";
+  }
+  if (error == nullptr && hasApi) {
+    error = apiSection.is<JsonObject>()
+                ? stageApiTokens(apiSection.as<JsonObjectConst>(), apiTokens)
+                : "API settings are invalid";
+  }
+  if (error != nullptr) {
+    sendResult(400, false, error);
+    return;
+  }
+
+  // 第二阶段：保存旧值快照后按顺序写入。NVS 每次 put 即提交，
+  // 中途失败时按相反顺序把已写入的分区恢复为快照，对外表现为全有或全无。
+  std::vector<TodoConfig> previousTodos = todoMgr->getTodoConfigs();
+  std::vector<AlarmConfig> previousAlarms = alarmMgr->getAlarmConfigs();
+  if (hasRadio) {
+    configMgr->getRadioSettings(*previousRadio);
+  }
+  bool todosApplied = false;
+  bool alarmsApplied = false;
+  bool radioApplied = false;
+  // 失败的那一步自己负责恢复已提交的键，restored 记录它是否恢复成功。
+  bool restored = true;
+  bool ok =
+      (!hasTodos || (todosApplied = todoMgr->applyTodos(todos))) &&
+      (!hasAlarms || (alarmsApplied = alarmMgr->applyAlarms(alarms))) &&
+      (!hasRadio ||
+       (radioApplied = configMgr->applyRadioSettings(*radio, restored))) &&
+      (!hasApi || applyApiTokens(apiTokens, restored));
+  if (ok) {
+    Serial.printf("[Web][batch] applied todos=%d alarms=%d radio=%d api=%d\n",
+                  hasTodos, hasAlarms, hasRadio, hasApi);
+    sendResult(200, true, "Configuration saved");
+    return;
+  }
+
+  // 关键逻辑：已成功的分区按相反顺序写回快照。待办与闹钟各只写一个键，
+  // 失败时不会留下半份数据；任何一步写回失败都如实告知客户端，
+  // 不再声称全有或全无。
+  bool radioRestored = true;
+  if (radioApplied &&
+      !configMgr->applyRadioSettings(*previousRadio, radioRestored)) {
+    restored = false;
+  }
+  if (alarmsApplied && !alarmMgr->applyAlarms(previousAlarms)) {
+    restored = false;
+  }
+  if (todosApplied && !todoMgr->applyTodos(previousTodos)) {
+    restored = false;
+  }
+  Serial.printf("[Web][batch] apply failed, restored=%d\n", restored);
+  sendResult(500, false,
+             restored ? "Configuration could not be saved"
+                      : "Configuration could not be saved or fully restored");
+}
+
+void WebManager::handleMetrics() {
+  // 堆信息只在抓取时采样，平时不为这些 gauge 付出任何开销。
+  Metrics::set(Metrics::HEAP_FREE_BYTES, ESP.getFreeHeap());
+  Metrics::set(Metrics::HEAP_MIN_FREE_BYTES, ESP.getMinFreeHeap());
+  Metrics::set(Metrics::HEAP_LARGEST_BLOCK_BYTES,
+               heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+  Metrics::set(Metrics::UPTIME_SECONDS, millis() / 1000);
+  String body;
+  body.reserve(METRICS_BODY_RESERVE);
+  Metrics::writePrometheus(body);
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "text/plain; version=0.0.4; charset=utf-8", body);
+}
+
+void WebManager::handleStatusEvents() {
+  uint32_t interval = server.hasArg("interval")
+                          ? static_cast<uint32_t>(server.arg("interval").toInt())
+                          : StatusEventStream::DEFAULT_INTERVAL_MS;
+  WiFiClient client = server.client();
+  if (!statusEvents.addClient(client, interval)) {
+    sendResult(503, false, "Too many event listeners");
+  }
 }
 
 void WebManager::handleListFiles() {
   String path = getRequestPath("path", "/");
-  if (!isSafePath(path) || !mountSD()) {
+  size_t offset = static_cast<size_t>(server.arg("offset").toInt());
+  long requestedLimit = server.hasArg("limit") ? server.arg("limit").toInt()
+                                               : LIST_DEFAULT_LIMIT;
+  size_t limit = requestedLimit <= 0 ? LIST_DEFAULT_LIMIT
+                                     : static_cast<size_t>(requestedLimit);
+  if (limit > LIST_MAX_LIMIT)
+    limit = LIST_MAX_LIMIT;
+
+  SDDirectoryCursor cursor;
+  bool opened = false;
+  {
+    SharedSPIBus::Guard spiGuard;
+    opened = isSafePath(path) && mountSD() && cursor.open(sd, path.c_str());
+    if (opened) {
+      cursor.skip(offset);
+    } else {
+      releaseSD();
+    }
+  }
+  if (!opened) {
     sendResult(400, false, "SD card or path is unavailable");
     return;
   }
-  std::vector<FileInfo> files = sd->listDir(path.c_str());
-  JsonDocument doc;
-  doc["path"] = path;
-  JsonArray items = doc["items"].to<JsonArray>();
-  for (const FileInfo &file : files) {
-    JsonObject item = items.add<JsonObject>();
-    item["name"] = file.name;
-    item["directory"] = file.isDirectory;
-    item["size"] = file.size;
+
+  // 关键逻辑：目录项边读边以 chunked 编码发出，不再把整个目录物化成
+  // vector 和 JsonDocument；内存占用只取决于单批缓冲，与目录大小无关。
+  ChunkedJsonWriter writer(server);
+  writer.begin();
+  writer.raw("{\"path\":");
+  writer.string(path.c_str());
+  writer.raw(",\"offset\":");
+  writer.number(offset);
+  writer.raw(",\"items\":[");
+  size_t count = 0;
+  bool more = true;
+  while (more && count < limit) {
+    // 关键逻辑：持锁只把一批目录项读进缓冲，释放总线后再编码发送；
+    // 客户端收得慢时只拖住 Web 任务，不会让刷屏和音频预读等总线。
+    size_t batch = 0;
+    {
+      SharedSPIBus::Guard spiGuard;
+      while (batch < LIST_ENTRIES_PER_LOCK && count + batch < limit) {
+        if (!cursor.next(listBatch[batch])) {
+          more = false;
+          break;
+        }
+        batch++;
+      }
+    }
+    for (size_t i = 0; i < batch; ++i, ++count) {
+      const DirEntry &entry = listBatch[i];
+      writer.raw(count == 0 ? "{\"name\":" : ",{\"name\":");
+      writer.string(entry.name);
+      writer.raw(entry.isDirectory ? ",\"directory\":true,\"size\":"
+                                   : ",\"directory\":false,\"size\":");
+      writer.number(entry.size);
+      writer.raw("}");
+    }
+    writer.flush();
   }
-  String json;
-  serializeJson(doc, json);
-  sd->end();
-  sendJson(200, json);
+  {
+    SharedSPIBus::Guard spiGuard;
+    // 多读一项判断是否还有下一页，下一页从 offset + count 继续。
+    more = more && cursor.next(listBatch[0]);
+    cursor.close();
+    releaseSD();
+  }
+  writer.raw("],\"next\":");
+  if (more) {
+    writer.number(offset + count);
+  } else {
+    writer.raw("null");
+  }
+  writer.raw("}");
+  writer.end();
 }
 
 void WebManager::handleDownloadFile() {
   String path = getRequestPath("path", "");
-  if (!isSafePath(path) || !mountSD()) {
-    sendResult(400, false, "File path is invalid");
+  File file;
+  int openStatus = 200;
+  {
+    SharedSPIBus::Guard spiGuard;
+    if (!isSafePath(path) || !mountSD()) {
+      openStatus = 400;
+    } else {
+      file = sd->open(path.c_str(), FILE_READ);
+      if (!file || file.isDirectory()) {
+        if (file)
+          file.close();
+        releaseSD();
+        openStatus = 404;
+      }
+    }
+  }
+  if (openStatus != 200) {
+    sendResult(openStatus, false,
+               openStatus == 400 ? "File path is invalid" : "File not found");
     return;
   }
-  File file = sd->open(path.c_str(), FILE_READ);
-  if (!file || file.isDirectory()) {
-    if (file)
+  size_t size = file.size();
+  String etag = buildFileEtag(size, file.getLastWrite());
+  size_t first = 0;
+  size_t last = size == 0 ? 0 : size - 1;
+  ByteRange::Result range = ByteRange::RANGE_NONE;
+  // 关键逻辑：If-Range 与当前 ETag 不一致说明文件已被替换，
+  // 必须返回完整文件，不能把新文件的片段拼接到客户端旧的半截下载上。
+  if (server.hasHeader("Range") &&
+      (!server.hasHeader("If-Range") || server.header("If-Range") == etag)) {
+    range =
+        ByteRange::parse(server.header("Range").c_str(), size, first, last);
+  }
+
+  server.sendHeader("Accept-Ranges", "bytes");
+  server.sendHeader("ETag", etag);
+  if (range == ByteRange::RANGE_UNSATISFIABLE) {
+    server.sendHeader("Content-Range", "bytes */" + String(size));
+    {
+      SharedSPIBus::Guard spiGuard;
       file.close();
-    sd->end();
-    sendResult(404, false, "File not found");
+      releaseSD();
+    }
+    sendResult(416, false, "Requested range not satisfiable");
     return;
   }
-  server.streamFile(file, getContentType(path));
-  file.close();
-  sd->end();
+
+  size_t length = size == 0 ? 0 : last - first + 1;
+  int status = 200;
+  if (range == ByteRange::RANGE_OK) {
+    status = 206;
+    server.sendHeader("Content-Range", "bytes " + String(first) + "-" +
+                                           String(last) + "/" +
+                                           String(size));
+  }
+  server.setContentLength(length);
+  server.send(status, getContentType(path), "");
+
+  uint32_t startMs = millis();
+  size_t sent = streamFileBody(file, first, length);
+  uint32_t elapsedMs = millis() - startMs;
+  {
+    SharedSPIBus::Guard spiGuard;
+    file.close();
+    releaseSD();
+  }
+  uint32_t kbps = elapsedMs == 0 ? 0
+                                 : static_cast<uint32_t>(
+                                       static_cast<uint64_t>(sent) * 1000ULL /
+                                       1024ULL / elapsedMs);
+  Serial.printf("[Web][download] %s status=%d range=%u-%u/%u sent=%u "
+                "ms=%lu rate=%luKB/s\n",
+                path.c_str(), status, static_cast<unsigned>(first),
+                static_cast<unsigned>(last),
+                static_cast<unsigned>(size), static_cast<unsigned>(sent),
+                static_cast<unsigned long>(elapsedMs),
+                static_cast<unsigned long>(kbps));
+}
+
+size_t WebManager::streamFileBody(File &file, size_t offset, size_t length) {
+  // 关键逻辑：不用 server.streamFile 一次性占住总线，而是按块读取，
+  // 每块读完立即释放 SPI，让 UI 刷屏可以穿插在下载过程中。
+  WiFiClient client = server.client();
+  size_t remaining = length;
+  size_t position = offset;
+  uint32_t lastProgressMs = millis();
+  {
+    SharedSPIBus::Guard spiGuard;
+    if (!file.seek(offset)) {
+      return 0;
+    }
+  }
+  while (remaining > 0 && client.connected()) {
+    // 首块只读到下一个 STREAM_CHUNK_SIZE 边界，之后每次读取都按整块对齐，
+    // 让 SD 驱动尽量走多扇区连续读而不是拆分的首尾扇区。
+    size_t want = STREAM_CHUNK_SIZE - position % STREAM_CHUNK_SIZE;
+    if (want > remaining) {
+      want = remaining;
+    }
+    size_t got = 0;
+    {
+      SharedSPIBus::Guard spiGuard;
+      got = file.read(streamBuffer, want);
+    }
+    if (got == 0) {
+      break;
+    }
+    size_t sent = 0;
+    while (sent < got && client.connected()) {
+      size_t written = client.write(streamBuffer + sent, got - sent);
+      if (written > 0) {
+        sent += written;
+        lastProgressMs = millis();
+      } else if (millis() - lastProgressMs > WEB_STREAM_STALL_TIMEOUT_MS) {
+        break;
+      } else {
+        vTaskDelay(1);
+      }
+    }
+    remaining -= sent;
+    position += sent;
+    Metrics::add(Metrics::WEB_TX_BYTES, static_cast<uint32_t>(sent));
+    if (sent < got) {
+      break;
+    }
+  }
+  return length - remaining;
 }
 
 void WebManager::handleRenameFile() {
   JsonDocument doc;
-  if (!parseBody(doc) || !mountSD()) {
+  if (!parseBody(doc, CONFIG_BODY_LIMIT)) {
     sendResult(400, false, "Rename request is invalid");
     return;
   }
   String from = doc["from"] | "";
   String to = doc["to"] | "";
-  bool ok = isSafePath(from) && isSafePath(to) && sd->exists(from.c_str());
-  if (ok && from == to) {
-    sd->end();
-    sendResult(200, true, "File name unchanged");
-    return;
-  }
-  if (ok && sd->exists(to.c_str())) {
-    sd->end();
-    sendResult(409, false, "Target file already exists");
-    return;
-  }
-  if (ok) {
-    ok = sd->rename(from.c_str(), to.c_str());
+  int status = 400;
+  const char *message = "Rename failed";
+  {
+    SharedSPIBus::Guard spiGuard;
+    if (!mountSD()) {
+      message = "Rename request is invalid";
+    } else {
+      bool valid =
+          isSafePath(from) && isSafePath(to) && sd->exists(from.c_str());
+      if (valid && from == to) {
+        status = 200;
+        message = "File name unchanged";
+      } else if (valid && sd->exists(to.c_str())) {
+        status = 409;
+        message = "Target file already exists";
+      } else if (valid && sd->rename(from.c_str(), to.c_str())) {
+        status = 200;
+        message = "File renamed";
+      }
+      releaseSD();
+    }
   }
-  sd->end();
-  sendResult(ok ? 200 : 400, ok, ok ? "File renamed" : "Rename failed");
+  sendResult(status, status == 200, message);
 }
 
 void WebManager::handleTrashFile() {
   JsonDocument doc;
-  if (!parseBody(doc) || !mountSD()) {
+  if (!parseBody(doc, CONFIG_BODY_LIMIT)) {
     sendResult(400, false, "Trash request is invalid");
     return;
   }
   String path = doc["path"] | "";
-  bool ok = isSafePath(path) && path != "/" && path != "/.trash" &&
-            sd->softDelete(path.c_str());
-  sd->end();
+  bool mounted = false;
+  bool ok = false;
+  {
+    SharedSPIBus::Guard spiGuard;
+    mounted = mountSD();
+    if (mounted) {
+      ok = isSafePath(path) && path != "/" && path != "/.trash" &&
+           sd->softDelete(path.c_str());
+      releaseSD();
+    }
+  }
+  if (!mounted) {
+    sendResult(400, false, "Trash request is invalid");
+    return;
+  }
   sendResult(ok ? 200 : 400, ok,
              ok ? "Moved to .trash" : "Move to trash failed");
 }
@@ -302,28 +909,84 @@ void WebManager::handleGetRingtones() {
   JsonDocument doc;
   JsonArray items = doc.to<JsonArray>();
   items.add("spiffs:/alarm.mp3");
-  if (mountSD()) {
-    for (const FileInfo &file : sd->listDir("/")) {
-      if (!file.isDirectory && file.name.endsWith(".mp3")) {
-        String path = file.name.startsWith("/") ? file.name
-                                                : "/" + file.name;
-        items.add("sd:" + path);
+  {
+    SharedSPIBus::Guard spiGuard;
+    SDDirectoryCursor cursor;
+    if (mountSD() && cursor.open(sd, "/")) {
+      DirEntry &entry = listBatch[0];
+      while (cursor.next(entry)) {
+        size_t length = strlen(entry.name);
+        if (!entry.isDirectory && length > 4 &&
+            (strcmp(entry.name + length - 4, ".mp3") == 0 ||
+             strcmp(entry.name + length - 4, ".rtn") == 0)) {
+          items.add(String("sd:/") + entry.name);
+        }
       }
+      cursor.close();
     }
-    sd->end();
+    releaseSD();
   }
   String json;
   serializeJson(doc, json);
   sendJson(200, json);
 }
 
+void WebManager::handleGetSDBenchmark() {
+  const SDBenchmarkResult &result = sd->getBenchmark();
+  JsonDocument doc;
+  doc["ok"] = true;
+  doc["valid"] = result.valid;
+  if (result.valid) {
+    JsonArray blocks = doc["blocks"].to<JsonArray>();
+    for (uint8_t i = 0; i < SDBenchmarkResult::BLOCK_SIZE_COUNT; ++i) {
+      JsonObject block = blocks.add<JsonObject>();
+      block["size"] = SDBenchmarkResult::BLOCK_SIZES[i];
+      block["writeKBps"] = result.writeKBps[i];
+      block["readKBps"] = result.readKBps[i];
+    }
+    doc["randomReadIops"] = result.randomReadIops;
+    doc["dirEntriesPerSec"] = result.dirEntriesPerSec;
+    doc["clockHz"] = result.clockHz;
+    doc["bufferSize"] = result.bufferSize;
+  }
+  String json;
+  serializeJson(doc, json);
+  sendJson(200, json);
+}
+
+void WebManager::handleRunSDBenchmark() {
+  // 测速独占 SD 与共享总线十几秒；本请求自身不持有挂载会话，
+  // 卡正被播放、闹铃或上传使用时由驱动拒绝。预唤醒需要总线预读铃声，
+  // 闹钟临近时不启动，避免响铃被测速拖住。
+  lockState();
+  bool ringing = alarmMgr->isRinging();
+  uint32_t wakeDelayMs =
+      ringing ? 0
+              : alarmMgr->getNextWakeDelayMs(rtc->getSoftwareTime(), millis());
+  unlockState();
+  if (ringing || wakeDelayMs < BENCHMARK_ALARM_GUARD_MS) {
+    sendResult(409, false, "Alarm is ringing or due soon");
+    return;
+  }
+  if (!sd->runBenchmark()) {
+    sendResult(409, false, "SD card is busy or benchmark failed");
+    return;
+  }
+  handleGetSDBenchmark();
+}
+
 void WebManager::handleFileUpload() {
   HTTPUpload &upload = server.upload();
   if (upload.status == UPLOAD_FILE_START) {
     uploadStarted = true;
     uploadFailed = false;
+    uploadComplete = false;
+    uploadError = nullptr;
     uploadTargetPath = "";
-    uploadFailed = !mountSD();
+    uploadId = getUploadId();
+    uploadOffset = 0;
+    uploadReceived = 0;
+    uint32_t crcSeed = 0;
     String directory = getRequestPath("path", "/");
     String filename = upload.filename;
     filename.replace("\\", "");
@@ -331,65 +994,405 @@ void WebManager::handleFileUpload() {
     String target = directory == "/" ? "/" + filename
                                      : directory + "/" + filename;
     uploadTargetPath = target;
-    uploadFailed = uploadFailed || !isSafePath(target);
-    // 覆盖文件前先移动到 .trash，上传失败时仍能恢复旧版本。
-    if (!uploadFailed && sd->exists(target.c_str()))
-      uploadFailed = !sd->softDelete(target.c_str());
-    if (!uploadFailed)
-      uploadFile = sd->open(target.c_str(), FILE_WRITE);
-    uploadFailed = uploadFailed || !uploadFile;
+    {
+      SharedSPIBus::Guard spiGuard;
+      uploadFailed = !mountSD() || !isSafePath(target);
+      if (!uploadFailed) {
+        uploadFailed = uploadId.length() > 0
+                           ? !openResumableUpload(target, crcSeed)
+                           : !openDirectUpload(target);
+      }
+    }
+    uploadFailed =
+        uploadFailed || !uploadWriter.start(uploadFile, uploadOffset, crcSeed);
   } else if (upload.status == UPLOAD_FILE_WRITE && !uploadFailed) {
-    if (upload.totalSize > 32UL * 1024UL * 1024UL) {
+    // WebServer 在回调返回后才把本块计入 totalSize，这里要加上当前块。
+    if (uploadOffset + upload.totalSize + upload.currentSize >
+        MAX_UPLOAD_BYTES) {
       uploadFailed = true;
+      uploadError = "File is larger than 32 MB";
       return;
     }
-    uploadFailed =
-        uploadFile.write(upload.buf, upload.currentSize) != upload.currentSize;
+    // 关键逻辑：这里只把分块拷入写入流水线，SD 写入由写入任务
+    // 按整块完成，Web 任务可以立即回去接收下一段网络数据。
+    uploadFailed = !uploadWriter.write(upload.buf, upload.currentSize);
+    Metrics::add(Metrics::WEB_RX_BYTES, upload.currentSize);
+    // 上传期间 handleClient 不会返回，进度事件在这里顺带推送。
+    statusEvents.publishUpload(true, uploadOffset + upload.totalSize);
+    statusEvents.service(millis());
   } else if (upload.status == UPLOAD_FILE_END ||
              upload.status == UPLOAD_FILE_ABORTED) {
     if (upload.status == UPLOAD_FILE_ABORTED)
       uploadFailed = true;
-    if (uploadFile)
-      uploadFile.close();
-    if (uploadFailed && sd->isMounted() && uploadTargetPath.length() > 0 &&
-        sd->exists(uploadTargetPath.c_str())) {
-      sd->softDelete(uploadTargetPath.c_str());
-    }
-    if (sd->isMounted())
-      sd->end();
+    completeUpload();
+    statusEvents.publishUpload(false, uploadOffset + upload.totalSize);
   }
 }
 
 void WebManager::handleUploadDone() {
   bool success = uploadStarted && !uploadFailed;
-  sendResult(success ? 200 : 400, success,
-             success ? "File uploaded" : "Upload failed");
+  bool partial = uploadId.length() > 0 && !uploadComplete;
+  const char *message = success ? (partial ? "Upload chunk stored"
+                                           : "File uploaded")
+                                : (uploadError != nullptr ? uploadError
+                                                          : "Upload failed");
+  JsonDocument doc;
+  doc["ok"] = success;
+  doc["message"] = message;
+  doc["received"] = uploadReceived;
+  doc["crc32"] = formatCrc32(uploadWriter.getCrc32());
+  doc["rateKBps"] = uploadWriter.getLastRateKBps();
+  if (uploadId.length() > 0) {
+    doc["uploadId"] = uploadId;
+    doc["complete"] = uploadComplete;
+  }
+  String json;
+  serializeJson(doc, json);
+  sendJson(success ? 200 : 400, json);
   uploadStarted = false;
   uploadFailed = false;
+  uploadComplete = false;
+  uploadError = nullptr;
   uploadTargetPath = "";
+  uploadId = "";
 }
 
-void WebManager::abortUpload() {
-  if (!uploadStarted) {
+void WebManager::handleUploadStatus() {
+  String id = getUploadId();
+  size_t received = 0;
+  uint32_t crc = 0;
+  String target;
+  bool known = false;
+  if (id.length() > 0) {
+    SharedSPIBus::Guard spiGuard;
+    if (mountSD()) {
+      known = loadUploadMeta(id, received, crc, target);
+      releaseSD();
+    }
+  }
+  JsonDocument doc;
+  doc["ok"] = true;
+  doc["uploadId"] = id;
+  doc["known"] = known;
+  doc["received"] = received;
+  doc["crc32"] = formatCrc32(crc);
+  doc["path"] = target;
+  doc["lastRateKBps"] = uploadWriter.getLastRateKBps();
+  String json;
+  serializeJson(doc, json);
+  sendJson(200, json);
+}
+
+void WebManager::handleRingtoneConvert() {
+  // 设备上没有把 MP3 解成 PCM 的接口，页面先用浏览器解码并重采样为
+  // 单声道 16 位小端 PCM，这里只做一次 ADPCM 编码并落盘。
+  HTTPUpload &upload = server.upload();
+  if (upload.status == UPLOAD_FILE_START) {
+    ringtoneStarted = true;
+    ringtoneFailed = !startRingtoneConvert();
+  } else if (upload.status == UPLOAD_FILE_WRITE && !ringtoneFailed) {
+    ringtoneInputBytes += upload.currentSize;
+    Metrics::add(Metrics::WEB_RX_BYTES, upload.currentSize);
+    if (ringtoneInputBytes / 2 > ringtoneSampleRate * RINGTONE_MAX_SECONDS) {
+      ringtoneFailed = true;
+      ringtoneError = "Ringtone is longer than 3 minutes";
+      return;
+    }
+    const uint8_t *data = upload.buf;
+    size_t remaining = upload.currentSize;
+    while (remaining > 0 && !ringtoneFailed) {
+      bool ready = false;
+      size_t used =
+          ringtoneEncoder.consume(data, remaining, ringtoneBlock, ready);
+      data += used;
+      remaining -= used;
+      if (ready) {
+        SharedSPIBus::Guard spiGuard;
+        ringtoneFailed = ringtoneFile.write(ringtoneBlock,
+                                            sizeof(ringtoneBlock)) !=
+                         sizeof(ringtoneBlock);
+      }
+    }
+  } else if (upload.status == UPLOAD_FILE_END ||
+             upload.status == UPLOAD_FILE_ABORTED) {
+    finishRingtoneConvert(upload.status == UPLOAD_FILE_ABORTED);
+  }
+}
+
+bool WebManager::startRingtoneConvert() {
+  ringtoneError = nullptr;
+  ringtoneInputBytes = 0;
+  ringtoneTargetPath = "";
+  String name = server.arg("name");
+  name.replace("\\", "");
+  name.replace("/", "");
+  name.trim();
+  long rate = server.hasArg("rate") ? server.arg("rate").toInt()
+                                    : RINGTONE_DEFAULT_RATE;
+  if (name.length() == 0 || rate < 8000 || rate > 48000) {
+    ringtoneError = "Ringtone name or sample rate is invalid";
+    return false;
+  }
+  ringtoneSampleRate = static_cast<uint32_t>(rate);
+  ringtoneTargetPath = "/" + name + ".rtn";
+  String tempPath = ringtoneTargetPath + RINGTONE_TEMP_SUFFIX;
+
+  SharedSPIBus::Guard spiGuard;
+  if (!mountSD() || !isSafePath(ringtoneTargetPath)) {
+    return false;
+  }
+  ringtoneFile = sd->open(tempPath.c_str(), FILE_WRITE);
+  if (!ringtoneFile) {
+    return false;
+  }
+  // 先写占位头部，采样总数在编码结束后回填。
+  uint8_t header[RingtoneCodec::HEADER_SIZE] = {};
+  ringtoneEncoder.begin();
+  return ringtoneFile.write(header, sizeof(header)) == sizeof(header);
+}
+
+void WebManager::finishRingtoneConvert(bool aborted) {
+  if (aborted) {
+    ringtoneFailed = true;
+  }
+  String tempPath = ringtoneTargetPath + RINGTONE_TEMP_SUFFIX;
+  SharedSPIBus::Guard spiGuard;
+  if (ringtoneFile) {
+    if (!ringtoneFailed && ringtoneEncoder.flush(ringtoneBlock)) {
+      ringtoneFailed = ringtoneFile.write(ringtoneBlock,
+                                          sizeof(ringtoneBlock)) !=
+                       sizeof(ringtoneBlock);
+    }
+    if (!ringtoneFailed && ringtoneEncoder.getSampleCount() == 0) {
+      ringtoneFailed = true;
+      ringtoneError = "Ringtone contains no audio";
+    }
+    if (!ringtoneFailed) {
+      RingtoneCodec::Header header = {RingtoneCodec::FORMAT_IMA_ADPCM, 1,
+                                      ringtoneSampleRate,
+                                      ringtoneEncoder.getSampleCount()};
+      uint8_t raw[RingtoneCodec::HEADER_SIZE];
+      RingtoneCodec::writeHeader(header, raw);
+      ringtoneFailed = !ringtoneFile.seek(0) ||
+                       ringtoneFile.write(raw, sizeof(raw)) != sizeof(raw);
+    }
+    ringtoneFile.close();
+  }
+  if (sdSessionHeld && ringtoneTargetPath.length() > 0) {
+    // 覆盖同名铃声前先移入 .trash，与普通上传保持一致。
+    if (!ringtoneFailed && sd->exists(ringtoneTargetPath.c_str()) &&
+        !sd->softDelete(ringtoneTargetPath.c_str())) {
+      ringtoneFailed = true;
+    }
+    if (!ringtoneFailed &&
+        !sd->rename(tempPath.c_str(), ringtoneTargetPath.c_str())) {
+      ringtoneFailed = true;
+    }
+    if (ringtoneFailed && sd->exists(tempPath.c_str())) {
+      sd->remove(tempPath.c_str());
+    }
+  }
+  releaseSD();
+  Serial.printf("[Web][ringtone] %s in=%lu samples=%lu rate=%lu %s\n",
+                ringtoneTargetPath.c_str(),
+                static_cast<unsigned long>(ringtoneInputBytes),
+                static_cast<unsigned long>(ringtoneEncoder.getSampleCount()),
+                static_cast<unsigned long>(ringtoneSampleRate),
+                ringtoneFailed ? "failed" : "ok");
+}
+
+void WebManager::handleRingtoneConvertDone() {
+  bool success = ringtoneStarted && !ringtoneFailed;
+  JsonDocument doc;
+  doc["ok"] = success;
+  doc["message"] = success ? "Ringtone converted"
+                   : ringtoneError != nullptr ? ringtoneError
+                                              : "Ringtone conversion failed";
+  if (success) {
+    doc["ringtone"] = "sd:" + ringtoneTargetPath;
+    doc["samples"] = ringtoneEncoder.getSampleCount();
+    doc["sampleRate"] = ringtoneSampleRate;
+  }
+  String json;
+  serializeJson(doc, json);
+  sendJson(success ? 200 : 400, json);
+  ringtoneStarted = false;
+  ringtoneFailed = false;
+  ringtoneError = nullptr;
+}
+
+void WebManager::abortRingtoneConvert() {
+  if (!ringtoneStarted) {
     return;
   }
-  if (uploadFile) {
-    uploadFile.close();
+  if (ringtoneFile) {
+    finishRingtoneConvert(true);
   }
-  if (sd->isMounted() && uploadTargetPath.length() > 0 &&
-      sd->exists(uploadTargetPath.c_str())) {
-    sd->softDelete(uploadTargetPath.c_str());
+  ringtoneStarted = false;
+  ringtoneFailed = false;
+  ringtoneError = nullptr;
+}
+
+void WebManager::abortUpload() {
+  if (!uploadStarted) {
+    return;
   }
-  if (sd->isMounted()) {
-    sd->end();
+  if (uploadFile || uploadWriter.isActive()) {
+    uploadFailed = true;
+    completeUpload();
   }
   uploadStarted = false;
   uploadFailed = false;
+  uploadComplete = false;
+  uploadError = nullptr;
   uploadTargetPath = "";
+  uploadId = "";
 }
 
-bool WebManager::parseBody(JsonDocument &doc) {
-  if (!server.hasArg("plain") || server.arg("plain").length() > 8192)
+bool WebManager::openDirectUpload(const String &target) {
+  // 覆盖文件前先移动到 .trash，上传失败时仍能恢复旧版本。
+  if (sd->exists(target.c_str()) && !sd->softDelete(target.c_str()))
+    return false;
+  uploadFile = sd->open(target.c_str(), FILE_WRITE);
+  return static_cast<bool>(uploadFile);
+}
+
+bool WebManager::openResumableUpload(const String &target,
+                                     uint32_t &crcSeed) {
+  if (!sd->exists(UPLOAD_STAGING_DIR) && !sd->mkdir(UPLOAD_STAGING_DIR))
+    return false;
+  size_t requested = static_cast<size_t>(server.arg("offset").toInt());
+  size_t received = 0;
+  String metaTarget;
+  String partPath = getUploadPartPath(uploadId);
+  // 关键逻辑：续传只接受从元数据记录的已落盘偏移继续，目标路径也必须一致；
+  // 否则客户端的 CRC 与设备端会错位，合并出的文件无法校验。
+  if (loadUploadMeta(uploadId, received, crcSeed, metaTarget)) {
+    if (metaTarget != target || requested != received) {
+      uploadError = "Upload offset does not match";
+      return false;
+    }
+    uploadFile = sd->open(partPath.c_str(), "r+");
+    if (!uploadFile || !uploadFile.seek(received)) {
+      return false;
+    }
+  } else {
+    if (requested != 0) {
+      uploadError = "Upload id is unknown";
+      return false;
+    }
+    crcSeed = 0;
+    uploadFile = sd->open(partPath.c_str(), FILE_WRITE);
+  }
+  uploadOffset = received;
+  return static_cast<bool>(uploadFile);
+}
+
+void WebManager::completeUpload() {
+  bool writerStarted = uploadWriter.isActive();
+  if (writerStarted && !uploadWriter.finish())
+    uploadFailed = true;
+  uploadReceived =
+      uploadOffset + (writerStarted ? uploadWriter.getCommittedBytes() : 0);
+
+  SharedSPIBus::Guard spiGuard;
+  if (uploadFile)
+    uploadFile.close();
+  if (uploadId.length() > 0) {
+    // 续传：无论本段是否成功都记录已落盘的字节数和 CRC，
+    // 客户端查询状态后从该偏移继续，不必从头重传。
+    if (writerStarted && sdSessionHeld) {
+      saveUploadMeta(uploadId, uploadReceived, uploadWriter.getCrc32(),
+                     uploadTargetPath);
+    }
+    if (!uploadFailed && server.arg("final") == "1")
+      finalizeResumableUpload();
+  } else if (uploadFailed && sdSessionHeld &&
+             uploadTargetPath.length() > 0 &&
+             sd->exists(uploadTargetPath.c_str())) {
+    sd->softDelete(uploadTargetPath.c_str());
+  }
+  releaseSD();
+}
+
+void WebManager::finalizeResumableUpload() {
+  String partPath = getUploadPartPath(uploadId);
+  File part = sd->open(partPath.c_str(), FILE_READ);
+  size_t partSize = part ? part.size() : 0;
+  if (part)
+    part.close();
+  if (partSize != uploadReceived) {
+    uploadFailed = true;
+    uploadError = "Staged upload size does not match";
+    return;
+  }
+  if (sd->exists(uploadTargetPath.c_str()) &&
+      !sd->softDelete(uploadTargetPath.c_str())) {
+    uploadFailed = true;
+    return;
+  }
+  if (!sd->rename(partPath.c_str(), uploadTargetPath.c_str())) {
+    uploadFailed = true;
+    return;
+  }
+  sd->remove(getUploadMetaPath(uploadId).c_str());
+  uploadComplete = true;
+}
+
+bool WebManager::loadUploadMeta(const String &id, size_t &received,
+                                uint32_t &crc, String &target) {
+  String metaPath = getUploadMetaPath(id);
+  if (!sd->exists(metaPath.c_str()))
+    return false;
+  // 元数据格式：<已落盘字节> <crc32 十六进制> <目标路径>
+  String meta = sd->readFile(metaPath.c_str());
+  int first = meta.indexOf(' ');
+  int second = first < 0 ? -1 : meta.indexOf(' ', first + 1);
+  if (second < 0)
+    return false;
+  received = static_cast<size_t>(strtoul(meta.substring(0, first).c_str(),
+                                          nullptr, 10));
+  crc = strtoul(meta.substring(first + 1, second).c_str(), nullptr, 16);
+  target = meta.substring(second + 1);
+  target.trim();
+  return isSafePath(target);
+}
+
+bool WebManager::saveUploadMeta(const String &id, size_t received,
+                                uint32_t crc, const String &target) {
+  String meta = String(static_cast<unsigned long>(received)) + " " +
+                formatCrc32(crc) + " " + target;
+  return sd->writeFile(getUploadMetaPath(id).c_str(), meta.c_str());
+}
+
+String WebManager::getUploadId() {
+  String id = server.arg("uploadId");
+  if (id.length() == 0 || id.length() > 32)
+    return "";
+  for (size_t i = 0; i < id.length(); ++i) {
+    char c = id[i];
+    if (!isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_')
+      return "";
+  }
+  return id;
+}
+
+String WebManager::getUploadPartPath(const String &id) const {
+  return String(UPLOAD_STAGING_DIR) + "/" + id + ".part";
+}
+
+String WebManager::getUploadMetaPath(const String &id) const {
+  return String(UPLOAD_STAGING_DIR) + "/" + id + ".meta";
+}
+
+String WebManager::formatCrc32(uint32_t crc) {
+  char text[9];
+  snprintf(text, sizeof(text), "%08lx", static_cast<unsigned long>(crc));
+  return String(text);
+}
+
+bool WebManager::parseBody(JsonDocument &doc, size_t maxLength) {
+  if (!server.hasArg("plain") || server.arg("plain").length() > maxLength)
     return false;
   return deserializeJson(doc, server.arg("plain")) == DeserializationError::Ok;
 }
@@ -417,7 +1420,19 @@ bool WebManager::isSystemClient() {
 }
 
 bool WebManager::mountSD() {
-  return sd != nullptr && !alarmMgr->isRinging() && sd->begin();
+  // 同一请求内重复调用只持有一次引用；卸载交给 SD 空闲超时，
+  // 连续的列表、下载和分块上传请求复用同一次挂载。
+  if (!sdSessionHeld && sd != nullptr && !alarmMgr->isRinging()) {
+    sdSessionHeld = sd->acquire();
+  }
+  return sdSessionHeld;
+}
+
+void WebManager::releaseSD() {
+  if (sdSessionHeld) {
+    sdSessionHeld = false;
+    sd->release();
+  }
 }
 
 bool WebManager::isSafePath(const String &path) const {
@@ -465,7 +1480,7 @@ bool WebManager::isValidStationName(const String &name) const {
     }
     i += width;
   }
-  return characters <= 24;
+  return characters <= RadioPresetStore::MAX_NAME_CHARS;
 }
 
 String WebManager::getRequestPath(const char *name,
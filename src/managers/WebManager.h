@@ -1,22 +1,46 @@
 #pragma once
 
+#include "../drivers/RtcDriver.h"
 #include "../drivers/SDCardDriver.h"
+#include "../utils/RingtoneCodec.h"
 #include "AlarmManager.h"
 #include "ConfigManager.h"
 #include "ConnectionManager.h"
+#include "MusicManager.h"
+#include "StatusEventStream.h"
 #include "TodoManager.h"
+#include "UploadWriter.h"
 #include "WeatherManager.h"
 #include <WebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+struct SystemWebAsset;
 
 class WebManager {
 public:
   WebManager(TodoManager *todo, AlarmManager *alarm, ConfigManager *config,
              SDCardDriver *sd, ConnectionManager *conn,
-             WeatherManager *weather);
+             WeatherManager *weather, RtcDriver *rtc, MusicManager *music);
   void begin();
   void loop();
+  void lockState() const;
+  void unlockState() const;
+  void publishStatus(const DeviceStatus &status);
+  bool hasStatusListeners() const { return statusEvents.hasClients(); }
 
 private:
+  static constexpr size_t STREAM_CHUNK_SIZE = 8192;
+  static constexpr size_t LIST_ENTRIES_PER_LOCK = 16;
+
+  struct ApiTokenUpdate {
+    String weather;
+    bool updateWeather;
+    String holiday;
+    bool updateHoliday;
+  };
+
   WebServer server;
   TodoManager *todoMgr;
   AlarmManager *alarmMgr;
@@ -24,14 +48,47 @@ private:
   SDCardDriver *sd;
   ConnectionManager *conn;
   WeatherManager *weatherMgr;
+  RtcDriver *rtc;
+  MusicManager *music;
   File uploadFile;
   bool uploadFailed = false;
   bool uploadStarted = false;
-  bool serverStarted = false;
+  bool uploadComplete = false;
+  volatile bool serverStarted = false;
+  bool sdSessionHeld = false;
   String uploadTargetPath;
+  String uploadId;
+  size_t uploadOffset = 0;
+  size_t uploadReceived = 0;
+  const char *uploadError = nullptr;
+  UploadWriter uploadWriter;
+  // 铃声转换：上传的 PCM 逐块编码为 ADPCM，先写临时文件，完成后改名。
+  File ringtoneFile;
+  bool ringtoneStarted = false;
+  bool ringtoneFailed = false;
+  const char *ringtoneError = nullptr;
+  String ringtoneTargetPath;
+  uint32_t ringtoneSampleRate = 0;
+  uint32_t ringtoneInputBytes = 0;
+  RingtoneCodec::AdpcmEncoder ringtoneEncoder;
+  uint8_t ringtoneBlock[RingtoneCodec::ADPCM_BLOCK_SIZE];
+  StatusEventStream statusEvents;
+  TaskHandle_t serverTask = nullptr;
+  mutable SemaphoreHandle_t stateMutex = nullptr;
+  // 下载分块与目录分批读取不会同时进行，共用同一块缓冲：都在持有
+  // 总线时读入这里，释放总线后再交给网络发送。
+  union {
+    uint8_t streamBuffer[STREAM_CHUNK_SIZE];
+    DirEntry listBatch[LIST_ENTRIES_PER_LOCK];
+  };
 
+  static void serverTaskEntry(void *param);
+  void serveWhilePortalActive();
+  void handleStateRoute(void (WebManager::*handler)());
+  void handleFileRoute(void (WebManager::*handler)());
+  size_t streamFileBody(File &file, size_t offset, size_t length);
   void registerRoutes();
-  void handleRoot();
+  void handleStaticAsset(const SystemWebAsset &asset);
   void handleGetTodos();
   void handleSaveTodos();
   void handleGetAlarms();
@@ -40,6 +97,13 @@ private:
   void handleSaveRadio();
   void handleGetApiSettings();
   void handleSaveApiSettings();
+  void handleSaveConfigBatch();
+  void handleMusicSeek();
+  const char *stageRadio(JsonObjectConst source, RadioSettings &staged);
+  const char *stageApiTokens(JsonObjectConst source, ApiTokenUpdate &staged);
+  bool applyApiTokens(const ApiTokenUpdate &update, bool &restored);
+  void handleStatusEvents();
+  void handleMetrics();
   void handleListFiles();
   void handleDownloadFile();
   void handleRenameFile();
@@ -47,11 +111,32 @@ private:
   void handleGetRingtones();
   void handleFileUpload();
   void handleUploadDone();
+  void handleUploadStatus();
+  void handleRingtoneConvert();
+  void handleRingtoneConvertDone();
+  void handleGetSDBenchmark();
+  void handleRunSDBenchmark();
+  bool startRingtoneConvert();
+  void finishRingtoneConvert(bool aborted);
+  void abortRingtoneConvert();
   void abortUpload();
-  bool parseBody(JsonDocument &doc);
+  bool openDirectUpload(const String &target);
+  bool openResumableUpload(const String &target, uint32_t &crcSeed);
+  void completeUpload();
+  void finalizeResumableUpload();
+  bool loadUploadMeta(const String &id, size_t &received, uint32_t &crc,
+                      String &target);
+  bool saveUploadMeta(const String &id, size_t received, uint32_t crc,
+                      const String &target);
+  String getUploadId();
+  String getUploadPartPath(const String &id) const;
+  String getUploadMetaPath(const String &id) const;
+  static String formatCrc32(uint32_t crc);
+  bool parseBody(JsonDocument &doc, size_t maxLength);
   bool authorizeRequest();
   bool isSystemClient();
   bool mountSD();
+  void releaseSD();
   bool isSafePath(const String &path) const;
   bool isValidStationName(const String &name) const;
   String getRequestPath(const char *name, const char *fallback);
@@ -21,6 +21,10 @@ public:
   virtual void enter() {}
   virtual void exit() {}
   virtual void update() {} // Called periodically
+  // 关键逻辑：UIManager 在共享状态锁内调用，页面把绘制要读、Web 任务又
+  // 可能改写的状态拷到自己的成员里；随后的 update/draw/输入处理不再持锁，
+  // 长时间刷屏期间 Web 接口也能照常读写闹钟和待办。
+  virtual void captureSharedState() {}
   // 关键逻辑：屏幕自己声明“最短空闲睡眠周期”，
   // 这样休眠调度和页面刷新节奏绑定，避免主循环硬编码 1 秒频繁睡醒。
   virtual uint32_t getIdleSleepIntervalMs() const { return 3600000UL; }
@@ -1,4 +1,6 @@
 #include "UIManager.h"
+#include "../drivers/SharedSPIBus.h"
+#include "../managers/NetworkEvents.h"
 #include "screens/AlarmScreen.h"
 #include "screens/CalendarScreen.h"
 #include "screens/HomeScreen.h"
@@ -62,7 +64,8 @@ UIManager::UIManager(DisplayDriver *disp, RtcDriver *rtc,
   statusBar = new StatusBar(conn, rtc, battery);
   todoMgr = new TodoManager();
 
-  webMgr = new WebManager(todoMgr, alarmMgr, config, sd, conn, weather);
+  webMgr = new WebManager(todoMgr, alarmMgr, config, sd, conn, weather, rtc,
+                          music);
 
   // Create Screens
   homeScreen = new HomeScreen(rtc, weather, sensor, statusBar, todoMgr, conn);
@@ -72,7 +75,7 @@ UIManager::UIManager(DisplayDriver *disp, RtcDriver *rtc,
   radioScreen = new RadioScreen(radio, statusBar, config);
   musicScreen = new MusicScreen(music, statusBar, config);
   weatherScreen = new WeatherScreen(weather, statusBar);
-  settingsScreen = new SettingsScreen(config, statusBar, battery, conn);
+  settingsScreen = new SettingsScreen(config, statusBar, battery, conn, sd);
   timerScreen = new TimerScreen(statusBar);
 
   // Set UIManager reference
@@ -99,6 +102,11 @@ void UIManager::init() {
 }
 
 void UIManager::update() {
+  captureScreenState();
+  // 关键逻辑：Web 服务任务会在另一核上读写 SD，页面 update 与状态栏局刷
+  // 都可能访问屏幕，需要整段持有共享 SPI 总线。
+  SharedSPIBus::Guard spiGuard(SharedSPIBus::WAIT_FOREVER,
+                               SharedSPIBus::DEVICE_DISPLAY);
   if (currentScreenObj) {
     drawing = true;
     currentScreenObj->update();
@@ -117,8 +125,47 @@ void UIManager::update() {
     }
   }
 
-  if (webMgr)
+  if (webMgr) {
+    publishWebStatus();
     webMgr->loop();
+  }
+}
+
+void UIManager::publishWebStatus() {
+  // 只有系统页订阅了事件流才采集状态，电池读取缓存值，不触发 I2C。
+  if (!webMgr->hasStatusListeners()) {
+    return;
+  }
+  DeviceStatus status;
+  status.screen = screenStateLabel(currentScreenState);
+  if (battery) {
+    const BatteryInfo &info = battery->getLastInfo();
+    status.batteryPercent = info.levelPercent;
+    status.batteryMillivolts = static_cast<uint16_t>(info.voltage * 1000.0f);
+  }
+  status.wifiConnected = conn && conn->isConnected();
+  status.weatherGeneration = weather ? weather->getGeneration() : 0;
+  status.alarmRinging = alarmMgr && alarmMgr->isRinging();
+  webMgr->publishStatus(status);
+}
+
+void UIManager::captureScreenState() {
+  if (currentScreenObj == nullptr) {
+    return;
+  }
+  lockSharedState();
+  currentScreenObj->captureSharedState();
+  unlockSharedState();
+}
+
+void UIManager::lockSharedState() const {
+  if (webMgr)
+    webMgr->lockState();
+}
+
+void UIManager::unlockSharedState() const {
+  if (webMgr)
+    webMgr->unlockState();
 }
 
 bool UIManager::canAcceptInput() const { return !drawing; }
@@ -140,6 +187,7 @@ bool UIManager::onInput(UIKey key) {
 
   Screen *screenBefore = currentScreenObj;
   ScreenState stateBefore = currentScreenState;
+  captureScreenState();
   if (!currentScreenObj->onInput(normalizedKey)) {
     return false;
   }
@@ -201,6 +249,8 @@ void UIManager::switchScreen(ScreenState state) {
   }
 
   currentScreenState = state;
+  // 天气刷新与设置页保持联网都取决于当前页面，切页后让网络任务立即重新判断。
+  NetworkEvents::notify(NetworkEvents::SCREEN_CHANGED);
 
   if (currentScreenObj) {
     currentScreenObj->enter();
@@ -213,6 +263,9 @@ void UIManager::drawCurrentScreen() {
     return;
   }
 
+  captureScreenState();
+  SharedSPIBus::Guard spiGuard(SharedSPIBus::WAIT_FOREVER,
+                               SharedSPIBus::DEVICE_DISPLAY);
   drawing = true;
   currentScreenObj->draw(display);
   drawing = false;
@@ -54,6 +54,8 @@ public:
   void onLongPressEnter();
   void switchScreen(ScreenState state);
   uint32_t getIdleSleepIntervalMs() const;
+  void lockSharedState() const;
+  void unlockSharedState() const;
 
   DisplayDriver *getDisplayDriver() { return display; }
   ScreenState getCurrentState() { return currentScreenState; }
@@ -92,7 +94,9 @@ private:
   TodoManager *todoMgr;
   WebManager *webMgr;
 
+  void captureScreenState();
   void drawCurrentScreen();
+  void publishWebStatus();
   bool shouldDrawAfterInput(Screen *screenBefore,
                             ScreenState stateBefore) const;
 };
@@ -21,6 +21,10 @@ void AlarmScreen::enter() {
   resetListState();
 }
 
+void AlarmScreen::captureSharedState() {
+  alarmView = alarmMgr->getAlarmConfigs();
+}
+
 void AlarmScreen::draw(DisplayDriver *display) {
   display->display.setFullWindow();
   display->display.firstPage();
@@ -72,7 +76,7 @@ void AlarmScreen::applyRepeatSelection() {
 void AlarmScreen::beginCreate() {
   resetEditorState();
   creatingAlarm = true;
-  editingIndex = alarmMgr->getAlarmCount();
+  editingIndex = alarmView.size();
   draftAlarm = alarmMgr->buildDefaultAlarm();
   setRepeatFocus();
   helperText = "回车选择字段，长按退出";
@@ -83,7 +87,7 @@ void AlarmScreen::beginEdit(size_t index) {
   resetEditorState();
   creatingAlarm = false;
   editingIndex = index;
-  draftAlarm = alarmMgr->getAlarm(index);
+  draftAlarm = alarmView[index];
   setRepeatFocus();
   helperText = "回车选择字段，长按退出";
   mode = MODE_EDITOR;
@@ -116,13 +120,16 @@ bool AlarmScreen::commitDraft() {
     return true;
   }
 
+  uiManager->lockSharedState();
   if (creatingAlarm) {
     alarmMgr->addAlarm(draftAlarm);
-    listFocus = alarmMgr->getAlarmCount() - 1;
   } else {
     alarmMgr->updateAlarm(editingIndex, draftAlarm);
-    listFocus = static_cast<int>(editingIndex);
   }
+  captureSharedState();
+  uiManager->unlockSharedState();
+  listFocus = creatingAlarm ? static_cast<int>(alarmView.size()) - 1
+                            : static_cast<int>(editingIndex);
 
   helperText = "回车编辑当前项，长按退出";
   mode = MODE_LIST;
@@ -145,7 +152,10 @@ void AlarmScreen::handleDeleteAction() {
     resetListState();
     return;
   }
+  uiManager->lockSharedState();
   alarmMgr->removeAlarm(editingIndex);
+  captureSharedState();
+  uiManager->unlockSharedState();
   resetListState();
   clampListFocus();
 }
@@ -200,7 +210,7 @@ bool AlarmScreen::handleListInput(UIKey key) {
 }
 
 bool AlarmScreen::isAlarmIndex(int itemIndex) const {
-  return itemIndex >= 0 && itemIndex < static_cast<int>(alarmMgr->getAlarmCount());
+  return itemIndex >= 0 && itemIndex < static_cast<int>(alarmView.size());
 }
 
 bool AlarmScreen::isEditorDayFocus() const {
@@ -10,6 +10,7 @@ public:
 
   void init() override;
   void enter() override;
+  void captureSharedState() override;
   void draw(DisplayDriver *display) override;
   bool onInput(UIKey key) override;
   bool shouldDrawAfterInput() const override { return false; }
@@ -32,6 +33,8 @@ private:
 
   AlarmManager *alarmMgr;
   StatusBar *statusBar;
+  // 闹钟列表副本：只在共享状态锁内刷新，绘制和焦点计算都读它。
+  std::vector<AlarmConfig> alarmView;
   AlarmScreenMode mode;
   AlarmConfig draftAlarm;
   String helperText;
@@ -185,7 +185,7 @@ void AlarmScreen::drawListRow(DisplayDriver *display, int itemIndex, int rowInde
   display->u8g2Fonts.setCursor(150, y + 21);
   display->u8g2Fonts.print(getListRowSubtitle(itemIndex));
   if (isAlarmIndex(itemIndex)) {
-    drawCheckbox(display, 344, y + 12, alarmMgr->getAlarm(itemIndex).enabled,
+    drawCheckbox(display, 344, y + 12, alarmView[itemIndex].enabled,
                  focused);
     display->u8g2Fonts.setCursor(150, y + 38);
     display->u8g2Fonts.print("回车编辑");
@@ -203,13 +203,13 @@ int AlarmScreen::getLastEditorFocus() const {
 int AlarmScreen::getActionRowCount() const { return 2; }
 
 int AlarmScreen::getAddIndex() const {
-  return static_cast<int>(alarmMgr->getAlarmCount());
+  return static_cast<int>(alarmView.size());
 }
 
 int AlarmScreen::getBackIndex() const { return getAddIndex() + 1; }
 
 int AlarmScreen::getItemCount() const {
-  return static_cast<int>(alarmMgr->getAlarmCount()) + getActionRowCount();
+  return static_cast<int>(alarmView.size()) + getActionRowCount();
 }
 
 String AlarmScreen::getListRowSubtitle(int itemIndex) const {
@@ -219,7 +219,7 @@ String AlarmScreen::getListRowSubtitle(int itemIndex) const {
   if (itemIndex == getBackIndex()) {
     return "返回菜单";
   }
-  return alarmMgr->getRepeatText(alarmMgr->getAlarm(itemIndex));
+  return alarmMgr->getRepeatText(alarmView[itemIndex]);
 }
 
 String AlarmScreen::getListRowTitle(int itemIndex) const {
@@ -229,7 +229,7 @@ String AlarmScreen::getListRowTitle(int itemIndex) const {
   if (itemIndex == getBackIndex()) {
     return "返回";
   }
-  return getTimeText(alarmMgr->getAlarm(itemIndex));
+  return getTimeText(alarmView[itemIndex]);
 }
 
 String AlarmScreen::getTimeText(const AlarmConfig &alarm) const {
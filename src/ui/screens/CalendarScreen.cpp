@@ -183,13 +183,14 @@ void CalendarScreen::drawWeatherPanel(DisplayDriver *displayDrv) {
   if (!weather)
     return;
 
+  weather->getSnapshot(weatherData);
   auto &u8g2 = displayDrv->u8g2Fonts;
   u8g2.setFont(u8g2_font_qweather_icon_16);
-  u8g2.drawUTF8(WEATHER_X, TOP_Y + 44, weather->data.icon_str);
+  u8g2.drawUTF8(WEATHER_X, TOP_Y + 44, weatherData.icon_str);
 
   u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-  String lineOne = buildWeatherLineOne(weather->data);
-  String lineTwo = buildWeatherLineTwo(weather->data);
+  String lineOne = buildWeatherLineOne(weatherData);
+  String lineTwo = buildWeatherLineTwo(weatherData);
   u8g2.setCursor(WEATHER_X + 28, TOP_Y + 22);
   u8g2.print(lineOne);
   u8g2.setCursor(WEATHER_X + 28, TOP_Y + 38);
@@ -392,7 +393,7 @@ CalendarScreen::DateParts CalendarScreen::getToday() const {
 }
 
 String CalendarScreen::buildWeatherLineOne(const WeatherData &data) {
-  String line = data.weather.length() == 0 ? "--" : data.weather;
+  String line = data.weather[0] == '\0' ? "--" : data.weather;
   line += " ";
   line += data.humidity;
   line += "%";
@@ -402,7 +403,7 @@ String CalendarScreen::buildWeatherLineOne(const WeatherData &data) {
 String CalendarScreen::buildWeatherLineTwo(const WeatherData &data) {
   String line = String(data.temp);
   line += "°C";
-  if (!data.daily.empty()) {
+  if (data.daily_count > 0) {
     line += " ";
     line += data.daily[0].temp_min;
     line += "-";
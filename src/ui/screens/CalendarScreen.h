@@ -41,6 +41,7 @@ private:
   StatusBar *statusBar;
   AlarmManager *alarmMgr;
   WeatherManager *weather;
+  WeatherData weatherData;
   uint16_t viewedYear = 2000;
   uint8_t viewedMonth = 1;
   uint32_t lastRenderedDateKey = 0;
@@ -97,12 +97,11 @@ public:
 
     refreshWeatherIfNeeded(displayDrv);
 
-    std::vector<TodoItem> tasks = todoMgr->getVisibleTodos(now);
-    bool tasksNeedUpdate =
-        (now.minute != lastTasksMinute) || (tasks.size() != lastTaskCount);
+    bool tasksNeedUpdate = (now.minute != lastTasksMinute) ||
+                           (visibleTasks.size() != lastTaskCount);
     if (tasksNeedUpdate) {
       renderTasksPartial(displayDrv);
-      lastTaskCount = tasks.size();
+      lastTaskCount = visibleTasks.size();
       lastTasksMinute = now.minute;
     }
 
@@ -116,6 +115,10 @@ public:
     refreshSensorIfNeeded(displayDrv, nowMs);
   }
 
+  void captureSharedState() override {
+    visibleTasks = todoMgr->getVisibleTodos(rtc->getSoftwareTime());
+  }
+
   bool onInput(UIKey key) override {
     // 关键逻辑：首页没有可移动光标，短 ENTER 不承担退出职责；
     // 退出/进入菜单统一交给 ENTER 长按，避免和其它页面手势不一致。
@@ -143,14 +146,13 @@ private:
   float lastTemp = -999;
   float lastHum = -999;
   uint32_t lastSensorCheck = 0;
-  int lastWeatherTemp = -999;
-  String lastWeatherStr = "";
-  String lastWeatherIcon = "";
-  int lastForecastTempHigh = -999;
-  int lastForecastTempLow = -999;
-  String lastForecastWeatherStr = "";
-  String lastForecastIcon = "";
+  // 首页绘制使用的天气快照及其代数；代数变化即表示有新一批天气数据发布。
+  WeatherData weatherData;
+  uint32_t weatherGeneration = 0;
+  uint32_t lastWeatherGeneration = UINT32_MAX;
   int lastTaskCount = -1;
+  // 在共享状态锁内拷出的待办，绘制时只读这份副本。
+  std::vector<TodoItem> visibleTasks;
   bool lastWifiState = false;
   int lastStatusBarMinute = -1;
 
@@ -168,6 +170,7 @@ private:
     if (!hasWeatherChanged()) {
       return;
     }
+    loadWeatherSnapshot();
     renderWeatherPartial(displayDrv);
     updateWeatherSnapshot();
   }
@@ -200,36 +203,27 @@ private:
 
     updateWeatherSnapshot();
 
-    lastTaskCount = todoMgr->getVisibleTodos(now).size();
+    lastTaskCount = visibleTasks.size();
     lastWifiState = conn->isConnected();
     lastStatusBarMinute = now.minute;
   }
 
   bool hasWeatherChanged() const {
     // 关键逻辑：首页天气区一次局刷会同时重绘 TODAY 和 TOMORROW。
-    // 如果这里只比较 today 字段，启动阶段“今天先回来、明天后回来”时，
-    // tomorrow 的异步结果就无法触发第二次局刷，界面会一直停留在空值。
-    return weather->data.temp != lastWeatherTemp ||
-           weather->data.weather != lastWeatherStr ||
-           String(weather->data.icon_str) != lastWeatherIcon ||
-           weather->data.forecast_temp_high != lastForecastTempHigh ||
-           weather->data.forecast_temp_low != lastForecastTempLow ||
-           weather->data.forecast_weather != lastForecastWeatherStr ||
-           String(weather->data.forecast_icon_str) != lastForecastIcon;
+    // WeatherManager 每发布一批新数据就推进代数，这里只需比较整数，
+    // 今天/明天任一字段变化都会触发同一次局刷。
+    return weather->getGeneration() != lastWeatherGeneration;
   }
 
-  void updateWeatherSnapshot() {
-    lastWeatherTemp = weather->data.temp;
-    lastWeatherStr = weather->data.weather;
-    lastWeatherIcon = weather->data.icon_str;
-    lastForecastTempHigh = weather->data.forecast_temp_high;
-    lastForecastTempLow = weather->data.forecast_temp_low;
-    lastForecastWeatherStr = weather->data.forecast_weather;
-    lastForecastIcon = weather->data.forecast_icon_str;
+  void loadWeatherSnapshot() {
+    weatherGeneration = weather->getSnapshot(weatherData);
   }
 
+  void updateWeatherSnapshot() { lastWeatherGeneration = weatherGeneration; }
+
   void renderAll(DisplayDriver *displayDrv) {
     Serial.println("Drawing Home Screen (Full)");
+    loadWeatherSnapshot();
     auto &display = displayDrv->display;
     auto &u8g2 = displayDrv->u8g2Fonts;
 
@@ -417,13 +411,13 @@ private:
     u8g2.print("TODAY");
 
     u8g2.setFont(u8g2_font_qweather_icon_16);
-    u8g2.drawUTF8(HOME_WEATHER_ICON_X, 130, weather->data.icon_str);
+    u8g2.drawUTF8(HOME_WEATHER_ICON_X, 130, weatherData.icon_str);
 
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     u8g2.setCursor(HOME_WEATHER_TEXT_X, 124);
-    u8g2.print(weather->data.weather);
+    u8g2.print(weatherData.weather);
     u8g2.print(" ");
-    u8g2.print(weather->data.temp);
+    u8g2.print(weatherData.temp);
     u8g2.print("°");
   }
 
@@ -434,23 +428,22 @@ private:
     u8g2.print("TOMORROW");
 
     u8g2.setFont(u8g2_font_qweather_icon_16);
-    u8g2.drawUTF8(HOME_WEATHER_ICON_X, 190, weather->data.forecast_icon_str);
+    u8g2.drawUTF8(HOME_WEATHER_ICON_X, 190, weatherData.forecast_icon_str);
 
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     u8g2.setCursor(HOME_WEATHER_TEXT_X, 183);
-    u8g2.print(weather->data.forecast_weather);
+    u8g2.print(weatherData.forecast_weather);
     u8g2.print(" ");
-    u8g2.print(weather->data.forecast_temp_low);
+    u8g2.print(weatherData.forecast_temp_low);
     u8g2.print("°-");
-    u8g2.print(weather->data.forecast_temp_high);
+    u8g2.print(weatherData.forecast_temp_high);
     u8g2.print("°");
   }
 
   void drawTasksSection(DisplayDriver *displayDrv) {
     auto &u8g2 = displayDrv->u8g2Fonts;
     auto &display = displayDrv->display;
-    DateTime now = rtc->getTime();
-    std::vector<TodoItem> tasks = todoMgr->getVisibleTodos(now);
+    const std::vector<TodoItem> &tasks = visibleTasks;
 
     u8g2.setFont(u8g2_font_helvB08_tr);
     u8g2.setCursor(10, 215);
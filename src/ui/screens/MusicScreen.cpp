@@ -13,6 +13,8 @@ const int PANEL_RIGHT_W = SCREEN_W - PANEL_LEFT_W;
 
 const uint16_t COLOR_BG = GxEPD_WHITE;
 const uint16_t COLOR_FG = GxEPD_BLACK;
+
+const int SEEK_STEP_SECONDS = 10;
 } // namespace MusicLayout
 
 namespace MusicGlyphs {
@@ -51,6 +53,8 @@ void MusicScreen::initLayout() {
       UIButton{SCREEN_W - 80, footerY + 5, 20, 30, "-"}; // Vol Dec
   buttons[BTN_VOL_INC] =
       UIButton{SCREEN_W - 30, footerY + 5, 20, 30, "+"}; // Vol Inc
+  buttons[BTN_SEEK] =
+      UIButton{15, footerY + 5, SCREEN_W - 140, 25, "Seek"}; // Progress
 
   // Right Panel Buttons (Playlist area and Pagination)
   buttons[BTN_LIST] =
@@ -70,14 +74,41 @@ void MusicScreen::enter() {
   digitalWrite(AMP_EN, 1);
   digitalWrite(CODEC_EN, 1);
   isFirstDraw = true;
+  seekMode = false;
   music->init();
+  lastIndexGeneration = music->getIndexGeneration();
+  visibleOffset = -1;
 }
 
 void MusicScreen::exit() {
   // music->stop();
 }
 
-void MusicScreen::update() { music->update(); }
+void MusicScreen::update() {
+  music->update();
+
+  // 后台重扫切换了索引：序号可能整体移动，整页列表和当前曲目都要重读。
+  uint32_t indexGeneration = music->getIndexGeneration();
+  if (indexGeneration != lastIndexGeneration) {
+    lastIndexGeneration = indexGeneration;
+    playlistMetadataDirty = true;
+    trackMetadataDirty = true;
+  }
+
+  // 后台解析补齐了时长/标签：只记录落在当前页或当前曲目上的变化，
+  // 首次进入时连续解析不可见条目不会引起刷屏。
+  uint32_t metadataGeneration = music->getMetadataGeneration();
+  if (metadataGeneration != lastMetadataGeneration) {
+    lastMetadataGeneration = metadataGeneration;
+    int parsed = music->getLastParsedTrack();
+    if (parsed >= visibleOffset && parsed < visibleOffset + visibleCount) {
+      playlistMetadataDirty = true;
+    }
+    if (parsed == music->getCurrentTrackIndex()) {
+      trackMetadataDirty = true;
+    }
+  }
+}
 
 void MusicScreen::draw(DisplayDriver *display) {
   using namespace MusicLayout;
@@ -96,7 +127,10 @@ void MusicScreen::draw(DisplayDriver *display) {
     lastIsPlaying = isPlaying;
     lastElapsed = elapsed;
     lastFocusedControl = focusedControl;
+    lastSeekMode = seekMode;
     lastScrollOffset = playlistScrollOffset;
+    playlistMetadataDirty = false;
+    trackMetadataDirty = false;
 
     display->display.setFullWindow();
     display->display.firstPage();
@@ -130,8 +164,9 @@ void MusicScreen::draw(DisplayDriver *display) {
     updateFooterInfo(display);
   }
 
-  if (abs((int)elapsed - (int)lastElapsed) >= 1) {
+  if (abs((int)elapsed - (int)lastElapsed) >= 1 || seekMode != lastSeekMode) {
     lastElapsed = elapsed;
+    lastSeekMode = seekMode;
     updateProgress(display);
   }
 
@@ -144,6 +179,17 @@ void MusicScreen::draw(DisplayDriver *display) {
     lastScrollOffset = playlistScrollOffset;
     updatePlaylist(display);
   }
+
+  if (playlistMetadataDirty) {
+    playlistMetadataDirty = false;
+    visibleOffset = -1;
+    updatePlaylist(display);
+  }
+  if (trackMetadataDirty) {
+    trackMetadataDirty = false;
+    updatePlaybackInfo(display);
+    updateProgress(display);
+  }
 }
 
 void MusicScreen::drawLeftPanel(DisplayDriver *display) {
@@ -152,11 +198,10 @@ void MusicScreen::drawLeftPanel(DisplayDriver *display) {
   int centerY = SYS_BAR_H + (LAYOUT_H / 2) - 20;
 
   // Track Info
-  const auto &playlist = music->getPlaylist();
+  const TrackInfo &track = music->getCurrentTrack();
   int currentIdx = music->getCurrentTrackIndex();
-  String title = (currentIdx != -1) ? playlist[currentIdx].title : "No Track";
-  String artist =
-      (currentIdx != -1) ? playlist[currentIdx].artist : "Unknown Artist";
+  String title = (currentIdx != -1) ? track.title : "No Track";
+  String artist = (currentIdx != -1) ? track.artist : "Unknown Artist";
 
   display->u8g2Fonts.setFont(u8g2_font_helvB14_tf);
   int tw = display->u8g2Fonts.getUTF8Width(title.c_str());
@@ -215,7 +260,6 @@ void MusicScreen::drawRightPanel(DisplayDriver *display) {
 
 void MusicScreen::drawPlaylist(DisplayDriver *display) {
   using namespace MusicLayout;
-  const auto &playlist = music->getPlaylist();
   int currentIdx = music->getCurrentTrackIndex();
 
   int startY = SYS_BAR_H;
@@ -229,12 +273,11 @@ void MusicScreen::drawPlaylist(DisplayDriver *display) {
     if (currentIdx >= playlistScrollOffset + itemsPerPage)
       playlistScrollOffset = currentIdx - itemsPerPage + 1;
   }
+  refreshVisibleTracks(itemsPerPage);
 
   display->u8g2Fonts.setFont(u8g2_font_helvB10_tf);
-  for (int i = 0; i < itemsPerPage; i++) {
+  for (int i = 0; i < visibleCount; i++) {
     int idx = playlistScrollOffset + i;
-    if (idx >= (int)playlist.size())
-      break;
 
     int y = startY + i * itemH;
     bool active = (idx == currentIdx);
@@ -249,40 +292,33 @@ void MusicScreen::drawPlaylist(DisplayDriver *display) {
 
     display->u8g2Fonts.setForegroundColor(active ? COLOR_BG : COLOR_FG);
     display->u8g2Fonts.setCursor(PANEL_LEFT_W + 15, y + (itemH / 2) + 5);
-    display->u8g2Fonts.print(playlist[idx].title);
+    display->u8g2Fonts.print(visibleTracks[i].title);
 
     // Duration
-    String dur = music->formatTime(playlist[idx].duration);
+    String dur = music->formatTime(visibleTracks[i].duration);
     int dw = display->u8g2Fonts.getUTF8Width(dur.c_str());
     display->u8g2Fonts.setCursor(SCREEN_W - dw - 15, y + (itemH / 2) + 5);
     display->u8g2Fonts.print(dur);
   }
 }
 
+void MusicScreen::refreshVisibleTracks(int itemsPerPage) {
+  if (visibleOffset == playlistScrollOffset) {
+    return;
+  }
+  visibleOffset = playlistScrollOffset;
+  size_t pageSize = itemsPerPage < MAX_VISIBLE_TRACKS ? itemsPerPage
+                                                      : MAX_VISIBLE_TRACKS;
+  visibleCount = static_cast<int>(
+      music->loadTracks(playlistScrollOffset, pageSize, visibleTracks));
+}
+
 void MusicScreen::drawFooter(DisplayDriver *display) {
   using namespace MusicLayout;
   int y = SCREEN_H - FOOTER_H;
   display->display.drawLine(0, y, SCREEN_W, y, COLOR_FG);
 
-  // Progress Bar
-  int progressWrapY = y + 5;
-  int progressWrapH = 30;
-  int progressX = 15;
-  int progressMaxW = SCREEN_W - 140;
-
-  uint32_t elapsed = music->getElapsedSeconds();
-  uint32_t total = music->getTotalSeconds();
-  float pct = (total > 0) ? (float)elapsed / total : 0;
-
-  display->u8g2Fonts.setFont(u8g2_font_helvB08_tf);
-  display->u8g2Fonts.setCursor(progressX, progressWrapY + 10);
-  display->u8g2Fonts.print(music->formatTime(elapsed) + " / " +
-                           music->formatTime(total));
-
-  display->display.drawRect(progressX, progressWrapY + 15, progressMaxW, 4,
-                            COLOR_FG);
-  display->display.fillRect(progressX, progressWrapY + 15,
-                            (int)(progressMaxW * pct), 4, COLOR_FG);
+  drawProgress(display, y + 5);
 
   // Tools
   updateVolumeUI(display);
@@ -445,6 +481,18 @@ void MusicScreen::setAlignedPartialWindow(DisplayDriver *display, int x, int y,
 }
 
 bool MusicScreen::onInput(UIKey key) {
+  using namespace MusicLayout;
+  if (seekMode) {
+    if (key == UI_KEY_LEFT) {
+      music->seekBy(-SEEK_STEP_SECONDS);
+    } else if (key == UI_KEY_RIGHT) {
+      music->seekBy(SEEK_STEP_SECONDS);
+    } else if (key == UI_KEY_ENTER) {
+      seekMode = false;
+    }
+    return true;
+  }
+
   int oldFocused = focusedControl;
   if (key == UI_KEY_LEFT) {
     focusedControl = (focusedControl - 1 + BUTTON_COUNT) % BUTTON_COUNT;
@@ -478,7 +526,10 @@ bool MusicScreen::onInput(UIKey key) {
       break;
     case BTN_PAGE_DOWN:
       playlistScrollOffset =
-          min((int)music->getPlaylist().size() - 1, playlistScrollOffset + 5);
+          max(0, min(music->getTrackCount() - 1, playlistScrollOffset + 5));
+      break;
+    case BTN_SEEK:
+      seekMode = music->getCurrentTrackIndex() != -1;
       break;
     }
   }
@@ -493,19 +544,31 @@ void MusicScreen::updateProgress(DisplayDriver *display) {
   display->display.firstPage();
   do {
     display->display.fillScreen(COLOR_BG);
-    uint32_t elapsed = music->getElapsedSeconds();
-    uint32_t total = music->getTotalSeconds();
-    float pct = (total > 0) ? (float)elapsed / total : 0;
+    drawProgress(display, y);
+  } while (display->display.nextPage());
+}
 
-    display->u8g2Fonts.setFont(u8g2_font_helvB08_tf);
-    display->u8g2Fonts.setCursor(15, y + 10);
-    display->u8g2Fonts.print(music->formatTime(elapsed) + " / " +
-                             music->formatTime(total));
+void MusicScreen::drawProgress(DisplayDriver *display, int y) {
+  using namespace MusicLayout;
+  const UIButton &btn = buttons[BTN_SEEK];
+  uint32_t elapsed = music->getElapsedSeconds();
+  uint32_t total = music->getTotalSeconds();
+  float pct = (total > 0) ? (float)elapsed / total : 0;
 
-    display->display.drawRect(15, y + 15, SCREEN_W - 140, 4, COLOR_FG);
-    display->display.fillRect(15, y + 15, (int)((SCREEN_W - 140) * pct), 4,
-                              COLOR_FG);
-  } while (display->display.nextPage());
+  display->u8g2Fonts.setFont(u8g2_font_helvB08_tf);
+  display->u8g2Fonts.setCursor(btn.x, y + 10);
+  String label = music->formatTime(elapsed) + " / " + music->formatTime(total);
+  display->u8g2Fonts.print(seekMode ? "<< " + label + " >>" : label);
+
+  display->display.drawRect(btn.x, y + 15, btn.w, 4, COLOR_FG);
+  display->display.fillRect(btn.x, y + 15, (int)(btn.w * pct), 4, COLOR_FG);
+  // 聚焦时加外框；拖动模式下进度条加粗，提示左右键正在快退/快进。
+  if (focusedControl == BTN_SEEK) {
+    display->display.drawRect(btn.x - 3, y, btn.w + 6, 23, COLOR_FG);
+  }
+  if (seekMode) {
+    display->display.drawRect(btn.x, y + 14, btn.w, 6, COLOR_FG);
+  }
 }
 
 void MusicScreen::updateFocus(DisplayDriver *display, int oldIdx, int newIdx) {
@@ -514,7 +577,8 @@ void MusicScreen::updateFocus(DisplayDriver *display, int oldIdx, int newIdx) {
       (newIdx >= BTN_PREV && newIdx <= BTN_NEXT);
   bool needsFooterRefresh =
       (oldIdx >= BTN_VOL_DEC && oldIdx <= BTN_LOOP) ||
-      (newIdx >= BTN_VOL_DEC && newIdx <= BTN_LOOP);
+      (newIdx >= BTN_VOL_DEC && newIdx <= BTN_LOOP) || oldIdx == BTN_SEEK ||
+      newIdx == BTN_SEEK;
   bool needsRightRefresh =
       (oldIdx >= BTN_LIST && oldIdx <= BTN_PAGE_DOWN) ||
       (newIdx >= BTN_LIST && newIdx <= BTN_PAGE_DOWN);
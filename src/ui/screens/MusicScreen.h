@@ -16,6 +16,7 @@
 #define BTN_LIST 6
 #define BTN_PAGE_UP 7
 #define BTN_PAGE_DOWN 8
+#define BTN_SEEK 9
 
 class MusicScreen : public Screen {
 public:
@@ -34,10 +35,21 @@ private:
   ConfigManager *config;
 
   int focusedControl = 0; // 0: Prev, 1: Play, 2: Next, 3: DecVol, 4: IncVol, 5:
-                          // Loop, 6: Playlist, 7: PageUp, 8: PageDown
+                          // Loop, 6: Playlist, 7: PageUp, 8: PageDown,
+                          // 9: Progress
+  // 进度条上按确认进入拖动模式：左右键按固定步长快退/快进，再按确认退出。
+  bool seekMode = false;
+  bool lastSeekMode = false;
   int playlistScrollOffset = 0;
   bool isFirstDraw = true;
 
+  // 当前页的播放列表条目缓存：只在翻页或重新进入页面时读取 SD 索引，
+  // 分页绘制的多次回调复用同一份数据。
+  static const int MAX_VISIBLE_TRACKS = 6;
+  TrackInfo visibleTracks[MAX_VISIBLE_TRACKS];
+  int visibleOffset = -1;
+  int visibleCount = 0;
+
   // State trackers for partial refresh
   int lastTrackIdx = -1;
   int lastVol = -1;
@@ -46,20 +58,26 @@ private:
   uint32_t lastElapsed = 0;
   int lastFocusedControl = -1;
   int lastScrollOffset = -1;
+  uint32_t lastMetadataGeneration = 0;
+  uint32_t lastIndexGeneration = 0;
+  bool playlistMetadataDirty = false;
+  bool trackMetadataDirty = false;
 
   struct UIButton {
     int x, y, w, h;
     char label[16];
   };
 
-  static const int BUTTON_COUNT = 9;
+  static const int BUTTON_COUNT = 10;
   UIButton buttons[BUTTON_COUNT];
 
   void initLayout();
   void drawLeftPanel(DisplayDriver *display);
   void drawRightPanel(DisplayDriver *display);
   void drawFooter(DisplayDriver *display);
+  void drawProgress(DisplayDriver *display, int y);
   void drawPlaylist(DisplayDriver *display);
+  void refreshVisibleTracks(int itemsPerPage);
   void drawPlaybackControls(DisplayDriver *display);
   bool isSymbolButton(int buttonIndex) const;
   const uint8_t *getButtonFont(int buttonIndex) const;
@@ -309,14 +309,11 @@ void RadioScreen::scanAndSavePresets() {
 void RadioScreen::saveScannedPresets(uint16_t *stations, uint8_t count) {
   // 关键逻辑：Scan 的结果代表当前电磁环境下的新预设列表；
   // 频率名称由独立别名表维护，因此本次只替换预设频率。
-  for (int i = 0; i < RADIO_PRESET_COUNT; i++) {
-    config->config.radio_presets[i] = i < count ? stations[i] : 0;
-  }
-  config->saveRadioPresets();
+  config->saveRadioPresets(stations, count);
 #if ENABLE_SERIAL_DEBUG
   Serial.print("[Radio][scan] saved presets:");
-  for (int i = 0; i < RADIO_PRESET_COUNT; i++) {
-    Serial.printf(" %u", config->config.radio_presets[i]);
+  for (int i = 0; i < count; i++) {
+    Serial.printf(" %u", stations[i]);
   }
   Serial.println();
 #endif
@@ -327,7 +324,7 @@ void RadioScreen::loadPreset(int index) {
     return;
   }
 
-  uint16_t freq = config->config.radio_presets[index];
+  uint16_t freq = config->getRadioPreset(index);
   if (freq > 0) {
     radio->setFrequency(freq);
     setFrequencyStatus("Preset");
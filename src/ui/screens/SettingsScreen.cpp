@@ -10,13 +10,24 @@ constexpr int CONTENT_X = SIDEBAR_W + 14;
 constexpr int CONTENT_W = 400 - CONTENT_X - 10;
 constexpr int BODY_Y = 24;
 constexpr int QR_SIZE = 112;
-const char *MENU_LABELS[] = {"检查器件", "网络配置", "系统设置"};
+const char *MENU_LABELS[] = {"检查器件", "网络配置", "系统设置", "存储测速"};
+constexpr int BENCH_COLUMN_X = CONTENT_X + 52;
+constexpr int BENCH_COLUMN_W = 48;
+
+void formatBlockSize(char *buffer, size_t size, uint16_t bytes) {
+  if (bytes >= 1024) {
+    snprintf(buffer, size, "%uK", static_cast<unsigned>(bytes / 1024));
+  } else {
+    snprintf(buffer, size, "%u", static_cast<unsigned>(bytes));
+  }
+}
 } // namespace
 
 SettingsScreen::SettingsScreen(ConfigManager *config, StatusBar *statusBar,
                                BatteryDriver *battery,
-                               ConnectionManager *conn)
-    : config(config), statusBar(statusBar), battery(battery), conn(conn) {}
+                               ConnectionManager *conn, SDCardDriver *sd)
+    : config(config), statusBar(statusBar), battery(battery), conn(conn),
+      sd(sd) {}
 
 void SettingsScreen::enter() {
   selectedItem = MENU_HARDWARE;
@@ -59,8 +70,11 @@ bool SettingsScreen::onInput(UIKey key) {
     runManualHardwareCheck();
   } else if (selectedItem == MENU_NETWORK) {
     conn->startAP();
-  } else {
+  } else if (selectedItem == MENU_SYSTEM) {
     conn->startSystemAP();
+  } else {
+    redrawAfterInput = false;
+    runStorageBenchmark();
   }
   return true;
 }
@@ -82,7 +96,7 @@ void SettingsScreen::drawSidebar(DisplayDriver *display) {
   epd.drawLine(SIDEBAR_W, BODY_Y, SIDEBAR_W, 299, GxEPD_BLACK);
   drawText(display, 16, 48, "设置", u8g2_font_wqy16_t_gb2312);
   for (uint8_t i = 0; i < MENU_COUNT; ++i) {
-    drawMenuItem(display, i, 70 + i * 58);
+    drawMenuItem(display, i, 60 + i * 48);
   }
   drawText(display, 32, 266, "左右选择", u8g2_font_wqy12_t_gb2312);
   drawText(display, 32, 288, "确认进入", u8g2_font_wqy12_t_gb2312);
@@ -110,8 +124,10 @@ void SettingsScreen::drawContent(DisplayDriver *display,
     drawHardwareContent(display, info);
   } else if (selectedItem == MENU_NETWORK) {
     drawNetworkContent(display);
-  } else {
+  } else if (selectedItem == MENU_SYSTEM) {
     drawSystemContent(display);
+  } else {
+    drawStorageContent(display);
   }
 }
 
@@ -149,6 +165,56 @@ void SettingsScreen::drawSystemContent(DisplayDriver *display) {
                     conn->isSystemPortalActive());
 }
 
+void SettingsScreen::drawStorageContent(DisplayDriver *display) {
+  drawText(display, CONTENT_X, 52, "存储测速", u8g2_font_wqy16_t_gb2312);
+  drawText(display, CONTENT_X, 78, "按确认键测速，约需十秒",
+           u8g2_font_wqy12_t_gb2312);
+  const SDBenchmarkResult &result = sd->getBenchmark();
+  if (!result.valid) {
+    drawText(display, CONTENT_X, 120, "尚无测速结果",
+             u8g2_font_wqy12_t_gb2312);
+    drawText(display, CONTENT_X, 144, "播放或上传时无法测速",
+             u8g2_font_wqy12_t_gb2312);
+    return;
+  }
+  drawBenchmarkTable(display, result);
+
+  char line[48];
+  snprintf(line, sizeof(line), "Random 4K: %lu IOPS",
+           static_cast<unsigned long>(result.randomReadIops));
+  drawText(display, CONTENT_X, 184, line, u8g2_font_helvR10_tf);
+  snprintf(line, sizeof(line), "Directory: %lu entries/s",
+           static_cast<unsigned long>(result.dirEntriesPerSec));
+  drawText(display, CONTENT_X, 206, line, u8g2_font_helvR10_tf);
+  drawText(display, CONTENT_X, 234, "推荐参数（已生效）",
+           u8g2_font_wqy12_t_gb2312);
+  char buffer[8];
+  formatBlockSize(buffer, sizeof(buffer),
+                  static_cast<uint16_t>(result.bufferSize));
+  snprintf(line, sizeof(line), "Clock %.1f MHz  Buffer %sB",
+           result.clockHz / 1000000.0f, buffer);
+  drawText(display, CONTENT_X, 256, line, u8g2_font_helvR10_tf);
+}
+
+void SettingsScreen::drawBenchmarkTable(DisplayDriver *display,
+                                        const SDBenchmarkResult &result) {
+  char cell[16];
+  drawText(display, CONTENT_X, 106, "KB/s", u8g2_font_helvB08_tr);
+  drawText(display, CONTENT_X, 128, "Write", u8g2_font_helvR10_tf);
+  drawText(display, CONTENT_X, 150, "Read", u8g2_font_helvR10_tf);
+  for (uint8_t i = 0; i < SDBenchmarkResult::BLOCK_SIZE_COUNT; ++i) {
+    int x = BENCH_COLUMN_X + i * BENCH_COLUMN_W;
+    formatBlockSize(cell, sizeof(cell), SDBenchmarkResult::BLOCK_SIZES[i]);
+    drawText(display, x, 106, cell, u8g2_font_helvB08_tr);
+    snprintf(cell, sizeof(cell), "%lu",
+             static_cast<unsigned long>(result.writeKBps[i]));
+    drawText(display, x, 128, cell, u8g2_font_helvR10_tf);
+    snprintf(cell, sizeof(cell), "%lu",
+             static_cast<unsigned long>(result.readKBps[i]));
+    drawText(display, x, 150, cell, u8g2_font_helvR10_tf);
+  }
+}
+
 void SettingsScreen::drawPortalContent(DisplayDriver *display,
                                        const String &payload,
                                        const char *title,
@@ -273,3 +339,17 @@ void SettingsScreen::finishManualHardwareCheck(DisplayDriver *display,
   delay(2000);
   draw(display);
 }
+
+void SettingsScreen::runStorageBenchmark() {
+  DisplayDriver *display = uiManager->getDisplayDriver();
+  if (sd->getRefCount() > 0) {
+    // 播放、闹铃或网页上传正在使用 SD，测速会打断它们。
+    display->showStatus("SD Busy", 0);
+  } else {
+    display->showStatus("SD Benchmark...", 0);
+    bool ok = sd->runBenchmark();
+    display->showStatus(ok ? "Benchmark Done" : "Benchmark Failed", 0);
+  }
+  delay(1500);
+  draw(display);
+}
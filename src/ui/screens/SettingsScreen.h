@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../drivers/BatteryDriver.h"
+#include "../../drivers/SDCardDriver.h"
 #include "../../managers/ConfigManager.h"
 #include "../../managers/ConnectionManager.h"
 #include "../../utils/SimpleQRCode.h"
@@ -10,7 +11,8 @@
 class SettingsScreen : public Screen {
 public:
   SettingsScreen(ConfigManager *config, StatusBar *statusBar,
-                 BatteryDriver *battery, ConnectionManager *conn);
+                 BatteryDriver *battery, ConnectionManager *conn,
+                 SDCardDriver *sd);
 
   void enter() override;
   void exit() override;
@@ -23,13 +25,15 @@ private:
     MENU_HARDWARE = 0,
     MENU_NETWORK = 1,
     MENU_SYSTEM = 2,
-    MENU_COUNT = 3
+    MENU_STORAGE = 3,
+    MENU_COUNT = 4
   };
 
   ConfigManager *config;
   StatusBar *statusBar;
   BatteryDriver *battery;
   ConnectionManager *conn;
+  SDCardDriver *sd;
   uint8_t selectedItem = MENU_HARDWARE;
   bool redrawAfterInput = true;
 
@@ -40,6 +44,9 @@ private:
   void drawHardwareContent(DisplayDriver *display, const BatteryInfo &info);
   void drawNetworkContent(DisplayDriver *display);
   void drawSystemContent(DisplayDriver *display);
+  void drawStorageContent(DisplayDriver *display);
+  void drawBenchmarkTable(DisplayDriver *display,
+                          const SDBenchmarkResult &result);
   void drawPortalContent(DisplayDriver *display, const String &payload,
                          const char *title, const String &address,
                          bool active);
@@ -56,4 +63,5 @@ private:
   void showDeviceCheckResult(DisplayDriver *display, const char *name, bool ok,
                              uint8_t line);
   void finishManualHardwareCheck(DisplayDriver *display, bool allOk);
+  void runStorageBenchmark();
 };
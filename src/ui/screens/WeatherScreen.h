@@ -12,6 +12,7 @@ public:
       : weather(weather), statusBar(statusBar) {}
 
   void draw(DisplayDriver *display) override {
+    weather->getSnapshot(data);
     display->display.setFullWindow();
     display->display.firstPage();
     do {
@@ -31,11 +32,11 @@ public:
 
       display->u8g2Fonts.setFont(u8g2_font_wqy16_t_gb2312);
       display->u8g2Fonts.setCursor(10, 52);
-      display->u8g2Fonts.print(weather->data.city);
+      display->u8g2Fonts.print(data.city);
 
       // Date Badge Styling: Black background, rounded corners, padding: 2px 6px
       display->u8g2Fonts.setFont(u8g2_font_wqy16_t_gb2312);
-      int tw = display->u8g2Fonts.getUTF8Width(weather->data.obs_time.c_str());
+      int tw = display->u8g2Fonts.getUTF8Width(data.obs_time);
       int bw = tw + 12; // 6px padding left + 6px right
       int bh = 20;      // 16px font + 2px top + 2px bottom padding
       int bx = 255 - bw;
@@ -46,8 +47,7 @@ public:
       display->u8g2Fonts.setForegroundColor(GxEPD_WHITE);
       display->u8g2Fonts.setBackgroundColor(GxEPD_BLACK);
       // Center text in badge: bx + 6 (padding), by + 16 (approx baseline)
-      display->u8g2Fonts.drawUTF8(bx + 6, by + 16,
-                                  weather->data.obs_time.c_str());
+      display->u8g2Fonts.drawUTF8(bx + 6, by + 16, data.obs_time);
       display->u8g2Fonts.setForegroundColor(GxEPD_BLACK);
       display->u8g2Fonts.setBackgroundColor(GxEPD_WHITE);
 
@@ -58,37 +58,38 @@ public:
       // Wait, u8g2_font_qweather_icon_16 is likely a 16pt font.
       // If I want 80x80, I might need a bigger font or draw bitmap.
       // Let's see if there's a larger font.
-      display->u8g2Fonts.drawUTF8(30, 120, weather->data.icon_str);
+      display->u8g2Fonts.drawUTF8(30, 120, data.icon_str);
 
       // 天气文本
       display->u8g2Fonts.setFont(u8g2_font_wqy16_t_gb2312);
       display->u8g2Fonts.setCursor(30, 150);
-      display->u8g2Fonts.print(weather->data.weather);
+      display->u8g2Fonts.print(data.weather);
 
       display->u8g2Fonts.setFont(u8g2_font_logisoso62_tn);
       display->u8g2Fonts.setCursor(110, 165);
-      display->u8g2Fonts.print(weather->data.temp);
+      display->u8g2Fonts.print(data.temp);
 
       // Fixed degree symbol for large temp - custom circle for larger size
       int tWidth =
-          display->u8g2Fonts.getUTF8Width(String(weather->data.temp).c_str());
+          display->u8g2Fonts.getUTF8Width(String(data.temp).c_str());
       int degreeX = 110 + tWidth + 12;
       int degreeY = 115;
       // display->display.drawCircle(degreeX, degreeY, 6, GxEPD_BLACK);
       display->display.drawCircle(degreeX, degreeY, 4, GxEPD_BLACK); // Thicker
 
       // Warning Box
-      if (weather->data.warning_text.length() > 0) {
+      if (data.warning_text[0] != '\0') {
         display->display.fillRect(10, 185, 240, 40, GxEPD_BLACK);
         display->u8g2Fonts.setFont(u8g2_font_wqy12_t_gb2312);
         display->u8g2Fonts.setForegroundColor(GxEPD_WHITE);
         display->u8g2Fonts.setBackgroundColor(GxEPD_BLACK);
         display->u8g2Fonts.setCursor(15, 200);
         display->u8g2Fonts.print("预警: ");
-        display->u8g2Fonts.print(weather->data.warning_title);
+        display->u8g2Fonts.print(data.warning_title);
         display->u8g2Fonts.setCursor(15, 218);
-        String shortWarning =
-            weather->data.warning_text.substring(0, 20) + "...";
+        char shortWarning[32];
+        formatShortWarning(shortWarning, sizeof(shortWarning),
+                           data.warning_text);
         display->u8g2Fonts.print(shortWarning);
         display->u8g2Fonts.setForegroundColor(GxEPD_BLACK);
         display->u8g2Fonts.setBackgroundColor(GxEPD_WHITE);
@@ -98,18 +99,18 @@ public:
       display->display.drawLine(0, 230, 260, 230, GxEPD_BLACK);
       int itemW = 260 / 6; // Show 6 items
       display->u8g2Fonts.setFont(u8g2_font_6x10_tf);
-      for (int i = 0; i < 6 && i < weather->data.hourly.size(); i++) {
+      for (int i = 0; i < 6 && i < data.hourly_count; i++) {
         int x = i * itemW;
         display->u8g2Fonts.setCursor(x + 5, 245);
-        display->u8g2Fonts.print(weather->data.hourly[i].time);
+        display->u8g2Fonts.print(data.hourly[i].time);
 
         display->u8g2Fonts.setFont(u8g2_font_qweather_icon_16);
         display->u8g2Fonts.drawUTF8(x + 10, 270,
-                                    weather->data.hourly[i].icon_str);
+                                    data.hourly[i].icon_str);
 
         display->u8g2Fonts.setFont(u8g2_font_helvR08_tf);
         display->u8g2Fonts.setCursor(x + 10, 290);
-        display->u8g2Fonts.print(weather->data.hourly[i].temp);
+        display->u8g2Fonts.print(data.hourly[i].temp);
         display->u8g2Fonts.print("°");
 
         if (i > 0)
@@ -126,22 +127,22 @@ public:
       // Daily List
       int rowH = (300 - 64) / 7;
       display->u8g2Fonts.setFont(u8g2_font_wqy12_t_gb2312);
-      for (int i = 0; i < 7 && i < weather->data.daily.size(); i++) {
+      for (int i = 0; i < 7 && i < data.daily_count; i++) {
         int y = 64 + i * rowH;
         display->u8g2Fonts.setCursor(265, y + 22);
-        display->u8g2Fonts.print(weather->data.daily[i].day);
+        display->u8g2Fonts.print(data.daily[i].day);
 
         display->u8g2Fonts.setFont(u8g2_font_qweather_icon_16);
         display->u8g2Fonts.drawUTF8(305, y + 25,
-                                    weather->data.daily[i].icon_str);
+                                    data.daily[i].icon_str);
 
         display->u8g2Fonts.setFont(u8g2_font_helvR08_tf);
         display->u8g2Fonts.setCursor(340, y + 22);
-        display->u8g2Fonts.print(weather->data.daily[i].temp_min);
+        display->u8g2Fonts.print(data.daily[i].temp_min);
         // display->u8g2Fonts.drawGlyph(display->u8g2Fonts.getCursorX(),
         //                              display->u8g2Fonts.getCursorY(), 176);
         display->u8g2Fonts.print("° / ");
-        display->u8g2Fonts.print(weather->data.daily[i].temp_max);
+        display->u8g2Fonts.print(data.daily[i].temp_max);
         display->u8g2Fonts.print("°");
         // display->u8g2Fonts.drawGlyph(display->u8g2Fonts.getCursorX(),
         //                              display->u8g2Fonts.getCursorY(), 176);
@@ -163,4 +164,17 @@ public:
 private:
   WeatherManager *weather;
   StatusBar *statusBar;
+  WeatherData data;
+
+  static void formatShortWarning(char *buffer, size_t size, const char *text) {
+    // 关键逻辑：预警正文只显示前 20 个字节，截断点要退回到 UTF-8
+    // 字符边界，避免半个汉字被 u8g2 绘制成乱码。
+    size_t len = strnlen(text, 20);
+    if (len == 20) {
+      while (len > 0 && (static_cast<uint8_t>(text[len]) & 0xC0) == 0x80) {
+        len--;
+      }
+    }
+    snprintf(buffer, size, "%.*s...", static_cast<int>(len), text);
+  }
 };
@@ -0,0 +1,96 @@
+#include "AcceptEncoding.h"
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
+
+namespace {
+enum Match { MATCH_NONE, MATCH_WILDCARD, MATCH_GZIP };
+
+bool isOptionalSpace(char c) { return c == ' ' || c == '\t'; }
+
+void trim(const char *&begin, const char *&end) {
+  while (begin < end && isOptionalSpace(*begin)) {
+    ++begin;
+  }
+  while (end > begin && isOptionalSpace(end[-1])) {
+    --end;
+  }
+}
+
+bool tokenEquals(const char *begin, const char *end, const char *token) {
+  size_t length = strlen(token);
+  return static_cast<size_t>(end - begin) == length &&
+         strncasecmp(begin, token, length) == 0;
+}
+
+Match matchCoding(const char *begin, const char *end) {
+  if (tokenEquals(begin, end, "gzip") || tokenEquals(begin, end, "x-gzip")) {
+    return MATCH_GZIP;
+  }
+  return tokenEquals(begin, end, "*") ? MATCH_WILDCARD : MATCH_NONE;
+}
+
+// 在 [begin, end) 的参数中找 q 值；只需区分是否为 0，格式不合法时按
+// 可接受处理（与主流浏览器一致，忽略无法理解的参数）。
+bool qualityIsZero(const char *begin, const char *end) {
+  while (begin < end) {
+    const char *next =
+        static_cast<const char *>(memchr(begin, ';', end - begin));
+    const char *paramEnd = next != nullptr ? next : end;
+    const char *param = begin;
+    trim(param, paramEnd);
+    if (paramEnd - param >= 2 &&
+        tolower(static_cast<unsigned char>(param[0])) == 'q' &&
+        param[1] == '=') {
+      const char *value = param + 2;
+      if (value == paramEnd || *value != '0') {
+        return false;
+      }
+      for (++value; value < paramEnd; ++value) {
+        if (*value != '.' && *value != '0') {
+          return false;
+        }
+      }
+      return true;
+    }
+    begin = next != nullptr ? next + 1 : end;
+  }
+  return false;
+}
+} // namespace
+
+namespace AcceptEncoding {
+
+bool allowsGzip(const char *header) {
+  if (header == nullptr) {
+    return false;
+  }
+  // 关键逻辑：显式的 gzip 条目优先于通配符，"*, gzip;q=0" 仍然拒绝 gzip。
+  int gzip = -1;
+  int wildcard = -1;
+  const char *cursor = header;
+  const char *headerEnd = header + strlen(header);
+  while (cursor < headerEnd) {
+    const char *comma =
+        static_cast<const char *>(memchr(cursor, ',', headerEnd - cursor));
+    const char *itemEnd = comma != nullptr ? comma : headerEnd;
+    const char *semicolon =
+        static_cast<const char *>(memchr(cursor, ';', itemEnd - cursor));
+    const char *codingEnd = semicolon != nullptr ? semicolon : itemEnd;
+    const char *coding = cursor;
+    trim(coding, codingEnd);
+    Match match = matchCoding(coding, codingEnd);
+    if (match != MATCH_NONE) {
+      bool accepted =
+          semicolon == nullptr || !qualityIsZero(semicolon + 1, itemEnd);
+      (match == MATCH_GZIP ? gzip : wildcard) = accepted ? 1 : 0;
+    }
+    cursor = comma != nullptr ? comma + 1 : headerEnd;
+  }
+  if (gzip >= 0) {
+    return gzip == 1;
+  }
+  return wildcard == 1;
+}
+
+} // namespace AcceptEncoding
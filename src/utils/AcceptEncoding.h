@@ -0,0 +1,10 @@
+#pragma once
+
+// HTTP Accept-Encoding 协商：只回答客户端能否接收 gzip，不依赖 Arduino，
+// 可以直接用主机编译器编译核对。
+namespace AcceptEncoding {
+// header 为请求中的 Accept-Encoding 值，缺失时传 nullptr。按 RFC 9110
+// 12.5.3：gzip（或 x-gzip）显式列出时看其 q 值，否则看 "*"；q=0 表示拒绝。
+// 没有该请求头时返回 false，宁可多传几 KB 也不让不支持 gzip 的客户端收到乱码。
+bool allowsGzip(const char *header);
+} // namespace AcceptEncoding
@@ -0,0 +1,92 @@
+#include "ByteRange.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+const char BYTES_PREFIX[] = "bytes=";
+
+// 去掉 [begin, end) 两端的空白，与 Arduino String::trim 一致。
+void trim(const char *&begin, const char *&end) {
+  while (begin < end && isspace(static_cast<unsigned char>(*begin))) {
+    ++begin;
+  }
+  while (end > begin && isspace(static_cast<unsigned char>(end[-1]))) {
+    --end;
+  }
+}
+
+// 整段都是十进制数字才算合法；空段由调用方单独处理。
+bool parseNumber(const char *begin, const char *end,
+                 unsigned long long &value) {
+  value = 0;
+  if (begin == end) {
+    return false;
+  }
+  for (const char *p = begin; p < end; ++p) {
+    if (*p < '0' || *p > '9') {
+      return false;
+    }
+    unsigned long long next = value * 10 + static_cast<unsigned>(*p - '0');
+    if (next < value) {
+      return false; // 溢出
+    }
+    value = next;
+  }
+  return true;
+}
+} // namespace
+
+namespace ByteRange {
+
+Result parse(const char *header, size_t size, size_t &first, size_t &last) {
+  size_t prefixLength = sizeof(BYTES_PREFIX) - 1;
+  if (header == nullptr || strncmp(header, BYTES_PREFIX, prefixLength) != 0 ||
+      strchr(header, ',') != nullptr) {
+    return RANGE_NONE;
+  }
+  const char *spec = header + prefixLength;
+  const char *specEnd = spec + strlen(spec);
+  trim(spec, specEnd);
+  const char *dash =
+      static_cast<const char *>(memchr(spec, '-', specEnd - spec));
+  if (dash == nullptr) {
+    return RANGE_NONE;
+  }
+  const char *head = spec;
+  const char *headEnd = dash;
+  const char *tail = dash + 1;
+  const char *tailEnd = specEnd;
+  trim(head, headEnd);
+  trim(tail, tailEnd);
+
+  if (head == headEnd) {
+    unsigned long long suffix;
+    if (!parseNumber(tail, tailEnd, suffix)) {
+      return RANGE_NONE;
+    }
+    if (suffix == 0 || size == 0) {
+      return RANGE_UNSATISFIABLE;
+    }
+    first = suffix >= size ? 0 : size - static_cast<size_t>(suffix);
+    last = size - 1;
+    return RANGE_OK;
+  }
+
+  unsigned long long start;
+  if (!parseNumber(head, headEnd, start)) {
+    return RANGE_NONE;
+  }
+  unsigned long long end = size == 0 ? 0 : size - 1;
+  if (tail != tailEnd && (!parseNumber(tail, tailEnd, end) || end < start)) {
+    return RANGE_NONE;
+  }
+  if (start >= size) {
+    return RANGE_UNSATISFIABLE;
+  }
+  first = static_cast<size_t>(start);
+  last = end >= size ? size - 1 : static_cast<size_t>(end);
+  return RANGE_OK;
+}
+
+} // namespace ByteRange
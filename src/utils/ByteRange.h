@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stddef.h>
+
+// HTTP Range 请求头解析：只处理单段字节范围，不依赖 Arduino，
+// 可以直接用主机编译器编译，对着 RFC 9110 的示例核对边界。
+namespace ByteRange {
+enum Result { RANGE_NONE, RANGE_OK, RANGE_UNSATISFIABLE };
+
+// 解析单段 "bytes=a-b" / "bytes=a-" / "bytes=-n"，结果为闭区间 [first, last]。
+// 多段范围或语法不合法时按 RFC 9110 忽略 Range，回退为完整响应。
+Result parse(const char *header, size_t size, size_t &first, size_t &last);
+} // namespace ByteRange
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace Crc32 {
+// IEEE 802.3 CRC32（与 zlib/浏览器端 crc32 一致），crc 传 0 开始新的校验。
+uint32_t update(uint32_t crc, const uint8_t *data, size_t length);
+} // namespace Crc32
@@ -1,5 +1,6 @@
 #include "I2CBus.h"
 #include "../config.h"
+#include "Metrics.h"
 #include <Wire.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
@@ -49,8 +50,16 @@ bool takeMutex(uint32_t timeoutMs) {
   ensureMutex();
   if (i2cMutex == nullptr)
     return false;
-  TickType_t ticks = pdMS_TO_TICKS(timeoutMs);
-  return xSemaphoreTake(i2cMutex, ticks) == pdTRUE;
+  if (xSemaphoreTake(i2cMutex, 0) == pdTRUE)
+    return true;
+
+  // 只有真正发生争用时才计时，无竞争路径保持一次非阻塞获取。
+  uint32_t waitStartUs = micros();
+  bool locked = xSemaphoreTake(i2cMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+  Metrics::add(locked ? Metrics::I2C_LOCK_CONTENDED
+                      : Metrics::I2C_LOCK_TIMEOUTS);
+  Metrics::observe(Metrics::I2C_LOCK_WAIT_US, micros() - waitStartUs);
+  return locked;
 }
 
 void releaseLines() {
@@ -0,0 +1,235 @@
+#include "Metrics.h"
+#include <esp_sleep.h>
+#include <freertos/FreeRTOS.h>
+
+namespace {
+constexpr uint8_t MAX_HISTOGRAM_BUCKETS = 8;
+
+struct SeriesInfo {
+  const char *name;
+  const char *labels;
+  const char *help;
+};
+
+struct HistogramInfo {
+  SeriesInfo series;
+  uint32_t bounds[MAX_HISTOGRAM_BUCKETS];
+  uint8_t boundCount;
+};
+
+struct HistogramData {
+  uint32_t buckets[MAX_HISTOGRAM_BUCKETS + 1];
+  uint64_t sum;
+  uint32_t count;
+};
+
+// 同一指标族的不同标签值必须相邻，输出时只为族的第一条打印 HELP/TYPE。
+const SeriesInfo COUNTERS[Metrics::COUNTER_COUNT] = {
+    {"clock_panel_refresh_total", "kind=\"full\"", "E-paper refreshes"},
+    {"clock_panel_refresh_total", "kind=\"partial\"", "E-paper refreshes"},
+    {"clock_light_sleep_total", "", "Light sleep entries"},
+    {"clock_light_sleep_milliseconds_total", "", "Time spent in light sleep"},
+    {"clock_wake_total", "cause=\"timer\"", "Light sleep wake-ups by cause"},
+    {"clock_wake_total", "cause=\"gpio\"", "Light sleep wake-ups by cause"},
+    {"clock_wake_total", "cause=\"other\"", "Light sleep wake-ups by cause"},
+    {"clock_wifi_sessions_total", "", "Wi-Fi power-on sessions"},
+    {"clock_wifi_session_milliseconds_total", "", "Time with Wi-Fi powered"},
+    {"clock_http_bytes_total", "direction=\"client_rx\"",
+     "HTTP payload bytes"},
+    {"clock_http_bytes_total", "direction=\"server_tx\"",
+     "HTTP payload bytes"},
+    {"clock_http_bytes_total", "direction=\"server_rx\"",
+     "HTTP payload bytes"},
+    {"clock_i2c_lock_contended_total", "", "I2C lock acquisitions that waited"},
+    {"clock_i2c_lock_timeouts_total", "", "I2C lock acquisitions that failed"},
+    {"clock_nvs_writes_total", "", "Preferences writes issued to flash"},
+    {"clock_nvs_writes_avoided_total", "",
+     "Deferred settings writes coalesced or skipped as unchanged"},
+    {"clock_audio_underruns_total", "",
+     "Times the decoder found the read-ahead buffer empty"},
+    {"clock_audio_read_bursts_total", "", "Read-ahead bursts from storage"},
+    {"clock_audio_read_bytes_total", "", "Bytes read by read-ahead bursts"},
+    {"clock_audio_cpu_microseconds_total", "path=\"mp3\"",
+     "Time inside the decode call, excluding lock waits and SD reads"},
+    {"clock_audio_cpu_microseconds_total", "path=\"native\"",
+     "Time inside the decode call, excluding lock waits and SD reads"},
+    {"clock_audio_playback_milliseconds_total", "path=\"mp3\"",
+     "Time with audio playing"},
+    {"clock_audio_playback_milliseconds_total", "path=\"native\"",
+     "Time with audio playing"},
+    {"clock_sd_mounts_total", "", "SD card initializations"},
+    {"clock_sd_mount_reuses_total", "",
+     "SD sessions served by an already mounted card"},
+    {"clock_sd_idle_unmounts_total", "", "SD unmounts after the idle timeout"},
+    {"clock_spi_busy_microseconds_total", "device=\"display\"",
+     "Shared SPI bus hold time by device"},
+    {"clock_spi_busy_microseconds_total", "device=\"sd\"",
+     "Shared SPI bus hold time by device"},
+    {"clock_spi_urgent_yields_total", "",
+     "Times a panel update handed the bus to an urgent SD read"},
+};
+
+const SeriesInfo GAUGES[Metrics::GAUGE_COUNT] = {
+    {"clock_heap_free_bytes", "", "Free heap"},
+    {"clock_heap_min_free_bytes", "", "Lowest free heap since boot"},
+    {"clock_heap_largest_block_bytes", "", "Largest allocatable heap block"},
+    {"clock_uptime_seconds", "", "Seconds since boot"},
+};
+
+const HistogramInfo HISTOGRAMS[Metrics::HISTOGRAM_COUNT] = {
+    {{"clock_panel_refresh_duration_milliseconds", "",
+      "E-paper refresh busy time"},
+     {200, 400, 800, 1500, 3000, 6000},
+     6},
+    {{"clock_i2c_lock_wait_microseconds", "",
+      "Wait time of contended I2C lock acquisitions"},
+     {50, 200, 1000, 5000, 20000, 100000},
+     6},
+    {{"clock_audio_buffer_fill_percent", "",
+      "Read-ahead buffer fill sampled during playback"},
+     {10, 25, 50, 75, 90},
+     5},
+    {{"clock_audio_read_burst_microseconds", "",
+      "Duration of one read-ahead burst"},
+     {2000, 5000, 10000, 20000, 50000, 100000},
+     6},
+    {{"clock_alarm_start_latency_milliseconds", "",
+      "Alarm trigger to first decoded audio"},
+     {10, 50, 100, 250, 500, 1000, 3000, 6000},
+     8},
+    {{"clock_sd_mount_milliseconds", "", "SD card initialization time"},
+     {20, 50, 100, 200, 500, 1000},
+     6},
+    {{"clock_spi_urgent_wait_microseconds", "",
+      "Wait for the shared SPI bus by urgent SD reads"},
+     {100, 500, 2000, 5000, 10000, 20000},
+     6},
+};
+
+portMUX_TYPE metricsMux = portMUX_INITIALIZER_UNLOCKED;
+uint64_t counterValues[Metrics::COUNTER_COUNT] = {};
+int32_t gaugeValues[Metrics::GAUGE_COUNT] = {};
+HistogramData histogramValues[Metrics::HISTOGRAM_COUNT] = {};
+
+void appendSeriesHeader(String &out, const SeriesInfo &info,
+                        const char *&lastFamily, const char *type) {
+  if (lastFamily != nullptr && strcmp(lastFamily, info.name) == 0) {
+    return;
+  }
+  lastFamily = info.name;
+  out += "# HELP ";
+  out += info.name;
+  out += ' ';
+  out += info.help;
+  out += "\n# TYPE ";
+  out += info.name;
+  out += ' ';
+  out += type;
+  out += '\n';
+}
+
+void appendSample(String &out, const char *name, const char *suffix,
+                  const char *labels, const char *extraLabel,
+                  unsigned long long value) {
+  char line[160];
+  bool hasLabels = labels[0] != '\0';
+  bool hasExtra = extraLabel != nullptr;
+  snprintf(line, sizeof(line), "%s%s%s%s%s%s%s %llu\n", name, suffix,
+           hasLabels || hasExtra ? "{" : "", labels,
+           hasLabels && hasExtra ? "," : "", hasExtra ? extraLabel : "",
+           hasLabels || hasExtra ? "}" : "", value);
+  out += line;
+}
+} // namespace
+
+namespace Metrics {
+
+void add(Counter counter, uint32_t delta) {
+  portENTER_CRITICAL_SAFE(&metricsMux);
+  counterValues[counter] += delta;
+  portEXIT_CRITICAL_SAFE(&metricsMux);
+}
+
+void set(Gauge gauge, int32_t value) {
+  portENTER_CRITICAL_SAFE(&metricsMux);
+  gaugeValues[gauge] = value;
+  portEXIT_CRITICAL_SAFE(&metricsMux);
+}
+
+void observe(Histogram histogram, uint32_t value) {
+  const HistogramInfo &info = HISTOGRAMS[histogram];
+  uint8_t bucket = 0;
+  while (bucket < info.boundCount && value > info.bounds[bucket]) {
+    ++bucket;
+  }
+  portENTER_CRITICAL_SAFE(&metricsMux);
+  HistogramData &data = histogramValues[histogram];
+  data.buckets[bucket]++;
+  data.sum += value;
+  data.count++;
+  portEXIT_CRITICAL_SAFE(&metricsMux);
+}
+
+void recordWakeCause(int wakeupCause) {
+  switch (wakeupCause) {
+  case ESP_SLEEP_WAKEUP_TIMER:
+    add(WAKE_TIMER);
+    break;
+  case ESP_SLEEP_WAKEUP_GPIO:
+    add(WAKE_GPIO);
+    break;
+  default:
+    add(WAKE_OTHER);
+    break;
+  }
+}
+
+void writePrometheus(String &out) {
+  // 关键逻辑：临界区内只做内存拷贝，字符串拼接放到锁外，
+  // 抓取再慢也不会让其他核上的累加操作自旋等待。
+  uint64_t counters[COUNTER_COUNT];
+  int32_t gauges[GAUGE_COUNT];
+  HistogramData histograms[HISTOGRAM_COUNT];
+  portENTER_CRITICAL(&metricsMux);
+  memcpy(counters, counterValues, sizeof(counters));
+  memcpy(gauges, gaugeValues, sizeof(gauges));
+  memcpy(histograms, histogramValues, sizeof(histograms));
+  portEXIT_CRITICAL(&metricsMux);
+
+  const char *lastFamily = nullptr;
+  for (uint8_t i = 0; i < COUNTER_COUNT; ++i) {
+    appendSeriesHeader(out, COUNTERS[i], lastFamily, "counter");
+    appendSample(out, COUNTERS[i].name, "", COUNTERS[i].labels, nullptr,
+                 counters[i]);
+  }
+  for (uint8_t i = 0; i < GAUGE_COUNT; ++i) {
+    appendSeriesHeader(out, GAUGES[i], lastFamily, "gauge");
+    char line[96];
+    snprintf(line, sizeof(line), "%s %ld\n", GAUGES[i].name,
+             static_cast<long>(gauges[i]));
+    out += line;
+  }
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; ++i) {
+    const HistogramInfo &info = HISTOGRAMS[i];
+    appendSeriesHeader(out, info.series, lastFamily, "histogram");
+    unsigned long long cumulative = 0;
+    char le[24];
+    for (uint8_t bucket = 0; bucket <= info.boundCount; ++bucket) {
+      cumulative += histograms[i].buckets[bucket];
+      if (bucket < info.boundCount) {
+        snprintf(le, sizeof(le), "le=\"%lu\"",
+                 static_cast<unsigned long>(info.bounds[bucket]));
+      } else {
+        snprintf(le, sizeof(le), "le=\"+Inf\"");
+      }
+      appendSample(out, info.series.name, "_bucket", info.series.labels, le,
+                   cumulative);
+    }
+    appendSample(out, info.series.name, "_sum", info.series.labels, nullptr,
+                 histograms[i].sum);
+    appendSample(out, info.series.name, "_count", info.series.labels, nullptr,
+                 histograms[i].count);
+  }
+}
+
+} // namespace Metrics
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+
+// 运行时指标登记表：序列在编译期固定，任意任务/核心都可以直接累加，
+// 只在 /metrics 抓取时统一拷贝快照并输出 Prometheus 文本格式。
+namespace Metrics {
+
+enum Counter : uint8_t {
+  PANEL_REFRESH_FULL,
+  PANEL_REFRESH_PARTIAL,
+  LIGHT_SLEEP_ENTRIES,
+  LIGHT_SLEEP_MS,
+  WAKE_TIMER,
+  WAKE_GPIO,
+  WAKE_OTHER,
+  WIFI_SESSIONS,
+  WIFI_SESSION_MS,
+  HTTP_CLIENT_RX_BYTES,
+  WEB_TX_BYTES,
+  WEB_RX_BYTES,
+  I2C_LOCK_CONTENDED,
+  I2C_LOCK_TIMEOUTS,
+  NVS_WRITES,
+  NVS_WRITES_AVOIDED,
+  AUDIO_UNDERRUNS,
+  AUDIO_READ_BURSTS,
+  AUDIO_READ_BYTES,
+  AUDIO_CPU_US_MP3,
+  AUDIO_CPU_US_NATIVE,
+  AUDIO_PLAY_MS_MP3,
+  AUDIO_PLAY_MS_NATIVE,
+  SD_MOUNTS,
+  SD_MOUNT_REUSES,
+  SD_IDLE_UNMOUNTS,
+  SPI_BUSY_US_DISPLAY,
+  SPI_BUSY_US_SD,
+  SPI_URGENT_YIELDS,
+  COUNTER_COUNT
+};
+
+enum Gauge : uint8_t {
+  HEAP_FREE_BYTES,
+  HEAP_MIN_FREE_BYTES,
+  HEAP_LARGEST_BLOCK_BYTES,
+  UPTIME_SECONDS,
+  GAUGE_COUNT
+};
+
+enum Histogram : uint8_t {
+  PANEL_REFRESH_MS,
+  I2C_LOCK_WAIT_US,
+  AUDIO_BUFFER_FILL_PERCENT,
+  AUDIO_READ_BURST_US,
+  ALARM_START_LATENCY_MS,
+  SD_MOUNT_MS,
+  SPI_URGENT_WAIT_US,
+  HISTOGRAM_COUNT
+};
+
+void add(Counter counter, uint32_t delta = 1);
+void set(Gauge gauge, int32_t value);
+void observe(Histogram histogram, uint32_t value);
+void recordWakeCause(int wakeupCause);
+// 以 Prometheus 0.0.4 文本格式追加全部序列。
+void writePrometheus(String &out);
+
+} // namespace Metrics
@@ -0,0 +1,667 @@
+#include "Mp3Metadata.h"
+#include <string.h>
+
+namespace {
+constexpr size_t ID3V2_HEADER_SIZE = 10;
+constexpr uint8_t ID3V2_FLAG_UNSYNC = 0x80;
+constexpr uint8_t ID3V2_FLAG_EXTENDED = 0x40;
+constexpr uint8_t ID3V2_FLAG_FOOTER = 0x10;
+// 帧格式标志（帧头第 10 字节）：分组标识占 1 字节、v2.4 数据长度指示占
+// 4 字节 syncsafe 整数，都位于帧体之前，读取文本时需跳过。
+constexpr uint8_t ID3V23_FRAME_GROUPING = 0x20;
+constexpr uint8_t ID3V24_FRAME_GROUPING = 0x40;
+constexpr uint8_t ID3V24_FRAME_DATA_LENGTH = 0x01;
+constexpr size_t VBRI_OFFSET = 4 + 32;
+constexpr size_t LAME_GAPLESS_OFFSET = 21;
+constexpr uint32_t TOC_FRACTION = 1024; // 百分点内插的定点精度
+
+const uint16_t BITRATES_MPEG1_L3[16] = {0,   32,  40,  48,  56,  64,
+                                        80,  96,  112, 128, 160, 192,
+                                        224, 256, 320, 0};
+const uint16_t BITRATES_MPEG2_L3[16] = {0,  8,  16, 24,  32,  40,  48,  56,
+                                        64, 80, 96, 112, 128, 144, 160, 0};
+const uint32_t SAMPLE_RATES_MPEG1[3] = {44100, 48000, 32000};
+
+uint32_t readBE32(const uint8_t *data) {
+  return (static_cast<uint32_t>(data[0]) << 24) |
+         (static_cast<uint32_t>(data[1]) << 16) |
+         (static_cast<uint32_t>(data[2]) << 8) | data[3];
+}
+
+uint32_t readBE24(const uint8_t *data) {
+  return (static_cast<uint32_t>(data[0]) << 16) |
+         (static_cast<uint32_t>(data[1]) << 8) | data[2];
+}
+
+uint32_t readSyncsafe(const uint8_t *data) {
+  return (static_cast<uint32_t>(data[0] & 0x7F) << 21) |
+         (static_cast<uint32_t>(data[1] & 0x7F) << 14) |
+         (static_cast<uint32_t>(data[2] & 0x7F) << 7) | (data[3] & 0x7F);
+}
+
+// 追加一个码点；放不下时返回 false，输出始终在完整字符处截断。
+bool appendCodepoint(char *out, size_t size, size_t &used, uint32_t cp) {
+  uint8_t bytes[4];
+  size_t count;
+  if (cp < 0x80) {
+    bytes[0] = static_cast<uint8_t>(cp);
+    count = 1;
+  } else if (cp < 0x800) {
+    bytes[0] = static_cast<uint8_t>(0xC0 | (cp >> 6));
+    bytes[1] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    count = 2;
+  } else if (cp < 0x10000) {
+    bytes[0] = static_cast<uint8_t>(0xE0 | (cp >> 12));
+    bytes[1] = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F));
+    bytes[2] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    count = 3;
+  } else {
+    bytes[0] = static_cast<uint8_t>(0xF0 | (cp >> 18));
+    bytes[1] = static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3F));
+    bytes[2] = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F));
+    bytes[3] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    count = 4;
+  }
+  if (used + count >= size) {
+    return false;
+  }
+  memcpy(out + used, bytes, count);
+  used += count;
+  return true;
+}
+
+void trimTrailingSpaces(char *out, size_t &used) {
+  while (used > 0 && out[used - 1] == ' ') {
+    --used;
+  }
+  out[used] = '\0';
+}
+
+void decodeLatin1(const uint8_t *data, size_t length, char *out, size_t size,
+                  size_t &used) {
+  for (size_t i = 0; i < length && data[i] != 0; ++i) {
+    if (!appendCodepoint(out, size, used, data[i])) {
+      break;
+    }
+  }
+}
+
+void decodeUtf8(const uint8_t *data, size_t length, char *out, size_t size,
+                size_t &used) {
+  size_t i = 0;
+  while (i < length && data[i] != 0) {
+    uint8_t lead = data[i];
+    size_t count = lead < 0x80 ? 1
+                   : (lead & 0xE0) == 0xC0 ? 2
+                   : (lead & 0xF0) == 0xE0 ? 3
+                   : (lead & 0xF8) == 0xF0 ? 4
+                                           : 0;
+    if (count == 0) {
+      ++i; // 跳过非法首字节
+      continue;
+    }
+    if (i + count > length || used + count >= size) {
+      break;
+    }
+    memcpy(out + used, data + i, count);
+    used += count;
+    i += count;
+  }
+}
+
+void decodeUtf16(const uint8_t *data, size_t length, bool bigEndian,
+                 char *out, size_t size, size_t &used) {
+  size_t i = 0;
+  if (length >= 2 && ((data[0] == 0xFF && data[1] == 0xFE) ||
+                      (data[0] == 0xFE && data[1] == 0xFF))) {
+    bigEndian = data[0] == 0xFE;
+    i = 2;
+  }
+  while (i + 1 < length) {
+    uint32_t unit = bigEndian ? (data[i] << 8) | data[i + 1]
+                              : (data[i + 1] << 8) | data[i];
+    i += 2;
+    if (unit == 0) {
+      break;
+    }
+    if (unit >= 0xD800 && unit < 0xDC00 && i + 1 < length) {
+      uint32_t low = bigEndian ? (data[i] << 8) | data[i + 1]
+                               : (data[i + 1] << 8) | data[i];
+      if (low >= 0xDC00 && low < 0xE000) {
+        unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+        i += 2;
+      }
+    }
+    if (!appendCodepoint(out, size, used, unit)) {
+      break;
+    }
+  }
+}
+
+// ID3v2 文本帧：首字节为编码，0 = ISO-8859-1，1 = 带 BOM 的 UTF-16，
+// 2 = UTF-16BE，3 = UTF-8。统一转换为 UTF-8。
+void decodeTextFrame(const uint8_t *data, size_t length, char *out,
+                     size_t size) {
+  if (length < 2) {
+    return;
+  }
+  size_t used = 0;
+  switch (data[0]) {
+  case 0:
+    decodeLatin1(data + 1, length - 1, out, size, used);
+    break;
+  case 1:
+  case 2:
+    decodeUtf16(data + 1, length - 1, data[0] == 2, out, size, used);
+    break;
+  case 3:
+    decodeUtf8(data + 1, length - 1, out, size, used);
+    break;
+  default:
+    break;
+  }
+  trimTrailingSpaces(out, used);
+}
+
+bool isFrameReadable(const uint8_t *frame, uint8_t major) {
+  // 压缩、加密或帧级反同步的内容无法直接按文本读取，直接跳过。
+  if (major == 3) {
+    return (frame[9] & 0xC0) == 0;
+  }
+  if (major == 4) {
+    return (frame[9] & 0x0E) == 0;
+  }
+  return true;
+}
+
+// 帧体前附加字段的总长度；顺序为分组标识在前、数据长度指示在后。
+size_t frameBodyPrefix(const uint8_t *frame, uint8_t major) {
+  uint8_t format = frame[9];
+  if (major == 3) {
+    return (format & ID3V23_FRAME_GROUPING) ? 1 : 0;
+  }
+  if (major == 4) {
+    return ((format & ID3V24_FRAME_GROUPING) ? 1 : 0) +
+           ((format & ID3V24_FRAME_DATA_LENGTH) ? 4 : 0);
+  }
+  return 0;
+}
+
+// LAME 扩展头紧跟在 Xing 字段之后：9 字节编码器版本串，第 21~23 字节为
+// 12 位编码器延迟 + 12 位尾部补零。ffmpeg 写入同格式的 "Lavc"/"Lavf" 头。
+void applyLameExtension(const uint8_t *lame, size_t available,
+                        Mp3Metadata::StreamInfo &info) {
+  if (available < LAME_GAPLESS_OFFSET + 3) {
+    return;
+  }
+  if (memcmp(lame, "LAME", 4) != 0 && memcmp(lame, "Lavc", 4) != 0 &&
+      memcmp(lame, "Lavf", 4) != 0) {
+    return;
+  }
+  const uint8_t *gapless = lame + LAME_GAPLESS_OFFSET;
+  info.encoderDelay =
+      static_cast<uint16_t>((gapless[0] << 4) | (gapless[1] >> 4));
+  info.encoderPadding =
+      static_cast<uint16_t>(((gapless[1] & 0x0F) << 8) | gapless[2]);
+}
+
+void applyXingHeader(const uint8_t *frame, size_t available,
+                     const Mp3Metadata::FrameHeader &header,
+                     Mp3Metadata::StreamInfo &info) {
+  size_t offset = 4 + header.sideInfoLength;
+  if (offset + 8 > available) {
+    return;
+  }
+  const uint8_t *tag = frame + offset;
+  bool xing = memcmp(tag, "Xing", 4) == 0;
+  if (!xing && memcmp(tag, "Info", 4) != 0) {
+    return;
+  }
+  info.leadFrameLength = header.frameLength;
+  uint32_t flags = readBE32(tag + 4);
+  size_t cursor = 8;
+  if ((flags & 0x01) && offset + cursor + 4 <= available) {
+    info.frameCount = readBE32(tag + cursor);
+    cursor += 4;
+  }
+  if ((flags & 0x02) && offset + cursor + 4 <= available) {
+    uint32_t bytes = readBE32(tag + cursor);
+    if (bytes > 0 && bytes < info.audioLength) {
+      info.audioLength = bytes;
+    }
+    cursor += 4;
+  }
+  if (flags & 0x04) {
+    if (offset + cursor + Mp3Metadata::TOC_SIZE <= available) {
+      memcpy(info.toc, tag + cursor, Mp3Metadata::TOC_SIZE);
+      info.hasToc = true;
+    }
+    cursor += Mp3Metadata::TOC_SIZE;
+  }
+  if (flags & 0x08) {
+    cursor += 4; // VBR quality
+  }
+  applyLameExtension(tag + cursor,
+                     offset + cursor < available ? available - offset - cursor
+                                                 : 0,
+                     info);
+  // "Info" 是 LAME 为 CBR 文件写的同格式头，帧数同样精确，但码率不需要折算。
+  info.vbr = xing && info.frameCount > 0;
+}
+
+void applyVbriHeader(const uint8_t *frame, size_t available,
+                     const Mp3Metadata::FrameHeader &header,
+                     Mp3Metadata::StreamInfo &info) {
+  if (VBRI_OFFSET + 18 > available ||
+      memcmp(frame + VBRI_OFFSET, "VBRI", 4) != 0) {
+    return;
+  }
+  info.leadFrameLength = header.frameLength;
+  info.frameCount = readBE32(frame + VBRI_OFFSET + 14);
+  info.vbr = info.frameCount > 0;
+}
+} // namespace
+
+namespace Mp3Metadata {
+
+bool parseFrameHeader(const uint8_t *data, FrameHeader &header) {
+  if (data[0] != 0xFF || (data[1] & 0xE0) != 0xE0) {
+    return false;
+  }
+  uint8_t versionBits = (data[1] >> 3) & 0x03;
+  uint8_t layerBits = (data[1] >> 1) & 0x03;
+  uint8_t bitrateIndex = data[2] >> 4;
+  uint8_t rateIndex = (data[2] >> 2) & 0x03;
+  if (versionBits == 1 || layerBits != 1 || bitrateIndex == 0 ||
+      bitrateIndex == 15 || rateIndex == 3) {
+    return false;
+  }
+  bool mpeg1 = versionBits == 3;
+  bool mono = (data[3] >> 6) == 3;
+  header.version = mpeg1 ? 1 : (versionBits == 2 ? 2 : 25);
+  header.sampleRate =
+      SAMPLE_RATES_MPEG1[rateIndex] >> (mpeg1 ? 0 : (versionBits == 2 ? 1 : 2));
+  header.bitrateKbps =
+      mpeg1 ? BITRATES_MPEG1_L3[bitrateIndex] : BITRATES_MPEG2_L3[bitrateIndex];
+  header.samplesPerFrame = mpeg1 ? 1152 : 576;
+  header.sideInfoLength = mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17);
+  header.frameLength = static_cast<uint16_t>(
+      (mpeg1 ? 144000UL : 72000UL) * header.bitrateKbps / header.sampleRate +
+      ((data[2] >> 1) & 0x01));
+  return true;
+}
+
+uint32_t parseId3v2(const uint8_t *data, size_t length, Tags &tags) {
+  if (length < ID3V2_HEADER_SIZE || memcmp(data, "ID3", 3) != 0 ||
+      ((data[6] | data[7] | data[8] | data[9]) & 0x80) != 0) {
+    return 0;
+  }
+  uint8_t major = data[3];
+  uint8_t flags = data[5];
+  uint32_t tagSize = readSyncsafe(data + 6);
+  uint32_t total = ID3V2_HEADER_SIZE + tagSize +
+                   ((flags & ID3V2_FLAG_FOOTER) ? ID3V2_HEADER_SIZE : 0);
+  // v2.2/v2.3 的整标签反同步会改写 UTF-16 BOM，这类标签只取长度不解析帧。
+  if (major < 2 || major > 4 || (major < 4 && (flags & ID3V2_FLAG_UNSYNC))) {
+    return total;
+  }
+
+  size_t end = ID3V2_HEADER_SIZE + tagSize;
+  if (end > length) {
+    end = length;
+  }
+  size_t pos = ID3V2_HEADER_SIZE;
+  if ((flags & ID3V2_FLAG_EXTENDED) && major >= 3 && pos + 4 <= end) {
+    pos += major == 3 ? 4 + readBE32(data + pos) : readSyncsafe(data + pos);
+  }
+
+  size_t idLength = major == 2 ? 3 : 4;
+  size_t headerLength = major == 2 ? 6 : 10;
+  const char *titleId = major == 2 ? "TT2" : "TIT2";
+  const char *artistId = major == 2 ? "TP1" : "TPE1";
+  while (pos + headerLength <= end) {
+    const uint8_t *frame = data + pos;
+    if (frame[0] == 0) {
+      break; // 进入填充区
+    }
+    uint32_t size = major == 2   ? readBE24(frame + 3)
+                    : major == 4 ? readSyncsafe(frame + 4)
+                                 : readBE32(frame + 4);
+    // 关键逻辑：帧超出已读窗口就停止，封面等大帧之后的标签宁可放弃，
+    // 也不为它多读 SD；标题和艺术家通常写在封面之前。
+    if (size > end - pos - headerLength) {
+      break;
+    }
+    size_t prefix = frameBodyPrefix(frame, major);
+    if (isFrameReadable(frame, major) && prefix <= size) {
+      const uint8_t *body = frame + headerLength + prefix;
+      size_t bodyLength = size - prefix;
+      if (tags.title[0] == '\0' && memcmp(frame, titleId, idLength) == 0) {
+        decodeTextFrame(body, bodyLength, tags.title, sizeof(tags.title));
+      } else if (tags.artist[0] == '\0' &&
+                 memcmp(frame, artistId, idLength) == 0) {
+        decodeTextFrame(body, bodyLength, tags.artist, sizeof(tags.artist));
+      }
+    }
+    pos += headerLength + size;
+  }
+  return total;
+}
+
+bool parseId3v1(const uint8_t *data, size_t length, Tags &tags) {
+  if (length < ID3V1_SIZE || memcmp(data, "TAG", 3) != 0) {
+    return false;
+  }
+  // ID3v1 没有编码声明，按 ISO-8859-1 处理；字段以空格或 NUL 填充到 30 字节。
+  size_t used = 0;
+  if (tags.title[0] == '\0') {
+    decodeLatin1(data + 3, 30, tags.title, sizeof(tags.title), used);
+    trimTrailingSpaces(tags.title, used);
+  }
+  used = 0;
+  if (tags.artist[0] == '\0') {
+    decodeLatin1(data + 33, 30, tags.artist, sizeof(tags.artist), used);
+    trimTrailingSpaces(tags.artist, used);
+  }
+  return true;
+}
+
+bool parseStream(const uint8_t *data, size_t length, uint32_t dataOffset,
+                 uint32_t audioEnd, StreamInfo &info) {
+  FrameHeader header;
+  FrameHeader following;
+  for (size_t pos = 0; pos + 4 <= length; ++pos) {
+    if (!parseFrameHeader(data + pos, header)) {
+      continue;
+    }
+    // 关键逻辑：下一帧落在窗口内时必须同样是兼容帧头，
+    // 排除封面残留或填充区里偶然出现的伪同步字。
+    size_t next = pos + header.frameLength;
+    if (next + 4 <= length &&
+        (!parseFrameHeader(data + next, following) ||
+         following.version != header.version ||
+         following.sampleRate != header.sampleRate)) {
+      continue;
+    }
+
+    memset(&info, 0, sizeof(info));
+    info.firstFrameOffset = dataOffset + static_cast<uint32_t>(pos);
+    info.audioLength =
+        audioEnd > info.firstFrameOffset ? audioEnd - info.firstFrameOffset : 0;
+    info.sampleRate = header.sampleRate;
+    info.samplesPerFrame = header.samplesPerFrame;
+    info.bitrateKbps = header.bitrateKbps;
+    applyXingHeader(data + pos, length - pos, header, info);
+    if (info.frameCount == 0) {
+      applyVbriHeader(data + pos, length - pos, header, info);
+    }
+
+    uint32_t audioBytes = info.audioLength;
+    if (info.frameCount > 0) {
+      uint64_t samples =
+          static_cast<uint64_t>(info.frameCount) * info.samplesPerFrame;
+      uint32_t trimmed = info.encoderDelay + info.encoderPadding;
+      if (samples > trimmed) {
+        samples -= trimmed;
+      }
+      info.durationMs =
+          static_cast<uint32_t>(samples * 1000ULL / info.sampleRate);
+      if (info.vbr && info.durationMs > 0) {
+        info.bitrateKbps = static_cast<uint16_t>(
+            static_cast<uint64_t>(audioBytes) * 8ULL / info.durationMs);
+      }
+    } else {
+      // 没有帧数信息时按 CBR 估算：字节数 * 8 / kbps 正好得到毫秒。
+      info.durationMs = static_cast<uint32_t>(
+          static_cast<uint64_t>(audioBytes) * 8ULL / info.bitrateKbps);
+    }
+    return true;
+  }
+  return false;
+}
+
+uint32_t seekOffsetForTime(const uint8_t *toc, uint32_t audioLength,
+                           uint32_t positionMs, uint32_t durationMs) {
+  if (durationMs == 0 || audioLength == 0) {
+    return 0;
+  }
+  if (positionMs >= durationMs) {
+    positionMs = durationMs - 1;
+  }
+  if (toc == nullptr) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(positionMs) *
+                                 audioLength / durationMs);
+  }
+  // 与 mpg123 等解码器一致：在相邻两个百分点之间线性内插。
+  uint64_t scaled = static_cast<uint64_t>(positionMs) * TOC_SIZE *
+                    TOC_FRACTION / durationMs;
+  uint32_t percent = static_cast<uint32_t>(scaled / TOC_FRACTION);
+  uint32_t fraction = static_cast<uint32_t>(scaled % TOC_FRACTION);
+  int32_t low = toc[percent];
+  int32_t high = percent + 1 < TOC_SIZE ? toc[percent + 1] : 256;
+  int64_t position = static_cast<int64_t>(low) * TOC_FRACTION +
+                     static_cast<int64_t>(high - low) * fraction;
+  if (position < 0) {
+    position = 0;
+  }
+  return static_cast<uint32_t>(position * audioLength / (256 * TOC_FRACTION));
+}
+
+uint32_t timeForSeekOffset(const uint8_t *toc, uint32_t audioLength,
+                           uint32_t offset, uint32_t durationMs) {
+  if (durationMs == 0 || audioLength == 0) {
+    return 0;
+  }
+  if (offset >= audioLength) {
+    return durationMs;
+  }
+  if (toc == nullptr) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(offset) * durationMs /
+                                 audioLength);
+  }
+  uint64_t position =
+      static_cast<uint64_t>(offset) * 256 * TOC_FRACTION / audioLength;
+  uint32_t percent = 0;
+  while (percent + 1 < TOC_SIZE &&
+         static_cast<uint64_t>(toc[percent + 1]) * TOC_FRACTION <= position) {
+    ++percent;
+  }
+  uint64_t low = static_cast<uint64_t>(toc[percent]) * TOC_FRACTION;
+  uint64_t high =
+      static_cast<uint64_t>(percent + 1 < TOC_SIZE ? toc[percent + 1] : 256) *
+      TOC_FRACTION;
+  uint64_t fraction = high > low && position > low
+                          ? (position - low) * TOC_FRACTION / (high - low)
+                          : 0;
+  if (fraction > TOC_FRACTION) {
+    fraction = TOC_FRACTION;
+  }
+  uint64_t scaled = static_cast<uint64_t>(percent) * TOC_FRACTION + fraction;
+  return static_cast<uint32_t>(scaled * durationMs / (TOC_SIZE * TOC_FRACTION));
+}
+
+void initSeekTable(const StreamInfo &info, SeekTable &table) {
+  memset(&table, 0, sizeof(table));
+  table.sampleRate = static_cast<uint16_t>(info.sampleRate);
+  table.samplesPerFrame = info.samplesPerFrame;
+  table.cbrBitrateKbps = info.vbr ? 0 : info.bitrateKbps;
+  table.leadFrameLength = info.leadFrameLength;
+}
+
+uint32_t frameForTime(const SeekTable &table, uint32_t positionMs,
+                      uint16_t encoderDelay) {
+  if (table.sampleRate == 0 || table.samplesPerFrame == 0) {
+    return 0;
+  }
+  uint64_t sample =
+      static_cast<uint64_t>(positionMs) * table.sampleRate / 1000 +
+      encoderDelay;
+  return static_cast<uint32_t>(sample / table.samplesPerFrame);
+}
+
+bool planSeek(const SeekTable &table, uint32_t targetFrame, uint32_t &start,
+              uint32_t &frames) {
+  if (table.sampleRate == 0 || table.samplesPerFrame == 0) {
+    return false;
+  }
+  if (table.anchorCount > 0) {
+    uint32_t anchor = targetFrame / table.anchorStep;
+    if (anchor >= table.anchorCount) {
+      anchor = table.anchorCount - 1;
+    }
+    start = table.anchors[anchor];
+    frames = targetFrame - anchor * table.anchorStep;
+    return true;
+  }
+  if (table.cbrBitrateKbps == 0) {
+    return false;
+  }
+  // 关键逻辑：CBR 各帧长度只因填充位相差 1 字节，第 k 帧帧头与按平均帧长
+  // 算出的位置最多差 1 字节；退后半帧交给解码器同步，落点正好是第 k 帧。
+  uint64_t frameBytes = static_cast<uint64_t>(table.samplesPerFrame) *
+                        table.cbrBitrateKbps * 125; // 再除以采样率即为字节
+  uint32_t position =
+      static_cast<uint32_t>(targetFrame * frameBytes / table.sampleRate);
+  uint32_t half = static_cast<uint32_t>(frameBytes / table.sampleRate / 2);
+  start = table.leadFrameLength + (targetFrame > 0 ? position - half : 0);
+  frames = 0;
+  return true;
+}
+
+bool timeForOffset(const SeekTable &table, uint32_t offset,
+                   uint16_t encoderDelay, uint32_t &positionMs) {
+  if (table.sampleRate == 0 || table.samplesPerFrame == 0) {
+    return false;
+  }
+  uint64_t samples = 0;
+  if (table.anchorCount > 0) {
+    uint32_t i = 0;
+    while (i + 1 < table.anchorCount && table.anchors[i + 1] <= offset) {
+      ++i;
+    }
+    // 锚点之间按字节比例内插；末个锚点之后沿用前一段的平均帧长。
+    uint32_t low = table.anchors[i];
+    uint32_t span = i + 1 < table.anchorCount ? table.anchors[i + 1] - low
+                    : i > 0                   ? low - table.anchors[i - 1]
+                                              : 0;
+    uint64_t frameSamples =
+        static_cast<uint64_t>(table.anchorStep) * table.samplesPerFrame;
+    samples = i * frameSamples;
+    if (offset > low && span > 0) {
+      samples += (offset - low) * frameSamples / span;
+    }
+  } else if (table.cbrBitrateKbps > 0) {
+    uint32_t bytes =
+        offset > table.leadFrameLength ? offset - table.leadFrameLength : 0;
+    samples = static_cast<uint64_t>(bytes) * table.sampleRate /
+              (table.cbrBitrateKbps * 125UL);
+  } else {
+    return false;
+  }
+  samples = samples > encoderDelay ? samples - encoderDelay : 0;
+  positionMs = static_cast<uint32_t>(samples * 1000 / table.sampleRate);
+  return true;
+}
+
+void FrameScanner::begin(uint32_t start, uint32_t length, uint32_t duration,
+                         const SeekTable &layout) {
+  audioStart = start;
+  audioLength = length;
+  durationMs = duration;
+  leadFrameEnd = start + layout.leadFrameLength;
+  elapsedSamples = 0;
+  nextOffset = start;
+  audioFrames = 0;
+  anchorCount = 0;
+  entries = 0;
+  // 按声明时长估出总帧数，让锚点大致均匀铺满全曲；多出的两帧覆盖
+  // 编码器延迟与尾部补零。
+  uint64_t frames = 0;
+  if (layout.sampleRate > 0 && layout.samplesPerFrame > 0) {
+    frames = static_cast<uint64_t>(duration) * layout.sampleRate / 1000 /
+                 layout.samplesPerFrame +
+             2;
+  }
+  uint64_t step = (frames + SEEK_ANCHORS - 1) / SEEK_ANCHORS;
+  anchorStep = static_cast<uint16_t>(step == 0 ? 1 : step > 0xFFFF ? 0xFFFF
+                                                                   : step);
+}
+
+uint32_t FrameScanner::feed(const uint8_t *data, size_t length,
+                            uint32_t offset) {
+  FrameHeader header;
+  while (!isDone() && nextOffset >= offset &&
+         nextOffset - offset + 4 <= length) {
+    const uint8_t *frame = data + (nextOffset - offset);
+    if (!parseFrameHeader(frame, header)) {
+      ++nextOffset; // 丢失同步后逐字节寻找下一个帧头
+      continue;
+    }
+    // 关键逻辑：当前帧的起始时刻越过下一个百分点时，
+    // 记录该帧相对首帧的字节比例，与 Xing TOC 的语义保持一致。
+    while (entries < TOC_SIZE &&
+           elapsedSamples * 1000ULL * TOC_SIZE >=
+               static_cast<uint64_t>(entries) * durationMs *
+                   header.sampleRate) {
+      uint64_t ratio =
+          static_cast<uint64_t>(nextOffset - audioStart) * 256 / audioLength;
+      table[entries++] = static_cast<uint8_t>(ratio > 255 ? 255 : ratio);
+    }
+    if (nextOffset >= leadFrameEnd) {
+      if (audioFrames % anchorStep == 0 && anchorCount < SEEK_ANCHORS) {
+        anchors[anchorCount++] = nextOffset - audioStart;
+      }
+      ++audioFrames;
+    }
+    elapsedSamples += header.samplesPerFrame;
+    nextOffset += header.frameLength;
+  }
+  return nextOffset;
+}
+
+bool FrameScanner::isDone() const {
+  return durationMs == 0 || audioLength == 0 ||
+         (entries >= TOC_SIZE && anchorCount >= SEEK_ANCHORS) ||
+         nextOffset - audioStart + 4 > audioLength;
+}
+
+void FrameScanner::finish(uint8_t *toc) const {
+  uint8_t last = 0;
+  for (size_t i = 0; i < TOC_SIZE; ++i) {
+    if (i < entries) {
+      last = table[i];
+    } else if (entries == 0) {
+      last = static_cast<uint8_t>(i * 256 / TOC_SIZE); // 没有数据时退化为线性
+    }
+    toc[i] = last;
+  }
+}
+
+void FrameScanner::finishAnchors(SeekTable &table) const {
+  table.anchorStep = anchorStep;
+  table.anchorCount = anchorCount;
+  memcpy(table.anchors, anchors, anchorCount * sizeof(anchors[0]));
+}
+
+void FrameWalker::begin(uint32_t start, uint32_t frames) {
+  nextOffset = start;
+  remaining = frames;
+  lost = false;
+}
+
+uint32_t FrameWalker::feed(const uint8_t *data, size_t length,
+                           uint32_t offset) {
+  FrameHeader header;
+  while (!isDone() && nextOffset >= offset &&
+         nextOffset - offset + 4 <= length) {
+    if (!parseFrameHeader(data + (nextOffset - offset), header)) {
+      lost = true;
+      break;
+    }
+    nextOffset += header.frameLength;
+    --remaining;
+  }
+  return nextOffset;
+}
+
+} // namespace Mp3Metadata
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MP3 元数据解析：只处理调用方从文件头尾读入的字节窗口，不依赖 Arduino 或 FS，
+// 可以直接用主机编译器编译，对着样例 MP3 目录核对时长与标签。
+namespace Mp3Metadata {
+constexpr size_t TITLE_SIZE = 48;
+constexpr size_t ARTIST_SIZE = 32;
+constexpr size_t ID3V1_SIZE = 128;
+constexpr size_t TOC_SIZE = 100;
+constexpr size_t SEEK_ANCHORS = 64;
+
+struct Tags {
+  char title[TITLE_SIZE];
+  char artist[ARTIST_SIZE];
+};
+
+struct FrameHeader {
+  uint8_t version; // 1 = MPEG1, 2 = MPEG2, 25 = MPEG2.5
+  uint8_t sideInfoLength;
+  uint16_t bitrateKbps;
+  uint16_t samplesPerFrame;
+  uint16_t frameLength;
+  uint32_t sampleRate;
+};
+
+struct StreamInfo {
+  uint32_t firstFrameOffset; // 相对文件起点
+  uint32_t audioLength;      // Xing 头声明的字节数，否则为首帧到音频结尾
+  uint32_t sampleRate;
+  uint16_t samplesPerFrame;
+  uint16_t bitrateKbps; // CBR 为帧码率，VBR 为按总字节数折算的平均码率
+  uint32_t frameCount;  // 0 表示没有 Xing/VBRI 头，时长按码率估算
+  // LAME 扩展头记录的编码器前置延迟与尾部补零（单位：采样），
+  // durationMs 已扣除这两段，得到无缝播放意义上的实际时长。
+  uint16_t encoderDelay;
+  uint16_t encoderPadding;
+  uint32_t durationMs;
+  // 首帧是 Xing/Info/VBRI 头时的帧长；该帧不含音频，真正的音频从其后开始。
+  uint16_t leadFrameLength;
+  bool vbr;
+  bool hasToc;
+  // Xing 约定的定位表：toc[i] / 256 为 i% 时长处相对首帧的字节比例。
+  uint8_t toc[TOC_SIZE];
+};
+
+// 帧级精确定位表，整体存入媒体索引记录。帧序号从第一个音频帧算起，
+// 偏移相对首帧（与 TOC 相同）。CBR 按帧长直接算出目标帧位置；VBR 需要
+// 逐帧扫描得到锚点，定位时从最近的锚点顺着帧头走到目标帧。
+struct SeekTable {
+  uint16_t sampleRate; // 0 表示尚未解析
+  uint16_t samplesPerFrame;
+  uint16_t cbrBitrateKbps; // CBR 的帧码率；VBR 为 0
+  uint16_t leadFrameLength;
+  uint16_t anchorStep;  // 相邻锚点相隔的帧数
+  uint16_t anchorCount; // 0 表示尚未逐帧扫描
+  uint32_t anchors[SEEK_ANCHORS]; // 第 i * anchorStep 帧的字节偏移
+};
+
+// VBR 文件的一次性逐帧扫描：分块顺序喂入音频数据，逐帧累计后生成与 Xing
+// 同格式的 TOC 和帧级锚点，结果缓存在索引中，只需扫描一次。
+class FrameScanner {
+public:
+  // layout 为 initSeekTable 填好帧布局的定位表，据此跳过首个头帧并确定锚点间隔。
+  void begin(uint32_t audioStart, uint32_t audioLength, uint32_t durationMs,
+             const SeekTable &layout);
+  // data 为从文件偏移 offset 开始的数据；返回下一次应读取的文件偏移，
+  // 跨块边界的帧头会从该偏移处重新读取。
+  uint32_t feed(const uint8_t *data, size_t length, uint32_t offset);
+  bool isDone() const;
+  // 未扫描到的尾部条目沿用最后一个值，保证 toc 单调不减。
+  void finish(uint8_t *toc) const;
+  // 写入已扫描到的锚点；扫描中途放弃时前面的锚点仍然有效。
+  void finishAnchors(SeekTable &table) const;
+
+private:
+  uint32_t audioStart = 0;
+  uint32_t audioLength = 0;
+  uint32_t durationMs = 0;
+  uint32_t leadFrameEnd = 0;
+  uint64_t elapsedSamples = 0;
+  uint32_t nextOffset = 0;
+  uint32_t audioFrames = 0;
+  uint16_t anchorStep = 1;
+  uint16_t anchorCount = 0;
+  uint8_t entries = 0;
+  uint8_t table[TOC_SIZE];
+  uint32_t anchors[SEEK_ANCHORS];
+};
+
+// 从一个帧头位置顺着帧长向后走固定帧数，找到目标帧的帧头。
+// 数据分块喂入，offset 与 start 使用同一基准。
+class FrameWalker {
+public:
+  void begin(uint32_t start, uint32_t frames);
+  uint32_t feed(const uint8_t *data, size_t length, uint32_t offset);
+  bool isDone() const { return remaining == 0 || lost; }
+  // 预期位置不是帧头：锚点已与文件不符，调用方应退回粗定位。
+  bool lostSync() const { return lost; }
+  uint32_t position() const { return nextOffset; }
+
+private:
+  uint32_t nextOffset = 0;
+  uint32_t remaining = 0;
+  bool lost = false;
+};
+
+// 只接受 Layer III 帧头；返回 false 表示不是有效同步字。
+bool parseFrameHeader(const uint8_t *data, FrameHeader &header);
+// 返回整个 ID3v2 标签占用的字节数（含头部和可选尾部），没有标签时返回 0。
+// 只解析 length 范围内完整可见的帧，标题与艺术家以 UTF-8 写入 tags 中仍为空的字段。
+uint32_t parseId3v2(const uint8_t *data, size_t length, Tags &tags);
+// data 为文件最后 128 字节；是 ID3v1 标签时返回 true，并补齐 tags 中仍为空的字段。
+bool parseId3v1(const uint8_t *data, size_t length, Tags &tags);
+// data 是从文件偏移 dataOffset 开始的窗口，audioEnd 为音频数据结束位置
+// （已扣除 ID3v1）。优先使用 Xing/Info/VBRI 头的帧数，否则按 CBR 码率估算时长。
+bool parseStream(const uint8_t *data, size_t length, uint32_t dataOffset,
+                 uint32_t audioEnd, StreamInfo &info);
+// 时间与首帧相对字节偏移互相换算；toc 为空时按 CBR 线性换算。
+uint32_t seekOffsetForTime(const uint8_t *toc, uint32_t audioLength,
+                           uint32_t positionMs, uint32_t durationMs);
+uint32_t timeForSeekOffset(const uint8_t *toc, uint32_t audioLength,
+                           uint32_t offset, uint32_t durationMs);
+
+// 由解析结果填好帧布局；锚点留待逐帧扫描。
+void initSeekTable(const StreamInfo &info, SeekTable &table);
+// 目标时刻所在的音频帧序号；positionMs 与 durationMs 一样不含编码器延迟。
+uint32_t frameForTime(const SeekTable &table, uint32_t positionMs,
+                      uint16_t encoderDelay);
+// 返回 true 时从 start 起再向后走 frames 帧即为目标帧的帧头。CBR 直接给出
+// 目标帧前半帧处的位置且 frames 为 0，解码器在下一个帧头即目标帧处同步。
+// 没有锚点的 VBR 返回 false，调用方退回 TOC 粗定位。
+bool planSeek(const SeekTable &table, uint32_t targetFrame, uint32_t &start,
+              uint32_t &frames);
+// 首帧相对字节偏移对应的播放时刻，精度为帧级；没有布局信息时返回 false。
+bool timeForOffset(const SeekTable &table, uint32_t offset,
+                   uint16_t encoderDelay, uint32_t &positionMs);
+} // namespace Mp3Metadata
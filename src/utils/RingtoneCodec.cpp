@@ -0,0 +1,193 @@
+#include "RingtoneCodec.h"
+#include <string.h>
+
+namespace {
+const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+const int16_t STEP_TABLE[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+uint16_t readLE16(const uint8_t *data) {
+  return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t readLE32(const uint8_t *data) {
+  return static_cast<uint32_t>(data[0]) |
+         (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void writeLE16(uint8_t *out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void writeLE32(uint8_t *out, uint32_t value) {
+  for (uint8_t i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+int32_t clampSample(int32_t value) {
+  return value > 32767 ? 32767 : (value < -32768 ? -32768 : value);
+}
+
+int8_t clampIndex(int32_t value) {
+  return static_cast<int8_t>(value > 88 ? 88 : (value < 0 ? 0 : value));
+}
+
+// 编码与解码共用同一套增量计算，保证编码端的预测值与解码端逐采样一致。
+int32_t applyNibble(uint8_t nibble, int32_t &predictor, int8_t &index) {
+  int32_t step = STEP_TABLE[index];
+  int32_t delta = step >> 3;
+  if (nibble & 4) {
+    delta += step;
+  }
+  if (nibble & 2) {
+    delta += step >> 1;
+  }
+  if (nibble & 1) {
+    delta += step >> 2;
+  }
+  predictor = clampSample((nibble & 8) ? predictor - delta : predictor + delta);
+  index = clampIndex(index + INDEX_TABLE[nibble & 7]);
+  return predictor;
+}
+
+uint8_t encodeSample(int32_t sample, int32_t &predictor, int8_t &index) {
+  int32_t diff = sample - predictor;
+  uint8_t nibble = 0;
+  if (diff < 0) {
+    nibble = 8;
+    diff = -diff;
+  }
+  int32_t step = STEP_TABLE[index];
+  if (diff >= step) {
+    nibble |= 4;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    nibble |= 2;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    nibble |= 1;
+  }
+  applyNibble(nibble, predictor, index);
+  return nibble;
+}
+} // namespace
+
+namespace RingtoneCodec {
+
+bool parseHeader(const uint8_t *data, size_t length, Header &header) {
+  if (length < HEADER_SIZE || readLE32(data) != MAGIC) {
+    return false;
+  }
+  header.format = readLE16(data + 4);
+  header.channels = readLE16(data + 6);
+  header.sampleRate = readLE32(data + 8);
+  header.sampleCount = readLE32(data + 12);
+  return (header.format == FORMAT_PCM16 ||
+          header.format == FORMAT_IMA_ADPCM) &&
+         header.channels == 1 && header.sampleRate >= 8000 &&
+         header.sampleRate <= 48000;
+}
+
+void writeHeader(const Header &header, uint8_t *out) {
+  writeLE32(out, MAGIC);
+  writeLE16(out + 4, header.format);
+  writeLE16(out + 6, header.channels);
+  writeLE32(out + 8, header.sampleRate);
+  writeLE32(out + 12, header.sampleCount);
+}
+
+size_t decodeAdpcmBlock(const uint8_t *block, size_t length, int16_t *out,
+                        size_t maxSamples) {
+  if (length < 4 || maxSamples == 0) {
+    return 0;
+  }
+  int32_t predictor = static_cast<int16_t>(readLE16(block));
+  int8_t index = clampIndex(block[2]);
+  size_t count = 0;
+  out[count++] = static_cast<int16_t>(predictor);
+  for (size_t i = 4; i < length && count < maxSamples; ++i) {
+    out[count++] =
+        static_cast<int16_t>(applyNibble(block[i] & 0x0F, predictor, index));
+    if (count < maxSamples) {
+      out[count++] =
+          static_cast<int16_t>(applyNibble(block[i] >> 4, predictor, index));
+    }
+  }
+  return count;
+}
+
+void AdpcmEncoder::begin() {
+  pendingCount = 0;
+  hasCarry = false;
+  predictor = 0;
+  index = 0;
+  sampleCount = 0;
+}
+
+size_t AdpcmEncoder::consume(const uint8_t *data, size_t length,
+                             uint8_t *block, bool &ready) {
+  ready = false;
+  size_t used = 0;
+  while (used < length) {
+    // HTTP 分块可能把一个采样的两个字节拆开，低字节先暂存。
+    if (!hasCarry) {
+      carry = data[used++];
+      hasCarry = true;
+      continue;
+    }
+    pending[pendingCount++] =
+        static_cast<int16_t>(carry | (data[used++] << 8));
+    hasCarry = false;
+    ++sampleCount;
+    if (pendingCount == ADPCM_BLOCK_SAMPLES) {
+      encodeBlock(block);
+      ready = true;
+      break;
+    }
+  }
+  return used;
+}
+
+bool AdpcmEncoder::flush(uint8_t *block) {
+  if (pendingCount == 0) {
+    return false;
+  }
+  // 尾块补零；解码端按头部的 sampleCount 截断，不会播出补齐的部分。
+  memset(pending + pendingCount, 0,
+         (ADPCM_BLOCK_SAMPLES - pendingCount) * sizeof(int16_t));
+  encodeBlock(block);
+  return true;
+}
+
+void AdpcmEncoder::encodeBlock(uint8_t *block) {
+  // 块首采样原样写入头部，预测值与步长索引从它开始，块可独立解码。
+  predictor = pending[0];
+  writeLE16(block, static_cast<uint16_t>(pending[0]));
+  block[2] = static_cast<uint8_t>(index);
+  block[3] = 0;
+  for (size_t i = 1, out = 4; i < ADPCM_BLOCK_SAMPLES; i += 2, ++out) {
+    uint8_t low = encodeSample(pending[i], predictor, index);
+    uint8_t high = encodeSample(pending[i + 1], predictor, index);
+    block[out] = static_cast<uint8_t>(low | (high << 4));
+  }
+  pendingCount = 0;
+}
+
+} // namespace RingtoneCodec
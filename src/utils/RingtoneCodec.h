@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 原生铃声格式（.rtn）：16 字节小端头部 + 单声道音频数据。
+// 数据为 16 位 PCM，或与 WAV 兼容的 IMA-ADPCM 定长块（每块自带预测值和
+// 步长索引，块与块之间可以独立解码）。闹钟播放不再需要 MP3 解码器，
+// 与 Mp3Metadata 一样不依赖 Arduino，可在主机上编译核对。
+namespace RingtoneCodec {
+constexpr uint32_t MAGIC = 0x314E5452; // "RTN1"
+constexpr size_t HEADER_SIZE = 16;
+constexpr size_t ADPCM_BLOCK_SIZE = 256;
+constexpr size_t ADPCM_BLOCK_SAMPLES = (ADPCM_BLOCK_SIZE - 4) * 2 + 1;
+
+enum Format : uint16_t { FORMAT_PCM16 = 1, FORMAT_IMA_ADPCM = 2 };
+
+struct Header {
+  uint16_t format;
+  uint16_t channels; // 目前只支持 1
+  uint32_t sampleRate;
+  uint32_t sampleCount;
+};
+
+bool parseHeader(const uint8_t *data, size_t length, Header &header);
+void writeHeader(const Header &header, uint8_t *out);
+// 解码一个 ADPCM 块，最多输出 maxSamples 个采样，返回实际输出数。
+size_t decodeAdpcmBlock(const uint8_t *block, size_t length, int16_t *out,
+                        size_t maxSamples);
+
+// 流式编码：按任意分块喂入 16 位小端 PCM 字节，每凑满一块输出一次，
+// 上传转换时无需把整段 PCM 放进内存。
+class AdpcmEncoder {
+public:
+  void begin();
+  // 返回本次消耗的字节数；凑满一块时 ready 置 true 且 block 写满。
+  size_t consume(const uint8_t *data, size_t length, uint8_t *block,
+                 bool &ready);
+  // 把不足一块的剩余采样编码输出；没有剩余时返回 false。
+  bool flush(uint8_t *block);
+  uint32_t getSampleCount() const { return sampleCount; }
+
+private:
+  int16_t pending[ADPCM_BLOCK_SAMPLES];
+  size_t pendingCount = 0;
+  uint8_t carry = 0;
+  bool hasCarry = false;
+  int32_t predictor = 0;
+  int8_t index = 0;
+  uint32_t sampleCount = 0;
+
+  void encodeBlock(uint8_t *block);
+};
+} // namespace RingtoneCodec
@@ -0,0 +1,245 @@
+"""Generate the synthetic MP3 fixtures used by the native tests.
+
+No encoder is needed: every file is a stream of valid MPEG audio Layer III
+frame headers whose payload is filled from a seeded PRNG, wrapped in the
+same container structures real encoders write (ID3v2/ID3v1 tags, LAME
+"Xing"/"Info" headers with TOC and gapless fields, Fraunhofer "VBRI"
+headers, ID3v2 frame format flags). Decoders cannot play them, but frame layout, padding distribution
+and header fields are exactly what utils/Mp3Metadata has to handle, and the
+output is byte-for-byte reproducible:
+
+    python test/fixtures/mp3/make_fixtures.py
+"""
+
+import os
+import random
+import struct
+
+OUT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+BITRATES_MPEG1 = [0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320]
+BITRATES_MPEG2 = [0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160]
+SAMPLE_RATES_MPEG1 = [44100, 48000, 32000]
+
+ENCODER_DELAY = 576
+
+
+class Layout:
+    def __init__(self, mpeg1, sample_rate, mono=False):
+        self.mpeg1 = mpeg1
+        self.sample_rate = sample_rate
+        self.mono = mono
+        rates = [r if mpeg1 else r // 2 for r in SAMPLE_RATES_MPEG1]
+        self.rate_index = rates.index(sample_rate)
+        self.bitrates = BITRATES_MPEG1 if mpeg1 else BITRATES_MPEG2
+        self.samples_per_frame = 1152 if mpeg1 else 576
+        self.side_info = (17 if mono else 32) if mpeg1 else (9 if mono else 17)
+        self.slot_bytes = 144000 if mpeg1 else 72000
+        self.remainder = 0
+
+    def frame_length(self, kbps, pad):
+        return self.slot_bytes * kbps // self.sample_rate + pad
+
+    def next_padding(self, kbps):
+        # Same accumulation LAME uses: pad whenever the fractional slot
+        # carried over from previous frames reaches a whole byte.
+        self.remainder += self.slot_bytes * kbps % self.sample_rate
+        if self.remainder >= self.sample_rate:
+            self.remainder -= self.sample_rate
+            return 1
+        return 0
+
+    def header(self, kbps, pad):
+        b1 = 0xFB if self.mpeg1 else 0xF3
+        b2 = (self.bitrates.index(kbps) << 4) | (self.rate_index << 2) | (pad << 1)
+        b3 = 0xC0 if self.mono else 0x00
+        return bytes([0xFF, b1, b2, b3])
+
+
+def syncsafe(value):
+    return bytes([(value >> 21) & 0x7F, (value >> 14) & 0x7F,
+                  (value >> 7) & 0x7F, value & 0x7F])
+
+
+def id3v2_frame(major, frame_id, body, flags=b"\x00\x00"):
+    size = syncsafe(len(body)) if major == 4 else struct.pack(">I", len(body))
+    return frame_id.encode("ascii") + size + flags + body
+
+
+def id3v2_tag(major, frames, padding=64):
+    body = b"".join(frames) + b"\x00" * padding
+    return b"ID3" + bytes([major, 0, 0]) + syncsafe(len(body)) + body
+
+
+def text_frame(major, frame_id, text, flags=b"\x00\x00"):
+    # ISO-8859-1 for v2.3, UTF-8 for v2.4.
+    encoding = b"\x03" if major == 4 else b"\x00"
+    payload = text.encode("utf-8" if major == 4 else "latin-1")
+    return id3v2_frame(major, frame_id, encoding + payload, flags)
+
+
+def flagged_text_frame(major, frame_id, text, flags, group=0x01):
+    """Text frame whose body is preceded by the grouping / data length fields."""
+    encoding = b"\x03" if major == 4 else b"\x00"
+    body = encoding + text.encode("utf-8" if major == 4 else "latin-1")
+    prefix = b""
+    if (major == 3 and flags[1] & 0x20) or (major == 4 and flags[1] & 0x40):
+        prefix += bytes([group])
+    if major == 4 and flags[1] & 0x01:
+        prefix += syncsafe(len(body))
+    return id3v2_frame(major, frame_id, prefix + body, flags)
+
+
+def id3v1_tag(title, artist):
+    return (b"TAG" + title.encode("latin-1").ljust(30, b"\x00") +
+            artist.encode("latin-1").ljust(30, b"\x00") + b"\x00" * 30 +
+            b"2024" + b"\x00" * 30 + b"\xff")
+
+
+def audio_frames(layout, rng, bitrates):
+    frames = []
+    for kbps in bitrates:
+        pad = layout.next_padding(kbps)
+        length = layout.frame_length(kbps, pad)
+        body = bytes(rng.getrandbits(8) for _ in range(length - 4))
+        frames.append(layout.header(kbps, pad) + body)
+    return frames
+
+
+def lame_extension(padding):
+    ext = bytearray(36)
+    ext[0:9] = b"LAME3.100"
+    gapless = (ENCODER_DELAY << 12) | padding
+    ext[21:24] = gapless.to_bytes(3, "big")
+    return bytes(ext)
+
+
+def xing_frame(layout, kbps, tag, frames, padding):
+    """Lead frame holding a Xing/Info header for the given audio frames."""
+    length = layout.frame_length(kbps, 0)
+    total = length + sum(len(f) for f in frames)
+    toc = bytearray(100)
+    duration = len(frames) * layout.samples_per_frame
+    offsets = []
+    elapsed = 0
+    position = length
+    for frame in frames:
+        offsets.append((elapsed, position))
+        elapsed += layout.samples_per_frame
+        position += len(frame)
+    cursor = 0
+    for i in range(100):
+        target = duration * i / 100
+        while cursor + 1 < len(offsets) and offsets[cursor + 1][0] <= target:
+            cursor += 1
+        toc[i] = min(255, offsets[cursor][1] * 256 // total)
+
+    frame = bytearray(length)
+    frame[0:4] = layout.header(kbps, 0)
+    start = 4 + layout.side_info
+    xing = tag + struct.pack(">III", 0x0F, len(frames), total) + bytes(toc)
+    xing += struct.pack(">I", 0) + lame_extension(padding)
+    frame[start:start + len(xing)] = xing
+    return bytes(frame)
+
+
+def vbri_frame(layout, kbps, frames):
+    length = layout.frame_length(kbps, 0)
+    total = length + sum(len(f) for f in frames)
+    frame = bytearray(length)
+    frame[0:4] = layout.header(kbps, 0)
+    vbri = b"VBRI" + struct.pack(">HHHII", 1, ENCODER_DELAY, 75, total, len(frames))
+    vbri += struct.pack(">HHHH", 0, 1, 2, 0)
+    frame[36:36 + len(vbri)] = vbri
+    return bytes(frame)
+
+
+def gapless_padding(layout, rng):
+    # Any source length whose last frame is only partially filled.
+    return rng.randrange(0, layout.samples_per_frame)
+
+
+def write(name, data):
+    with open(os.path.join(OUT_DIR, name), "wb") as f:
+        f.write(data)
+
+
+def make_cbr_info():
+    rng = random.Random(128)
+    layout = Layout(True, 44100)
+    frames = audio_frames(layout, rng, [128] * 215)
+    padding = gapless_padding(layout, rng)
+    tag = id3v2_tag(3, [text_frame(3, "TIT2", "Seek CBR"),
+                        text_frame(3, "TPE1", "Fixture")])
+    lead = xing_frame(Layout(True, 44100), 128, b"Info", frames, padding)
+    write("cbr128_info.mp3", tag + lead + b"".join(frames) +
+          id3v1_tag("Seek CBR", "Fixture"))
+
+
+def tagged_stream(seed):
+    rng = random.Random(seed)
+    return b"".join(audio_frames(Layout(True, 44100), rng, [128] * 8))
+
+
+def make_id3_fixtures():
+    # v2.4 frames flagged with a data length indicator (0x01), alone and
+    # together with a group id (0x41); the prefix precedes the text body.
+    write("id3v24_data_length.mp3", id3v2_tag(4, [
+        flagged_text_frame(4, "TIT2", "Grüße aus 2.4", b"\x00\x01"),
+        flagged_text_frame(4, "TPE1", "Grouped Artist", b"\x00\x41"),
+    ]) + tagged_stream(24))
+    # A compressed frame cannot be read but must still be stepped over;
+    # the artist then comes from ID3v1.
+    write("id3v24_compressed.mp3", id3v2_tag(4, [
+        flagged_text_frame(4, "TPE1", "zlib data", b"\x00\x09"),
+        flagged_text_frame(4, "TIT2", "After Compressed", b"\x00\x01"),
+    ]) + tagged_stream(25) + id3v1_tag("v1 title", "v1 artist"))
+    write("id3v23_grouping.mp3", id3v2_tag(3, [
+        flagged_text_frame(3, "TIT2", "Grouped 2.3", b"\x00\x20"),
+        text_frame(3, "TPE1", "Plain 2.3"),
+    ]) + tagged_stream(23))
+
+
+def make_cbr_plain():
+    rng = random.Random(64)
+    layout = Layout(True, 48000, mono=True)
+    write("cbr64_plain.mp3", b"".join(audio_frames(layout, rng, [64] * 250)))
+
+
+def make_vbr_xing():
+    rng = random.Random(1)
+    layout = Layout(True, 44100)
+    rates = [rng.choice(BITRATES_MPEG1[1:10]) for _ in range(230)]
+    frames = audio_frames(layout, rng, rates)
+    padding = gapless_padding(layout, rng)
+    lead = xing_frame(Layout(True, 44100), 128, b"Xing", frames, padding)
+    write("vbr_xing.mp3", lead + b"".join(frames))
+
+
+def make_vbr_vbri():
+    rng = random.Random(2)
+    layout = Layout(True, 44100)
+    rates = [rng.choice(BITRATES_MPEG1[1:10]) for _ in range(200)]
+    frames = audio_frames(layout, rng, rates)
+    tag = id3v2_tag(3, [text_frame(3, "TIT2", "Seek VBRI")])
+    write("vbr_vbri.mp3", tag + vbri_frame(layout, 128, frames) +
+          b"".join(frames))
+
+
+def make_vbr_mpeg2():
+    rng = random.Random(3)
+    layout = Layout(False, 22050)
+    rates = [rng.choice(BITRATES_MPEG2[1:9]) for _ in range(400)]
+    frames = audio_frames(layout, rng, rates)
+    padding = gapless_padding(layout, rng)
+    lead = xing_frame(Layout(False, 22050), 64, b"Xing", frames, padding)
+    write("vbr_mpeg2.mp3", lead + b"".join(frames))
+
+
+if __name__ == "__main__":
+    make_cbr_info()
+    make_cbr_plain()
+    make_vbr_xing()
+    make_vbr_vbri()
+    make_vbr_mpeg2()
+    make_id3_fixtures()
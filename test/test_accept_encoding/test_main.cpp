@@ -0,0 +1,55 @@
+#include "utils/AcceptEncoding.h"
+#include <unity.h>
+
+// 静态页面只在客户端明确接受 gzip 时才发送压缩体，其余一律回退原文。
+void setUp() {}
+void tearDown() {}
+
+void test_browsers_accept_gzip() {
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip, deflate, br"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip, deflate, br, zstd"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("deflate,gzip"));
+}
+
+void test_matching_is_case_insensitive() {
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("GZIP"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("x-gzip"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("br;q=1.0, Gzip;Q=0.8"));
+}
+
+void test_missing_or_other_codings_fall_back() {
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip(nullptr));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip(""));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("identity"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("br, deflate"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("gzipped"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("xgzip"));
+}
+
+void test_zero_quality_rejects() {
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("gzip;q=0"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("gzip; q=0.000, br"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("br, gzip ;q=0."));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip;q=0.001"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip;q=0.5"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("gzip;level=1"));
+}
+
+void test_wildcard_applies_unless_gzip_is_listed() {
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("*"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("br, *;q=0.1"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("*;q=0"));
+  TEST_ASSERT_FALSE(AcceptEncoding::allowsGzip("*, gzip;q=0"));
+  TEST_ASSERT_TRUE(AcceptEncoding::allowsGzip("*;q=0, gzip"));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_browsers_accept_gzip);
+  RUN_TEST(test_matching_is_case_insensitive);
+  RUN_TEST(test_missing_or_other_codings_fall_back);
+  RUN_TEST(test_zero_quality_rejects);
+  RUN_TEST(test_wildcard_applies_unless_gzip_is_listed);
+  return UNITY_END();
+}
@@ -0,0 +1,94 @@
+#include "utils/ByteRange.h"
+#include <unity.h>
+
+// 对着 RFC 9110 14.1.2 的示例核对单段 Range 的解析与越界处理。
+namespace {
+constexpr size_t FILE_SIZE = 10000;
+
+void assertRange(const char *header, size_t size, size_t first, size_t last) {
+  size_t gotFirst = 0;
+  size_t gotLast = 0;
+  TEST_ASSERT_EQUAL_INT_MESSAGE(ByteRange::RANGE_OK,
+                                ByteRange::parse(header, size, gotFirst,
+                                                 gotLast),
+                                header);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(first, gotFirst, header);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(last, gotLast, header);
+}
+
+void assertResult(ByteRange::Result expected, const char *header,
+                  size_t size) {
+  size_t first = 123;
+  size_t last = 456;
+  TEST_ASSERT_EQUAL_INT_MESSAGE(expected,
+                                ByteRange::parse(header, size, first, last),
+                                header);
+  // 未命中时不得改写调用方预先填好的完整区间。
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(123, first, header);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(456, last, header);
+}
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_closed_range() {
+  assertRange("bytes=0-499", FILE_SIZE, 0, 499);
+  assertRange("bytes=500-999", FILE_SIZE, 500, 999);
+  assertRange("bytes=9999-9999", FILE_SIZE, 9999, 9999);
+}
+
+void test_open_range() {
+  assertRange("bytes=9500-", FILE_SIZE, 9500, 9999);
+  assertRange("bytes=0-", FILE_SIZE, 0, 9999);
+}
+
+void test_suffix_range() {
+  assertRange("bytes=-500", FILE_SIZE, 9500, 9999);
+  assertRange("bytes=-20000", FILE_SIZE, 0, 9999);
+  assertRange("bytes=-1", 1, 0, 0);
+}
+
+void test_last_is_clamped_to_size() {
+  assertRange("bytes=9000-20000", FILE_SIZE, 9000, 9999);
+}
+
+void test_whitespace_is_trimmed() {
+  assertRange("bytes= 100 - 199 ", FILE_SIZE, 100, 199);
+}
+
+void test_unsatisfiable() {
+  assertResult(ByteRange::RANGE_UNSATISFIABLE, "bytes=10000-", FILE_SIZE);
+  assertResult(ByteRange::RANGE_UNSATISFIABLE, "bytes=10000-10001",
+               FILE_SIZE);
+  assertResult(ByteRange::RANGE_UNSATISFIABLE, "bytes=-0", FILE_SIZE);
+  assertResult(ByteRange::RANGE_UNSATISFIABLE, "bytes=0-", 0);
+  assertResult(ByteRange::RANGE_UNSATISFIABLE, "bytes=-5", 0);
+}
+
+void test_invalid_falls_back_to_full_response() {
+  assertResult(ByteRange::RANGE_NONE, "", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "items=0-1", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=0-1,5-9", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=500", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=-", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=500-100", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=a-1", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=1-2x", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=5--3", FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, "bytes=99999999999999999999999-",
+               FILE_SIZE);
+  assertResult(ByteRange::RANGE_NONE, nullptr, FILE_SIZE);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_closed_range);
+  RUN_TEST(test_open_range);
+  RUN_TEST(test_suffix_range);
+  RUN_TEST(test_last_is_clamped_to_size);
+  RUN_TEST(test_whitespace_is_trimmed);
+  RUN_TEST(test_unsatisfiable);
+  RUN_TEST(test_invalid_falls_back_to_full_response);
+  return UNITY_END();
+}
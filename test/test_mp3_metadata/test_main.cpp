@@ -0,0 +1,89 @@
+#include "utils/Mp3Metadata.h"
+#include <stdio.h>
+#include <unity.h>
+#include <vector>
+
+// 对着 test/fixtures/mp3 下的样例核对 ID3v2 帧格式标志：分组标识与
+// v2.4 数据长度指示要跳过，压缩帧要整帧跳过，首个音频帧紧跟在标签之后。
+// 样例由同目录的 make_fixtures.py 生成。
+#ifndef MP3_FIXTURE_DIR
+#define MP3_FIXTURE_DIR "test/fixtures/mp3/"
+#endif
+
+namespace {
+struct Parsed {
+  Mp3Metadata::Tags tags = {};
+  uint32_t tagLength = 0;
+  Mp3Metadata::StreamInfo info;
+};
+
+void parseFixture(const char *name, Parsed &parsed) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s%s", MP3_FIXTURE_DIR, name);
+  FILE *file = fopen(path, "rb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(file, path);
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data.insert(data.end(), chunk, chunk + length);
+  }
+  fclose(file);
+
+  uint32_t audioEnd = static_cast<uint32_t>(data.size());
+  parsed.tagLength = Mp3Metadata::parseId3v2(data.data(), data.size(),
+                                             parsed.tags);
+  if (Mp3Metadata::parseId3v1(data.data() + data.size() -
+                                  Mp3Metadata::ID3V1_SIZE,
+                              Mp3Metadata::ID3V1_SIZE, parsed.tags)) {
+    audioEnd -= Mp3Metadata::ID3V1_SIZE;
+  }
+  TEST_ASSERT_TRUE(Mp3Metadata::parseStream(
+      data.data() + parsed.tagLength, audioEnd - parsed.tagLength,
+      parsed.tagLength, audioEnd, parsed.info));
+}
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_v24_data_length_indicator() {
+  Parsed parsed;
+  parseFixture("id3v24_data_length.mp3", parsed);
+  TEST_ASSERT_EQUAL_STRING("Grüße aus 2.4", parsed.tags.title);
+  TEST_ASSERT_EQUAL_STRING("Grouped Artist", parsed.tags.artist);
+  TEST_ASSERT_EQUAL_UINT32(parsed.tagLength, parsed.info.firstFrameOffset);
+}
+
+void test_v24_compressed_frame_is_skipped() {
+  Parsed parsed;
+  parseFixture("id3v24_compressed.mp3", parsed);
+  TEST_ASSERT_EQUAL_STRING("After Compressed", parsed.tags.title);
+  TEST_ASSERT_EQUAL_STRING("v1 artist", parsed.tags.artist);
+  TEST_ASSERT_EQUAL_UINT32(parsed.tagLength, parsed.info.firstFrameOffset);
+}
+
+void test_v23_grouping_identity() {
+  Parsed parsed;
+  parseFixture("id3v23_grouping.mp3", parsed);
+  TEST_ASSERT_EQUAL_STRING("Grouped 2.3", parsed.tags.title);
+  TEST_ASSERT_EQUAL_STRING("Plain 2.3", parsed.tags.artist);
+  TEST_ASSERT_EQUAL_UINT32(parsed.tagLength, parsed.info.firstFrameOffset);
+}
+
+void test_existing_tags_still_parse() {
+  Parsed parsed;
+  parseFixture("cbr128_info.mp3", parsed);
+  TEST_ASSERT_EQUAL_STRING("Seek CBR", parsed.tags.title);
+  TEST_ASSERT_EQUAL_STRING("Fixture", parsed.tags.artist);
+  TEST_ASSERT_EQUAL_UINT16(576, parsed.info.encoderDelay);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_v24_data_length_indicator);
+  RUN_TEST(test_v24_compressed_frame_is_skipped);
+  RUN_TEST(test_v23_grouping_identity);
+  RUN_TEST(test_existing_tags_still_parse);
+  return UNITY_END();
+}
@@ -0,0 +1,233 @@
+#include "utils/Mp3Metadata.h"
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include <vector>
+
+// 对着 test/fixtures/mp3 下的样例文件核对帧级定位：按设备上的流程解析头部、
+// 逐帧扫描生成锚点、规划定位并走到目标帧，落点必须是包含目标时刻的那一帧，
+// 与目标时刻相差不足一帧（TOC 粗定位的误差是整曲时长的 1%）。
+// 样例由同目录的 make_fixtures.py 生成。
+#ifndef MP3_FIXTURE_DIR
+#define MP3_FIXTURE_DIR "test/fixtures/mp3/"
+#endif
+
+namespace {
+constexpr size_t READ_CHUNK = 4096;
+constexpr uint32_t TARGET_STEP_MS = 250;
+
+struct Fixture {
+  std::vector<uint8_t> data;
+  uint32_t audioEnd = 0;
+  Mp3Metadata::StreamInfo info;
+  Mp3Metadata::SeekTable table;
+  // 每个音频帧帧头相对首帧的偏移，顺着帧长直接走出来的真实位置。
+  std::vector<uint32_t> frames;
+};
+
+bool readFile(const char *name, std::vector<uint8_t> &out) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s%s", MP3_FIXTURE_DIR, name);
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  uint8_t chunk[READ_CHUNK];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    out.insert(out.end(), chunk, chunk + length);
+  }
+  fclose(file);
+  return true;
+}
+
+// 与 MusicManager 的后台扫描一致：按块读入，跨块的帧头从返回的偏移处重读。
+void scanAnchors(Fixture &f) {
+  Mp3Metadata::FrameScanner scanner;
+  uint32_t start = f.info.firstFrameOffset;
+  scanner.begin(start, f.info.audioLength, f.info.durationMs, f.table);
+  uint32_t offset = start;
+  while (!scanner.isDone() && offset < f.data.size()) {
+    size_t length = f.data.size() - offset;
+    if (length > READ_CHUNK) {
+      length = READ_CHUNK;
+    }
+    uint32_t next = scanner.feed(f.data.data() + offset, length, offset);
+    if (next == offset) {
+      break;
+    }
+    offset = next;
+  }
+  scanner.finishAnchors(f.table);
+}
+
+void loadFixture(const char *name, Fixture &f) {
+  TEST_ASSERT_TRUE_MESSAGE(readFile(name, f.data), name);
+  f.audioEnd = static_cast<uint32_t>(f.data.size());
+  Mp3Metadata::Tags tags = {};
+  if (f.data.size() >= Mp3Metadata::ID3V1_SIZE &&
+      Mp3Metadata::parseId3v1(f.data.data() + f.data.size() -
+                                  Mp3Metadata::ID3V1_SIZE,
+                              Mp3Metadata::ID3V1_SIZE, tags)) {
+    f.audioEnd -= Mp3Metadata::ID3V1_SIZE;
+  }
+  uint32_t audioStart =
+      Mp3Metadata::parseId3v2(f.data.data(), f.data.size(), tags);
+  TEST_ASSERT_TRUE(Mp3Metadata::parseStream(f.data.data() + audioStart,
+                                            f.audioEnd - audioStart, audioStart,
+                                            f.audioEnd, f.info));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, f.info.durationMs);
+  Mp3Metadata::initSeekTable(f.info, f.table);
+  if (f.info.vbr) {
+    scanAnchors(f);
+    TEST_ASSERT_GREATER_THAN_UINT16(0, f.table.anchorCount);
+  }
+
+  Mp3Metadata::FrameHeader header;
+  uint32_t offset = f.info.leadFrameLength;
+  uint32_t end = f.audioEnd - f.info.firstFrameOffset;
+  while (offset + 4 <= end &&
+         Mp3Metadata::parseFrameHeader(
+             f.data.data() + f.info.firstFrameOffset + offset, header)) {
+    f.frames.push_back(offset);
+    offset += header.frameLength;
+  }
+  TEST_ASSERT_EQUAL_UINT32(end, offset);
+}
+
+// 模拟解码器在任意位置重新同步：找到下一个帧头，且按帧长跳过去仍是帧头。
+uint32_t resync(const Fixture &f, uint32_t offset) {
+  const uint8_t *audio = f.data.data() + f.info.firstFrameOffset;
+  uint32_t end = f.audioEnd - f.info.firstFrameOffset;
+  Mp3Metadata::FrameHeader header;
+  Mp3Metadata::FrameHeader following;
+  for (; offset + 4 <= end; ++offset) {
+    if (!Mp3Metadata::parseFrameHeader(audio + offset, header)) {
+      continue;
+    }
+    uint32_t next = offset + header.frameLength;
+    if (next == end || (next + 4 <= end && Mp3Metadata::parseFrameHeader(
+                                               audio + next, following))) {
+      return offset;
+    }
+  }
+  return end;
+}
+
+// 与 MusicManager::findFrameOffset 相同：从锚点起按块喂给 FrameWalker。
+bool walkToFrame(const Fixture &f, uint32_t start, uint32_t frames,
+                 uint32_t &offset) {
+  Mp3Metadata::FrameWalker walker;
+  walker.begin(start, frames);
+  const uint8_t *audio = f.data.data() + f.info.firstFrameOffset;
+  uint32_t end = f.audioEnd - f.info.firstFrameOffset;
+  uint32_t readOffset = start;
+  while (!walker.isDone() && readOffset < end) {
+    size_t length = end - readOffset;
+    if (length > READ_CHUNK) {
+      length = READ_CHUNK;
+    }
+    uint32_t next = walker.feed(audio + readOffset, length, readOffset);
+    if (next == readOffset) {
+      break;
+    }
+    readOffset = next;
+  }
+  if (!walker.isDone() || walker.lostSync()) {
+    return false;
+  }
+  offset = walker.position();
+  return true;
+}
+
+void checkSeekAccuracy(const char *name) {
+  Fixture f;
+  loadFixture(name, f);
+  const Mp3Metadata::SeekTable &table = f.table;
+  int64_t frameSamples = table.samplesPerFrame;
+  char message[160];
+
+  for (uint32_t ms = 0; ms < f.info.durationMs; ms += TARGET_STEP_MS) {
+    uint32_t target =
+        Mp3Metadata::frameForTime(table, ms, f.info.encoderDelay);
+    uint32_t start = 0;
+    uint32_t frames = 0;
+    TEST_ASSERT_TRUE(Mp3Metadata::planSeek(table, target, start, frames));
+    uint32_t landing = start;
+    if (frames > 0) {
+      TEST_ASSERT_TRUE(walkToFrame(f, start, frames, landing));
+    }
+    landing = resync(f, landing);
+
+    size_t frame = 0;
+    while (frame < f.frames.size() && f.frames[frame] < landing) {
+      ++frame;
+    }
+    snprintf(message, sizeof(message), "%s @%lums landed on byte %lu", name,
+             static_cast<unsigned long>(ms),
+             static_cast<unsigned long>(landing));
+    TEST_ASSERT_TRUE_MESSAGE(frame < f.frames.size(), message);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(f.frames[frame], landing, message);
+
+    // 落点必须正好是包含目标采样的那一帧：其首个输出采样（扣除编码器
+    // 延迟）不晚于目标时刻，且相差不足一帧。
+    int64_t landed =
+        static_cast<int64_t>(frame) * frameSamples - f.info.encoderDelay;
+    int64_t wanted = static_cast<int64_t>(ms) * table.sampleRate / 1000;
+    int64_t error = wanted - landed;
+    TEST_ASSERT_TRUE_MESSAGE(error >= 0 && error < frameSamples, message);
+
+    // CBR 的进度换算同样精确到帧。
+    if (table.cbrBitrateKbps > 0) {
+      uint32_t elapsedMs = 0;
+      TEST_ASSERT_TRUE(Mp3Metadata::timeForOffset(table, landing,
+                                                  f.info.encoderDelay,
+                                                  elapsedMs));
+      uint32_t frameMs =
+          static_cast<uint32_t>(frameSamples * 1000 / table.sampleRate) + 1;
+      TEST_ASSERT_UINT32_WITHIN_MESSAGE(frameMs, ms, elapsedMs, message);
+    }
+  }
+}
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_cbr_with_info_header() { checkSeekAccuracy("cbr128_info.mp3"); }
+void test_cbr_without_header() { checkSeekAccuracy("cbr64_plain.mp3"); }
+void test_vbr_xing() { checkSeekAccuracy("vbr_xing.mp3"); }
+void test_vbr_vbri() { checkSeekAccuracy("vbr_vbri.mp3"); }
+void test_vbr_mpeg2() { checkSeekAccuracy("vbr_mpeg2.mp3"); }
+
+void test_vbr_without_anchors_falls_back() {
+  Fixture f;
+  loadFixture("vbr_xing.mp3", f);
+  f.table.anchorCount = 0;
+  uint32_t start = 0;
+  uint32_t frames = 0;
+  TEST_ASSERT_FALSE(Mp3Metadata::planSeek(f.table, 10, start, frames));
+}
+
+void test_stale_anchor_loses_sync() {
+  Fixture f;
+  loadFixture("vbr_xing.mp3", f);
+  uint32_t start = 0;
+  uint32_t frames = 0;
+  uint32_t target = f.table.anchorStep + 1;
+  TEST_ASSERT_TRUE(Mp3Metadata::planSeek(f.table, target, start, frames));
+  uint32_t offset = 0;
+  TEST_ASSERT_FALSE(walkToFrame(f, start + 1, frames, offset));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_cbr_with_info_header);
+  RUN_TEST(test_cbr_without_header);
+  RUN_TEST(test_vbr_xing);
+  RUN_TEST(test_vbr_vbri);
+  RUN_TEST(test_vbr_mpeg2);
+  RUN_TEST(test_vbr_without_anchors_falls_back);
+  RUN_TEST(test_stale_anchor_loses_sync);
+  return UNITY_END();
+}
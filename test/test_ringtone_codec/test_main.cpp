@@ -0,0 +1,213 @@
+#include "utils/RingtoneCodec.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+#include <vector>
+
+// 按上传转换的流程把 PCM 字节切成奇数长度的分块喂给 AdpcmEncoder，
+// 再按 RingtonePlayer::decodeNext 的方式逐块解码并用头部的采样数截断，
+// 核对采样数、块首采样和逐采样误差。
+namespace {
+constexpr uint32_t SAMPLE_RATE = 16000;
+constexpr double TONE_HZ = 440.0;
+constexpr double TONE_AMPLITUDE = 12000.0;
+// 编码器的步长索引从 0 起步，幅度 12000 的正弦要十来个采样才追上，
+// 之后单个采样误差约在 400 以内、平均约 100（4 位量化，约 40 dB 信噪比）。
+constexpr size_t SETTLE_SAMPLES = 16;
+constexpr int32_t MAX_SAMPLE_ERROR = 512;
+constexpr int32_t MAX_MEAN_ERROR = 128;
+
+using Blocks = std::vector<std::vector<uint8_t>>;
+
+std::vector<int16_t> makeTone(size_t count) {
+  std::vector<int16_t> samples(count);
+  for (size_t i = 0; i < count; ++i) {
+    double phase = 2.0 * M_PI * TONE_HZ * i / SAMPLE_RATE;
+    samples[i] = static_cast<int16_t>(lround(TONE_AMPLITUDE * sin(phase)));
+  }
+  return samples;
+}
+
+std::vector<uint8_t> toBytes(const std::vector<int16_t> &samples) {
+  std::vector<uint8_t> bytes(samples.size() * 2);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    uint16_t value = static_cast<uint16_t>(samples[i]);
+    bytes[2 * i] = static_cast<uint8_t>(value);
+    bytes[2 * i + 1] = static_cast<uint8_t>(value >> 8);
+  }
+  return bytes;
+}
+
+// 与 WebManager 的上传回调一致：同一分块可能凑满多块，循环到全部消耗。
+Blocks encode(const std::vector<uint8_t> &bytes, size_t chunk,
+              uint32_t &sampleCount) {
+  RingtoneCodec::AdpcmEncoder encoder;
+  encoder.begin();
+  Blocks blocks;
+  uint8_t block[RingtoneCodec::ADPCM_BLOCK_SIZE];
+  for (size_t offset = 0; offset < bytes.size(); offset += chunk) {
+    size_t length = bytes.size() - offset < chunk ? bytes.size() - offset
+                                                   : chunk;
+    size_t used = 0;
+    while (used < length) {
+      bool ready = false;
+      used += encoder.consume(bytes.data() + offset + used, length - used,
+                              block, ready);
+      if (ready) {
+        blocks.emplace_back(block, block + sizeof(block));
+      }
+    }
+  }
+  if (encoder.flush(block)) {
+    blocks.emplace_back(block, block + sizeof(block));
+  }
+  sampleCount = encoder.getSampleCount();
+  return blocks;
+}
+
+std::vector<int16_t> decode(const Blocks &blocks, uint32_t sampleCount) {
+  std::vector<int16_t> samples;
+  int16_t out[RingtoneCodec::ADPCM_BLOCK_SAMPLES];
+  for (const std::vector<uint8_t> &block : blocks) {
+    uint32_t remaining = sampleCount - samples.size();
+    if (remaining == 0) {
+      break;
+    }
+    size_t count = RingtoneCodec::decodeAdpcmBlock(block.data(), block.size(),
+                                                   out, remaining);
+    samples.insert(samples.end(), out, out + count);
+  }
+  return samples;
+}
+
+void checkRoundTrip(size_t sampleTotal, size_t chunk) {
+  std::vector<int16_t> source = makeTone(sampleTotal);
+  uint32_t sampleCount = 0;
+  Blocks blocks = encode(toBytes(source), chunk, sampleCount);
+  char message[96];
+  snprintf(message, sizeof(message), "samples=%u chunk=%u",
+           static_cast<unsigned>(sampleTotal), static_cast<unsigned>(chunk));
+
+  size_t expectedBlocks = (sampleTotal + RingtoneCodec::ADPCM_BLOCK_SAMPLES -
+                           1) /
+                          RingtoneCodec::ADPCM_BLOCK_SAMPLES;
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(sampleTotal, sampleCount, message);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(expectedBlocks, blocks.size(), message);
+
+  std::vector<int16_t> decoded = decode(blocks, sampleCount);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(sampleTotal, decoded.size(), message);
+  int64_t errorSum = 0;
+  for (size_t i = 0; i < decoded.size(); ++i) {
+    if (i % RingtoneCodec::ADPCM_BLOCK_SAMPLES == 0) {
+      // 块首采样写在块头里，必须原样还原。
+      TEST_ASSERT_EQUAL_INT_MESSAGE(source[i], decoded[i], message);
+    }
+    if (i < SETTLE_SAMPLES) {
+      continue;
+    }
+    int32_t error = abs(static_cast<int32_t>(decoded[i]) - source[i]);
+    TEST_ASSERT_TRUE_MESSAGE(error <= MAX_SAMPLE_ERROR, message);
+    errorSum += error;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(
+      errorSum / static_cast<int64_t>(decoded.size() - SETTLE_SAMPLES) <=
+          MAX_MEAN_ERROR,
+      message);
+}
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_block_geometry() {
+  // 4 字节块头带一个采样，其余每字节两个采样。
+  TEST_ASSERT_EQUAL_UINT32(505, RingtoneCodec::ADPCM_BLOCK_SAMPLES);
+  TEST_ASSERT_EQUAL_UINT32(
+      RingtoneCodec::ADPCM_BLOCK_SIZE,
+      4 + (RingtoneCodec::ADPCM_BLOCK_SAMPLES - 1) / 2);
+}
+
+void test_round_trip_split_byte_chunks() {
+  // 奇数分块长度让每个采样的高低字节轮流落在两次 consume 里。
+  checkRoundTrip(3 * RingtoneCodec::ADPCM_BLOCK_SAMPLES + 123, 1);
+  checkRoundTrip(3 * RingtoneCodec::ADPCM_BLOCK_SAMPLES + 123, 3);
+  checkRoundTrip(3 * RingtoneCodec::ADPCM_BLOCK_SAMPLES + 123, 1459);
+}
+
+void test_exact_blocks_have_no_tail() {
+  checkRoundTrip(2 * RingtoneCodec::ADPCM_BLOCK_SAMPLES, 7);
+}
+
+void test_single_sample_tail() {
+  // 尾块只有块头采样，其余 504 个补零采样必须被 sampleCount 截掉。
+  checkRoundTrip(RingtoneCodec::ADPCM_BLOCK_SAMPLES + 1, 5);
+}
+
+void test_chunking_does_not_change_output() {
+  std::vector<uint8_t> bytes =
+      toBytes(makeTone(2 * RingtoneCodec::ADPCM_BLOCK_SAMPLES + 77));
+  uint32_t byteCount = 0;
+  uint32_t wholeCount = 0;
+  Blocks byByte = encode(bytes, 1, byteCount);
+  Blocks whole = encode(bytes, bytes.size(), wholeCount);
+  TEST_ASSERT_EQUAL_UINT32(wholeCount, byteCount);
+  TEST_ASSERT_EQUAL_UINT32(whole.size(), byByte.size());
+  for (size_t i = 0; i < whole.size(); ++i) {
+    TEST_ASSERT_EQUAL_MEMORY(whole[i].data(), byByte[i].data(),
+                             RingtoneCodec::ADPCM_BLOCK_SIZE);
+  }
+}
+
+void test_decode_truncates_to_max_samples() {
+  std::vector<int16_t> source = makeTone(RingtoneCodec::ADPCM_BLOCK_SAMPLES);
+  uint32_t sampleCount = 0;
+  Blocks blocks = encode(toBytes(source), 64, sampleCount);
+  TEST_ASSERT_EQUAL_UINT32(1, blocks.size());
+  int16_t out[RingtoneCodec::ADPCM_BLOCK_SAMPLES];
+  // 奇数和偶数上限分别停在低半字节和高半字节之后。
+  TEST_ASSERT_EQUAL_UINT32(
+      10, RingtoneCodec::decodeAdpcmBlock(blocks[0].data(), blocks[0].size(),
+                                          out, 10));
+  TEST_ASSERT_EQUAL_UINT32(
+      11, RingtoneCodec::decodeAdpcmBlock(blocks[0].data(), blocks[0].size(),
+                                          out, 11));
+  TEST_ASSERT_EQUAL_UINT32(
+      0, RingtoneCodec::decodeAdpcmBlock(blocks[0].data(), blocks[0].size(),
+                                         out, 0));
+  TEST_ASSERT_EQUAL_UINT32(
+      0, RingtoneCodec::decodeAdpcmBlock(blocks[0].data(), 3, out, 10));
+}
+
+void test_header_round_trip() {
+  RingtoneCodec::Header header = {RingtoneCodec::FORMAT_IMA_ADPCM, 1,
+                                  SAMPLE_RATE, 123456};
+  uint8_t raw[RingtoneCodec::HEADER_SIZE];
+  RingtoneCodec::writeHeader(header, raw);
+  RingtoneCodec::Header parsed = {};
+  TEST_ASSERT_TRUE(RingtoneCodec::parseHeader(raw, sizeof(raw), parsed));
+  TEST_ASSERT_EQUAL_UINT16(header.format, parsed.format);
+  TEST_ASSERT_EQUAL_UINT32(header.sampleRate, parsed.sampleRate);
+  TEST_ASSERT_EQUAL_UINT32(header.sampleCount, parsed.sampleCount);
+  TEST_ASSERT_FALSE(RingtoneCodec::parseHeader(raw, sizeof(raw) - 1, parsed));
+
+  header.channels = 2;
+  RingtoneCodec::writeHeader(header, raw);
+  TEST_ASSERT_FALSE(RingtoneCodec::parseHeader(raw, sizeof(raw), parsed));
+  header.channels = 1;
+  header.sampleRate = 96000;
+  RingtoneCodec::writeHeader(header, raw);
+  TEST_ASSERT_FALSE(RingtoneCodec::parseHeader(raw, sizeof(raw), parsed));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_block_geometry);
+  RUN_TEST(test_round_trip_split_byte_chunks);
+  RUN_TEST(test_exact_blocks_have_no_tail);
+  RUN_TEST(test_single_sample_tail);
+  RUN_TEST(test_chunking_does_not_change_output);
+  RUN_TEST(test_decode_truncates_to_max_samples);
+  RUN_TEST(test_header_round_trip);
+  return UNITY_END();
+}
@@ -0,0 +1,391 @@
+#include "managers/WeatherParser.h"
+#include "managers/WeatherResponse.h"
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+// 用主机上的回放传输层驱动 requestWeatherApi 的接收与解析路径，核对
+// test/fixtures/weather 下录制的和风天气响应，并按设备上 [HTTP][bench]
+// 的格式报告单个请求与整批请求的耗时（不含设备上请求间的固定间隔）。
+// 浸泡测试反复走接收、解析和填充路径，统计堆分配确认刷新不会让堆增长。
+#ifndef WEATHER_FIXTURE_DIR
+#define WEATHER_FIXTURE_DIR "test/fixtures/weather/"
+#endif
+
+namespace {
+constexpr size_t NETWORK_CHUNK = 256; // 与 ArduinoHttpTransport 的读块一致
+constexpr uint32_t BATCH_RUNS = 50;
+constexpr uint32_t SOAK_RUNS = 500;
+
+struct Endpoint {
+  const char *name;
+  const char *url;
+};
+
+// 与 WeatherManager::updateWeatherBatch 的请求顺序一致。
+const Endpoint WEATHER_BATCH[] = {
+    {"current weather", "https://ne4ewr7vn6.re.qweatherapi.com/v7/weather/"
+                        "now?location=101280112&lang=zh&unit=m"},
+    {"forecast weather", "https://ne4ewr7vn6.re.qweatherapi.com/v7/weather/"
+                         "3d?location=101280112&lang=zh&unit=m"},
+    {"hourly weather", "https://ne4ewr7vn6.re.qweatherapi.com/v7/weather/"
+                       "24h?location=101280112&lang=zh&unit=m"},
+    {"daily weather", "https://ne4ewr7vn6.re.qweatherapi.com/v7/weather/"
+                      "7d?location=101280112&lang=zh&unit=m"},
+    {"weather warning", "https://ne4ewr7vn6.re.qweatherapi.com/v7/warning/"
+                        "now?location=101280112&lang=zh&unit=m"},
+};
+constexpr size_t WEATHER_BATCH_COUNT =
+    sizeof(WEATHER_BATCH) / sizeof(WEATHER_BATCH[0]);
+
+// 主机回放传输层：文件格式与设备录制相同（首行 "<status> <gzip 0|1>\n"，
+// 其后为原始响应体），设备 SPIFFS 上录到的文件改名后即可放进 fixtures。
+// 文件名取 URL 中 /v7/ 之后的两段路径，如 .../v7/weather/now?... 对应
+// weather_now.http。不模拟网络延迟，测到的只有解析路径本身的耗时。
+class FixtureHttpTransport : public HttpTransport {
+public:
+  explicit FixtureHttpTransport(size_t chunkSize) : chunkSize(chunkSize) {}
+  bool isAvailable() const override { return true; }
+  bool get(const HttpRequest &request, HttpResponseInfo &info,
+           const HttpChunkCallback &onChunk) override {
+    char path[128];
+    FILE *file =
+        fixturePath(request.url, path, sizeof(path)) ? fopen(path, "rb")
+                                                     : nullptr;
+    if (file == nullptr) {
+      info.statusCode = -1;
+      return false;
+    }
+    char statusLine[32];
+    int gzip = 0;
+    if (fgets(statusLine, sizeof(statusLine), file) == nullptr ||
+        sscanf(statusLine, "%d %d", &info.statusCode, &gzip) < 1) {
+      fclose(file);
+      info.statusCode = -1;
+      return false;
+    }
+    info.gzip = gzip != 0;
+    long bodyStart = ftell(file);
+    fseek(file, 0, SEEK_END);
+    info.contentLength = static_cast<int>(ftell(file) - bodyStart);
+    fseek(file, bodyStart, SEEK_SET);
+    if (info.statusCode != 200) {
+      fclose(file);
+      return false;
+    }
+
+    uint8_t buffer[4096];
+    size_t length = chunkSize > sizeof(buffer) ? sizeof(buffer) : chunkSize;
+    size_t total = 0;
+    size_t readLen;
+    while ((readLen = fread(buffer, 1, length, file)) > 0) {
+      if (!onChunk(buffer, readLen)) {
+        fclose(file);
+        return false;
+      }
+      total += readLen;
+    }
+    fclose(file);
+    return total > 0;
+  }
+
+private:
+  size_t chunkSize;
+
+  // 传输层本身不分配堆内存，浸泡测试统计到的分配只来自被测路径。
+  static bool fixturePath(const char *url, char *path, size_t size) {
+    const char *start = strstr(url, "/v7/");
+    if (start == nullptr) {
+      return false;
+    }
+    start += 4;
+    int length = static_cast<int>(strcspn(start, "?"));
+    int written = snprintf(path, size, "%s%.*s.http", WEATHER_FIXTURE_DIR,
+                           length, start);
+    if (written < 0 || static_cast<size_t>(written) >= size) {
+      return false;
+    }
+    char *slash = strchr(path + strlen(WEATHER_FIXTURE_DIR), '/');
+    if (slash != nullptr) {
+      *slash = '_';
+    }
+    return true;
+  }
+};
+
+// 只发出一串超过响应缓冲区容量的数据块。
+class OversizedHttpTransport : public HttpTransport {
+public:
+  bool isAvailable() const override { return true; }
+  bool get(const HttpRequest &, HttpResponseInfo &info,
+           const HttpChunkCallback &onChunk) override {
+    info.statusCode = 200;
+    uint8_t buffer[NETWORK_CHUNK];
+    memset(buffer, ' ', sizeof(buffer));
+    for (size_t sent = 0; sent <= WeatherResponse::BODY_CAPACITY;
+         sent += sizeof(buffer)) {
+      if (!onChunk(buffer, sizeof(buffer))) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+// 统计 JsonDocument 的内存池分配，live 为当前未释放的块数。
+class CountingAllocator : public ArduinoJson::Allocator {
+public:
+  size_t allocations = 0;
+  long live = 0;
+
+  void *allocate(size_t size) override {
+    ++allocations;
+    ++live;
+    return malloc(size);
+  }
+  void deallocate(void *ptr) override {
+    --live;
+    free(ptr);
+  }
+  void *reallocate(void *ptr, size_t newSize) override {
+    ++allocations;
+    return realloc(ptr, newSize);
+  }
+};
+
+// 与 WeatherManager 各 fetch* 的填充函数一一对应。
+void (*const WEATHER_FILL[])(JsonDocument &, WeatherData &) = {
+    WeatherParser::fillNow, WeatherParser::fillForecast,
+    WeatherParser::fillHourly, WeatherParser::fillDaily,
+    WeatherParser::fillWarning,
+};
+
+HttpRequest makeRequest(const Endpoint &endpoint) {
+  static const HttpHeader headers[] = {{"X-QW-Api-Key", "test-token"},
+                                       {"Accept-Encoding", "identity"}};
+  return {endpoint.url, endpoint.name, headers, 2, 0};
+}
+
+// 主机上没有 ArduinoUZlib；录制的响应都是 identity 编码。
+WeatherResponse::Result fetch(HttpTransport &transport,
+                              const Endpoint &endpoint, JsonDocument &doc,
+                              WeatherResponse &response) {
+  WeatherResponse::Result result =
+      response.receive(transport, makeRequest(endpoint));
+  return result == WeatherResponse::RESULT_OK ? response.parse(doc) : result;
+}
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedUs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                               start)
+      .count();
+}
+
+size_t newCount = 0;
+} // namespace
+
+// 统计 operator new 次数，被测路径里的 std::vector/std::string/
+// std::function 等隐式分配都会计入。
+void *operator new(size_t size) {
+  ++newCount;
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+void setUp() {}
+void tearDown() {}
+
+void test_current_weather() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  JsonDocument doc;
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_OK,
+                        fetch(transport, WEATHER_BATCH[0], doc, response));
+  TEST_ASSERT_EQUAL_INT(200, response.getInfo().statusCode);
+  TEST_ASSERT_EQUAL_UINT32(response.getInfo().contentLength,
+                           response.getBodyLength());
+  TEST_ASSERT_EQUAL_STRING("200", doc["code"].as<const char *>());
+  TEST_ASSERT_EQUAL_INT(31, doc["now"]["temp"].as<int>());
+  TEST_ASSERT_EQUAL_INT(101, doc["now"]["icon"].as<int>());
+  TEST_ASSERT_EQUAL_STRING("多云", doc["now"]["text"].as<const char *>());
+}
+
+void test_forecast_endpoints() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  const size_t expectedItems[] = {0, 3, 24, 7, 1};
+  const char *arrays[] = {nullptr, "daily", "hourly", "daily", "alerts"};
+  for (size_t i = 1; i < WEATHER_BATCH_COUNT; ++i) {
+    JsonDocument doc;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(
+        WeatherResponse::RESULT_OK,
+        fetch(transport, WEATHER_BATCH[i], doc, response),
+        WEATHER_BATCH[i].name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(expectedItems[i],
+                                     doc[arrays[i]].size(),
+                                     WEATHER_BATCH[i].name);
+  }
+}
+
+void test_chunk_size_does_not_change_result() {
+  FixtureHttpTransport byteTransport(1);
+  FixtureHttpTransport bulkTransport(4096);
+  static WeatherResponse response(nullptr);
+  JsonDocument byByte;
+  JsonDocument bulk;
+  const Endpoint &hourly = WEATHER_BATCH[2];
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_OK,
+                        fetch(byteTransport, hourly, byByte, response));
+  size_t byteLength = response.getBodyLength();
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_OK,
+                        fetch(bulkTransport, hourly, bulk, response));
+  TEST_ASSERT_EQUAL_UINT32(byteLength, response.getBodyLength());
+  TEST_ASSERT_EQUAL_STRING(bulk["hourly"][23]["fxTime"].as<const char *>(),
+                           byByte["hourly"][23]["fxTime"].as<const char *>());
+}
+
+void test_http_error_is_not_parsed() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  JsonDocument doc;
+  const Endpoint unauthorized = {
+      "monthly weather", "https://ne4ewr7vn6.re.qweatherapi.com/v7/weather/"
+                         "30d?location=101280112"};
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_TRANSPORT_FAILED,
+                        fetch(transport, unauthorized, doc, response));
+  TEST_ASSERT_EQUAL_INT(401, response.getInfo().statusCode);
+  TEST_ASSERT_TRUE(doc.isNull());
+
+  const Endpoint missing = {
+      "air quality",
+      "https://ne4ewr7vn6.re.qweatherapi.com/v7/air/now?location=101280112"};
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_TRANSPORT_FAILED,
+                        fetch(transport, missing, doc, response));
+  TEST_ASSERT_EQUAL_INT(-1, response.getInfo().statusCode);
+}
+
+void test_batch_latency() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  uint64_t transferUs[WEATHER_BATCH_COUNT] = {};
+  uint64_t parseUs[WEATHER_BATCH_COUNT] = {};
+  size_t bytes[WEATHER_BATCH_COUNT] = {};
+  uint64_t batchUs = 0;
+  for (uint32_t run = 0; run < BATCH_RUNS; ++run) {
+    Clock::time_point batchStart = Clock::now();
+    for (size_t i = 0; i < WEATHER_BATCH_COUNT; ++i) {
+      Clock::time_point start = Clock::now();
+      TEST_ASSERT_EQUAL_INT_MESSAGE(
+          WeatherResponse::RESULT_OK,
+          response.receive(transport, makeRequest(WEATHER_BATCH[i])),
+          WEATHER_BATCH[i].name);
+      transferUs[i] += elapsedUs(start);
+      start = Clock::now();
+      JsonDocument doc;
+      TEST_ASSERT_EQUAL_INT_MESSAGE(WeatherResponse::RESULT_OK,
+                                    response.parse(doc),
+                                    WEATHER_BATCH[i].name);
+      parseUs[i] += elapsedUs(start);
+      bytes[i] = response.getBodyLength();
+    }
+    batchUs += elapsedUs(batchStart);
+  }
+  for (size_t i = 0; i < WEATHER_BATCH_COUNT; ++i) {
+    printf("[HTTP][bench] %s bytes=%u transfer=%lluus parse=%lluus\n",
+           WEATHER_BATCH[i].name, static_cast<unsigned>(bytes[i]),
+           static_cast<unsigned long long>(transferUs[i] / BATCH_RUNS),
+           static_cast<unsigned long long>(parseUs[i] / BATCH_RUNS));
+  }
+  printf("[HTTP][bench] weather batch total=%lluus runs=%u ok\n",
+         static_cast<unsigned long long>(batchUs / BATCH_RUNS),
+         static_cast<unsigned>(BATCH_RUNS));
+}
+
+void test_oversized_body_is_rejected() {
+  OversizedHttpTransport transport;
+  static WeatherResponse response(nullptr);
+  JsonDocument doc;
+  TEST_ASSERT_EQUAL_INT(
+      WeatherResponse::RESULT_TOO_LARGE,
+      response.receive(transport, makeRequest(WEATHER_BATCH[0])));
+  TEST_ASSERT_EQUAL_UINT32(0, response.getBodyLength());
+  TEST_ASSERT_EQUAL_INT(WeatherResponse::RESULT_EMPTY, response.parse(doc));
+}
+
+void test_fill_weather_data() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  static WeatherData data = {};
+  for (size_t i = 0; i < WEATHER_BATCH_COUNT; ++i) {
+    JsonDocument doc;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(
+        WeatherResponse::RESULT_OK,
+        fetch(transport, WEATHER_BATCH[i], doc, response),
+        WEATHER_BATCH[i].name);
+    WEATHER_FILL[i](doc, data);
+  }
+  TEST_ASSERT_EQUAL_INT(31, data.temp);
+  TEST_ASSERT_EQUAL_STRING("多云", data.weather);
+  TEST_ASSERT_EQUAL_UINT8(WEATHER_HOURLY_CAPACITY, data.hourly_count);
+  TEST_ASSERT_EQUAL_UINT8(WEATHER_DAILY_CAPACITY, data.daily_count);
+  TEST_ASSERT_EQUAL_INT(5, strlen(data.hourly[0].time));
+  TEST_ASSERT_TRUE(data.warning_title[0] != '\0');
+}
+
+void test_soak_no_heap_growth() {
+  FixtureHttpTransport transport(NETWORK_CHUNK);
+  static WeatherResponse response(nullptr);
+  static WeatherData data = {};
+  CountingAllocator allocator;
+  size_t firstBatchAllocations = 0;
+  size_t newBefore = newCount;
+  for (uint32_t run = 0; run < SOAK_RUNS; ++run) {
+    size_t batchStart = allocator.allocations;
+    for (size_t i = 0; i < WEATHER_BATCH_COUNT; ++i) {
+      // 与设备一致：每个请求一份 JsonDocument，解析填充后立即释放。
+      JsonDocument doc(&allocator);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(
+          WeatherResponse::RESULT_OK,
+          fetch(transport, WEATHER_BATCH[i], doc, response),
+          WEATHER_BATCH[i].name);
+      WEATHER_FILL[i](doc, data);
+    }
+    // 文档析构后内存池必须全部归还。
+    TEST_ASSERT_EQUAL_INT(0, allocator.live);
+    size_t batchAllocations = allocator.allocations - batchStart;
+    if (run == 0) {
+      firstBatchAllocations = batchAllocations;
+    }
+    // 同样的输入每批的池分配次数不变，说明没有随刷新次数累积的状态。
+    TEST_ASSERT_EQUAL_UINT32(firstBatchAllocations, batchAllocations);
+  }
+  // 接收、解压缓冲和填充路径本身不经过 operator new。
+  TEST_ASSERT_EQUAL_UINT32(0, newCount - newBefore);
+  printf("[HTTP][soak] runs=%u pool_allocs_per_batch=%u\n",
+         static_cast<unsigned>(SOAK_RUNS),
+         static_cast<unsigned>(firstBatchAllocations));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_current_weather);
+  RUN_TEST(test_forecast_endpoints);
+  RUN_TEST(test_chunk_size_does_not_change_result);
+  RUN_TEST(test_http_error_is_not_parsed);
+  RUN_TEST(test_oversized_body_is_rejected);
+  RUN_TEST(test_fill_weather_data);
+  RUN_TEST(test_soak_no_heap_growth);
+  RUN_TEST(test_batch_latency);
+  return UNITY_END();
+}